@@ -1,11 +1,9 @@
 //go:build !windows
-
-//go:generate sh -c "cd ../.. && mkdir -p build && cd build && cmake -DGO_BUILTIN_EXPORT_PKG_PATH=\"../bindings/builtin\" .. && make reindexer -j8"
+//go:generate sh -c "cd ../.. && mkdir -p build && cd build && cmake -DGO_BUILTIN_EXPORT_PKG_PATH=\"../bindings/builtin\" .. && make reindexer -j1"
 
 package builtin
 
-// #cgo pkg-config: libreindexer
-// #cgo CXXFLAGS: -std=c++20 -g -O2 -Wall -Wpedantic -Wextra
-// #cgo CFLAGS: -std=c99 -g -O2 -Wall -Wpedantic -Wno-unused-variable
-// #cgo LDFLAGS:  -rdynamic -g
+// #cgo CXXFLAGS: -std=c++20 -g -O2 -Wall -Wpedantic -Wextra -I../../cpp_src  -fopenmp
+// #cgo CFLAGS: -std=c99 -g -O2 -Wall -Wpedantic -Wno-unused-variable -I../../cpp_src  -fopenmp
+// #cgo LDFLAGS: -L${SRCDIR}/../../build/cpp_src/  -fopenmp -lreindexer -lleveldb -lsnappy -L/usr/lib/gcc/x86_64-linux-gnu/12 -lgomp -L/usr/lib/x86_64-linux-gnu -lpthread -lfriso_dict_resources -lrt -ldl -rdynamic -g
 import "C"
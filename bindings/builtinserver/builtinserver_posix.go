@@ -1,11 +1,9 @@
 //go:build !windows
-
-//go:generate sh -c "cd ../.. && mkdir -p build && cd build && cmake -DLINK_RESOURCES=On -DGO_BUILTIN_SERVER_EXPORT_PKG_PATH=\"../../bindings/builtinserver\" .. && make reindexer_server_library reindexer -j8"
+//go:generate sh -c "cd ../.. && mkdir -p build && cd build && cmake -DGO_BUILTIN_SERVER_EXPORT_PKG_PATH=\"../../bindings/builtinserver\" .. && make reindexer_server_library reindexer -j1"
 
 package builtinserver
 
-// #cgo pkg-config: libreindexer_server
-// #cgo CXXFLAGS: -std=c++20 -g -O2 -Wall -Wpedantic -Wextra
-// #cgo CFLAGS: -std=c99 -g -O2 -Wall -Wpedantic -Wno-unused-variable
-// #cgo LDFLAGS:  -rdynamic -g
+// #cgo CXXFLAGS: -std=c++20 -g -O2 -Wall -Wpedantic -Wextra -I../../cpp_src  -fopenmp
+// #cgo CFLAGS: -std=c99 -g -O2 -Wall -Wpedantic -Wno-unused-variable -I../../cpp_src  -fopenmp
+// #cgo LDFLAGS: -L${SRCDIR}/../../build/cpp_src/ -L${SRCDIR}/../../build/cpp_src/server/ -lreindexer_server_library  -fopenmp -lreindexer -lleveldb -lsnappy -L/usr/lib/gcc/x86_64-linux-gnu/12 -lgomp -L/usr/lib/x86_64-linux-gnu -lpthread -lfriso_dict_resources -lrt -ldl -lreindexer_server_resources -lm -rdynamic -g
 import "C"
@@ -15,11 +15,17 @@ type StorageConf struct {
 const ServerThreadingDedicated = "dedicated"
 const ServerThreadingShared = "shared"
 
+// io_uring backend replaces epoll only: sockets are still read and written by recv/send, so it is not expected to be faster
+const ServerIOBackendNative = "native"
+const ServerIOBackendUring = "io_uring"
+
 type NetConf struct {
 	HTTPAddr            string `yaml:"httpaddr"`
-	HTTPThreading       string `yaml:"http_threading"` // "dedicated" or "shared"
+	HTTPThreading       string `yaml:"http_threading"`            // "dedicated" or "shared"
+	HTTPIOBackend       string `yaml:"http_io_backend,omitempty"` // "native" or "io_uring"
 	RPCAddr             string `yaml:"rpcaddr"`
-	RPCThreading        string `yaml:"rpc_threading"` // "dedicated" or "shared"
+	RPCThreading        string `yaml:"rpc_threading"`            // "dedicated" or "shared"
+	RPCIOBackend        string `yaml:"rpc_io_backend,omitempty"` // "native" or "io_uring"
 	UnixRPCAddr         string `yaml:"urpcaddr"`
 	UnixRPCThreading    string `yaml:"urpc_threading"` // "dedicated" or "shared"
 	WebRoot             string `yaml:"webroot"`
@@ -24,14 +24,17 @@ const (
 	INFO    = 3
 	TRACE   = 4
 
-	AggSum         = 0
-	AggAvg         = 1
-	AggFacet       = 2
-	AggMin         = 3
-	AggMax         = 4
-	AggDistinct    = 5
-	AggCount       = 6
-	AggCountCached = 7
+	AggSum                 = 0
+	AggAvg                 = 1
+	AggFacet               = 2
+	AggMin                 = 3
+	AggMax                 = 4
+	AggDistinct            = 5
+	AggCount               = 6
+	AggCountCached         = 7
+	AggApproxCountDistinct = 8
+	AggPercentile          = 9
+	AggTopKApprox          = 10
 
 	CollateNone    = 0
 	CollateASCII   = 1
@@ -99,6 +102,8 @@ const (
 	QueryFunction                  = 34
 	QueryFunctionSubQueryCondition = 35
 	QueryExpressions               = 36
+	QueryParallelism               = 37
+	QueryAggregationPercentile     = 38
 
 	ExpressionTypeField      = 0
 	ExpressionTypeValues     = 1
@@ -34,6 +34,17 @@ type EmbedderConnectionPoolConfig struct {
 	WriteTimeout int `json:"write_timeout_ms,omitempty"`
 }
 
+type EmbedderBatchingConfig struct {
+	// Max number of documents, coalesced from the concurrent upserts into the single request to the embedding service. Optional
+	// Values range: [1,1024]
+	// Default: 1 (batching is disabled)
+	MaxItems int `json:"max_items,omitempty"`
+	// Max time to wait for the other documents of the batch (milliseconds). Optional
+	// Values range: [0,1000]
+	// Default: 0 (only already pending documents are coalesced)
+	MaxDelay int `json:"max_delay_ms,omitempty"`
+}
+
 func DefaultEmbedderConnectionPoolConfig() *EmbedderConnectionPoolConfig {
 	return &EmbedderConnectionPoolConfig{
 		Connections:    10,
@@ -59,6 +70,8 @@ type EmbedderConfig struct {
 	EmbeddingStrategy string `json:"embedding_strategy,omitempty"`
 	// Connection pool configuration
 	ConnectionPoolConfig *EmbedderConnectionPoolConfig `json:"pool,omitempty"`
+	// Batching configuration of the concurrent requests. Optional, for UpsertEmbedder only
+	BatchingConfig *EmbedderBatchingConfig `json:"batching,omitempty"`
 }
 
 func DefaultUpsertEmbedderConfig(url string, fields []string) *EmbedderConfig {
@@ -92,6 +105,10 @@ type QuantizationConfig struct {
 	Quantile   float32 `json:"quantile,omitempty"`
 	SampleSize int64   `json:"sample_size,omitempty"`
 	Threshold  int64   `json:"quantization_threshold,omitempty"`
+	// Product quantization only
+	PQSubquantizers int64 `json:"pq_subquantizers,omitempty"`
+	PQBits          int64 `json:"pq_bits,omitempty"`
+	RerankFactor    int64 `json:"rerank_factor,omitempty"`
 }
 
 type FloatVectorIndexOpts struct {
@@ -169,8 +186,9 @@ type ConnectOptions struct {
 }
 
 const (
-	StorageTypeLevelDB = 0
-	StorageTypeRocksDB = 1
+	StorageTypeLevelDB       = 0
+	StorageTypeRocksDB       = 1
+	StorageTypeRocksDBShared = 2
 )
 
 func DefaultConnectOptions() *ConnectOptions {
@@ -198,7 +216,7 @@ func (so *ConnectOptions) AllowNamespaceErrors(value bool) *ConnectOptions {
 
 // Choose storage type
 func (so *ConnectOptions) StorageType(value uint16) *ConnectOptions {
-	if value != StorageTypeLevelDB && value != StorageTypeRocksDB {
+	if value != StorageTypeLevelDB && value != StorageTypeRocksDB && value != StorageTypeRocksDBShared {
 		so.Storage = StorageTypeLevelDB
 	} else {
 		so.Storage = value
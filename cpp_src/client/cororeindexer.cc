@@ -148,6 +148,10 @@ Error CoroReindexer::GetSnapshot(std::string_view nsName, const SnapshotOpts& op
 Error CoroReindexer::ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch) noexcept {
 	RETURN_RESULT_NOEXCEPT(impl_->ApplySnapshotChunk(nsName, ch, ctx_));
 }
+Error CoroReindexer::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+										  std::vector<uint64_t>& hashes) noexcept {
+	RETURN_RESULT_NOEXCEPT(impl_->GetDataHashTreeNodes(nsName, leavesCount, nodes, hashes, ctx_));
+}
 Error CoroReindexer::SetTagsMatcher(std::string_view nsName, TagsMatcher&& tm) noexcept {
 	RETURN_RESULT_NOEXCEPT(impl_->SetTagsMatcher(nsName, std::move(tm), ctx_));
 }
@@ -164,6 +168,12 @@ Error CoroReindexer::RemoveConnectionStateObserver(int64_t id) noexcept {
 	RETURN_RESULT_NOEXCEPT(impl_->RemoveConnectionStateObserver(id));
 }
 
+Error CoroReindexer::SetCompressionDict(std::string_view nsName, std::shared_ptr<const net::cproto::ZstdDictionary> dict) noexcept {
+	RETURN_RESULT_NOEXCEPT(impl_->SetCompressionDict(nsName, std::move(dict)));
+}
+
+net::cproto::CompressionStats CoroReindexer::GetCompressionStats() const noexcept { return impl_->GetCompressionStats(); }
+
 Error CoroReindexer::ShardingControlRequest(const sharding::ShardingControlRequestData& request,
 											sharding::ShardingControlResponseData& response) noexcept {
 	RETURN_RESULT_NOEXCEPT(impl_->ShardingControlRequest(request, response, ctx_));
@@ -233,6 +233,13 @@ public:
 	/// @param nsName - Name of namespace
 	/// @param ch - Snapshot chunk to apply
 	Error ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch) noexcept;
+	/// Get hashes of the namespace's data hash tree nodes. This request is for replicator only.
+	/// @param nsName - Name of namespace
+	/// @param leavesCount - Leaves count of the tree
+	/// @param nodes - Tree nodes in the heap layout (root is 1)
+	/// @param hashes - Result hashes of the nodes
+	Error GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+							   std::vector<uint64_t>& hashes) noexcept;
 	/// Set tags matcher for replica namespace. Current tagsmatcher and new tagsmatcher have to have the same state tokens.
 	/// This request is for replicator only.
 	/// @param nsName - Name of namespace
@@ -247,6 +254,14 @@ public:
 	/// @param id - observer's ID
 	Error RemoveConnectionStateObserver(int64_t id) noexcept;
 
+	/// Set zstd dictionary for the compression of the namespace's items. The dictionary is shipped to the server once per connection and
+	/// is used only if zstd compression was negotiated with the server
+	/// @param nsName - Name of namespace
+	/// @param dict - dictionary (nullptr removes the namespace's dictionary)
+	Error SetCompressionDict(std::string_view nsName, std::shared_ptr<const net::cproto::ZstdDictionary> dict) noexcept;
+	/// Get compression statistics of the client's connection
+	net::cproto::CompressionStats GetCompressionStats() const noexcept;
+
 	/// Execute sharding control request during the sharding config change
 	/// @param request - control params
 	/// @param response - control response
@@ -149,11 +149,10 @@ Error CoroTransaction::addTxItemRaw(std::string_view cjson, ItemModifyMode mode,
 		return Error(errParams, "Raw CJSON interface does not support CJSON with bundled tags matcher");
 	}
 
-	return i_.rpcClient_->conn_
-		.Call({net::cproto::kCmdAddTxItem, i_.requestTimeout_, i_.execTimeout_, lsn, -1, ShardingKeyType::NotSetShard, nullptr, false,
-			   i_.sessionTs_},
-			  FormatCJson, cjson, mode, std::string_view(), int(i_.localTm_->stateToken()), i_.txId_)
-		.Status();
+	net::cproto::CommandParams cmd{net::cproto::kCmdAddTxItem, i_.requestTimeout_, i_.execTimeout_, lsn, -1, ShardingKeyType::NotSetShard,
+								   nullptr, false, i_.sessionTs_};
+	cmd.compressionDictId = i_.rpcClient_->compressionDictId(i_.ns_->name, InternalRdxContext{}.WithTimeout(i_.execTimeout_));
+	return i_.rpcClient_->conn_.Call(cmd, FormatCJson, cjson, mode, std::string_view(), int(i_.localTm_->stateToken()), i_.txId_).Status();
 }
 
 Error CoroTransaction::mergeTmFromItem(Item& item, Item& rItem) {
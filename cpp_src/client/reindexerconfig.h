@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <string>
+#include "net/cproto/zstdcodec.h"
 
 namespace reindexer {
 namespace client {
@@ -29,6 +30,9 @@ struct [[nodiscard]] ReindexerConfig {
 	std::string AppName;
 	unsigned int SyncRxCoroCount;
 	std::string ReplToken;
+	// Codec for the traffic compression (if compression is enabled). Zstd falls back to snappy, if server does not support it
+	net::cproto::CompressionCodec Codec = net::cproto::CompressionCodec::Snappy;
+	int ZstdCompressionLevel = net::cproto::kDefaultZstdCompressionLevel;
 };
 
 }  // namespace client
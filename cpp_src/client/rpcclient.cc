@@ -56,6 +56,8 @@ Error RPCClient::Connect(const DSN& dsn, ev::dynamic_loop& loop, const client::C
 	connectData.opts = cproto::CoroClientConnection::Options(
 		config_.NetTimeout, config_.NetTimeout, opts.IsCreateDBIfMissing(), opts.HasExpectedClusterID(), opts.ExpectedClusterID(),
 		config_.ReconnectAttempts, config_.EnableCompression, config_.RequestDedicatedThread, config_.AppName, config_.ReplToken);
+	connectData.opts.compressionCodec = config_.Codec;
+	connectData.opts.zstdCompressionLevel = config_.ZstdCompressionLevel;
 	conn_.Start(loop, std::move(connectData));
 	loop_ = &loop;
 	return errOK;
@@ -286,8 +288,9 @@ Error RPCClient::modifyItemRaw(std::string_view nsName, std::string_view cjson,
 	}
 
 	const auto stateToken = getNamespace(nsName)->GetStateToken();
-	const auto ret = conn_.Call(mkCommand(cproto::kCmdModifyItem, netTimeout, &ctx), nsName, int(DataFormat::FormatCJson), cjson, mode,
-								std::string_view(), stateToken, 0);
+	auto cmd = mkCommand(cproto::kCmdModifyItem, netTimeout, &ctx);
+	cmd.compressionDictId = compressionDictId(nsName, ctx);
+	const auto ret = conn_.Call(cmd, nsName, int(DataFormat::FormatCJson), cjson, mode, std::string_view(), stateToken, 0);
 
 	if (!ret.Status().ok()) {
 		return ret.Status();
@@ -618,6 +621,44 @@ Error RPCClient::Version(std::string& version, const InternalRdxContext& ctx) {
 
 std::shared_ptr<Namespace> RPCClient::getNamespace(std::string_view nsName) { return namespaces_->Get(nsName); }
 
+Error RPCClient::SetCompressionDict(std::string_view nsName, std::shared_ptr<const cproto::ZstdDictionary> dict) {
+	if (dict) {
+		compressionDicts_[std::string(nsName)] = std::move(dict);
+	} else {
+		compressionDicts_.erase(nsName);
+	}
+	return {};
+}
+
+uint32_t RPCClient::compressionDictId(std::string_view nsName, const InternalRdxContext& ctx) {
+	if (compressionDicts_.empty() || !conn_.ZstdEnabled()) {
+		return 0;
+	}
+	const auto found = compressionDicts_.find(nsName);
+	if (found == compressionDicts_.end()) {
+		return 0;
+	}
+	const auto dict = found->second;
+	if (!conn_.HasCompressionDict(dict->ID())) {
+		// Dictionary has to be shipped to the server once per connection
+		const auto loginTs = conn_.LoginTs();
+		if (!loginTs.has_value()) {
+			return 0;
+		}
+		const auto status = conn_.Call(mkCommand(cproto::kCmdSetCompressionDict, *loginTs, &ctx), dict->Data()).Status();
+		if (!status.ok() || conn_.LoginTs() != loginTs) {
+			// The request will be compressed without dictionary
+			return 0;
+		}
+		try {
+			conn_.AddCompressionDict(dict);
+		} catch (const Error&) {
+			return 0;
+		}
+	}
+	return dict->ID();
+}
+
 cproto::CommandParams RPCClient::mkCommand(cproto::CmdCode cmd, const InternalRdxContext* ctx) const noexcept {
 	return mkCommand(cmd, config_.NetTimeout, ctx);
 }
@@ -749,6 +790,33 @@ Error RPCClient::ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk
 	return conn_.Call(mkCommand(cproto::kCmdApplySnapshotCh, &ctx), nsName, ser.Slice()).Status();
 }
 
+Error RPCClient::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+									  std::vector<uint64_t>& hashes, const InternalRdxContext& ctx) {
+	WrSerializer ser;
+	ser.PutVarUint(nodes.size());
+	for (auto node : nodes) {
+		ser.PutVarUint(node);
+	}
+	auto ret = conn_.Call(mkCommand(cproto::kCmdGetDataHashTree, &ctx), nsName, int64_t(leavesCount), ser.Slice());
+	if (ret.Status().ok()) {
+		try {
+			auto data = ret.GetArgs(1)[0].As<std::string>();
+			Serializer rser(data);
+			const auto count = rser.GetVarUInt();
+			if (count != nodes.size()) {
+				return Error(errParseBin, "Unexpected count of the data hash tree nodes: {} ({} were requested)", count, nodes.size());
+			}
+			hashes.resize(count);
+			for (auto& hash : hashes) {
+				hash = rser.GetUInt64();
+			}
+		} catch (Error& err) {
+			return err;
+		}
+	}
+	return ret.Status();
+}
+
 Error RPCClient::SetTagsMatcher(std::string_view nsName, TagsMatcher&& tm, const InternalRdxContext& ctx) {
 	WrSerializer ser;
 	tm.serialize(ser);
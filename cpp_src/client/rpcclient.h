@@ -159,6 +159,8 @@ public:
 	Error SetClusterOperationStatus(std::string_view nsName, const ClusterOperationStatus& status, const InternalRdxContext& ctx);
 	Error GetSnapshot(std::string_view nsName, const SnapshotOpts& opts, Snapshot& snapshot, const InternalRdxContext& ctx);
 	Error ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch, const InternalRdxContext& ctx);
+	Error GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+							   std::vector<uint64_t>& hashes, const InternalRdxContext& ctx);
 	Error SetTagsMatcher(std::string_view nsName, TagsMatcher&& tm, const InternalRdxContext& ctx);
 
 	Error SuggestLeader(const NodeData& suggestion, NodeData& response, const InternalRdxContext& ctx);
@@ -169,6 +171,11 @@ public:
 	int64_t AddConnectionStateObserver(ConnectionStateHandlerT callback);
 	Error RemoveConnectionStateObserver(int64_t id);
 
+	// Sets zstd dictionary for the compression of the namespace's items (the dictionary is used only if zstd was negotiated with the
+	// server). Nullptr removes the dictionary
+	Error SetCompressionDict(std::string_view nsName, std::shared_ptr<const cproto::ZstdDictionary> dict);
+	cproto::CompressionStats GetCompressionStats() const noexcept { return conn_.GetCompressionStats(); }
+
 	const cproto::CoroClientConnection* GetConnPtr() const noexcept { return &conn_; }
 
 	typedef CoroQueryResults QueryResultsT;
@@ -184,6 +191,8 @@ protected:
 						   const InternalRdxContext& ctx);
 	Error modifyItemRaw(std::string_view nsName, std::string_view cjson, int mode, milliseconds netTimeout, const InternalRdxContext& ctx);
 	std::shared_ptr<Namespace> getNamespace(std::string_view nsName);
+	// ID of the namespace's zstd dictionary (or 0). Ships the dictionary to the server, if it was not shipped to the current connection
+	uint32_t compressionDictId(std::string_view nsName, const InternalRdxContext& ctx);
 
 	void onConnectionState(const Error& err) noexcept {
 		const auto observers = observers_;
@@ -204,6 +213,8 @@ protected:
 	ev::dynamic_loop* loop_ = nullptr;
 	coroutine::mutex mtx_;
 	fast_hash_map<int64_t, ConnectionStateHandlerT> observers_;
+	fast_hash_map<std::string, std::shared_ptr<const cproto::ZstdDictionary>, nocase_hash_str, nocase_equal_str, nocase_less_str>
+		compressionDicts_;
 
 	friend class CoroTransaction;
 };
@@ -219,6 +219,7 @@ Error ClusterConfigData::FromYAML(const std::string& yaml) {
 		retrySyncIntervalMSec = root["retry_sync_interval_msec"].as<int>(retrySyncIntervalMSec);
 		enableCompression = root["enable_compression"].as<bool>(enableCompression);
 		batchingRoutinesCount = root["batching_routines_count"].as<int>(batchingRoutinesCount);
+		applyLanesCount = root["apply_lanes_count"].as<int>(applyLanesCount);
 		maxWALDepthOnForceSync = root["max_wal_depth_on_force_sync"].as<int>(maxWALDepthOnForceSync);
 		proxyConnCount = root["proxy_conn_count"].as<int>(proxyConnCount);
 		proxyConnConcurrency = root["proxy_conn_concurrency"].as<int>(proxyConnConcurrency);
@@ -282,7 +283,12 @@ Error AsyncReplConfigData::FromYAML(const std::string& yaml) {
 		forceSyncOnWrongDataHash = root["force_sync_on_wrong_data_hash"].as<bool>(forceSyncOnWrongDataHash);
 		retrySyncIntervalMSec = root["retry_sync_interval_msec"].as<int>(retrySyncIntervalMSec);
 		enableCompression = root["enable_compression"].as<bool>(enableCompression);
+		compressionCodec = net::cproto::CompressionCodecFromStr(
+			root["compression_codec"].as<std::string>(std::string(net::cproto::CompressionCodecToStr(compressionCodec))));
+		zstdCompressionLevel = root["zstd_compression_level"].as<int>(zstdCompressionLevel);
+		zstdDictSize = root["zstd_dict_size"].as<int>(zstdDictSize);
 		batchingRoutinesCount = root["batching_routines_count"].as<int>(batchingRoutinesCount);
+		applyLanesCount = root["apply_lanes_count"].as<int>(applyLanesCount);
 		maxWALDepthOnForceSync = root["max_wal_depth_on_force_sync"].as<int>(maxWALDepthOnForceSync);
 		onlineUpdatesDelayMSec = root["online_updates_delay_msec"].as<int>(onlineUpdatesDelayMSec);
 		logLevel = logLevelFromString(root["log_level"].as<std::string>("info"));
@@ -343,6 +349,15 @@ Error AsyncReplConfigData::FromJSON(const gason::JsonNode& root) {
 			}
 		}
 
+		if (std::string codecStr(net::cproto::CompressionCodecToStr(compressionCodec));
+			tryReadOptionalJsonValue(&errorString, root, "compression_codec"sv, codecStr).ok()) {
+			try {
+				compressionCodec = net::cproto::CompressionCodecFromStr(codecStr);
+			} catch (Error& err) {
+				ensureEndsWith(errorString, "\n") += err.what();
+			}
+		}
+
 		auto err = tryReadOptionalJsonValue(&errorString, root, "app_name"sv, appName);
 
 		err = tryReadOptionalJsonValue(&errorString, root, "sync_threads"sv, replThreadsCount);
@@ -353,7 +368,10 @@ Error AsyncReplConfigData::FromJSON(const gason::JsonNode& root) {
 		err = tryReadOptionalJsonValue(&errorString, root, "force_sync_on_wrong_data_hash"sv, forceSyncOnWrongDataHash);
 		err = tryReadOptionalJsonValue(&errorString, root, "retry_sync_interval_msec"sv, retrySyncIntervalMSec);
 		err = tryReadOptionalJsonValue(&errorString, root, "enable_compression"sv, enableCompression);
+		err = tryReadOptionalJsonValue(&errorString, root, "zstd_compression_level"sv, zstdCompressionLevel);
+		err = tryReadOptionalJsonValue(&errorString, root, "zstd_dict_size"sv, zstdDictSize);
 		err = tryReadOptionalJsonValue(&errorString, root, "batching_routines_count"sv, batchingRoutinesCount);
+		err = tryReadOptionalJsonValue(&errorString, root, "apply_lanes_count"sv, applyLanesCount);
 		err = tryReadOptionalJsonValue(&errorString, root, "max_wal_depth_on_force_sync"sv, maxWALDepthOnForceSync);
 		err = tryReadOptionalJsonValue(&errorString, root, "online_updates_delay_msec"sv, onlineUpdatesDelayMSec);
 		err = tryReadOptionalJsonValue(&errorString, root, "self_replication_token"sv, selfReplToken);
@@ -408,10 +426,14 @@ void AsyncReplConfigData::GetJSON(JsonBuilder& jb, MaskingDSN maskingDSN) const
 	jb.Put("sync_timeout_sec", syncTimeoutSec);
 	jb.Put("online_updates_timeout_sec", onlineUpdatesTimeoutSec);
 	jb.Put("enable_compression", enableCompression);
+	jb.Put("compression_codec", net::cproto::CompressionCodecToStr(compressionCodec));
+	jb.Put("zstd_compression_level", zstdCompressionLevel);
+	jb.Put("zstd_dict_size", zstdDictSize);
 	jb.Put("force_sync_on_logic_error", forceSyncOnLogicError);
 	jb.Put("force_sync_on_wrong_data_hash", forceSyncOnWrongDataHash);
 	jb.Put("retry_sync_interval_msec", retrySyncIntervalMSec);
 	jb.Put("batching_routines_count", batchingRoutinesCount);
+	jb.Put("apply_lanes_count", applyLanesCount);
 	jb.Put("max_wal_depth_on_force_sync", maxWALDepthOnForceSync);
 	jb.Put("online_updates_delay_msec", onlineUpdatesDelayMSec);
 	jb.Put("self_replication_token", selfReplToken);
@@ -479,6 +501,18 @@ void AsyncReplConfigData::GetYAML(WrSerializer& ser) const {
 			"# Resync timeout on network errors\n"
 			"retry_sync_interval_msec: " + std::to_string(retrySyncIntervalMSec) + "\n"
 			"\n"
+			"# Enable network traffic compression\n"
+			"enable_compression: " + (enableCompression ? "true" : "false") + "\n"
+			"\n"
+			"# Compression codec: snappy or zstd. Zstd is used only if the target node supports it (otherwise snappy is used)\n"
+			"compression_codec: " + std::string(net::cproto::CompressionCodecToStr(compressionCodec)) + "\n"
+			"\n"
+			"# Zstd compression level\n"
+			"zstd_compression_level: " + std::to_string(zstdCompressionLevel) + "\n"
+			"\n"
+			"# Size of the zstd dictionaries, trained on the replicated items of each namespace (bytes). 0 - disables dictionaries\n"
+			"zstd_dict_size: " + std::to_string(zstdDictSize) + "\n"
+			"\n"
 			"# Number of data replication threads\n"
 			"sync_threads: " + std::to_string(replThreadsCount) + "\n"
 			"\n"
@@ -489,6 +523,10 @@ void AsyncReplConfigData::GetYAML(WrSerializer& ser) const {
 			"# networks trip-around await time, but will require more RAM\n"
 			"batching_routines_count: " + std::to_string(batchingRoutinesCount) + "\n"
 			"\n"
+			"# Number of connections to each follower, used to apply online updates in parallel. Updates of the single namespace\n"
+			"# are always sent via the same connection, so the follower applies updates of the different namespaces concurrently\n"
+			"apply_lanes_count: " + std::to_string(applyLanesCount) + "\n"
+			"\n"
 			"# Maximum number of WAL-records, which may be gained from force-sync.\n"
 			"# Increasing this value may help to avoid force-syncs after leader's switch, however it also increases RAM consumption during syncs\n"
 			"max_wal_depth_on_force_sync: " + std::to_string(maxWALDepthOnForceSync) + "\n"
@@ -5,6 +5,7 @@
 #include <span>
 #include "core/keyvalue/variant.h"
 #include "core/namespace/namespacenamesets.h"
+#include "net/cproto/zstdcodec.h"
 #include "sharding/ranges.h"
 #include "tools/dsn.h"
 #include "tools/errors.h"
@@ -176,6 +177,7 @@ struct [[nodiscard]] ClusterConfigData {
 	int replThreadsCount = 4;
 	int parallelSyncsPerThreadCount = 2;
 	int batchingRoutinesCount = 100;
+	int applyLanesCount = 1;
 	bool enableCompression = true;
 	int maxWALDepthOnForceSync = 1000;
 	int leaderSyncThreads = 8;
@@ -281,7 +283,11 @@ struct [[nodiscard]] AsyncReplConfigData {
 	bool forceSyncOnWrongDataHash = false;	// TODO: Use this for test purposes
 	intrusive_ptr<NamespaceList> namespaces = make_intrusive<NamespaceList>();
 	bool enableCompression = true;
+	net::cproto::CompressionCodec compressionCodec = net::cproto::CompressionCodec::Snappy;
+	int zstdCompressionLevel = net::cproto::kDefaultZstdCompressionLevel;
+	int zstdDictSize = int(net::cproto::kDefaultZstdDictSize);	// 0 - disables zstd dictionaries
 	int batchingRoutinesCount = 100;
+	int applyLanesCount = 1;
 	int maxWALDepthOnForceSync = 1000;
 	std::vector<AsyncReplNodeConfig> nodes;
 	int onlineUpdatesDelayMSec = 100;
@@ -294,8 +300,10 @@ struct [[nodiscard]] AsyncReplConfigData {
 			   (forceSyncOnLogicError == rdata.forceSyncOnLogicError) && (forceSyncOnWrongDataHash == rdata.forceSyncOnWrongDataHash) &&
 			   (retrySyncIntervalMSec == rdata.retrySyncIntervalMSec) && (onlineUpdatesTimeoutSec == rdata.onlineUpdatesTimeoutSec) &&
 			   (namespaces == rdata.namespaces || (namespaces && rdata.namespaces && *namespaces == *rdata.namespaces)) &&
-			   (enableCompression == rdata.enableCompression) && (appName == rdata.appName) &&
-			   (batchingRoutinesCount == rdata.batchingRoutinesCount) && (maxWALDepthOnForceSync == rdata.maxWALDepthOnForceSync) &&
+			   (enableCompression == rdata.enableCompression) && (compressionCodec == rdata.compressionCodec) &&
+			   (zstdCompressionLevel == rdata.zstdCompressionLevel) && (zstdDictSize == rdata.zstdDictSize) && (appName == rdata.appName) &&
+			   (batchingRoutinesCount == rdata.batchingRoutinesCount) && (applyLanesCount == rdata.applyLanesCount) &&
+			   (maxWALDepthOnForceSync == rdata.maxWALDepthOnForceSync) &&
 			   (syncTimeoutSec == rdata.syncTimeoutSec) && (onlineUpdatesDelayMSec == rdata.onlineUpdatesDelayMSec) &&
 			   (logLevel == rdata.logLevel) && (nodes == rdata.nodes) && (selfReplToken == rdata.selfReplToken);
 	}
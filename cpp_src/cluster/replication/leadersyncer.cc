@@ -278,6 +278,7 @@ void LeaderSyncThread::syncNamespaceImpl(bool forced, const LeaderSyncQueue::Ent
 		if (terminate_) {
 			return;
 		}
+		timeCounter.AddChunk(ch.Chunk());
 		ns->ApplySnapshotChunk(ch.Chunk(), true, ctx.WithCancelCtx(deadlineCtx));
 	}
 }
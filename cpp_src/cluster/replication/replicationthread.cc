@@ -23,6 +23,8 @@ constexpr static auto kCoro32KStackSize = 32 * 1024;
 constexpr static auto kLocalCallsTimeout = std::chrono::seconds(300);
 // Some really large value (considered 'endless') instead of zero or negative timeouts in config
 constexpr static auto kLargeDefaultTimeoutSec = 1200;
+// Each of the apply lanes requires dedicated connection and dedicated thread on the follower's side
+constexpr static int kMaxApplyLanesCount = 32;
 
 using updates::ItemReplicationRecord;
 using updates::TagsMatcherReplicationRecord;
@@ -40,10 +42,14 @@ using updates::ResetShardingCfgRecord;
 ReplThreadConfig::ReplThreadConfig(const ReplicationConfigData& baseConfig, const AsyncReplConfigData& config) {
 	AppName = config.appName;
 	EnableCompression = config.enableCompression;
+	CompressionCodec = config.compressionCodec;
+	ZstdCompressionLevel = config.zstdCompressionLevel;
+	ZstdDictSize = config.zstdDictSize > 0 ? size_t(config.zstdDictSize) : 0;
 	UpdatesTimeoutSec = (config.onlineUpdatesTimeoutSec > 0) ? config.onlineUpdatesTimeoutSec : kLargeDefaultTimeoutSec;
 	RetrySyncIntervalMSec = config.retrySyncIntervalMSec;
 	ParallelSyncsPerThreadCount = config.parallelSyncsPerThreadCount;
 	BatchingRoutinesCount = config.batchingRoutinesCount > 0 ? size_t(config.batchingRoutinesCount) : 100;
+	ApplyLanesCount = size_t(std::clamp(config.applyLanesCount, 1, kMaxApplyLanesCount));
 	MaxWALDepthOnForceSync = config.maxWALDepthOnForceSync;
 	ForceSyncOnLogicError = config.forceSyncOnLogicError;
 	SyncTimeoutSec = std::max(config.syncTimeoutSec, config.onlineUpdatesTimeoutSec);
@@ -75,6 +81,7 @@ ReplThreadConfig::ReplThreadConfig(const ReplicationConfigData& baseConfig, cons
 		SyncTimeoutSec = kLargeDefaultTimeoutSec;
 	}
 	BatchingRoutinesCount = config.batchingRoutinesCount > 0 ? size_t(config.batchingRoutinesCount) : 100;
+	ApplyLanesCount = size_t(std::clamp(config.applyLanesCount, 1, kMaxApplyLanesCount));
 	OnlineUpdatesDelaySec = 0;
 }
 
@@ -92,16 +99,64 @@ void NamespaceData::UpdateLsnOnRecord(const updates::UpdateRecord& rec) {
 	}
 }
 
+Node::Node(int _serverId, uint32_t _uid, const client::ReindexerConfig& config, size_t applyLanesCount)
+	: serverId(_serverId), uid(_uid), client(config) {
+	assertrx(applyLanesCount > 0);
+	// Follower with the default 'shared' RPC threading serves the connections on the same threads pool, so the lanes have to
+	// request the dedicated threads explicitly to be applied concurrently
+	client::ReindexerConfig laneConfig = config;
+	laneConfig.RequestDedicatedThread = true;
+	laneClients.reserve(applyLanesCount - 1);
+	for (size_t i = 1; i < applyLanesCount; ++i) {
+		laneClients.emplace_back(std::make_unique<client::CoroReindexer>(laneConfig));
+	}
+	applyStats.lanes.resize(applyLanesCount);
+}
+
 void Node::Reconnect(net::ev::dynamic_loop& loop, const ReplThreadConfig& config) {
-	if (connObserverId.has_value()) {
-		auto err = client.RemoveConnectionStateObserver(*connObserverId);
-		(void)err;	// ignored
-		connObserverId.reset();
+	RemoveConnectionStateObservers();
+	Stop();
+	const auto opts = client::ConnectOpts().CreateDBIfMissing().WithExpectedClusterID(config.ClusterID);
+	for (size_t lane = 0; lane < LanesCount(); ++lane) {
+		auto err = LaneClient(lane).Connect(dsn, loop, opts);
+		(void)err;	// ignored; Error will be checked during the further requests
 	}
+}
+
+void Node::Stop() {
 	client.Stop();
-	const auto opts = client::ConnectOpts().CreateDBIfMissing().WithExpectedClusterID(config.ClusterID);
-	auto err = client.Connect(dsn, loop, opts);
-	(void)err;	// ignored; Error will be checked during the further requests
+	for (auto& laneClient : laneClients) {
+		laneClient->Stop();
+	}
+}
+
+Error Node::AddConnectionStateObservers(const client::CoroReindexer::ConnectionStateHandlerT& observer) {
+	assertrx(connObserverIds.empty());
+	for (size_t lane = 0; lane < LanesCount(); ++lane) {
+		auto id = LaneClient(lane).AddConnectionStateObserver(observer);
+		if (!id.has_value()) {
+			RemoveConnectionStateObservers();
+			return id.error();
+		}
+		connObserverIds.emplace_back(id.value());
+	}
+	return Error();
+}
+
+void Node::RemoveConnectionStateObservers() noexcept {
+	for (size_t lane = 0; lane < connObserverIds.size(); ++lane) {
+		auto err = LaneClient(lane).RemoveConnectionStateObserver(connObserverIds[lane]);
+		(void)err;	// ignored
+	}
+	connObserverIds.clear();
+}
+
+net::cproto::CompressionStats Node::GetCompressionStats() const noexcept {
+	auto stats = client.GetCompressionStats();
+	for (auto& laneClient : laneClients) {
+		stats += laneClient->GetCompressionStats();
+	}
+	return stats;
 }
 }  // namespace repl_thread_impl
 
@@ -190,6 +245,7 @@ void ReplThread<BehaviourParamT>::Run(ReplThreadConfig config, const std::vector
 	// NOLINTNEXTLINE(bugprone-exception-escape,rx-perf-lambda-to-std-function-allocation)
 	loop.spawn([this, &nodesList, funcName = __FUNCTION__]() noexcept {
 		nodes.clear();
+		compressionDicts_.clear();
 		if (config_.ParallelSyncsPerThreadCount > 0) {
 			nsSyncTokens_ = std::make_unique<coroutine::tokens_pool<bool>>(config_.ParallelSyncsPerThreadCount);
 		} else {
@@ -200,9 +256,11 @@ void ReplThread<BehaviourParamT>::Run(ReplThreadConfig config, const std::vector
 		rpcCfg.AppName = config_.AppName;
 		rpcCfg.NetTimeout = std::chrono::seconds(config_.UpdatesTimeoutSec);
 		rpcCfg.EnableCompression = config_.EnableCompression;
+		rpcCfg.Codec = config_.CompressionCodec;
+		rpcCfg.ZstdCompressionLevel = config_.ZstdCompressionLevel;
 		rpcCfg.ReplToken = config_.LeaderReplToken;
 		for (const auto& nodeP : nodesList) {
-			nodes.emplace_back(nodeP.second.GetServerID(), nodeP.first, rpcCfg);
+			nodes.emplace_back(nodeP.second.GetServerID(), nodeP.first, rpcCfg, config_.ApplyLanesCount);
 			nodes.back().dsn = nodeP.second.GetRPCDsn();
 		}
 
@@ -272,12 +330,8 @@ void ReplThread<BehaviourParamT>::DisconnectNodes() {
 		loop.spawn(
 			swg,
 			[&node]() noexcept {
-				if (node.connObserverId.has_value()) {
-					auto err = node.client.RemoveConnectionStateObserver(*node.connObserverId);
-					(void)err;	// ignore
-					node.connObserverId.reset();
-				}
-				node.client.Stop();
+				node.RemoveConnectionStateObservers();
+				node.Stop();
 			},
 			k16kCoroStack);
 	}
@@ -321,9 +375,10 @@ void ReplThread<BehaviourParamT>::nodeReplicationRoutine(Node& node) {
 		statsCollector_.SaveNodeError(node.uid, err);  // Reset last node error after checking node replication allowance
 		if (err.ok()) {
 			expectingReconnect = true;
-			if (!node.connObserverId.has_value()) {
+			if (!node.HasConnectionStateObservers()) {
+				// Any of the lanes' connection errors requires the resync
 				// NOLINTNEXTLINE(bugprone-exception-escape) TODO: Currently there are no good ways to recover, crash is intended
-				auto connObserverId = node.client.AddConnectionStateObserver([this, &node](const Error& err) noexcept {
+				err = node.AddConnectionStateObservers([this, &node](const Error& err) noexcept {
 					if (!err.ok() && updates_ && !terminate_) {
 						logInfo("{}:{} Connection error: {}", serverId_, node.uid, err.whatStr());
 						UpdatesContainer recs;
@@ -335,11 +390,6 @@ void ReplThread<BehaviourParamT>::nodeReplicationRoutine(Node& node) {
 						}
 					}
 				});
-				if (connObserverId.has_value()) {
-					node.connObserverId = connObserverId.value();
-				} else {
-					err = connObserverId.error();
-				}
 			}
 
 			const auto nsList = generateSyncNssList(node);
@@ -387,12 +437,8 @@ void ReplThread<BehaviourParamT>::nodeReplicationRoutine(Node& node) {
 	if (terminate_) {
 		logTrace("{}:{} Node replication routine was terminated", serverId_, node.uid);
 	}
-	if (node.connObserverId.has_value()) {
-		auto err = node.client.RemoveConnectionStateObserver(*node.connObserverId);
-		(void)err;	// ignore; Error does not matter here
-		node.connObserverId.reset();
-	}
-	node.client.Stop();
+	node.RemoveConnectionStateObservers();
+	node.Stop();
 }
 
 template <>
@@ -609,7 +655,7 @@ Error ReplThread<BehaviourParamT>::nodeReplicationImpl(Node& node, const std::ve
 	logTrace("{}:{} Performing ns data cleanup...", serverId_, node.uid);
 	for (auto nsDataIt = node.namespaceData.begin(); nsDataIt != node.namespaceData.end();) {
 		if (!nsDataIt->second.tx.IsFree()) {
-			auto err = node.client.WithLSN(lsn_t(0, serverId_)).RollBackTransaction(nsDataIt->second.tx);
+			auto err = node.LaneClient(node.Lane(nsDataIt->first)).WithLSN(lsn_t(0, serverId_)).RollBackTransaction(nsDataIt->second.tx);
 			logInfo("{}:{} Rollback transaction result: {}", serverId_, node.uid,
 					err.ok() ? "OK" : ("Error:" + std::to_string(err.code()) + ". " + err.whatStr()));
 			nsDataIt->second.tx = client::CoroTransaction();
@@ -784,7 +830,29 @@ Error ReplThread<BehaviourParamT>::syncNamespace(Node& node, const NamespaceName
 		if (!err.ok()) {
 			return err;
 		}
-		if (snapshot.HasRawData()) {
+		if (snapshot.HasRawData() && !followerState.nsVersion.isEmpty() && followerState.nsVersion == localState.nsVersion &&
+			followerState.dataCount) {
+			// Follower has the same namespace, so it's probably cheaper to resync the diverged buckets of the data hash tree only
+			try {
+				if (auto diff = compareDataHashTrees(client, nsName, std::max(localState.dataCount, followerState.dataCount)); diff) {
+					SnapshotOpts opts(requiredLsn, config_.MaxWALDepthOnForceSync);
+					opts.dataHashTreeDiff = std::move(diff);
+					Snapshot partialSnapshot;
+					deadlineCtx = RdxDeadlineContext(kLocalCallsTimeout);
+					err = thisNode.GetSnapshot(nsName, opts, partialSnapshot, RdxContext().WithCancelCtx(deadlineCtx));
+					if (err.ok() && partialSnapshot.IsPartial()) {
+						snapshot = std::move(partialSnapshot);
+					}
+				}
+			} catch (Error& e) {
+				logWarn("{}:{}:{} Unable to compare data hash trees: {}", serverId_, node.uid, nsName, e.whatStr());
+			}
+		}
+		if (snapshot.IsPartial()) {
+			logInfo("{}:{}:{} Snapshot has RAW data of {} diverged buckets (performing PARTIAL sync)", serverId_, node.uid, nsName,
+					snapshot.ResyncBucketsCount());
+			timeCounter.SetType(SyncTimeCounter::Type::PartialSync);
+		} else if (snapshot.HasRawData()) {
 			logInfo("{}:{}:{} Snapshot has RAW data, creating tmp namespace (performing FORCE sync)", serverId_, node.uid, nsName);
 			createTmpNamespace = true;
 		} else if (snapshot.NsVersion().Server() != requiredLsn.NsVersion().Server() ||
@@ -823,7 +891,9 @@ Error ReplThread<BehaviourParamT>::syncNamespace(Node& node, const NamespaceName
 			if (!bhvParam_.IsLeader()) {
 				return Error(errParams, "Leader was switched");
 			}
-			err = client.WithLSN(lsn_t(0, serverId_)).ApplySnapshotChunk(replNsName, it.Chunk());
+			const auto chunk = it.Chunk();
+			timeCounter.AddChunk(chunk);
+			err = client.WithLSN(lsn_t(0, serverId_)).ApplySnapshotChunk(replNsName, chunk);
 			if (!err.ok()) {
 				return err;
 			}
@@ -869,6 +939,84 @@ Error ReplThread<BehaviourParamT>::syncNamespace(Node& node, const NamespaceName
 	return Error();
 }
 
+template <typename BehaviourParamT>
+std::shared_ptr<const DataHashTreeDiff> ReplThread<BehaviourParamT>::compareDataHashTrees(client::CoroReindexer& client,
+																						  const NamespaceName& nsName, size_t itemsCount) {
+	const auto leavesCount = DataHashTree::LeavesCountFor(itemsCount);
+	std::optional<DataHashTree> tree;
+	RdxDeadlineContext deadlineCtx(kLocalCallsTimeout);
+	auto err = thisNode.GetDataHashTree(nsName, leavesCount, tree, RdxContext().WithCancelCtx(deadlineCtx));
+	if (!err.ok()) {
+		throw err;
+	}
+	auto buckets = tree->DivergedBuckets(
+		[&](std::span<const uint32_t> nodes, std::vector<uint64_t>& hashes) {
+			auto nodesErr = client.GetDataHashTreeNodes(nsName, leavesCount, nodes, hashes);
+			if (!nodesErr.ok()) {
+				throw nodesErr;
+			}
+		},
+		DataHashTree::MaxDivergedBuckets(leavesCount));
+	if (!buckets.has_value() || buckets->empty()) {
+		return nullptr;
+	}
+	return std::make_shared<const DataHashTreeDiff>(DataHashTreeDiff{std::move(*tree), std::move(*buckets)});
+}
+
+// Counts the stall of the all apply lanes, caused by the update, which can not be batched
+static void onApplyStall(ApplyLanesStats::Stalls& stalls, const updates::UpdateRecord& rec) noexcept {
+	using updates::URType;
+	switch (rec.Type()) {
+		case URType::IndexAdd:
+		case URType::IndexDrop:
+		case URType::IndexUpdate:
+		case URType::SetSchema:
+		case URType::AddNamespace:
+		case URType::DropNamespace:
+		case URType::CloseNamespace:
+		case URType::RenameNamespace:
+		case URType::SetTagsMatcher:
+			++stalls.ddl;
+			return;
+		case URType::BeginTx:
+		case URType::CommitTx:
+		case URType::SetTagsMatcherTx:
+			++stalls.tx;
+			return;
+		case URType::UpdateQuery:
+		case URType::DeleteQuery:
+			++stalls.query;
+			return;
+		case URType::None:
+		case URType::ItemUpdate:
+		case URType::ItemUpsert:
+		case URType::ItemDelete:
+		case URType::ItemInsert:
+		case URType::ItemUpdateTx:
+		case URType::ItemUpsertTx:
+		case URType::ItemDeleteTx:
+		case URType::ItemInsertTx:
+		case URType::PutMeta:
+		case URType::PutMetaTx:
+		case URType::UpdateQueryTx:
+		case URType::DeleteQueryTx:
+		case URType::Truncate:
+		case URType::ResyncNamespaceGeneric:
+		case URType::ResyncNamespaceLeaderInit:
+		case URType::ResyncOnUpdatesDrop:
+		case URType::EmptyUpdate:
+		case URType::NodeNetworkCheck:
+		case URType::SaveShardingConfig:
+		case URType::ApplyShardingConfig:
+		case URType::ResetOldShardingConfig:
+		case URType::ResetCandidateConfig:
+		case URType::RollbackCandidateConfig:
+		case URType::DeleteMeta:
+			++stalls.other;
+			return;
+	}
+}
+
 template <typename BehaviourParamT>
 // NOLINTNEXTLINE(bugprone-exception-escape) TODO: Currently there are no good ways to recover, crash is intended
 UpdateApplyStatus ReplThread<BehaviourParamT>::nodeUpdatesHandlingLoop(Node& node) noexcept {
@@ -986,13 +1134,15 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::nodeUpdatesHandlingLoop(Node& nod
 					--node.nextUpdateId;  // Have to read this update again
 					break;
 				}
+				sampleForCompressionDict(it, updatePtr->ID() + offset);
 				if (nsData.requiresTmUpdate && (it.IsBatchingAllowed() || it.IsTxBeginning())) {
 					nsData.requiresTmUpdate = false;
 					// Explicitly update tm for this namespace
 					// TODO: Find better solution?
 					logTrace("{}:{}:{} Executing select to update tm...", serverId_, node.uid, nsName);
 					client::CoroQueryResults qr;
-					res = node.client.WithShardId(ShardingKeyType::ProxyOff, false).Select(Query(nsName).Limit(0), qr);
+					auto& laneClient = node.LaneClient(node.Lane(nsName));
+					res = laneClient.WithShardId(ShardingKeyType::ProxyOff, false).Select(Query(nsName).Limit(0), qr);
 					if (!res.err.ok()) {
 						--node.nextUpdateId;  // Have to read this update again
 						break;
@@ -1006,6 +1156,9 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::nodeUpdatesHandlingLoop(Node& nod
 					}
 					continue;
 				} else {
+					if (batcher.BatchedUpdatesCount()) {
+						onApplyStall(node.applyStats.stalls, it);
+					}
 					res = batcher.AwaitBatchedUpdates();
 					if (!res.err.ok()) {
 						--node.nextUpdateId;  // Have to read this update again
@@ -1049,6 +1202,8 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::nodeUpdatesHandlingLoop(Node& nod
 					res = std::move(batchedRes);
 				}
 			}
+			statsCollector_.OnCompressionStats(node.uid, node.GetCompressionStats());
+			statsCollector_.OnApplyLanesStats(node.uid, node.applyStats);
 
 			if (requireReelections) {
 				logWarn("{}:{} Requesting leader reelection on error: {}", serverId_, node.uid, res.err.whatStr());
@@ -1073,6 +1228,47 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::nodeUpdatesHandlingLoop(Node& nod
 	return Error();
 }
 
+template <typename BehaviourParamT>
+void ReplThread<BehaviourParamT>::sampleForCompressionDict(const updates::UpdateRecord& rec, uint64_t updateId) {
+	if (!config_.EnableCompression || config_.CompressionCodec != net::cproto::CompressionCodec::Zstd || !config_.ZstdDictSize ||
+		!net::cproto::ZstdCompressionAvailable()) {
+		return;
+	}
+	const auto* data = std::get_if<ItemReplicationRecord>(rec.Data().get());
+	if (!data || data->ch.size() > kMaxCompressionDictSampleSize) {
+		return;
+	}
+	auto& trainer = compressionDicts_[rec.NsName()];
+	if (trainer.trained || trainer.failedAttempts >= kMaxCompressionDictTrainAttempts || updateId < trainer.nextUpdateId) {
+		// Each of the node's routines reads the same records, so each record is sampled only once
+		return;
+	}
+	trainer.nextUpdateId = updateId + 1;
+	trainer.samples.emplace_back(std::string_view(data->ch));
+	trainer.samplesSize += data->ch.size();
+	if (trainer.samplesSize < config_.ZstdDictSize * kCompressionDictSamplesSizeFactor &&
+		trainer.samples.size() < kMaxCompressionDictSamples) {
+		return;
+	}
+
+	const std::string_view nsName(rec.NsName());
+	try {
+		auto dict = net::cproto::ZstdDictionary::Train(trainer.samples, config_.ZstdDictSize, config_.ZstdCompressionLevel);
+		for (auto& node : nodes) {
+			// Dictionary will be sent to the follower right before the first request, which uses it
+			std::ignore = node.LaneClient(node.Lane(rec.NsName())).SetCompressionDict(nsName, dict);
+		}
+		trainer.trained = true;
+		logInfo("{}: Zstd dictionary {} ({} bytes) was trained for '{}' on {} samples", serverId_, dict->ID(), dict->Data().size(), nsName,
+				trainer.samples.size());
+	} catch (const Error& err) {
+		++trainer.failedAttempts;
+		logWarn("{}: Unable to train zstd dictionary for '{}' (attempt {}): {}", serverId_, nsName, trainer.failedAttempts, err.what());
+	}
+	trainer.samples = std::vector<std::string>();
+	trainer.samplesSize = 0;
+}
+
 template <typename BehaviourParamT>
 bool ReplThread<BehaviourParamT>::handleUpdatesWithError(Node& node, const Error& err) {
 	auto& updatesNotifier = *node.updateNotifier;
@@ -1215,7 +1411,14 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::applyUpdate(const updates::Update
 														   ReplThread::NamespaceData& nsData) noexcept {
 	auto lsn = rec.ExtLSN().LSN();
 	std::string_view nsName = rec.NsName();
-	auto& client = node.client;
+	const size_t lane = node.Lane(rec.NsName());
+	auto& client = node.LaneClient(lane);
+	const auto applyBeg = steady_clock_w::now();
+	const auto applyStatsGuard = MakeScopeGuard([&node, lane, applyBeg]() noexcept {
+		auto& laneStats = node.applyStats.lanes[lane];
+		++laneStats.updates;
+		laneStats.applyTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_w::now() - applyBeg).count();
+	});
 	try {
 		switch (rec.Type()) {
 			case updates::URType::ItemUpdate: {
@@ -1282,7 +1485,7 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::applyUpdate(const updates::Update
 				if (!nsData.tx.IsFree()) {
 					return UpdateApplyStatus(Error(errLogic, "Tx is not empty"), rec.Type());
 				}
-				nsData.tx = node.client.WithLSN(lsn).NewTransaction(nsName);
+				nsData.tx = client.WithLSN(lsn).NewTransaction(nsName);
 				return UpdateApplyStatus(Error(nsData.tx.Status()), rec.Type());
 			}
 			case updates::URType::CommitTx: {
@@ -1290,7 +1493,7 @@ UpdateApplyStatus ReplThread<BehaviourParamT>::applyUpdate(const updates::Update
 					return UpdateApplyStatus(Error(errLogic, "Tx is empty"), rec.Type());
 				}
 				client::CoroQueryResults qr;
-				return UpdateApplyStatus(node.client.WithLSN(lsn).CommitTransaction(nsData.tx, qr), rec.Type());
+				return UpdateApplyStatus(client.WithLSN(lsn).CommitTransaction(nsData.tx, qr), rec.Type());
 			}
 			case updates::URType::ItemUpdateTx:
 			case updates::URType::ItemUpsertTx:
@@ -32,9 +32,14 @@ struct [[nodiscard]] ReplThreadConfig {
 	int ParallelSyncsPerThreadCount = 2;
 	int ClusterID = 1;
 	size_t BatchingRoutinesCount = 100;
+	// Count of the connections to each follower, which are used to apply online updates of the different namespaces concurrently
+	size_t ApplyLanesCount = 1;
 	int64_t MaxWALDepthOnForceSync = 1000;
 	bool ForceSyncOnLogicError = false;
 	bool EnableCompression = true;
+	net::cproto::CompressionCodec CompressionCodec = net::cproto::CompressionCodec::Snappy;
+	int ZstdCompressionLevel = net::cproto::kDefaultZstdCompressionLevel;
+	size_t ZstdDictSize = 0;
 	double OnlineUpdatesDelaySec = 0;
 	std::string LeaderReplToken;
 };
@@ -62,19 +67,34 @@ public:
 struct [[nodiscard]] Node {
 	using UpdatesChT = coroutine::channel<bool>;
 
-	Node(int _serverId, uint32_t _uid, const client::ReindexerConfig& config) : serverId(_serverId), uid(_uid), client(config) {}
+	Node(int _serverId, uint32_t _uid, const client::ReindexerConfig& config, size_t applyLanesCount);
 	void Reconnect(net::ev::dynamic_loop& loop, const ReplThreadConfig& config);
+	void Stop();
+	size_t LanesCount() const noexcept { return laneClients.size() + 1; }
+	// All of the online updates of the namespace are applied via the same lane to keep their LSN order on the follower: the follower's
+	// WAL does not accept the origin LSNs out of order, so the updates of the single namespace can not be spread over the lanes
+	size_t Lane(const NamespaceName& nsName) const noexcept { return laneClients.empty() ? 0 : nsName.hash() % LanesCount(); }
+	client::CoroReindexer& LaneClient(size_t lane) noexcept { return lane ? *laneClients[lane - 1] : client; }
+	net::cproto::CompressionStats GetCompressionStats() const noexcept;
+	// Observer is added to the each of the lanes' connections
+	Error AddConnectionStateObservers(const client::CoroReindexer::ConnectionStateHandlerT& observer);
+	void RemoveConnectionStateObservers() noexcept;
+	bool HasConnectionStateObservers() const noexcept { return !connObserverIds.empty(); }
 
 	int serverId;
 	uint32_t uid;
 	DSN dsn;
 	client::CoroReindexer client;
+	// Extra connections for the apply lanes [1, LanesCount()). Lane 0 uses the main client
+	std::vector<std::unique_ptr<client::CoroReindexer>> laneClients;
+	ApplyLanesStats applyStats;
 	std::unique_ptr<UpdatesChT> updateNotifier = std::make_unique<UpdatesChT>();
 	std::unordered_map<NamespaceName, NamespaceData, NamespaceNameHash, NamespaceNameEqual>
 		namespaceData;	// This map should not invalidate references
 	uint64_t nextUpdateId = 0;
 	bool requireResync = false;
-	std::optional<int64_t> connObserverId;
+	// Observers' ids of the lanes' clients
+	std::vector<int64_t> connObserverIds;
 };
 }  // namespace repl_thread_impl
 
@@ -119,12 +139,16 @@ private:
 																 bool currentlyOnline, const updates::UpdateRecord& rec) noexcept;
 
 	Error syncNamespace(Node&, const NamespaceName&, const ReplicationStateV2& followerState);
+	std::shared_ptr<const DataHashTreeDiff> compareDataHashTrees(client::CoroReindexer& client, const NamespaceName& nsName,
+																 size_t itemsCount);
 	Error syncShardingConfig(Node& node) noexcept;
 	UpdateApplyStatus nodeUpdatesHandlingLoop(Node& node) noexcept;
 	bool handleUpdatesWithError(Node& node, const Error& err);
 	Error checkIfReplicationAllowed(Node& node, LogLevel& logLevel);
 
 	UpdateApplyStatus applyUpdate(const updates::UpdateRecord& rec, Node& node, NamespaceData& nsData) noexcept;
+	// Collects CJSON samples of the namespace's items and trains zstd dictionary for the replication stream, when there are enough of them
+	void sampleForCompressionDict(const updates::UpdateRecord& rec, uint64_t updateId);
 	static bool isNetworkError(const Error& err) noexcept { return err.code() == errNetwork || err.code() == errConnectSSL; }
 	static bool isTimeoutError(const Error& err) noexcept { return err.code() == errTimeout || err.code() == errCanceled; }
 	static bool isLeaderChangedError(const Error& err) noexcept { return err.code() == errWrongReplicationData; }
@@ -139,6 +163,18 @@ private:
 	}
 	bool needForceSyncOnLogicError(const Error&) const noexcept;
 
+	struct [[nodiscard]] CompressionDictTrainer {
+		std::vector<std::string> samples;
+		size_t samplesSize = 0;
+		uint64_t nextUpdateId = 0;
+		int failedAttempts = 0;
+		bool trained = false;
+	};
+	constexpr static size_t kMaxCompressionDictSampleSize = 64 * 1024;
+	constexpr static size_t kMaxCompressionDictSamples = 4096;
+	constexpr static size_t kCompressionDictSamplesSizeFactor = 32;
+	constexpr static int kMaxCompressionDictTrainAttempts = 3;
+
 	const int serverId_ = -1;
 	uint32_t consensusCnt_ = 0;
 	uint32_t requiredReplicas_ = 0;
@@ -154,6 +190,7 @@ private:
 	std::shared_ptr<UpdatesQueueT> updates_;
 	coroutine::channel<bool> terminateCh_;
 	ReplicationStatsCollector statsCollector_;
+	std::unordered_map<NamespaceName, CompressionDictTrainer, NamespaceNameHash, NamespaceNameEqual> compressionDicts_;
 	const Logger& log_;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/namespace/snapshot/snapshotrecord.h"
 #include "replicationstats.h"
 #include "tools/clock.h"
 
@@ -40,24 +41,29 @@ public:
 		}
 	}
 
-	void OnWalSync(std::chrono::microseconds time) noexcept {
+	void OnWalSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
 		if (counter_) {
-			counter_->OnWalSync(time);
+			counter_->OnWalSync(time, records, bytes);
 		}
 	}
-	void OnForceSync(std::chrono::microseconds time) noexcept {
+	void OnForceSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
 		if (counter_) {
-			counter_->OnForceSync(time);
+			counter_->OnForceSync(time, records, bytes);
 		}
 	}
-	void OnInitialWalSync(std::chrono::microseconds time) noexcept {
+	void OnPartialSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
 		if (counter_) {
-			counter_->OnInitialWalSync(time);
+			counter_->OnPartialSync(time, records, bytes);
 		}
 	}
-	void OnInitialForceSync(std::chrono::microseconds time) noexcept {
+	void OnInitialWalSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
 		if (counter_) {
-			counter_->OnInitialForceSync(time);
+			counter_->OnInitialWalSync(time, records, bytes);
+		}
+	}
+	void OnInitialForceSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
+		if (counter_) {
+			counter_->OnInitialForceSync(time, records, bytes);
 		}
 	}
 	void OnInitialSyncDone(std::chrono::microseconds time) noexcept {
@@ -115,6 +121,16 @@ public:
 			counter_->OnEnqueueNamespacesSync(nodeId, count);
 		}
 	}
+	void OnCompressionStats(size_t nodeId, const net::cproto::CompressionStats& stats) noexcept {
+		if (counter_) {
+			counter_->OnCompressionStats(nodeId, stats);
+		}
+	}
+	void OnApplyLanesStats(size_t nodeId, const ApplyLanesStats& stats) {
+		if (counter_) {
+			counter_->OnApplyLanesStats(nodeId, stats);
+		}
+	}
 	void SaveNodeError(size_t nodeId, const Error& err) {
 		if (counter_) {
 			counter_->SaveNodeError(nodeId, err);
@@ -140,25 +156,33 @@ private:
 
 class [[nodiscard]] SyncTimeCounter {
 public:
-	enum class [[nodiscard]] Type { ForceSync, WalSync, InitialForceSync, InitialWalSync };
+	enum class [[nodiscard]] Type { ForceSync, WalSync, PartialSync, InitialForceSync, InitialWalSync };
 
 	SyncTimeCounter(Type type, ReplicationStatsCollector& statsCollector) noexcept
 		: tmStart_(steady_clock_w::now()), statsCollector_(statsCollector), type_(type) {}
 	void SetType(Type type) noexcept { type_ = type; }
+	// Volume of the applied snapshot
+	void AddChunk(const SnapshotChunk& ch) noexcept {
+		records_ += ch.Records().size();
+		bytes_ += ch.DataSize();
+	}
 	~SyncTimeCounter() {
 		std::chrono::microseconds time = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock_w::now() - tmStart_);
 		switch (type_) {
 			case Type::ForceSync:
-				statsCollector_.OnForceSync(time);
+				statsCollector_.OnForceSync(time, records_, bytes_);
 				break;
 			case Type::WalSync:
-				statsCollector_.OnWalSync(time);
+				statsCollector_.OnWalSync(time, records_, bytes_);
+				break;
+			case Type::PartialSync:
+				statsCollector_.OnPartialSync(time, records_, bytes_);
 				break;
 			case Type::InitialForceSync:
-				statsCollector_.OnInitialForceSync(time);
+				statsCollector_.OnInitialForceSync(time, records_, bytes_);
 				break;
 			case Type::InitialWalSync:
-				statsCollector_.OnInitialWalSync(time);
+				statsCollector_.OnInitialWalSync(time, records_, bytes_);
 				break;
 		}
 	}
@@ -167,6 +191,8 @@ private:
 	const steady_clock_w::time_point tmStart_;
 	ReplicationStatsCollector& statsCollector_;
 	Type type_;
+	size_t records_ = 0;
+	size_t bytes_ = 0;
 };
 
 }  // namespace cluster
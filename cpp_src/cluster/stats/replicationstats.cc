@@ -12,12 +12,16 @@ void SyncStats::FromJSON(const gason::JsonNode& root) {
 	count = root["count"sv].As<size_t>(0);
 	maxTimeUs = root["max_time_us"sv].As<size_t>(0);
 	avgTimeUs = root["avg_time_us"sv].As<size_t>(0);
+	records = root["records"sv].As<size_t>(0);
+	bytes = root["bytes"sv].As<size_t>(0);
 }
 
 void SyncStats::GetJSON(JsonBuilder& builder) const {
 	builder.Put("count"sv, count);
 	builder.Put("max_time_us"sv, maxTimeUs);
 	builder.Put("avg_time_us"sv, avgTimeUs);
+	builder.Put("records"sv, records);
+	builder.Put("bytes"sv, bytes);
 }
 
 void InitialSyncStats::FromJSON(const gason::JsonNode& root) {
@@ -102,6 +106,55 @@ static Error NodeErrorFromJson(const gason::JsonNode& lastErrorRoot) {
 	return Error(ErrorCode(code), what);
 }
 
+static void compressionStatsFromJSON(const gason::JsonNode& root, net::cproto::CompressionStats& stats) {
+	stats.rawBytes = root["raw_bytes"sv].As<uint64_t>(0);
+	stats.compressedBytes = root["compressed_bytes"sv].As<uint64_t>(0);
+	stats.compressTimeUs = root["compress_time_us"sv].As<uint64_t>(0);
+	stats.decompressTimeUs = root["decompress_time_us"sv].As<uint64_t>(0);
+	stats.zstdRawBytes = root["zstd_raw_bytes"sv].As<uint64_t>(0);
+	stats.zstdDictRawBytes = root["zstd_dict_raw_bytes"sv].As<uint64_t>(0);
+}
+
+static void compressionStatsGetJSON(JsonBuilder& builder, const net::cproto::CompressionStats& stats) {
+	builder.Put("ratio"sv, stats.Ratio());
+	builder.Put("raw_bytes"sv, stats.rawBytes);
+	builder.Put("compressed_bytes"sv, stats.compressedBytes);
+	builder.Put("compress_time_us"sv, stats.compressTimeUs);
+	builder.Put("decompress_time_us"sv, stats.decompressTimeUs);
+	builder.Put("zstd_raw_bytes"sv, stats.zstdRawBytes);
+	builder.Put("zstd_dict_raw_bytes"sv, stats.zstdDictRawBytes);
+}
+
+void ApplyLanesStats::FromJSON(const gason::JsonNode& root) {
+	lanes.clear();
+	for (auto& laneNode : root["lanes"sv]) {
+		auto& lane = lanes.emplace_back();
+		lane.updates = laneNode["updates"sv].As<uint64_t>(0);
+		lane.applyTimeUs = laneNode["apply_time_us"sv].As<uint64_t>(0);
+	}
+	const auto& stallsNode = root["stalls"sv];
+	stalls.ddl = stallsNode["ddl"sv].As<uint64_t>(0);
+	stalls.tx = stallsNode["tx"sv].As<uint64_t>(0);
+	stalls.query = stallsNode["query"sv].As<uint64_t>(0);
+	stalls.other = stallsNode["other"sv].As<uint64_t>(0);
+}
+
+void ApplyLanesStats::GetJSON(JsonBuilder& builder) const {
+	{
+		auto lanesArray = builder.Array("lanes"sv);
+		for (auto& lane : lanes) {
+			auto laneObj = lanesArray.Object();
+			laneObj.Put("updates"sv, lane.updates);
+			laneObj.Put("apply_time_us"sv, lane.applyTimeUs);
+		}
+	}
+	auto stallsObj = builder.Object("stalls"sv);
+	stallsObj.Put("ddl"sv, stalls.ddl);
+	stallsObj.Put("tx"sv, stalls.tx);
+	stallsObj.Put("query"sv, stalls.query);
+	stallsObj.Put("other"sv, stalls.other);
+}
+
 void NodeStats::FromJSON(const gason::JsonNode& root) {
 	dsn = DSN(root["dsn"sv].As<std::string>());
 	serverId = root["server_id"sv].As<int>(-1);
@@ -112,6 +165,8 @@ void NodeStats::FromJSON(const gason::JsonNode& root) {
 	nssSyncQueue = root["queued_namespace_syncs"sv].As<size_t>(0);
 	syncState = NodeSyncStateFromStr(root["sync_state"sv].As<std::string_view>("none"sv));
 	lastError = NodeErrorFromJson(root["last_error"sv]);
+	compressionStatsFromJSON(root["compression"sv], compression);
+	applyLanes.FromJSON(root["apply_lanes"sv]);
 	for (auto& ns : root["namespaces"sv]) {
 		namespaces.emplace_back(ns.As<std::string>());
 	}
@@ -131,6 +186,14 @@ void NodeStats::GetJSON(JsonBuilder& builder) const {
 		lastErrorJsonBuilder.Put("code"sv, int(lastError.code()));
 		lastErrorJsonBuilder.Put("message"sv, lastError.what());
 	}
+	{
+		auto compressionJsonBuilder = builder.Object("compression"sv);
+		compressionStatsGetJSON(compressionJsonBuilder, compression);
+	}
+	{
+		auto applyLanesJsonBuilder = builder.Object("apply_lanes"sv);
+		applyLanes.GetJSON(applyLanesJsonBuilder);
+	}
 	{
 		auto nsArray = builder.Array("namespaces"sv);
 		for (auto& ns : namespaces) {
@@ -158,6 +221,7 @@ Error ReplicationStats::FromJSON(const gason::JsonNode& root) {
 		}
 		forceSyncs.FromJSON(root["force_syncs"sv]);
 		walSyncs.FromJSON(root["wal_syncs"sv]);
+		partialSyncs.FromJSON(root["partial_syncs"sv]);
 		updateDrops = root["update_drops"sv].As<int64_t>(updateDrops);
 		pendingUpdatesCount = root["pending_updates_count"sv].As<int64_t>(pendingUpdatesCount);
 		allocatedUpdatesCount = root["allocated_updates_count"sv].As<int64_t>(allocatedUpdatesCount);
@@ -191,6 +255,10 @@ void ReplicationStats::GetJSON(JsonBuilder& builder) const {
 		auto obj = builder.Object("wal_syncs"sv);
 		walSyncs.GetJSON(obj);
 	}
+	{
+		auto obj = builder.Object("partial_syncs"sv);
+		partialSyncs.GetJSON(obj);
+	}
 	builder.Put("update_drops"sv, updateDrops);
 	builder.Put("pending_updates_count"sv, pendingUpdatesCount);
 	builder.Put("allocated_updates_count"sv, allocatedUpdatesCount);
@@ -210,9 +278,11 @@ void ReplicationStats::GetJSON(WrSerializer& ser) const {
 	GetJSON(jb);
 }
 
-void SyncStatsCounter::Hit(std::chrono::microseconds time) noexcept {
+void SyncStatsCounter::Hit(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
 	lock_guard lck(mtx_);
 	totalTimeUs += time.count();
+	totalRecords += records;
+	totalBytes += bytes;
 	++count;
 	if (maxTimeUs < time.count()) {
 		maxTimeUs = time.count();
@@ -224,6 +294,8 @@ void SyncStatsCounter::Reset() noexcept {
 	count = 0;
 	maxTimeUs = 0;
 	totalTimeUs = 0;
+	totalRecords = 0;
+	totalBytes = 0;
 }
 
 SyncStats SyncStatsCounter::Get() const {
@@ -233,6 +305,8 @@ SyncStats SyncStatsCounter::Get() const {
 		stats.count = count;
 		stats.maxTimeUs = maxTimeUs;
 		stats.avgTimeUs = totalTimeUs / (count ? count : 1);
+		stats.records = totalRecords;
+		stats.bytes = totalBytes;
 	}
 	return stats;
 }
@@ -247,6 +321,16 @@ Error NodeStatsCounter::GetLastError() const {
 	return lastError;
 }
 
+void NodeStatsCounter::OnCompressionStats(const net::cproto::CompressionStats& stats) noexcept {
+	lock_guard lck(mtx_);
+	compression = stats;
+}
+
+void NodeStatsCounter::OnApplyLanesStats(const ApplyLanesStats& stats) {
+	lock_guard lck(mtx_);
+	applyLanes = stats;
+}
+
 NodeStats NodeStatsCounter::Get() const {
 	NodeStats stats{};
 	stats.dsn = dsn;
@@ -256,7 +340,12 @@ NodeStats NodeStatsCounter::Get() const {
 	stats.syncState = syncState.load(std::memory_order_relaxed);
 	stats.role = RaftInfo::Role::None;
 	stats.isSynchronized = false;
-	stats.lastError = GetLastError();
+	{
+		lock_guard lck(mtx_);
+		stats.lastError = lastError;
+		stats.compression = compression;
+		stats.applyLanes = applyLanes;
+	}
 	stats.nssSyncQueue = nssSyncQueueSize.load(std::memory_order_relaxed);
 	return stats;
 }
@@ -324,9 +413,24 @@ void ReplicationStatCounter::SaveNodeError(size_t nodeId, const Error& lastError
 	}
 }
 
+void ReplicationStatCounter::OnCompressionStats(size_t nodeId, const net::cproto::CompressionStats& stats) noexcept {
+	shared_lock rlck(mtx_);
+	if (auto found = nodeCounters_.find(nodeId); found != nodeCounters_.end()) {
+		found->second->OnCompressionStats(stats);
+	}
+}
+
+void ReplicationStatCounter::OnApplyLanesStats(size_t nodeId, const ApplyLanesStats& stats) {
+	shared_lock rlck(mtx_);
+	if (auto found = nodeCounters_.find(nodeId); found != nodeCounters_.end()) {
+		found->second->OnApplyLanesStats(stats);
+	}
+}
+
 void ReplicationStatCounter::Clear() noexcept {
 	walSyncs_.Reset();
 	forceSyncs_.Reset();
+	partialSyncs_.Reset();
 	initialForceSyncs_.Reset();
 	initialWalSyncs_.Reset();
 
@@ -354,6 +458,7 @@ ReplicationStats ReplicationStatCounter::Get() const {
 	stats.allocatedUpdatesSizeBytes = allocatedUpdatesSizeBytes_.load(std::memory_order_relaxed);
 	stats.walSyncs = walSyncs_.Get();
 	stats.forceSyncs = forceSyncs_.Get();
+	stats.partialSyncs = partialSyncs_.Get();
 	stats.initialSync.walSyncs = initialWalSyncs_.Get();
 	stats.initialSync.forceSyncs = initialForceSyncs_.Get();
 	stats.initialSync.totalTimeUs = initialSyncTotalTimeUs_.load(std::memory_order_relaxed);
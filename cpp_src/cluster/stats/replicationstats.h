@@ -18,6 +18,9 @@ struct [[nodiscard]] SyncStats {
 	size_t count;
 	size_t maxTimeUs;
 	size_t avgTimeUs;
+	// Total count and size of the snapshot records, sent by all of the syncs
+	size_t records;
+	size_t bytes;
 };
 
 struct [[nodiscard]] InitialSyncStats {
@@ -31,6 +34,33 @@ struct [[nodiscard]] InitialSyncStats {
 	size_t totalTimeUs;
 };
 
+/// Online updates apply stats of the follower's connections (apply lanes). Each of the namespaces is bound to the single lane
+struct [[nodiscard]] ApplyLanesStats {
+	struct [[nodiscard]] Lane {
+		bool operator==(const Lane& r) const noexcept = default;
+
+		uint64_t updates = 0;
+		// Total time of the lane's update requests. Time of the concurrent requests is summed up
+		uint64_t applyTimeUs = 0;
+	};
+	// Updates, which can not be batched, await all of the batched updates of the all lanes. Such stalls are counted by the reason
+	struct [[nodiscard]] Stalls {
+		bool operator==(const Stalls& r) const noexcept = default;
+
+		uint64_t ddl = 0;
+		uint64_t tx = 0;
+		uint64_t query = 0;
+		uint64_t other = 0;
+	};
+
+	void FromJSON(const gason::JsonNode&);
+	void GetJSON(JsonBuilder& builder) const;
+	bool operator==(const ApplyLanesStats& r) const noexcept = default;
+
+	std::vector<Lane> lanes;
+	Stalls stalls;
+};
+
 struct [[nodiscard]] NodeStats {
 	enum class [[nodiscard]] Status { None, Offline, Online, RaftError };
 	enum class [[nodiscard]] SyncState { None, Syncing, AwaitingResync, OnlineReplication, InitialLeaderSync };
@@ -50,6 +80,8 @@ struct [[nodiscard]] NodeStats {
 	bool isSynchronized;
 	std::vector<std::string> namespaces;
 	Error lastError;
+	net::cproto::CompressionStats compression;
+	ApplyLanesStats applyLanes;
 };
 
 struct [[nodiscard]] ReplicationStats {
@@ -67,19 +99,23 @@ struct [[nodiscard]] ReplicationStats {
 	int64_t allocatedUpdatesSizeBytes;
 	SyncStats walSyncs;
 	SyncStats forceSyncs;
+	// Force syncs of the diverged data hash tree buckets only
+	SyncStats partialSyncs;
 	InitialSyncStats initialSync;
 	std::vector<NodeStats> nodeStats;
 	LogLevel logLevel;
 };
 
 struct [[nodiscard]] SyncStatsCounter {
-	void Hit(std::chrono::microseconds time) noexcept RX_REQUIRES(!mtx_);
+	void Hit(std::chrono::microseconds time, size_t records, size_t bytes) noexcept RX_REQUIRES(!mtx_);
 	void Reset() noexcept RX_REQUIRES(!mtx_);
 	SyncStats Get() const RX_REQUIRES(!mtx_);
 
 	size_t count RX_GUARDED_BY(mtx_) = 0;
 	int64_t maxTimeUs RX_GUARDED_BY(mtx_) = 0;
 	int64_t totalTimeUs RX_GUARDED_BY(mtx_) = 0;
+	size_t totalRecords RX_GUARDED_BY(mtx_) = 0;
+	size_t totalBytes RX_GUARDED_BY(mtx_) = 0;
 	mutable spinlock mtx_;
 };
 
@@ -96,6 +132,8 @@ struct [[nodiscard]] NodeStatsCounter {
 	}
 	void SaveLastError(const Error& err) noexcept RX_REQUIRES(!mtx_);
 	Error GetLastError() const RX_REQUIRES(!mtx_);
+	void OnCompressionStats(const net::cproto::CompressionStats& stats) noexcept RX_REQUIRES(!mtx_);
+	void OnApplyLanesStats(const ApplyLanesStats& stats) RX_REQUIRES(!mtx_);
 	NodeStats Get() const RX_REQUIRES(!mtx_);
 
 	const DSN dsn;
@@ -106,6 +144,8 @@ struct [[nodiscard]] NodeStatsCounter {
 	std::atomic<NodeStats::Status> status = {NodeStats::Status::None};
 	std::atomic<NodeStats::SyncState> syncState = {NodeStats::SyncState::None};
 	Error lastError RX_GUARDED_BY(mtx_);
+	net::cproto::CompressionStats compression RX_GUARDED_BY(mtx_);
+	ApplyLanesStats applyLanes RX_GUARDED_BY(mtx_);
 	mutable spinlock mtx_;
 };
 
@@ -136,10 +176,15 @@ public:
 			nodeCounters_.emplace(i, std::make_unique<NodeStatsCounter>(nodes[i].GetRPCDsn(), namespaces));
 		}
 	}
-	void OnWalSync(std::chrono::microseconds time) noexcept { walSyncs_.Hit(time); }
-	void OnForceSync(std::chrono::microseconds time) noexcept { forceSyncs_.Hit(time); }
-	void OnInitialWalSync(std::chrono::microseconds time) noexcept { initialWalSyncs_.Hit(time); }
-	void OnInitialForceSync(std::chrono::microseconds time) noexcept { initialForceSyncs_.Hit(time); }
+	void OnWalSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept { walSyncs_.Hit(time, records, bytes); }
+	void OnForceSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept { forceSyncs_.Hit(time, records, bytes); }
+	void OnPartialSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept { partialSyncs_.Hit(time, records, bytes); }
+	void OnInitialWalSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
+		initialWalSyncs_.Hit(time, records, bytes);
+	}
+	void OnInitialForceSync(std::chrono::microseconds time, size_t records, size_t bytes) noexcept {
+		initialForceSyncs_.Hit(time, records, bytes);
+	}
 	void OnInitialSyncDone(std::chrono::microseconds time) noexcept {
 		initialSyncTotalTimeUs_.store(time.count(), std::memory_order_relaxed);
 	}
@@ -171,6 +216,8 @@ public:
 	void OnEnqueueNamespacesSync(size_t nodeId, size_t count) noexcept RX_REQUIRES(!mtx_);
 	void OnServerIdChanged(size_t nodeId, int serverId) const noexcept RX_REQUIRES(!mtx_);
 	void SaveNodeError(size_t nodeId, const Error& lastError) noexcept RX_REQUIRES(!mtx_);
+	void OnCompressionStats(size_t nodeId, const net::cproto::CompressionStats& stats) noexcept RX_REQUIRES(!mtx_);
+	void OnApplyLanesStats(size_t nodeId, const ApplyLanesStats& stats) RX_REQUIRES(!mtx_);
 	void Clear() noexcept RX_REQUIRES(!mtx_);
 	ReplicationStats Get() const RX_REQUIRES(!mtx_);
 
@@ -185,6 +232,7 @@ private:
 	std::atomic<int64_t> allocatedUpdatesSizeBytes_ = {0};
 	SyncStatsCounter walSyncs_;
 	SyncStatsCounter forceSyncs_;
+	SyncStatsCounter partialSyncs_;
 	SyncStatsCounter initialForceSyncs_;
 	SyncStatsCounter initialWalSyncs_;
 	std::atomic<size_t> initialSyncTotalTimeUs_ = {0};
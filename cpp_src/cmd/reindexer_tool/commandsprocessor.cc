@@ -1700,7 +1700,8 @@ void CommandsProcessor<DBInterface>::commandSelectSQL(std::string_view command)
 		output_() << "Aggregations: " << std::endl;
 		for (auto& agg : aggResults) {
 			switch (agg.GetType()) {
-				case AggFacet: {
+				case AggFacet:
+				case AggTopKApprox: {
 					const auto& fields = agg.GetFields();
 					assertrx(!fields.empty());
 					reindexer::h_vector<int, 1> maxW;
@@ -1757,12 +1758,20 @@ void CommandsProcessor<DBInterface>::commandSelectSQL(std::string_view command)
 					}
 					output_() << "Returned " << nRows << " values" << std::endl;
 				} break;
+				case AggPercentile:
+					assertrx(agg.GetFields().size() == 1);
+					for (const auto& p : agg.GetPercentiles()) {
+						output_() << reindexer::AggTypeToStr(agg.GetType()) << '(' << agg.GetFields().front() << ", " << p.rank
+								  << ") = " << p.value << std::endl;
+					}
+					break;
 				case AggSum:
 				case AggAvg:
 				case AggMin:
 				case AggMax:
 				case AggCount:
 				case AggCountCached:
+				case AggApproxCountDistinct:
 				case AggUnknown:
 					assertrx(agg.GetFields().size() == 1);
 					output_() << reindexer::AggTypeToStr(agg.GetType()) << '(' << agg.GetFields().front() << ") = " << agg.GetValueOrZero()
@@ -17,10 +17,15 @@ const std::string kBuiltinPrefix = "builtin://";
 namespace {
 
 StorageTypeOpt getOpt(StorageType type) {
-	if (type == StorageType::LevelDB) {
-		return kStorageTypeOptLevelDB;
+	switch (type) {
+		case StorageType::LevelDB:
+			return kStorageTypeOptLevelDB;
+		case StorageType::RocksDB:
+			return kStorageTypeOptRocksDB;
+		case StorageType::RocksDBShared:
+			return kStorageTypeOptRocksDBShared;
 	}
-	return kStorageTypeOptRocksDB;
+	return kStorageTypeOptLevelDB;
 }
 
 }  // namespace
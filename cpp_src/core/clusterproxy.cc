@@ -436,6 +436,11 @@ Error ClusterProxy::ApplySnapshotChunk(std::string_view nsName, const SnapshotCh
 	return impl_.ApplySnapshotChunk(nsName, ch, ctx);
 }
 
+Error ClusterProxy::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+										 std::vector<uint64_t>& hashes, const RdxContext& ctx) {
+	return impl_.GetDataHashTreeNodes(nsName, leavesCount, nodes, hashes, ctx);
+}
+
 Error ClusterProxy::SuggestLeader(const cluster::NodeData& suggestion, cluster::NodeData& response) {
 	return impl_.SuggestLeader(suggestion, response);
 }
@@ -60,6 +60,8 @@ public:
 	Error SetClusterOperationStatus(std::string_view nsName, const ClusterOperationStatus& status, const RdxContext& ctx);
 	bool NeedTraceActivity() const noexcept { return impl_.NeedTraceActivity(); }
 	Error ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch, const RdxContext& ctx);
+	Error GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+							   std::vector<uint64_t>& hashes, const RdxContext& ctx);
 
 	Error SuggestLeader(const cluster::NodeData& suggestion, cluster::NodeData& response);
 	Error LeadersPing(const cluster::NodeData& leader);
@@ -44,6 +44,41 @@ std::string_view cacheMode2str(CacheMode mode) {
 	}
 }
 
+CachePolicy str2cachePolicy(std::string_view policy) {
+	using namespace std::string_view_literals;
+	if (policy == "lru"sv || policy == ""sv) {
+		return CachePolicy::LRU;
+	}
+	if (policy == "w_tinylfu"sv) {
+		return CachePolicy::WTinyLFU;
+	}
+
+	throw Error(errParams, "Unknown cache policy {}", policy);
+}
+
+std::string_view cachePolicy2str(CachePolicy policy) {
+	using namespace std::string_view_literals;
+	switch (policy) {
+		case CachePolicy::LRU:
+			return "lru"sv;
+		case CachePolicy::WTinyLFU:
+			return "w_tinylfu"sv;
+		default:
+			throw Error(errParams, "Unknown cache policy {}", int(policy));
+	}
+}
+
+void readCachePolicy(std::string& errorString, const gason::JsonNode& node, std::string_view name, CachePolicy& policy) {
+	auto stringViewVal = cachePolicy2str(policy);
+	if (tryReadOptionalJsonValue(&errorString, node, name, stringViewVal).ok()) {
+		try {
+			policy = str2cachePolicy(stringViewVal);
+		} catch (Error& err) {
+			ensureEndsWith(errorString, "\n") += "errParams: " + err.whatStr();
+		}
+	}
+}
+
 int64_t correctMaxIterationsIdSetPreSelect(std::string_view nsName, int64_t maxIterationsIdSetPreSelect) {
 	auto res = maxIterationsIdSetPreSelect;
 	static constexpr int64_t minBound = joins::PreSelect::MaxIterationsForValuesOptimization + 1;
@@ -750,19 +785,32 @@ Error NamespaceConfigData::FromJSON(const gason::JsonNode& v) {
 	err = tryReadOptionalJsonValue(&errorString, v, "index_updates_counting_mode"sv, idxUpdatesCountingMode);
 	err = tryReadOptionalJsonValue(&errorString, v, "sync_storage_flush_limit"sv, syncStorageFlushLimit, 0);
 	err = tryReadOptionalJsonValue(&errorString, v, "ann_storage_cache_build_timeout_ms"sv, annStorageCacheBuildTimeout, 0);
+	err = tryReadOptionalJsonValue(&errorString, v, "items_image"sv, itemsImage);
+	err = tryReadOptionalJsonValue(&errorString, v, "max_select_parallelism"sv, maxSelectParallelism, 1, kMaxSelectParallelism);
+	err = tryReadOptionalJsonValue(&errorString, v, "min_parallel_scan_items"sv, minParallelScanItems, 0);
+	err = tryReadOptionalJsonValue(&errorString, v, "payloads_memory_limit"sv, payloadsMemoryLimit, 0);
 	(void)err;	// ignored; Errors will be handled with errorString
 
 	const auto cacheNode = v["cache"];
 	if (!cacheNode.isEmpty()) {
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "index_idset_cache_size"sv, cacheConfig.idxIdsetCacheSize, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "index_idset_hits_to_cache"sv, cacheConfig.idxIdsetHitsToCache, 0);
+		err = tryReadOptionalJsonValue(&errorString, cacheNode, "index_idset_cache_shards"sv, cacheConfig.idxIdsetCacheShards, 1,
+									   kMaxIdSetCacheShards);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "ft_index_cache_size"sv, cacheConfig.ftIdxCacheSize, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "ft_index_hits_to_cache"sv, cacheConfig.ftIdxHitsToCache, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "joins_preselect_cache_size"sv, cacheConfig.joinCacheSize, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "joins_preselect_hit_to_cache"sv, cacheConfig.joinHitsToCache, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "query_count_cache_size"sv, cacheConfig.queryCountCacheSize, 0);
 		err = tryReadOptionalJsonValue(&errorString, cacheNode, "query_count_hit_to_cache"sv, cacheConfig.queryCountHitsToCache, 0);
+		err = tryReadOptionalJsonValue(&errorString, cacheNode, "cold_payloads_cache_size"sv, cacheConfig.coldPayloadsCacheSize, 0);
+		err = tryReadOptionalJsonValue(&errorString, cacheNode, "cold_payloads_hit_to_cache"sv, cacheConfig.coldPayloadsHitsToCache, 0);
 		(void)err;	// ignored; Errors will be handled with errorString
+		readCachePolicy(errorString, cacheNode, "index_idset_cache_policy"sv, cacheConfig.idxIdsetCachePolicy);
+		readCachePolicy(errorString, cacheNode, "ft_index_cache_policy"sv, cacheConfig.ftIdxCachePolicy);
+		readCachePolicy(errorString, cacheNode, "joins_preselect_cache_policy"sv, cacheConfig.joinCachePolicy);
+		readCachePolicy(errorString, cacheNode, "query_count_cache_policy"sv, cacheConfig.queryCountCachePolicy);
+		readCachePolicy(errorString, cacheNode, "cold_payloads_cache_policy"sv, cacheConfig.coldPayloadsCachePolicy);
 	}
 
 	if (!errorString.empty()) {
@@ -792,16 +840,28 @@ void NamespaceConfigData::GetJSON(JsonBuilder& jb) const {
 	jb.Put("index_updates_counting_mode"sv, idxUpdatesCountingMode);
 	jb.Put("sync_storage_flush_limit"sv, syncStorageFlushLimit);
 	jb.Put("ann_storage_cache_build_timeout_ms"sv, annStorageCacheBuildTimeout);
+	jb.Put("items_image"sv, itemsImage);
+	jb.Put("max_select_parallelism"sv, maxSelectParallelism);
+	jb.Put("min_parallel_scan_items"sv, minParallelScanItems);
+	jb.Put("payloads_memory_limit"sv, payloadsMemoryLimit);
 
 	auto c = jb.Object("cache"sv);
 	c.Put("index_idset_cache_size"sv, cacheConfig.idxIdsetCacheSize);
 	c.Put("index_idset_hits_to_cache"sv, cacheConfig.idxIdsetHitsToCache);
+	c.Put("index_idset_cache_shards"sv, cacheConfig.idxIdsetCacheShards);
 	c.Put("ft_index_cache_size"sv, cacheConfig.ftIdxCacheSize);
 	c.Put("ft_index_hits_to_cache"sv, cacheConfig.ftIdxHitsToCache);
 	c.Put("joins_preselect_cache_size"sv, cacheConfig.joinCacheSize);
 	c.Put("joins_preselect_hit_to_cache"sv, cacheConfig.joinHitsToCache);
 	c.Put("query_count_cache_size"sv, cacheConfig.queryCountCacheSize);
 	c.Put("query_count_hit_to_cache"sv, cacheConfig.queryCountHitsToCache);
+	c.Put("cold_payloads_cache_size"sv, cacheConfig.coldPayloadsCacheSize);
+	c.Put("cold_payloads_hit_to_cache"sv, cacheConfig.coldPayloadsHitsToCache);
+	c.Put("index_idset_cache_policy"sv, cachePolicy2str(cacheConfig.idxIdsetCachePolicy));
+	c.Put("ft_index_cache_policy"sv, cachePolicy2str(cacheConfig.ftIdxCachePolicy));
+	c.Put("joins_preselect_cache_policy"sv, cachePolicy2str(cacheConfig.joinCachePolicy));
+	c.Put("query_count_cache_policy"sv, cachePolicy2str(cacheConfig.queryCountCachePolicy));
+	c.Put("cold_payloads_cache_policy"sv, cachePolicy2str(cacheConfig.coldPayloadsCachePolicy));
 	c.End();
 }
 
@@ -4,6 +4,7 @@
 #include <ostream>
 #include <string>
 #include "cluster/config.h"
+#include "core/enums.h"
 #include "core/namespace/namespacenamemap.h"
 #include "estl/fast_hash_map.h"
 #include "estl/shared_mutex.h"
@@ -80,27 +81,45 @@ public:
 
 constexpr size_t kDefaultCacheSizeLimit = 1024 * 1024 * 128;
 constexpr uint32_t kDefaultHitCountToCache = 2;
+constexpr uint32_t kDefaultIdSetCacheShards = 8;
+constexpr uint32_t kMaxIdSetCacheShards = 256;
+constexpr int kMaxSelectParallelism = 256;
 
 struct [[nodiscard]] NamespaceCacheConfigData {
 	bool IsIndexesCacheEqual(const NamespaceCacheConfigData& o) noexcept {
 		return idxIdsetCacheSize == o.idxIdsetCacheSize && idxIdsetHitsToCache == o.idxIdsetHitsToCache &&
-			   ftIdxCacheSize == o.ftIdxCacheSize && ftIdxHitsToCache == o.ftIdxHitsToCache;
+			   idxIdsetCachePolicy == o.idxIdsetCachePolicy && idxIdsetCacheShards == o.idxIdsetCacheShards &&
+			   ftIdxCacheSize == o.ftIdxCacheSize &&
+			   ftIdxHitsToCache == o.ftIdxHitsToCache && ftIdxCachePolicy == o.ftIdxCachePolicy;
 	}
 	bool IsJoinCacheEqual(const NamespaceCacheConfigData& o) noexcept {
-		return joinCacheSize == o.joinCacheSize && joinHitsToCache == o.joinHitsToCache;
+		return joinCacheSize == o.joinCacheSize && joinHitsToCache == o.joinHitsToCache && joinCachePolicy == o.joinCachePolicy;
 	}
 	bool IsQueryCountCacheEqual(const NamespaceCacheConfigData& o) noexcept {
-		return queryCountCacheSize == o.queryCountCacheSize && queryCountHitsToCache == o.queryCountHitsToCache;
+		return queryCountCacheSize == o.queryCountCacheSize && queryCountHitsToCache == o.queryCountHitsToCache &&
+			   queryCountCachePolicy == o.queryCountCachePolicy;
+	}
+	bool IsColdPayloadsCacheEqual(const NamespaceCacheConfigData& o) noexcept {
+		return coldPayloadsCacheSize == o.coldPayloadsCacheSize && coldPayloadsHitsToCache == o.coldPayloadsHitsToCache &&
+			   coldPayloadsCachePolicy == o.coldPayloadsCachePolicy;
 	}
 
 	uint64_t idxIdsetCacheSize = kDefaultCacheSizeLimit;
 	uint32_t idxIdsetHitsToCache = kDefaultHitCountToCache;
+	uint32_t idxIdsetCacheShards = kDefaultIdSetCacheShards;
 	uint64_t ftIdxCacheSize = kDefaultCacheSizeLimit;
 	uint32_t ftIdxHitsToCache = kDefaultHitCountToCache;
 	uint64_t joinCacheSize = 2 * kDefaultCacheSizeLimit;
 	uint32_t joinHitsToCache = kDefaultHitCountToCache;
 	uint64_t queryCountCacheSize = kDefaultCacheSizeLimit;
 	uint32_t queryCountHitsToCache = kDefaultHitCountToCache;
+	uint64_t coldPayloadsCacheSize = kDefaultCacheSizeLimit;
+	uint32_t coldPayloadsHitsToCache = 1;
+	CachePolicy idxIdsetCachePolicy = CachePolicy::LRU;
+	CachePolicy ftIdxCachePolicy = CachePolicy::LRU;
+	CachePolicy joinCachePolicy = CachePolicy::LRU;
+	CachePolicy queryCountCachePolicy = CachePolicy::LRU;
+	CachePolicy coldPayloadsCachePolicy = CachePolicy::LRU;
 };
 
 struct [[nodiscard]] NamespaceConfigData {
@@ -121,6 +140,10 @@ struct [[nodiscard]] NamespaceConfigData {
 	bool idxUpdatesCountingMode = false;
 	int syncStorageFlushLimit = 20'000;
 	int annStorageCacheBuildTimeout = 5'000;
+	bool itemsImage = false;
+	int maxSelectParallelism = 1;
+	int64_t minParallelScanItems = 100'000;
+	int64_t payloadsMemoryLimit = 0;  // Bytes of the resident items' tuples. 0 - eviction of the cold payloads is disabled
 	NamespaceCacheConfigData cacheConfig;
 
 	Error FromJSON(const gason::JsonNode& v);
@@ -48,6 +48,11 @@ constexpr std::string_view kConnectorPoolConnections{"connections"};
 constexpr std::string_view kConnectorPoolConnectTO{"connect_timeout_ms"};
 constexpr std::string_view kConnectorPoolReadTO{"read_timeout_ms"};
 constexpr std::string_view kConnectorPoolWriteTO{"write_timeout_ms"};
+constexpr std::string_view kBatching{"batching"};
+constexpr std::string_view kBatchingMaxItems{"max_items"};
+constexpr std::string_view kBatchingMaxDelay{"max_delay_ms"};
+constexpr size_t kBatchingMaxItemsLimit = 1024;
+constexpr size_t kBatchingMaxDelayLimit = 1000;
 
 FloatVectorIndexOpts::EmbedderOpts::Strategy parseStrategy(std::string_view strategy, std::string_view name) {
 	if (strategy == kEmbedderStrategyAlways) {
@@ -101,6 +106,17 @@ FloatVectorIndexOpts::PoolOpts parsePoolConfig(const gason::JsonNode& node) {
 	return opts;
 }
 
+FloatVectorIndexOpts::BatchingOpts parseBatchingConfig(const gason::JsonNode& node) {
+	FloatVectorIndexOpts::BatchingOpts opts;
+	if (!node[kBatchingMaxItems].isEmpty()) {
+		opts.max_items = node[kBatchingMaxItems].As<size_t>();
+	}
+	if (!node[kBatchingMaxDelay].isEmpty()) {
+		opts.max_delay_ms = node[kBatchingMaxDelay].As<size_t>();
+	}
+	return opts;
+}
+
 FloatVectorIndexOpts::EmbedderOpts parseEmbedderConfig(const gason::JsonNode& node, std::string_view name) {
 	FloatVectorIndexOpts::EmbedderOpts opts;
 	opts.endpointUrl = node[kEmbedderURL].As<std::string>();
@@ -128,6 +144,10 @@ FloatVectorIndexOpts::EmbedderOpts parseEmbedderConfig(const gason::JsonNode& no
 			auto strategy = node[kEmbedderStrategy].As<std::string_view>();
 			opts.strategy = parseStrategy(strategy, name);
 		}
+
+		if (!node[kBatching].isEmpty()) {
+			opts.batching = parseBatchingConfig(node[kBatching]);
+		}
 	}
 	if (!node[kConnectorPool].isEmpty()) {
 		const auto& poolConf = node[kConnectorPool];
@@ -193,6 +213,19 @@ void validateEmbedderOpts(const FloatVectorIndexOpts::EmbedderOpts& opts, std::s
 	validateEmbedderPollTMOpt(opts.pool.connect_timeout_ms, 100, name, kConnectorPoolConnectTO);
 	validateEmbedderPollTMOpt(opts.pool.read_timeout_ms, 500, name, kConnectorPoolReadTO);
 	validateEmbedderPollTMOpt(opts.pool.write_timeout_ms, 500, name, kConnectorPoolWriteTO);
+
+	if (opts.batching.max_items < 1 || opts.batching.max_items > kBatchingMaxItemsLimit) {
+		throw reindexer::Error{errParams,  "Configuration '{}:{}:{}:{}' should be in range [1, {}], in config '{}'",
+							   kEmbedding, name,
+							   kBatching,  kBatchingMaxItems,
+							   kBatchingMaxItemsLimit, opts.batching.max_items};
+	}
+	if (opts.batching.max_delay_ms > kBatchingMaxDelayLimit) {
+		throw reindexer::Error{errParams,  "Configuration '{}:{}:{}:{}' should not be more than {} ms, in config '{}'",
+							   kEmbedding, name,
+							   kBatching,  kBatchingMaxDelay,
+							   kBatchingMaxDelayLimit, opts.batching.max_delay_ms};
+	}
 }
 
 void getJsonEmbedderConfig(const FloatVectorIndexOpts::EmbedderOpts& opts, reindexer::builders::JsonBuilder& json) {
@@ -222,6 +255,12 @@ void getJsonEmbedderConfig(const FloatVectorIndexOpts::EmbedderOpts& opts, reind
 		objNodePool.Put(kConnectorPoolReadTO, pool.read_timeout_ms);
 		objNodePool.Put(kConnectorPoolWriteTO, pool.write_timeout_ms);
 	}
+
+	if (opts.batching != FloatVectorIndexOpts::BatchingOpts{}) {
+		auto objNodeBatching = json.Object(kBatching);
+		objNodeBatching.Put(kBatchingMaxItems, opts.batching.max_items);
+		objNodeBatching.Put(kBatchingMaxDelay, opts.batching.max_delay_ms);
+	}
 }
 
 }  // namespace
@@ -36,6 +36,13 @@ public:
 
 		bool operator==(const PoolOpts& o) const noexcept = default;
 	};
+	// Coalescing of the concurrent upsert embedding requests into the batched requests
+	struct [[nodiscard]] BatchingOpts {
+		size_t max_items{1};
+		size_t max_delay_ms{0};
+
+		bool operator==(const BatchingOpts& o) const noexcept = default;
+	};
 	struct [[nodiscard]] EmbedderOpts {
 		std::string endpointUrl;
 		std::string name;
@@ -43,6 +50,7 @@ public:
 		reindexer::h_vector<std::string, 1> fields;
 		enum class [[nodiscard]] Strategy : uint8_t { Always, EmptyOnly, Strict } strategy{Strategy::Always};
 		PoolOpts pool{};
+		BatchingOpts batching{};
 
 		bool operator==(const EmbedderOpts& o) const noexcept = default;
 	};
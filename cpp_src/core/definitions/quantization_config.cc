@@ -16,6 +16,14 @@ void QuantizationConfig::FromJSON(const gason::JsonNode& root) {
 
 	sampleSize = root["sample_size"].As<size_t>(kDefaultSampleSize);
 	quantizationThreshold = root["quantization_threshold"].As<size_t>(kDefaultQuantizationThreshold);
+	if (quantizationType == QuantizationType::ProductQuantization) {
+		pqSubquantizers = root["pq_subquantizers"].As<size_t>(0);
+		pqBits = root["pq_bits"].As<size_t>(kDefaultPQBits);
+		if (pqBits < kMinPQBits || pqBits > kMaxPQBits) {
+			throw reindexer::Error(errParams, "The pq_bits value must be within [{}; {}]", kMinPQBits, kMaxPQBits);
+		}
+		rerankFactor = root["rerank_factor"].As<size_t>(0);
+	}
 }
 
 void QuantizationConfig::GetJSON(reindexer::JsonBuilder&& builder) const {
@@ -26,6 +34,15 @@ void QuantizationConfig::GetJSON(reindexer::JsonBuilder&& builder) const {
 	}
 	builder.Put("sample_size"sv, sampleSize);
 	builder.Put("quantization_threshold"sv, quantizationThreshold);
+	if (quantizationType == QuantizationType::ProductQuantization) {
+		if (pqSubquantizers) {
+			builder.Put("pq_subquantizers"sv, pqSubquantizers);
+		}
+		builder.Put("pq_bits"sv, pqBits);
+		if (rerankFactor) {
+			builder.Put("rerank_factor"sv, rerankFactor);
+		}
+	}
 }
 
 void QuantizationConfig::Deserialize(IReader& reader) {
@@ -39,6 +56,11 @@ void QuantizationConfig::Deserialize(IReader& reader) {
 	}
 	sampleSize = reader.GetVarUInt();
 	quantizationThreshold = reader.GetVarUInt();
+	if (quantizationType == QuantizationType::ProductQuantization) {
+		pqSubquantizers = reader.GetVarUInt();
+		pqBits = reader.GetVarUInt();
+		rerankFactor = reader.GetVarUInt();
+	}
 }
 
 void QuantizationConfig::Serialize(IWriter& writer) const {
@@ -46,17 +68,38 @@ void QuantizationConfig::Serialize(IWriter& writer) const {
 	writer.PutFloat(quantile ? *quantile : 0.f);
 	writer.PutVarUInt(uint64_t{sampleSize});
 	writer.PutVarUInt(uint64_t{quantizationThreshold});
+	// Product quantization fields are written after the common ones to keep the format of the SQ8 configs unchanged
+	if (quantizationType == QuantizationType::ProductQuantization) {
+		writer.PutVarUInt(uint64_t{pqSubquantizers});
+		writer.PutVarUInt(uint64_t{pqBits});
+		writer.PutVarUInt(uint64_t{rerankFactor});
+	}
 }
 
 bool QuantizationConfig::operator==(const QuantizationConfig& o) const noexcept {
 	return quantizationType == o.quantizationType && quantile == o.quantile && sampleSize == o.sampleSize &&
-		   quantizationThreshold == o.quantizationThreshold;
+		   quantizationThreshold == o.quantizationThreshold && pqSubquantizers == o.pqSubquantizers && pqBits == o.pqBits &&
+		   rerankFactor == o.rerankFactor;
+}
+
+size_t QuantizationConfig::PQSubquantizers(size_t dim) const noexcept {
+	if (pqSubquantizers) {
+		return pqSubquantizers;
+	}
+	for (size_t m = std::max(dim / 4, size_t(1)); m > 1; --m) {
+		if (dim % m == 0) {
+			return m;
+		}
+	}
+	return 1;
 }
 
 std::string_view QuantizationConfig::encodeQuantizationType(QuantizationType quantizationType) {
 	switch (quantizationType) {
 		case QuantizationType::ScalarQuantization8bit:
 			return "scalar_quantization_8_bit";
+		case QuantizationType::ProductQuantization:
+			return "product_quantization";
 		default:
 			throw reindexer::Error(errParams, "Unsupported quantization type - {}", int(quantizationType));
 	}
@@ -65,6 +108,8 @@ std::string_view QuantizationConfig::encodeQuantizationType(QuantizationType qua
 QuantizationType QuantizationConfig::decodeQuantizationType(std::string_view quantizationType) {
 	if (quantizationType == "scalar_quantization_8_bit") {
 		return QuantizationType::ScalarQuantization8bit;
+	} else if (quantizationType == "product_quantization") {
+		return QuantizationType::ProductQuantization;
 	} else {
 		throw reindexer::Error(errParams, "Unsupported quantization type - {}", quantizationType);
 	}
@@ -13,9 +13,12 @@ class JsonBuilder;
 
 namespace hnswlib {
 
-enum class [[nodiscard]] QuantizationType { ScalarQuantization8bit };
+enum class [[nodiscard]] QuantizationType { ScalarQuantization8bit, ProductQuantization };
 static constexpr size_t kDefaultSampleSize = 20'000;
 static constexpr size_t kDefaultQuantizationThreshold = 100'000;
+static constexpr size_t kDefaultPQBits = 8;
+static constexpr size_t kMinPQBits = 4;
+static constexpr size_t kMaxPQBits = 16;
 
 class IReader;
 class IWriter;
@@ -29,11 +32,19 @@ struct [[nodiscard]] QuantizationConfig {
 
 	bool operator==(const QuantizationConfig& o) const noexcept;
 
+	// Subquantizers count for the product quantization. Explicit value or the largest divisor of the dimension not greater than dim/4
+	size_t PQSubquantizers(size_t dim) const noexcept;
+
 	QuantizationType quantizationType = QuantizationType::ScalarQuantization8bit;
 	std::optional<float> quantile;
 	size_t sampleSize = kDefaultSampleSize;
 	size_t quantizationThreshold = kDefaultQuantizationThreshold;
 
+	// Product quantization only
+	size_t pqSubquantizers = 0;	 // 0 - choose automatically
+	size_t pqBits = kDefaultPQBits;
+	size_t rerankFactor = 0;  // Re-rank k * rerankFactor PQ candidates by the original vectors. 0 or 1 - disabled
+
 private:
 	static std::string_view encodeQuantizationType(QuantizationType quantizationType);
 	static QuantizationType decodeQuantizationType(std::string_view quantizationType);
@@ -54,15 +54,27 @@ constexpr std::string_view kDefNamespacesConfig = R"json({
 				"index_updates_counting_mode":false,
 				"sync_storage_flush_limit":20000,
 				"ann_storage_cache_build_timeout_ms": 5000,
+				"items_image":false,
+				"max_select_parallelism":1,
+				"min_parallel_scan_items":100000,
+				"payloads_memory_limit":0,
 				"cache":{
 					"index_idset_cache_size":134217728,
 					"index_idset_hits_to_cache":2,
+					"index_idset_cache_shards":8,
 					"ft_index_cache_size":134217728,
 					"ft_index_hits_to_cache":2,
 					"joins_preselect_cache_size":268435456,
 					"joins_preselect_hit_to_cache":2,
 					"query_count_cache_size":134217728,
-					"query_count_hit_to_cache":2
+					"query_count_hit_to_cache":2,
+					"cold_payloads_cache_size":134217728,
+					"cold_payloads_hit_to_cache":1,
+					"index_idset_cache_policy":"lru",
+					"ft_index_cache_policy":"lru",
+					"joins_preselect_cache_policy":"lru",
+					"query_count_cache_policy":"lru",
+					"cold_payloads_cache_policy":"lru"
 				}
 			}
 		]
@@ -87,10 +99,14 @@ constexpr std::string_view kDefAsyncReplicationConfig = R"json({
 			"sync_timeout_sec":60,
 			"online_updates_timeout_sec":20,
 			"enable_compression":true,
+			"compression_codec":"snappy",
+			"zstd_compression_level":3,
+			"zstd_dict_size":16384,
 			"force_sync_on_logic_error": false,
 			"force_sync_on_wrong_data_hash": false,
 			"retry_sync_interval_msec":30000,
 			"batching_routines_count":100,
+			"apply_lanes_count":1,
 			"max_wal_depth_on_force_sync":1000,
 			"online_updates_delay_msec":100,
 			"self_replication_token": "",
@@ -62,10 +62,18 @@ EmbedderPerfStat EmbedderBase::GetPerfStat(std::string_view tag) const {
 	if (cache_ && !tag.empty()) {
 		stat.cacheStat = cache_->GetPerfStat(tag);
 	}
+	if (dispatcher_) {
+		stat.batching = dispatcher_->GetPerfStat();
+	}
 	return stat;
 }
 
-void EmbedderBase::ResetPerfStat() const noexcept { statistic_.Reset(); }
+void EmbedderBase::ResetPerfStat() const noexcept {
+	statistic_.Reset();
+	if (dispatcher_) {
+		dispatcher_->ResetPerfStat();
+	}
+}
 
 void EmbedderBase::Statistic::Reset() {
 	embedderTimes.Reset();
@@ -104,6 +112,24 @@ void EmbedderBase::calculate(const RdxContext& ctx, const embedding::Adapter& sr
 		}
 	}
 	PerfStatCalculatorMT embedderTimesCacheMissCalculator(statistic_.embedderTimesCacheMiss, tmStart, enablePerfStat);
+	if (dispatcher_) {
+		dispatcher_->Calculate(ctx, srcAdapter, enablePerfStat, products);
+		return;
+	}
+
+	const auto content = send(ctx, srcAdapter.Content(), enablePerfStat);
+	logFmt(LogTrace, "Embedding data: {}", content);
+	auto error = embedding::Adapter::VectorsFromJSON(content, products);
+	if (!error.ok()) {
+		throw error;
+	}
+
+	if (cache_) {
+		cache_->Put(config_.tag, srcAdapter, products);
+	}
+}
+
+std::string EmbedderBase::send(const RdxContext& ctx, chunk&& content, bool enablePerfStat) const {
 	PerfStatCalculatorMT connectionAwaitCalculator(statistic_.connectionAwait, enablePerfStat);
 	auto res = pool_->GetConnector(ctx);
 	if (!res.first.ok()) {
@@ -113,7 +139,7 @@ void EmbedderBase::calculate(const RdxContext& ctx, const embedding::Adapter& sr
 		connectionAwaitCalculator.HitManualy();
 		statistic_.avgConnInUse.Hit(pool_->ConnectionInUse());
 	}
-	auto response = (*res.second).Send(serverPath_, srcAdapter.Content());
+	auto response = (*res.second).Send(serverPath_, std::move(content));
 
 	if (enablePerfStat) {
 		statistic_.totalReadBytes.fetch_add(response.read_bytes, std::memory_order_relaxed);
@@ -122,21 +148,16 @@ void EmbedderBase::calculate(const RdxContext& ctx, const embedding::Adapter& sr
 	if (!response.ok) {
 		throw Error{errNetwork, "Failed to get embedding for '{}'. Problem with client: {}", fieldName_, response.content};
 	}
-
-	logFmt(LogTrace, "Embedding data: {}", response.content);
-	auto error = embedding::Adapter::VectorsFromJSON(response.content, products);
-	if (!error.ok()) {
-		throw error;
-	}
-
-	if (cache_) {
-		cache_->Put(config_.tag, srcAdapter, products);
-	}
+	return std::move(response.content);
 }
 
 UpsertEmbedder::UpsertEmbedder(std::string_view name, std::string_view fieldName, EmbedderConfig&& config, PoolConfig&& poolConfig,
 							   const std::shared_ptr<EmbeddersCache>& cache, bool enablePerfStat)
-	: EmbedderBase(name, kFormatJson, fieldName, std::move(config), std::move(poolConfig), cache), enablePerfStat_(enablePerfStat) {}
+	: EmbedderBase(name, kFormatJson, fieldName, std::move(config), std::move(poolConfig), cache), enablePerfStat_(enablePerfStat) {
+	if (config_.batching.Enabled()) {
+		dispatcher_ = std::make_unique<EmbeddingDispatcher>(*this, config_.batching);
+	}
+}
 
 bool UpsertEmbedder::IsAuxiliaryField(std::string_view fieldName) const noexcept {
 	return std::ranges::find(config_.fields, fieldName) != config_.fields.end();
@@ -5,6 +5,7 @@
 #include "core/embedding/connectorpool.h"
 #include "core/embedding/embedderscache.h"
 #include "core/embedding/embeddingconfig.h"
+#include "core/embedding/embeddingdispatcher.h"
 #include "core/keyvalue/variant.h"
 #include "core/perfstatcounter.h"
 #include "estl/h_vector.h"
@@ -42,6 +43,10 @@ protected:
 
 	void calculate(const RdxContext& ctx, const embedding::Adapter& srcAdapter, system_clock_w::time_point tmStart, bool enablePerfStat,
 				   embedding::ValueT& products) const;
+	// Sends the request to the embedding service and returns the response content
+	std::string send(const RdxContext& ctx, chunk&& content, bool enablePerfStat) const;
+
+	friend EmbeddingDispatcher;
 
 	const std::string name_;
 	const std::string fieldName_;
@@ -49,6 +54,8 @@ protected:
 	const std::shared_ptr<EmbeddersCache> cache_;
 	const EmbedderConfig config_;
 	std::unique_ptr<ConnectorPool> pool_;
+	// Coalesces concurrent requests into the batches. Not set, if batching is disabled
+	std::unique_ptr<EmbeddingDispatcher> dispatcher_;
 
 	class [[nodiscard]] LastError {
 	public:
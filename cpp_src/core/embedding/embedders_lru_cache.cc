@@ -251,8 +251,10 @@ EmbeddersCacheMemStat EmbeddersLRUCache::GetMemStat() const {
 }
 
 LRUCachePerfStat EmbeddersLRUCache::GetPerfStat() const {
-	LRUCachePerfStat stats{
-		.state = IsActive() ? LRUCachePerfStat::State::Active : LRUCachePerfStat::State::Inactive, .hits = hits_, .misses = misses_};
+	LRUCachePerfStat stats{.state = IsActive() ? LRUCachePerfStat::State::Active : LRUCachePerfStat::State::Inactive,
+						   .hits = hits_,
+						   .misses = misses_,
+						   .regions = std::nullopt};
 	return stats;
 }
 
@@ -44,7 +44,33 @@ Error Adapter::VectorsFromJSON(const StrorageKeyT& json, ValueT& result) noexcep
 	return {};
 }
 
-Adapter::Adapter(const BaseKeyT& source) {
+Error Adapter::VectorsFromJSON(const StrorageKeyT& json, std::span<ValueT> results) noexcept {
+	try {
+		assertrx_dbg(!json.empty());
+
+		gason::JsonParser parser;
+		auto root = parser.Parse(json);
+		size_t count = 0;
+		for (auto products : root[kResultDataName]) {
+			if (count < results.size()) {
+				results[count].resize(0);
+				productsFromJSON(products, results[count]);
+			}
+			++count;
+		}
+		if (count != results.size()) {
+			return {errParseJson, "Embed source adapter got {} products in the batched response, but {} was expected", count,
+					results.size()};
+		}
+	} catch (const std::exception& e) {
+		return {errParseJson, "Embed source adapter can't parse vectors batch '{}': {}", json, e.what()};
+	} catch (...) {
+		return {errParseJson, "Embed source adapter can't parse vectors batch '{}'", json};
+	}
+	return {};
+}
+
+Adapter::Adapter(const BaseKeyT& source) : docsCount_{1} {
 	WrSerializer ser;
 	{  // [text0]
 		JsonBuilder json{ser, ObjType::TypePlain};
@@ -53,7 +79,7 @@ Adapter::Adapter(const BaseKeyT& source) {
 	view_ = std::string{ser.Slice()};
 }
 
-Adapter::Adapter(std::span<const std::vector<std::pair<std::string, VariantArray>>> sources) {
+Adapter::Adapter(std::span<const std::vector<std::pair<std::string, VariantArray>>> sources) : docsCount_{sources.size()} {
 	WrSerializer ser;
 	{  // {'fld0':text,'fld1':[Val0,Val1,...],...}
 		JsonBuilder json{ser, ObjType::TypePlain};
@@ -75,6 +101,21 @@ Adapter::Adapter(std::span<const std::vector<std::pair<std::string, VariantArray
 	view_ = std::string{ser.Slice()};
 }
 
+Adapter::Adapter(std::span<const Adapter* const> batch) {
+	size_t size = 0;
+	for (const auto* adapter : batch) {
+		size += adapter->View().size() + 1;
+	}
+	view_.reserve(size);
+	for (const auto* adapter : batch) {
+		if (!view_.empty()) {
+			view_.push_back(',');
+		}
+		view_.append(adapter->View());
+		docsCount_ += adapter->DocsCount();
+	}
+}
+
 chunk Adapter::Content() const {
 	WrSerializer ser;
 	{  // {'data':[*view_*]}
@@ -86,17 +127,21 @@ chunk Adapter::Content() const {
 }
 
 void Adapter::vectorsFromJSON(const gason::JsonNode& root, ValueT& result) {
+	for (auto products : root[kResultDataName]) {
+		productsFromJSON(products, result);
+	}
+}
+
+void Adapter::productsFromJSON(const gason::JsonNode& products, ValueT& result) {
 	using namespace std::string_view_literals;
 	static thread_local std::vector<float> values(kProductDimension);
-	for (auto products : root[kResultDataName]) {
-		for (auto product : products) {
-			values.resize(0);
-			// auto chunk = product["chunk"sv].As<std::string>();
-			for (auto val : product["embedding"sv]) {
-				values.emplace_back(val.As<double>());
-			}
-			result.emplace_back(values);
+	for (auto product : products) {
+		values.resize(0);
+		// auto chunk = product["chunk"sv].As<std::string>();
+		for (auto val : product["embedding"sv]) {
+			values.emplace_back(val.As<double>());
 		}
+		result.emplace_back(values);
 	}
 }
 
@@ -23,17 +23,24 @@ using BaseKeyT = std::string;
 class [[nodiscard]] Adapter final {
 public:
 	static Error VectorsFromJSON(const StrorageKeyT& json, ValueT& result) noexcept;
+	// Splits the products of the batched request: one value per requested document
+	static Error VectorsFromJSON(const StrorageKeyT& json, std::span<ValueT> results) noexcept;
 
 	explicit Adapter(const BaseKeyT& source);
 	explicit Adapter(std::span<const std::vector<std::pair<std::string, VariantArray>>> sources);
+	// Joins the documents of several adapters into the single batched request
+	explicit Adapter(std::span<const Adapter* const> batch);
 	const StrorageKeyT& View() const& noexcept { return view_; }
 	auto View() const&& = delete;
+	size_t DocsCount() const noexcept { return docsCount_; }
 	chunk Content() const;
 
 private:
 	static void vectorsFromJSON(const gason::JsonNode& root, ValueT& result);
+	static void productsFromJSON(const gason::JsonNode& products, ValueT& result);
 
 	StrorageKeyT view_;
+	size_t docsCount_{0};
 };
 }  // namespace embedding
 
@@ -46,10 +46,18 @@ struct [[nodiscard]] CacheTagLess {
 	bool operator()(const CacheTag& lhs, const CacheTag& rhs) const noexcept { return lhs.Tag() < rhs.Tag(); }
 };
 
+struct [[nodiscard]] BatchingConfig {
+	size_t maxItems{1};
+	size_t maxDelayMs{0};
+	bool Enabled() const noexcept { return maxItems > 1; }
+	bool operator==(const BatchingConfig& other) const noexcept = default;
+};
+
 struct [[nodiscard]] EmbedderConfig {
 	CacheTag tag;
 	reindexer::h_vector<std::string, 1> fields;
 	enum class [[nodiscard]] Strategy { Always, EmptyOnly, Strict } strategy{Strategy::Always};
+	BatchingConfig batching{};
 	bool operator==(const EmbedderConfig& other) const noexcept = default;
 };
 
@@ -0,0 +1,186 @@
+#include "embeddingdispatcher.h"
+
+#include <algorithm>
+#include "core/embedding/embedder.h"
+#include "core/namespace/namespacestat.h"
+#include "core/rdxcontext.h"
+#include "estl/chunk.h"
+#include "estl/fast_hash_map.h"
+#include "estl/lock.h"
+#include "tools/logger.h"
+
+namespace reindexer {
+
+namespace {
+constexpr auto kCancelCheckPeriod = std::chrono::milliseconds(50);
+}  // namespace
+
+void EmbeddingDispatcher::Calculate(const RdxContext& ctx, const embedding::Adapter& srcAdapter, bool enablePerfStat,
+									embedding::ValueT& products) {
+	auto request = std::make_shared<Request>(srcAdapter);
+	unique_lock lck(mtx_);
+	pending_.emplace_back(request);
+	if (collecting_ && pending_.size() >= config_.maxItems) {
+		cond_.notify_all();
+	}
+
+	// Waiting for the products or for the opportunity to become the leader of the next batch
+	const auto ready = [&]() RX_REQUIRES(mtx_) { return request->done || (!collecting_ && !request->taken); };
+	while (!ready()) {
+		if (cond_.wait_for(lck, kCancelCheckPeriod, ready)) {
+			break;
+		}
+		if (ctx.IsCancelable() && ctx.CheckCancel() != CancelType::None) {
+			// Request, which was already taken into the batch, will be dropped by the leader
+			if (!request->taken) {
+				pending_.erase(std::find(pending_.begin(), pending_.end(), request));
+			}
+			lck.unlock();
+			ThrowOnCancel(ctx, "Context was canceled or timed out (embedding batch awaiting)");
+		}
+	}
+
+	if (!request->done) {
+		// This writer is the leader of the batch now
+		collecting_ = true;
+		if (config_.maxDelayMs && pending_.size() < config_.maxItems) {
+			std::ignore = cond_.wait_for(lck, std::chrono::milliseconds(config_.maxDelayMs),
+										 [this]() RX_REQUIRES(mtx_) { return pending_.size() >= config_.maxItems; });
+		}
+
+		// Leader's request goes first, the others are sent in the order of arrival
+		std::vector<RequestPtr> batch;
+		batch.reserve(std::min(pending_.size(), config_.maxItems));
+		batch.emplace_back(request);
+		for (const auto& r : pending_) {
+			if (batch.size() >= config_.maxItems) {
+				break;
+			}
+			if (r != request) {
+				batch.emplace_back(r);
+			}
+		}
+		for (auto& r : batch) {
+			r->taken = true;
+		}
+		std::erase_if(pending_, [](const RequestPtr& r) { return r->taken; });
+		collecting_ = false;
+		lck.unlock();
+		// Next batch may be collected, while this one is being sent
+		cond_.notify_all();
+
+		sendBatch(batch, enablePerfStat);
+
+		lck.lock();
+		for (auto& r : batch) {
+			r->done = true;
+		}
+		lck.unlock();
+		cond_.notify_all();
+	} else {
+		lck.unlock();
+	}
+
+	if (!request->err.ok()) {
+		throw request->err;
+	}
+	products = std::move(request->products);
+}
+
+void EmbeddingDispatcher::sendBatch(std::vector<RequestPtr>& batch, bool enablePerfStat) const noexcept {
+	const auto tmStart = enablePerfStat ? system_clock_w::now() : system_clock_w::time_point{};
+	try {
+		// Identical documents are sent once
+		h_vector<const embedding::Adapter*, 16> unique;
+		h_vector<size_t, 16> uniqueIdx;
+		fast_hash_map<std::string_view, size_t> positions;
+		for (const auto& r : batch) {
+			auto [it, inserted] = positions.try_emplace(std::string_view(r->src.View()), unique.size());
+			if (inserted) {
+				unique.emplace_back(&r->src);
+			}
+			uniqueIdx.emplace_back(it->second);
+		}
+
+		const embedding::Adapter batchAdapter(std::span<const embedding::Adapter* const>(unique.data(), unique.size()));
+		// Batch is sent on behalf of all of the writers, so it is not canceled by the leader's context
+		const auto content = embedder_.send(RdxContext(), batchAdapter.Content(), enablePerfStat);
+		logFmt(LogTrace, "Embedding batch data: {}", content);
+		std::vector<embedding::ValueT> results(batchAdapter.DocsCount());
+		if (auto err = embedding::Adapter::VectorsFromJSON(content, results); !err.ok()) {
+			throw err;
+		}
+
+		h_vector<size_t, 16> offsets;
+		for (size_t offset = 0; const auto* adapter : unique) {
+			offsets.emplace_back(offset);
+			offset += adapter->DocsCount();
+		}
+		std::vector<bool> cached(unique.size(), false);
+		for (size_t i = 0; i < batch.size(); ++i) {
+			auto& r = *batch[i];
+			const auto u = uniqueIdx[i];
+			r.products.resize(0);
+			for (size_t doc = offsets[u], end = offsets[u] + unique[u]->DocsCount(); doc < end; ++doc) {
+				for (const auto& product : results[doc]) {
+					r.products.emplace_back(product);
+				}
+			}
+			if (embedder_.cache_ && !cached[u]) {
+				cached[u] = true;
+				embedder_.cache_->Put(embedder_.config_.tag, r.src, r.products);
+			}
+		}
+
+		if (enablePerfStat) {
+			const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(system_clock_w::now() - tmStart);
+			statistic_.batchTimes.Hit(latency);
+			statistic_.batchLatenciesUs.Hit(latency.count());
+			statistic_.avgBatchSize.Hit(batchAdapter.DocsCount());
+			statistic_.batchSizes.Hit(batchAdapter.DocsCount());
+			statistic_.totalBatchedDocumentsCount.fetch_add(batchAdapter.DocsCount(), std::memory_order_relaxed);
+			statistic_.totalDeduplicatedDocumentsCount.fetch_add(batch.size() - unique.size(), std::memory_order_relaxed);
+		}
+	} catch (const std::exception& e) {
+		const Error err(e);
+		for (auto& r : batch) {
+			r->err = err;
+		}
+	} catch (...) {
+		const Error err(errLogic, "Unexpected error during embedding batch sending");
+		for (auto& r : batch) {
+			r->err = err;
+		}
+	}
+}
+
+EmbedderBatchingPerfStat EmbeddingDispatcher::GetPerfStat() const {
+	EmbedderBatchingPerfStat stat;
+	const PerfStat batchTimes = statistic_.batchTimes.Get<PerfStat>();
+	const float avgBatchSize = statistic_.avgBatchSize.Get();
+
+	stat.totalBatchesCount = batchTimes.totalHitCount;
+	stat.totalBatchedDocumentsCount = statistic_.totalBatchedDocumentsCount.load(std::memory_order_relaxed);
+	stat.totalDeduplicatedDocumentsCount = statistic_.totalDeduplicatedDocumentsCount.load(std::memory_order_relaxed);
+	stat.lastSecBatches = batchTimes.lastSecHitCount;
+	stat.lastSecBatchedDps = static_cast<unsigned int>(batchTimes.lastSecHitCount * avgBatchSize);
+	stat.lastSecAvgBatchSize = static_cast<unsigned int>(avgBatchSize);
+	stat.totalAvgBatchLatencyUs = batchTimes.totalAvgTimeUs;
+	stat.lastSecAvgBatchLatencyUs = batchTimes.lastSecAvgTimeUs;
+	stat.batchSizeHistogram = statistic_.batchSizes.Get<std::vector<HistogramBucketStat>>();
+	stat.batchLatencyHistogramUs = statistic_.batchLatenciesUs.Get<std::vector<HistogramBucketStat>>();
+	return stat;
+}
+
+void EmbeddingDispatcher::ResetPerfStat() const noexcept { statistic_.Reset(); }
+
+void EmbeddingDispatcher::Statistic::Reset() noexcept {
+	batchTimes.Reset();
+	avgBatchSize.Reset();
+	batchSizes.Reset();
+	batchLatenciesUs.Reset();
+	totalBatchedDocumentsCount.store(0, std::memory_order_relaxed);
+	totalDeduplicatedDocumentsCount.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace reindexer
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "core/embedding/embedderscache.h"
+#include "core/embedding/embeddingconfig.h"
+#include "core/perfstatcounter.h"
+#include "estl/condition_variable.h"
+#include "estl/mutex.h"
+#include "estl/thread_annotation_attributes.h"
+#include "tools/errors.h"
+
+namespace reindexer {
+
+class EmbedderBase;
+class RdxContext;
+struct EmbedderBatchingPerfStat;
+
+/// Coalesces concurrent embedding requests of the single upsert embedder into the batched requests to the embedding service.
+/// The first waiting writer becomes the leader of the batch: it collects the documents of the other writers for up to 'max_delay_ms'
+/// or until 'max_items' documents are pending, sends them as one request and fans the products back to the waiters.
+/// Identical documents of the batch are sent once. Cache lookups are done by the writers before the enqueueing.
+class [[nodiscard]] EmbeddingDispatcher final {
+public:
+	EmbeddingDispatcher(const EmbedderBase& embedder, const BatchingConfig& config) noexcept : embedder_{embedder}, config_{config} {}
+	EmbeddingDispatcher(const EmbeddingDispatcher&) = delete;
+	EmbeddingDispatcher(EmbeddingDispatcher&&) noexcept = delete;
+	EmbeddingDispatcher& operator=(const EmbeddingDispatcher&) = delete;
+	EmbeddingDispatcher& operator=(EmbeddingDispatcher&&) noexcept = delete;
+
+	void Calculate(const RdxContext& ctx, const embedding::Adapter& srcAdapter, bool enablePerfStat, embedding::ValueT& products)
+		RX_REQUIRES(!mtx_);
+
+	EmbedderBatchingPerfStat GetPerfStat() const;
+	void ResetPerfStat() const noexcept;
+
+private:
+	struct [[nodiscard]] Request {
+		explicit Request(const embedding::Adapter& s) : src{s} {}
+
+		// Copy of the source: canceled writer may leave, while its request is being sent
+		const embedding::Adapter src;
+		embedding::ValueT products;
+		Error err;
+		bool taken = false;
+		bool done = false;
+	};
+	using RequestPtr = std::shared_ptr<Request>;
+
+	void sendBatch(std::vector<RequestPtr>& batch, bool enablePerfStat) const noexcept;
+
+	const EmbedderBase& embedder_;
+	const BatchingConfig config_;
+
+	mutex mtx_;
+	condition_variable cond_;
+	std::vector<RequestPtr> pending_ RX_GUARDED_BY(mtx_);
+	bool collecting_ RX_GUARDED_BY(mtx_) = false;
+
+	// Batch size is limited by 1024 items, so the last bucket is always empty
+	static constexpr size_t kBatchSizeBuckets = 12;
+	// Latencies up to ~4 seconds
+	static constexpr size_t kBatchLatencyBuckets = 24;
+	struct [[nodiscard]] Statistic {
+		void Reset() noexcept;
+		PerfStatCounterMT batchTimes;
+		PerfStatCounterCountAvgMT avgBatchSize;
+		PerfStatHistogram<kBatchSizeBuckets> batchSizes;
+		PerfStatHistogram<kBatchLatencyBuckets> batchLatenciesUs;
+		std::atomic<uint64_t> totalBatchedDocumentsCount{0};
+		std::atomic<uint64_t> totalDeduplicatedDocumentsCount{0};
+	};
+	mutable Statistic statistic_;
+};
+
+}  // namespace reindexer
@@ -102,6 +102,7 @@ enum class [[nodiscard]] VectorMetric { L2, InnerProduct, Cosine };
 enum class [[nodiscard]] QueryRankType { NotSet, No, FullText, KnnL2, KnnIP, KnnCos, Hybrid };
 enum class [[nodiscard]] RankSortType : unsigned { RankOnly, RankAndID, ExternalExpression, IDOnly, IDAndPositions };
 enum class [[nodiscard]] RankOrdering { Off, Asc, Desc };
+enum class [[nodiscard]] CachePolicy { LRU, WTinyLFU };
 
 class [[nodiscard]] FloatVectorDimension {
 public:
@@ -0,0 +1,94 @@
+#include "blockidrelvec.h"
+#include <algorithm>
+#include <numeric>
+#include "streamvbyte.h"
+
+namespace reindexer {
+
+BlockPackedIdRelVec::iterator::iterator(const BlockPackedIdRelVec* pv, size_type idx) : pv_(pv), idx_(idx) {
+	if (idx_ >= pv_->size()) {
+		return;
+	}
+	const auto& blocks = pv_->blocks_;
+	const auto it = std::upper_bound(blocks.begin(), blocks.end(), idx_, [](size_type i, const Block& b) noexcept { return i < b.firstIdx; });
+	assertrx_dbg(it != blocks.begin());
+	loadBlock((it - blocks.begin()) - 1);
+	for (size_type i = blocks[block_].firstIdx; i < idx_; ++i) {
+		posOffset_ += counts_[inBlock_++];
+	}
+}
+
+void BlockPackedIdRelVec::iterator::SkipTo(VDocIdType target) {
+	if (idx_ >= pv_->size() || Id() >= target) {
+		return;
+	}
+	const auto& blocks = pv_->blocks_;
+	if (blocks[block_].lastId < target) {
+		const auto it = std::lower_bound(blocks.begin() + block_ + 1, blocks.end(), target,
+										 [](const Block& b, VDocIdType id) noexcept { return b.lastId < id; });
+		unpacked_ = false;
+		if (it == blocks.end()) {
+			idx_ = pv_->size();
+			return;
+		}
+		loadBlock(it - blocks.begin());
+		idx_ = it->firstIdx;
+	}
+	while (Id() < target) {
+		operator++();
+	}
+}
+
+void BlockPackedIdRelVec::iterator::loadBlock(size_t block) {
+	block_ = block;
+	inBlock_ = 0;
+	posOffset_ = 0;
+	size_t offset = pv_->decodeIds(block, ids_);
+	const auto& data = pv_->data_;
+	counts_.resize(ids_.size());
+	offset += StreamVByteDecode(data.data() + offset, data.size() - offset, counts_.size(), counts_.data());
+	values_.resize(std::accumulate(counts_.begin(), counts_.end(), size_t(0)));
+	std::ignore = StreamVByteDecode(data.data() + offset, data.size() - offset, values_.size(), values_.data());
+}
+
+size_t BlockPackedIdRelVec::decodeIds(size_t block, std::vector<uint32_t>& ids) const {
+	const Block& b = blocks_[block];
+	ids.resize(blockSize(block));
+	const size_t offset = b.offset + StreamVByteDecode(data_.data() + b.offset, data_.size() - b.offset, ids.size(), ids.data());
+	DeltaDecode(ids.data(), ids.size(), b.firstId);
+	assertrx_dbg(ids.back() == b.lastId);
+	return offset;
+}
+
+void BlockPackedIdRelVec::appendBlock(VDocIdType firstId, VDocIdType lastId, size_type firstIdx, const std::vector<uint32_t>& ids,
+									  const std::vector<uint32_t>& counts, const std::vector<uint32_t>& values) {
+	const size_t offset = data_.size();
+	data_.resize(offset + StreamVByteMaxEncodedSize(ids.size()) + StreamVByteMaxEncodedSize(counts.size()) +
+				 StreamVByteMaxEncodedSize(values.size()));
+	size_t p = offset;
+	p += StreamVByteEncode(ids.data(), ids.size(), data_.data() + p);
+	p += StreamVByteEncode(counts.data(), counts.size(), data_.data() + p);
+	p += StreamVByteEncode(values.data(), values.size(), data_.data() + p);
+	data_.resize(p);
+	blocks_.emplace_back(Block{.firstId = firstId, .lastId = lastId, .firstIdx = firstIdx, .offset = offset});
+}
+
+size_t BlockPackedIdRelVec::varint_size() const {
+	size_t res = 0;
+	VDocIdType lastId = 0;
+	unsigned lastField = 0;
+	bool arrayFound = false;
+	h_vector<uint8_t, 256> buf;
+	for (auto it = begin(); it != end(); ++it) {
+		const IdRelType& relid = *it;
+		arrayFound = arrayFound || relid.ArrayDataFound();
+		buf.resize(relid.maxpackedsize());
+		res += arrayFound ? relid.pack(buf.data(), lastId, lastField) : relid.packWithoutArrayIdxs(buf.data(), lastId, lastField);
+		lastId = relid.Id();
+		assertrx_dbg(relid.Pos().size() > 0);
+		lastField = relid.Pos()[0].field();
+	}
+	return res;
+}
+
+}  // namespace reindexer
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <vector>
+#include "idrelset.h"
+
+namespace reindexer {
+
+// Posting list, which is split into the blocks of up to kBlockSize documents. Ids (as deltas), numbers of the position values and
+// the position values of each block are stored in the separate Stream VByte sections, so the whole block is decoded by the SIMD kernels
+// at once. The first and the last ids of the blocks are kept uncompressed and are used as skip pointers.
+// The blocks never cross the borders of insert_back() calls, so the last commit step may be erased without re-encoding
+class [[nodiscard]] BlockPackedIdRelVec {
+public:
+	typedef IdRelType value_type;
+	typedef unsigned size_type;
+	typedef IdRelType* pointer;
+	typedef IdRelType& reference;
+	typedef const IdRelType* const_pointer;
+	typedef const IdRelType& const_reference;
+
+	static constexpr size_t kBlockSize = 128;
+
+	struct [[nodiscard]] state {
+		size_type size = 0;
+	};
+
+	class [[nodiscard]] iterator {
+	public:
+		iterator(const BlockPackedIdRelVec* pv, size_type idx);
+
+		iterator& operator++() {
+			++idx_;
+			if (idx_ < pv_->size()) {
+				posOffset_ += counts_[inBlock_];
+				if (++inBlock_ == ids_.size()) {
+					loadBlock(block_ + 1);
+				}
+			}
+			unpacked_ = false;
+			return *this;
+		}
+		pointer operator->() { return &unpack(); }
+		reference operator*() { return unpack(); }
+		bool operator!=(const iterator& rhs) const noexcept { return idx_ != rhs.idx_; }
+		bool operator==(const iterator& rhs) const noexcept { return idx_ == rhs.idx_; }
+
+		// Id of the current document without decoding of its positions
+		VDocIdType Id() const noexcept {
+			assertrx_dbg(inBlock_ < ids_.size());
+			return ids_[inBlock_];
+		}
+		// Moves to the first document with id greater or equal to 'target'. Blocks before the target are skipped without decoding
+		void SkipTo(VDocIdType target);
+
+	private:
+		reference unpack() {
+			if (!unpacked_) {
+				assertrx_dbg(inBlock_ < ids_.size());
+				curItem_.unpackPositions(ids_[inBlock_], values_.data() + posOffset_, counts_[inBlock_]);
+				unpacked_ = true;
+			}
+			return curItem_;
+		}
+		void loadBlock(size_t block);
+
+		value_type curItem_;
+		const BlockPackedIdRelVec* pv_;
+		size_type idx_;
+		size_t block_ = 0;
+		size_t inBlock_ = 0;
+		size_t posOffset_ = 0;
+		bool unpacked_ = false;
+		std::vector<uint32_t> ids_;
+		std::vector<uint32_t> counts_;
+		std::vector<uint32_t> values_;
+	};
+
+	using const_iterator = const iterator;
+	iterator begin() const { return iterator(this, 0); }
+	iterator end() const { return iterator(this, size()); }
+	// Iterator, which starts decoding from the item with the index 'idx'. Previous item's values are not required for this format
+	iterator iterator_at(size_t idx, VDocIdType /*prevId*/, unsigned /*prevField*/) const {
+		assertrx_dbg(idx <= size());
+		return iterator(this, idx);
+	}
+
+	void erase_back(state st, size_t dataSize) {
+		data_.resize(dataSize);
+		blocks_.erase(std::lower_bound(blocks_.begin(), blocks_.end(), st.size,
+									   [](const Block& b, size_type size) noexcept { return b.firstIdx < size; }),
+					  blocks_.end());
+		st_ = st;
+	}
+
+	size_type size() const noexcept { return st_.size; }
+
+	template <typename InputIterator>
+	void insert_back(InputIterator from, InputIterator to) {
+		insert_back(from, to, [](const IdRelType&, size_t, VDocIdType, unsigned) noexcept {});
+	}
+	// onPack is called for each item with its index and the previous item's values, i.e. with the arguments for iterator_at()
+	template <typename InputIterator, typename OnPack>
+	void insert_back(InputIterator from, InputIterator to, OnPack&& onPack) {
+		std::vector<uint32_t> ids, counts, values;
+		ids.reserve(kBlockSize);
+		counts.reserve(kBlockSize);
+		size_type idx = st_.size;
+		for (auto it = from; it != to;) {
+			ids.clear();
+			counts.clear();
+			values.clear();
+			const size_type firstIdx = idx;
+			const VDocIdType firstId = it->Id();
+			VDocIdType prevId = firstId;
+			for (size_t n = 0; n < kBlockSize && it != to; ++n, ++it, ++idx) {
+				onPack(*it, idx, 0, 0);
+				assertrx_dbg(it->Id() >= prevId);
+				ids.emplace_back(it->Id() - prevId);
+				counts.emplace_back(it->packPositions(values));
+				prevId = it->Id();
+			}
+			appendBlock(firstId, prevId, firstIdx, ids, counts, values);
+		}
+		st_.size = idx;
+	}
+
+	// Calls 'f' for the ids of all of the documents, until it returns false. Positions are not decoded
+	template <typename F>
+	bool AllOfIds(F&& f) const {
+		std::vector<uint32_t> ids;
+		for (size_t b = 0; b < blocks_.size(); ++b) {
+			decodeIds(b, ids);
+			for (auto id : ids) {
+				if (!f(id)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	void shrink_to_fit() {
+		data_.shrink_to_fit();
+		blocks_.shrink_to_fit();
+	}
+	size_t heap_size() const noexcept { return data_.capacity() + blocks_.capacity() * sizeof(Block); }
+	// Size of the same data in the PackedIdRelVec's format. Computed by the full re-encoding on each call, so it is used by the memory
+	// statistics only
+	size_t varint_size() const;
+	void clear() noexcept {
+		data_.clear();
+		blocks_.clear();
+		st_ = state();
+	}
+	bool empty() const noexcept { return st_.size == 0; }
+
+	void get_state(state& st, size_t& dataSize) const noexcept {
+		st = st_;
+		dataSize = data_.size();
+	}
+
+private:
+	struct [[nodiscard]] Block {
+		VDocIdType firstId = 0;
+		VDocIdType lastId = 0;
+		size_type firstIdx = 0;
+		size_t offset = 0;
+	};
+
+	size_t blockSize(size_t block) const noexcept {
+		assertrx_dbg(block < blocks_.size());
+		return ((block + 1 < blocks_.size()) ? blocks_[block + 1].firstIdx : st_.size) - blocks_[block].firstIdx;
+	}
+	// Returns offset of the block's counts section
+	size_t decodeIds(size_t block, std::vector<uint32_t>& ids) const;
+	void appendBlock(VDocIdType firstId, VDocIdType lastId, size_type firstIdx, const std::vector<uint32_t>& ids,
+					 const std::vector<uint32_t>& counts, const std::vector<uint32_t>& values);
+
+	std::vector<uint8_t> data_;
+	std::vector<Block> blocks_;
+	state st_;
+};
+
+}  // namespace reindexer
@@ -205,7 +205,18 @@ void FTConfig::parse(std::string_view json, const RHashMap<std::string, FtIndexF
 		} else {
 			throw Error(errParseJson, "FTConfig: unknown optimization value: {}", opt);
 		}
+		const std::string postings = toLower(root["postings_format"].As<std::string>("varint"));
+		if (postings == "varint") {
+			postingsFormat = PostingsFormat::Varint;
+		} else if (postings == "blocks") {
+			postingsFormat = PostingsFormat::Blocks;
+		} else {
+			throw Error(errParseJson, "FTConfig: unknown postings_format value: {}", postings);
+		}
 		enablePreselectBeforeFt = root["enable_preselect_before_ft"].As<>(enablePreselectBeforeFt);
+		enableBlockMaxPruning = root["enable_block_max_pruning"].As<>(enableBlockMaxPruning);
+		enableBackgroundMerge = root["enable_background_merge"].As<>(enableBackgroundMerge);
+		maxSelectParallelism = root["max_select_parallelism"].As<>(maxSelectParallelism, 0, 256);
 
 		const std::string splitterStr = toLower(root["splitter"].As<std::string>("fast"));
 		if (splitterStr == "fast") {
@@ -434,6 +445,15 @@ std::string FTConfig::GetJSON(const fast_hash_map<std::string, int>& fields) con
 			break;
 	}
 
+	switch (postingsFormat) {
+		case PostingsFormat::Varint:
+			jsonBuilder.Put("postings_format", "varint");
+			break;
+		case PostingsFormat::Blocks:
+			jsonBuilder.Put("postings_format", "blocks");
+			break;
+	}
+
 	switch (splitterType) {
 		case Splitter::Fast:
 			jsonBuilder.Put("splitter", "fast");
@@ -444,6 +464,9 @@ std::string FTConfig::GetJSON(const fast_hash_map<std::string, int>& fields) con
 	}
 
 	jsonBuilder.Put("enable_preselect_before_ft", enablePreselectBeforeFt);
+	jsonBuilder.Put("enable_block_max_pruning", enableBlockMaxPruning);
+	jsonBuilder.Put("enable_background_merge", enableBackgroundMerge);
+	jsonBuilder.Put("max_select_parallelism", maxSelectParallelism);
 
 	if (fields.empty() || isAllEqual(fieldsCfg)) {
 		assertrx_throw(!fieldsCfg.empty());
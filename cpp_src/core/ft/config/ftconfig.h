@@ -215,7 +215,16 @@ public:
 
 	h_vector<FTFieldConfig, 8> fieldsCfg;
 	enum class [[nodiscard]] Optimization { CPU, Memory } optimization = Optimization::Memory;
+	// Format of the compressed posting lists ('Memory' optimization only): byte-wise varints or SIMD-decodable blocks
+	enum class [[nodiscard]] PostingsFormat { Varint, Blocks } postingsFormat = PostingsFormat::Varint;
 	bool enablePreselectBeforeFt = false;
+	// Keep per-block rank bounds of the posting lists and skip blocks, which can not get into the top merge_limit documents
+	bool enableBlockMaxPruning = false;
+	// Compact the commit steps and the removed documents in the background index optimization instead of the full rebuild
+	// on the query. Queries rebuild the index only after the hard limit of the steps count
+	bool enableBackgroundMerge = false;
+	// Max threads count for the lookup of the query terms and their variants. 0 or 1 - lookup in the query's thread
+	int maxSelectParallelism = 1;
 	int MaxTyposInWord() const noexcept { return (maxTypos / 2) + (maxTypos % 2); }
 	unsigned MaxExtraLetters() const noexcept { return maxExtraLetters >= 0 ? unsigned(maxExtraLetters) : std::numeric_limits<int>::max(); }
 	unsigned MaxMissingLetters() const noexcept {
@@ -92,7 +92,24 @@ template <typename IdCont>
 size_t DataHolder<IdCont>::GetMemStat() {
 	size_t res = IDataHolder::GetMemStat();
 	for (auto& w : words_) {
-		res += sizeof(w) + w.vids.heap_size();
+		res += sizeof(w) + w.vids.heap_size() + w.blocks.HeapSize();
+	}
+	return res;
+}
+
+template <typename IdCont>
+PostingsMemStat DataHolder<IdCont>::GetPostingsMemStat() const {
+	PostingsMemStat res;
+	if constexpr (!std::is_same_v<IdCont, IdRelVec>) {
+		res.varintSize = 0;
+	}
+	for (const auto& w : words_) {
+		res.size += w.vids.heap_size();
+		if constexpr (std::is_same_v<IdCont, BlockPackedIdRelVec>) {
+			*res.varintSize += w.vids.varint_size();
+		} else if constexpr (std::is_same_v<IdCont, PackedIdRelVec>) {
+			*res.varintSize += w.vids.heap_size();
+		}
 	}
 	return res;
 }
@@ -139,8 +156,8 @@ void DataHolder<IdCont>::StartCommit(bool complete_updated) {
 
 template <typename IdCont>
 void DataHolder<IdCont>::Process(VDocsTexts& vdocsTexts, const std::vector<uint32_t>& vdocsIds, size_t numDocsTotal, size_t fieldSize,
-								 bool multithread, std::vector<h_vector<float, 3>>& wordsCounts) {
-	DataProcessor<IdCont>{*this, fieldSize}.Process(vdocsTexts, vdocsIds, numDocsTotal, multithread, wordsCounts);
+								 bool multithread, std::vector<h_vector<float, 3>>& wordsCounts, const index::ICancelable* cancelable) {
+	DataProcessor<IdCont>{*this, fieldSize, cancelable}.Process(vdocsTexts, vdocsIds, numDocsTotal, multithread, wordsCounts);
 }
 
 template <typename IdCont>
@@ -156,6 +173,7 @@ DataHolder<IdCont>::DataHolder(FTConfig* c) {
 }
 
 template class DataHolder<PackedIdRelVec>;
+template class DataHolder<BlockPackedIdRelVec>;
 template class DataHolder<IdRelVec>;
 
 }  // namespace reindexer
@@ -1,7 +1,10 @@
 #pragma once
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include "core/ft/blockidrelvec.h"
 #include "core/ft/config/ftconfig.h"
+#include "core/ft/ft_fast/postingblocks.h"
 #include "core/ft/ft_fast/splitter.h"
 #include "core/ft/idrelset.h"
 #include "core/ft/limits.h"
@@ -21,6 +24,9 @@ static_assert(kMaxStepsCount <= TyposMap::kMaxStepNum, "TyposMap max steps overf
 static_assert(kTypoStepNumBits <= TyposMap::kStepBits, "TyposMap max steps overflow");
 
 class RdxContext;
+namespace index {
+class ICancelable;
+}  // namespace index
 
 // documents for the word
 
@@ -37,13 +43,50 @@ public:
 	PackedWordEntry& operator=(PackedWordEntry&&) noexcept = default;
 
 	PackedIdRelVec vids;
+	// Rank bounds for the blocks of vids. Built only if block max pruning is enabled
+	ft::PostingBlocks blocks;
 	// Necessary for correct rebuilding of the last step
 	PackedIdRelVec::state cur_step_state;
 	size_t cur_step_data_size = 0;
+	ft::PostingBlocks::State cur_step_blocks_state = 0;
 
-	void SaveState() { vids.get_state(cur_step_state, cur_step_data_size); }
+	void SaveState() {
+		vids.get_state(cur_step_state, cur_step_data_size);
+		cur_step_blocks_state = blocks.GetState();
+	}
+
+	void RestoreState() {
+		vids.erase_back(cur_step_state, cur_step_data_size);
+		blocks.RestoreState(cur_step_blocks_state);
+	}
+};
+
+template <>
+class [[nodiscard]] PackedWordEntry<BlockPackedIdRelVec> {
+public:
+	PackedWordEntry() noexcept = default;
+	PackedWordEntry(const PackedWordEntry&) = delete;
+	PackedWordEntry(PackedWordEntry&&) noexcept = default;
+	PackedWordEntry& operator=(const PackedWordEntry&) = delete;
+	PackedWordEntry& operator=(PackedWordEntry&&) noexcept = default;
+
+	BlockPackedIdRelVec vids;
+	// Rank bounds for the blocks of vids. Built only if block max pruning is enabled
+	ft::PostingBlocks blocks;
+	// Necessary for correct rebuilding of the last step
+	BlockPackedIdRelVec::state cur_step_state;
+	size_t cur_step_data_size = 0;
+	ft::PostingBlocks::State cur_step_blocks_state = 0;
+
+	void SaveState() {
+		vids.get_state(cur_step_state, cur_step_data_size);
+		cur_step_blocks_state = blocks.GetState();
+	}
 
-	void RestoreState() { vids.erase_back(cur_step_state, cur_step_data_size); }
+	void RestoreState() {
+		vids.erase_back(cur_step_state, cur_step_data_size);
+		blocks.RestoreState(cur_step_blocks_state);
+	}
 };
 
 template <>
@@ -56,16 +99,32 @@ public:
 	PackedWordEntry& operator=(PackedWordEntry&&) noexcept = default;
 
 	IdRelVec vids;
+	// Rank bounds for the blocks of vids. Built only if block max pruning is enabled
+	ft::PostingBlocks blocks;
 	// Necessary for correct rebuilding of the last step
 	size_t cur_step_data_size = 0;
+	ft::PostingBlocks::State cur_step_blocks_state = 0;
 
-	void SaveState() { cur_step_data_size = vids.pos(vids.end()); }
+	void SaveState() {
+		cur_step_data_size = vids.pos(vids.end());
+		cur_step_blocks_state = blocks.GetState();
+	}
 
-	void RestoreState() { vids.erase_back(cur_step_data_size); }
+	void RestoreState() {
+		vids.erase_back(cur_step_data_size);
+		blocks.RestoreState(cur_step_blocks_state);
+	}
 };
 
 enum [[nodiscard]] ProcessStatus { FullRebuild, RecommitLast, CreateNew };
 
+struct [[nodiscard]] PostingsMemStat {
+	// Heap size of the posting lists in the current format
+	size_t size = 0;
+	// Size of the same posting lists in the varint format. Empty for the uncompressed posting lists
+	std::optional<size_t> varintSize;
+};
+
 class [[nodiscard]] IDataHolder {
 public:
 	using WordsMapType = tsl::hopscotch_map<size_t, h_vector<WordIdType, 1>>;
@@ -93,13 +152,17 @@ public:
 
 	virtual ~IDataHolder() = default;
 	virtual void Process(VDocsTexts& vdocsTexts, const std::vector<uint32_t>& vdocsIds, size_t numDocsTotal, size_t fieldSize,
-						 bool multithread, std::vector<h_vector<float, 3>>& wordsCounts) = 0;
+						 bool multithread, std::vector<h_vector<float, 3>>& wordsCounts, const index::ICancelable* cancelable) = 0;
 	virtual size_t GetMemStat() = 0;
+	virtual PostingsMemStat GetPostingsMemStat() const = 0;
 	virtual void Clear() = 0;
 	virtual void StartCommit(bool complete_updated) = 0;
 	intrusive_ptr<const ISplitter> GetSplitter() const noexcept { return splitter_; }
 	bool NeedRebuild(bool complete_updated) const noexcept {
-		return steps.empty() || complete_updated || steps.size() >= size_t(cfg_->maxRebuildSteps) ||
+		// With the background merge the steps are compacted by the index optimization, so the query has to rebuild the index
+		// only if the steps can not be added anymore
+		const size_t maxSteps = cfg_->enableBackgroundMerge ? kMaxStepsCount : size_t(cfg_->maxRebuildSteps);
+		return steps.empty() || complete_updated || steps.size() >= maxSteps ||
 			   (steps.size() == 1 && steps.front().suffixes_.word_size() < size_t(cfg_->maxStepSize));
 	}
 	bool NeedRecommitLast() const noexcept { return steps.back().suffixes_.word_size() < size_t(cfg_->maxStepSize); }
@@ -187,8 +250,9 @@ class [[nodiscard]] DataHolder : public IDataHolder {
 public:
 	explicit DataHolder(FTConfig* c);
 	void Process(VDocsTexts& vdocsTexts, const std::vector<uint32_t>& vdocsIds, size_t numDocsTotal, size_t fieldSize, bool multithread,
-				 std::vector<h_vector<float, 3>>& wordsCounts) final;
+				 std::vector<h_vector<float, 3>>& wordsCounts, const index::ICancelable* cancelable) final;
 	size_t GetMemStat() override final;
+	PostingsMemStat GetPostingsMemStat() const override final;
 	void StartCommit(bool complte_updated) override final;
 	void Clear() override final;
 	std::vector<PackedWordEntry<IdCont>>& GetWords() noexcept { return words_; }
@@ -1,8 +1,10 @@
 ﻿#include "dataprocessor.h"
 #include <chrono>
 #include <limits>
+#include <optional>
 #include "core/ft/numtotext.h"
 #include "core/ft/typos.h"
+#include "core/index/auxiliary_interfaces.h"
 
 #include "tools/clock.h"
 #include "tools/logger.h"
@@ -26,12 +28,14 @@ void DataProcessor<IdCont>::Process(VDocsTexts& vdocsTexts, const std::vector<ui
 	words_map words_um;
 	const auto tm0 = system_clock_w::now();
 	size_t szCnt = buildWordsMap(vdocsTexts, vdocsIds, numDocsTotal, words_um, multithreaded, holder_.splitter_, wordsCounts);
+	throwIfCanceled();
 	const auto tm1 = system_clock_w::now();
 	auto& words = holder_.GetWords();
 	const size_t wrdOffset = words.size();
 	holder_.SetWordsOffset(wrdOffset);
 
 	const auto preprocWords = insertIntoSuffix(words_um, holder_);
+	throwIfCanceled();
 	const auto tm2 = system_clock_w::now();
 	// Step 4: Commit suffixes array. It runs in parallel with next step
 	auto& suffixes = holder_.GetLastStepSuffix();
@@ -42,8 +46,12 @@ void DataProcessor<IdCont>::Process(VDocsTexts& vdocsTexts, const std::vector<ui
 	});
 	// Step 5: Normalize and sort idrelsets. It runs in parallel with next step
 	size_t idsetcnt = 0;
+	std::optional<ft::PostingBlocksBuilder> blocksBuilder;
+	if (holder_.cfg_->enableBlockMaxPruning) {
+		blocksBuilder.emplace(vdocsIds, wordsCounts);
+	}
 	std::thread idrelsetCommitThread = runInThread(exwr, [&] {
-		idsetcnt = commitIdRelSets(preprocWords, words_um, holder_, wrdOffset);
+		idsetcnt = commitIdRelSets(preprocWords, words_um, holder_, wrdOffset, blocksBuilder ? &*blocksBuilder : nullptr);
 		tm4 = system_clock_w::now();
 	});
 
@@ -109,7 +117,7 @@ typename DataProcessor<IdCont>::WordsVector DataProcessor<IdCont>::insertIntoSuf
 
 template <typename IdCont>
 size_t DataProcessor<IdCont>::commitIdRelSets(const WordsVector& preprocWords, words_map& words_um, DataHolder<IdCont>& holder,
-											  size_t wrdOffset) {
+											  size_t wrdOffset, const ft::PostingBlocksBuilder* blocksBuilder) {
 	size_t idsetcnt = 0;
 	auto wIt = holder.GetWords().begin() + wrdOffset;
 	uint32_t i = 0;
@@ -129,15 +137,27 @@ size_t DataProcessor<IdCont>::commitIdRelSets(const WordsVector& preprocWords, w
 			idsetcnt += sizeof(*wIt);
 		}
 
-		if constexpr (std::is_same_v<IdCont, PackedIdRelVec>) {
-			wordEntry->vids.insert_back(keyIt->second.begin(), keyIt->second.end());
+		if constexpr (!std::is_same_v<IdCont, IdRelVec>) {
+			if (blocksBuilder) {
+				wordEntry->vids.insert_back(keyIt->second.begin(), keyIt->second.end(), blocksBuilder->MakeSink(wordEntry->blocks));
+			} else {
+				wordEntry->vids.insert_back(keyIt->second.begin(), keyIt->second.end());
+			}
 		} else {
+			if (blocksBuilder) {
+				auto sink = blocksBuilder->MakeSink(wordEntry->blocks);
+				size_t offset = wordEntry->vids.size();
+				for (const auto& relid : keyIt->second) {
+					sink(relid, offset++, 0, 0);
+				}
+			}
 			wordEntry->vids.insert(wordEntry->vids.end(), std::make_move_iterator(keyIt->second.begin()),
 								   std::make_move_iterator(keyIt->second.end()));
 		}
 		keyIt->second = IdRelSet();
 		wordEntry->vids.shrink_to_fit();
-		idsetcnt += wordEntry->vids.heap_size();
+		wordEntry->blocks.ShrinkToFit();
+		idsetcnt += wordEntry->vids.heap_size() + wordEntry->blocks.HeapSize();
 	}
 	return idsetcnt;
 }
@@ -234,6 +254,9 @@ size_t DataProcessor<IdCont>::buildWordsMap(VDocsTexts& vdocsTexts, const std::v
 		std::string wordWithoutDelims;
 		auto task = textSplitter->CreateTask();
 		for (VDocIdType j = start; j < fin; ++j) {
+			if ((j - start) % index::kCancelCheckFrequency == 0) {
+				throwIfCanceled();
+			}
 			const size_t vdocId = vdocsIds[j];
 			auto& vdocsText = vdocsTexts[j];
 			wordsCounts[j].resize(0);
@@ -374,6 +397,7 @@ void DataProcessor<IdCont>::buildTyposMap(uint32_t startPos, const WordsVector&
 		ths[threadIdx] =
 			runInThread(exwr, [threadIdx, numThreads, &preprocWords, startPos, maxTypoLen, maxTyposInWord, &threadsTyposDatas, this]() {
 				auto wordPos = startPos;
+				size_t processed = 0;
 				std::wstring wordStringW, buf;
 				std::vector<std::pair<uint32_t, WordTypo>>& typosData = threadsTyposDatas[threadIdx];
 
@@ -387,6 +411,9 @@ void DataProcessor<IdCont>::buildTyposMap(uint32_t startPos, const WordsVector&
 						wordPos++;
 						continue;
 					}
+					if (++processed % index::kCancelCheckFrequency == 0) {
+						throwIfCanceled();
+					}
 					const auto wordId = holder_.BuildWordId(wordPos++);
 
 					auto cb = [&typosData, wordId](std::wstring_view typo, const TyposVec& positions, std::wstring_view) {
@@ -421,7 +448,15 @@ std::thread DataProcessor<IdCont>::runInThread(ExceptionPtrWrapper& ew, F&& f, A
 		std::forward<Args>(args)...);
 }
 
+template <typename IdCont>
+void DataProcessor<IdCont>::throwIfCanceled() const {
+	if (cancelable_ && cancelable_->IsCanceled()) [[unlikely]] {
+		throw Error(errCanceled, "Fulltext index build was canceled");
+	}
+}
+
 template class DataProcessor<PackedIdRelVec>;
+template class DataProcessor<BlockPackedIdRelVec>;
 template class DataProcessor<IdRelVec>;
 
 }  // namespace reindexer
@@ -16,7 +16,9 @@ public:
 	using words_map =
 		tsl::hopscotch_map<std::string, IdRelSet, word_hash, word_equal, std::allocator<std::pair<std::string, IdRelSet>>, 30, true>;
 
-	DataProcessor(DataHolder<IdCont>& holder, size_t fieldSize) : holder_(holder), fieldSize_(fieldSize) {}
+	// 'cancelable' allows to interrupt the build with the errCanceled exception. The holder's state is not consistent after that
+	DataProcessor(DataHolder<IdCont>& holder, size_t fieldSize, const index::ICancelable* cancelable = nullptr)
+		: holder_(holder), fieldSize_(fieldSize), cancelable_(cancelable) {}
 
 	void Process(VDocsTexts& vdocsTexts, const std::vector<uint32_t>& vdocsIds, size_t numDocsTotal, bool multithread,
 				 std::vector<h_vector<float, 3>>& wordsCounts);
@@ -68,12 +70,15 @@ private:
 						  unsigned field, unsigned arrayIdx, size_t insertPos, std::vector<std::string_view>& container);
 	void buildTyposMap(uint32_t startPos, const WordsVector& preprocWords, bool multithread);
 	static WordsVector insertIntoSuffix(words_map& words_um, DataHolder<IdCont>& holder);
-	static size_t commitIdRelSets(const WordsVector& preprocWords, words_map& words_um, DataHolder<IdCont>& holder, size_t wrdOffset);
+	static size_t commitIdRelSets(const WordsVector& preprocWords, words_map& words_um, DataHolder<IdCont>& holder, size_t wrdOffset,
+								  const ft::PostingBlocksBuilder* blocksBuilder);
 	template <typename F, typename... Args>
 	static std::thread runInThread(ExceptionPtrWrapper&, F&&, Args&&...) noexcept;
+	void throwIfCanceled() const;
 
 	DataHolder<IdCont>& holder_;
 	size_t fieldSize_;
+	const index::ICancelable* cancelable_;
 };
 
 }  // namespace reindexer
@@ -236,6 +236,13 @@ private:
 	template <typename DocsStatsGetter>
 	void preselectMostRelevantDocs(QueryMergeData<IdCont>& queryData, const DocsStatsGetter& docsStatsGetter);
 
+	bool canUseBlockMaxPruning(const QueryMergeData<IdCont>& queryData) const;
+	// Selects maxMergedDocs_ documents with the highest ranks (without distance and full match boosts) into 'selected' using block max
+	// WAND traversal over the posting lists of all the subterms. Returns false, if the bounds are not applicable to the current ranking
+	template <typename Bm25T, typename DocsStatsGetter, typename IsAllowedT>
+	bool selectTopByBlockMax(const QueryMergeData<IdCont>& queryData, const IsAllowedT& isAllowed, BitsetType& selected,
+							 const DocsStatsGetter& docsStatsGetter);
+
 	size_t estimateNumDocsInMerge(QueryMergeData<IdCont>& queryData) {
 		size_t estimatedNumDocsOr = 0;
 		size_t estimatedNumDocsAnd = std::numeric_limits<size_t>::max();
@@ -1,3 +1,4 @@
+#include <numeric>
 #include "core/ft/bm25.h"
 #include "core/rdxcontext.h"
 #include "merger.h"
@@ -125,7 +126,7 @@ void Merger<IdCont, MergeDataType, MergeOffsetT>::mergeTerm(TermResults<IdCont>&
 
 		for (auto&& occurence : subterm.Occurences()) {
 			static_assert((std::is_same_v<IdCont, IdRelVec> && std::is_same_v<decltype(occurence), const IdRelType&>) ||
-							  (std::is_same_v<IdCont, PackedIdRelVec> && std::is_same_v<decltype(occurence), IdRelType&>),
+							  (!std::is_same_v<IdCont, IdRelVec> && std::is_same_v<decltype(occurence), IdRelType&>),
 						  "Expecting positionsInDoc is movable for packed vector and not movable for simple vector");
 
 			const int docId = occurence.Id();
@@ -463,6 +464,188 @@ void Merger<IdCont, MergeDataType, MergeOffsetT>::preselectMostRelevantDocs(Quer
 	needToCheckRemoved_ = false;
 }
 
+template <typename IdCont, typename MergeDataType, typename MergeOffsetT>
+bool Merger<IdCont, MergeDataType, MergeOffsetT>::canUseBlockMaxPruning(const QueryMergeData<IdCont>& queryMergeData) const {
+	if (!cfg_->enableBlockMaxPruning || !queryMergeData.synonyms.empty()) {
+		return false;
+	}
+	for (const auto& qp : queryMergeData.queryParts) {
+		if (qp.IsPhrase()) {
+			// Phrases ranks depend on the positions of all their terms. Excluded phrases are already applied to the restricting mask
+			if (qp.Phrase().Op() == OpNot) {
+				continue;
+			}
+			return false;
+		}
+		if (qp.Term().Op() == OpNot) {
+			continue;
+		}
+		for (const auto& subterm : qp.Term()) {
+			if (!subterm.Blocks() || (subterm.Blocks()->Empty() && !subterm.Occurences().empty())) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// Block max WAND: posting lists are ordered by their current documents. Pivot is the first document, which may get into the top by the sum
+// of the lists' max bounds. Then the bounds of the blocks, containing the pivot, are checked: if they are not enough, all the lists before
+// the pivot skip to the nearest end of their blocks without decoding the documents
+template <typename IdCont, typename MergeDataType, typename MergeOffsetT>
+template <typename Bm25T, typename DocsStatsGetter, typename IsAllowedT>
+bool Merger<IdCont, MergeDataType, MergeOffsetT>::selectTopByBlockMax(const QueryMergeData<IdCont>& queryMergeData,
+																	  const IsAllowedT& isAllowed, BitsetType& selected,
+																	  const DocsStatsGetter& docsStatsGetter) {
+	using Bm25CalcT = Bm25Calculator<Bm25T>;
+	struct [[nodiscard]] PostingList {
+		PostingCursor<IdCont> cursor;
+		BlockRankBound<Bm25CalcT> bound;
+		Bm25CalcT bm25;
+		const SubtermResults<IdCont>* subterm;
+		const TermResults<IdCont>* term;
+		size_t termIdx;
+		float maxBound;
+	};
+	constexpr size_t kCancelCheckPeriod = 4096;
+
+	std::vector<PostingList> lists;
+	size_t termsCount = 0;
+	for (const auto& qp : queryMergeData.queryParts) {
+		if (qp.Op() == OpNot) {
+			continue;
+		}
+		const TermResults<IdCont>& term = qp.Term();
+		for (const SubtermResults<IdCont>& subterm : term) {
+			if (subterm.Occurences().empty()) {
+				continue;
+			}
+			// first doc is always empty
+			Bm25CalcT bm25{static_cast<double>(totalNumDocs_ - 1), static_cast<double>(subterm.Occurences().size()),
+						   cfg_->bm25Config.bm25k1, cfg_->bm25Config.bm25b};
+			if (bm25.GetIDF() < 0.0) {
+				// Bm25 does not grow with the term's frequency in this case
+				return false;
+			}
+			const PostingBlocks& blocks = *subterm.Blocks();
+			BlockRankBound<Bm25CalcT> bound(term.Opts(), subterm.Proc(), bm25, *cfg_, docsStatsGetter);
+			float maxBound = 0.0;
+			for (size_t i = 0; i < blocks.Size(); ++i) {
+				maxBound = std::max(maxBound, bound(blocks[i]));
+			}
+			lists.emplace_back(PostingList{.cursor = PostingCursor<IdCont>(subterm.Occurences(), blocks),
+										   .bound = std::move(bound),
+										   .bm25 = bm25,
+										   .subterm = &subterm,
+										   .term = &term,
+										   .termIdx = termsCount,
+										   .maxBound = maxBound});
+		}
+		++termsCount;
+	}
+
+	std::vector<PostingList*> order;
+	order.reserve(lists.size());
+	for (auto& list : lists) {
+		order.emplace_back(&list);
+	}
+	const auto byDoc = [](const PostingList* l, const PostingList* r) noexcept { return l->cursor.Doc() < r->cursor.Doc(); };
+	std::sort(order.begin(), order.end(), byDoc);
+
+	// Min-heap of the current top documents
+	using RankedDoc = std::pair<float, VDocIdType>;
+	const auto byRank = [](const RankedDoc& l, const RankedDoc& r) noexcept { return l.first > r.first; };
+	std::vector<RankedDoc> top;
+	top.reserve(maxMergedDocs_);
+	h_vector<float, 4> termRanks(termsCount);
+	size_t docsEvaluated = 0, iterations = 0;
+
+	while (!order.empty() && !order.front()->cursor.End()) {
+		if (!inTransaction_ && !(++iterations % kCancelCheckPeriod)) {
+			ThrowOnCancel(ctx_);
+		}
+		const float threshold = top.size() < maxMergedDocs_ ? 0.0 : top.front().first;
+
+		float boundsSum = 0.0;
+		size_t pivot = 0;
+		for (; pivot < order.size() && !order[pivot]->cursor.End(); ++pivot) {
+			boundsSum += order[pivot]->maxBound;
+			if (boundsSum > threshold) {
+				break;
+			}
+		}
+		if (pivot == order.size() || order[pivot]->cursor.End()) {
+			break;
+		}
+		const VDocIdType pivotDoc = order[pivot]->cursor.Doc();
+		while (pivot + 1 < order.size() && order[pivot + 1]->cursor.Doc() == pivotDoc) {
+			++pivot;
+		}
+
+		float blocksBoundsSum = 0.0;
+		VDocIdType nextDoc = (pivot + 1 < order.size()) ? order[pivot + 1]->cursor.Doc() : PostingCursor<IdCont>::kEndDoc;
+		for (size_t i = 0; i <= pivot; ++i) {
+			if (const PostingBlock* block = order[i]->cursor.ShallowSeek(pivotDoc); block) {
+				blocksBoundsSum += order[i]->bound(*block);
+				nextDoc = std::min<VDocIdType>(nextDoc, block->lastId + 1);
+			}
+		}
+
+		if (blocksBoundsSum <= threshold) {
+			// None of the documents before the nearest end of the pivot's blocks is able to get into the top
+			for (size_t i = 0; i <= pivot; ++i) {
+				order[i]->cursor.Seek(nextDoc);
+			}
+		} else if (order.front()->cursor.Doc() == pivotDoc) {
+			++docsEvaluated;
+			if (isAllowed(pivotDoc)) {
+				std::fill(termRanks.begin(), termRanks.end(), 0.0);
+				for (size_t i = 0; i <= pivot; ++i) {
+					PostingList& list = *order[i];
+					TermRankInfo subtermInf;
+					subtermInf.proc = list.subterm->Proc();
+					const auto [rank, field] =
+						calcTermRank(list.term->Opts(), list.bm25, list.cursor.Cur(), subtermInf, cfg_, docsStatsGetter);
+					termRanks[list.termIdx] = std::max(termRanks[list.termIdx], rank);
+				}
+				const float rank = std::accumulate(termRanks.begin(), termRanks.end(), 0.0f);
+				if (rank > threshold) {
+					if (top.size() >= maxMergedDocs_) {
+						std::pop_heap(top.begin(), top.end(), byRank);
+						top.pop_back();
+					}
+					top.emplace_back(rank, pivotDoc);
+					std::push_heap(top.begin(), top.end(), byRank);
+				}
+			}
+			for (size_t i = 0; i <= pivot; ++i) {
+				order[i]->cursor.Next();
+			}
+		} else {
+			for (size_t i = 0; i < pivot && order[i]->cursor.Doc() < pivotDoc; ++i) {
+				order[i]->cursor.Seek(pivotDoc);
+			}
+		}
+
+		// Only the lists up to the pivot were moved
+		std::sort(order.begin(), order.begin() + pivot + 1, byDoc);
+		std::inplace_merge(order.begin(), order.begin() + pivot + 1, order.end(), byDoc);
+		while (!order.empty() && order.back()->cursor.End()) {
+			order.pop_back();
+		}
+	}
+
+	selected.ResizeAndReset(totalNumDocs_);
+	for (const auto& doc : top) {
+		selected.set(doc.second);
+	}
+	if (cfg_->logLevel >= LogInfo) [[unlikely]] {
+		logFmt(LogInfo, "Block max selection ({} posting lists): {} docs evaluated, {} docs selected", lists.size(), docsEvaluated,
+			   top.size());
+	}
+	return true;
+}
+
 template <typename IdCont, typename MergeDataType, typename MergeOffsetT>
 template <typename Bm25T, typename DocsStatsGetter>
 MergeDataType Merger<IdCont, MergeDataType, MergeOffsetT>::Merge(QueryMergeData<IdCont>& queryMergeData, RankSortType rankSortType,
@@ -479,6 +662,14 @@ MergeDataType Merger<IdCont, MergeDataType, MergeOffsetT>::Merge(QueryMergeData<
 	queryMergeData.SortSubterms();
 	if (queryMergeData.Simple()) {
 		auto& singleTerm = queryMergeData.queryParts[0].Term();
+		// Documents, which are not in the top, are excluded instead of skipping all the documents after first merge_limit ones
+		if (queryMergeData.totalORVids > cfg_->mergeLimit && canUseBlockMaxPruning(queryMergeData)) {
+			BitsetType selected;
+			const auto isAllowed = [&](index_t docId) { return !docsExcluded_[docId] && !docsStatsGetter.DocRemoved(docId); };
+			if (selectTopByBlockMax<Bm25T>(queryMergeData, isAllowed, selected, docsStatsGetter)) {
+				docsExcluded_ |= selected.Invert();
+			}
+		}
 		return mergeSimple<Bm25T>(singleTerm, rankSortType, docsStatsGetter);
 	}
 
@@ -486,7 +677,14 @@ MergeDataType Merger<IdCont, MergeDataType, MergeOffsetT>::Merge(QueryMergeData<
 	static const bool kDisable2PhaseMerge = std::getenv("REINDEXER_NO_2PHASE_FT_MERGE");
 	if (!kDisable2PhaseMerge && estimateNumDocsInMerge(queryMergeData) > cfg_->mergeLimit && totalNumDocs_ > cfg_->mergeLimit &&
 		restrictingMask_.PopCount() > cfg_->mergeLimit) {
-		preselectMostRelevantDocs(queryMergeData, docsStatsGetter);
+		BitsetType selected;
+		const auto isAllowed = [&](index_t docId) { return restrictingMask_[docId] && !docsStatsGetter.DocRemoved(docId); };
+		if (canUseBlockMaxPruning(queryMergeData) && selectTopByBlockMax<Bm25T>(queryMergeData, isAllowed, selected, docsStatsGetter)) {
+			restrictingMask_ &= selected;
+			needToCheckRemoved_ = false;
+		} else {
+			preselectMostRelevantDocs(queryMergeData, docsStatsGetter);
+		}
 	}
 
 	size_t phraseIdx = 0;
@@ -172,7 +172,7 @@ void PhraseMerger<IdCont, MergeDataType, MergeOffsetT>::mergePhraseTerm(TermResu
 
 		for (auto&& occurence : subterm.Occurences()) {
 			static_assert((std::is_same_v<IdCont, IdRelVec> && std::is_same_v<decltype(occurence), const IdRelType&>) ||
-							  (std::is_same_v<IdCont, PackedIdRelVec> && std::is_same_v<decltype(occurence), IdRelType&>),
+							  (!std::is_same_v<IdCont, IdRelVec> && std::is_same_v<decltype(occurence), IdRelType&>),
 						  "Expecting occurence is movable for packed vector and not movable for simple vector");
 
 			const index_t docId = occurence.Id();
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "core/ft/blockidrelvec.h"
+#include "core/ft/config/ftconfig.h"
+#include "core/ft/idrelset.h"
+
+namespace reindexer {
+
+namespace ft {
+
+// Posting lists of the words are split into the blocks of kPostingBlockSize documents. Each block keeps the decoder's state for its first
+// document and the statistics, which give the upper bound of the term's rank for any document of the block. This allows to skip the
+// blocks, which are not able to get into the top of the results, without decoding
+constexpr size_t kPostingBlockSize = 128;
+
+struct [[nodiscard]] PostingBlock {
+	size_t offset = 0;	// Offset of the first document of the block (bytes for PackedIdRelVec, elements for the other containers)
+	VDocIdType prevId = 0;	// Decoder's state before the first document of the block (PackedIdRelVec only)
+	uint32_t prevField = 0;
+	VDocIdType lastId = 0;			// Id of the last document of the block
+	uint32_t maxTermFreq = 0;		// Max number of the word's positions in a single field of the block's documents
+	uint32_t minWordsInField = 0;	// Min number of words in the fields, which contain the word
+};
+
+class [[nodiscard]] PostingBlocks {
+public:
+	using State = size_t;
+
+	const PostingBlock& operator[](size_t idx) const noexcept {
+		assertrx_dbg(idx < blocks_.size());
+		return blocks_[idx];
+	}
+	size_t Size() const noexcept { return blocks_.size(); }
+	bool Empty() const noexcept { return blocks_.empty(); }
+	// Index of the first block starting from 'from', which may contain documents with ids greater or equal to 'target'
+	size_t Find(size_t from, VDocIdType target) const noexcept {
+		if (from >= blocks_.size()) {
+			return blocks_.size();
+		}
+		return std::lower_bound(blocks_.begin() + from, blocks_.end(), target,
+								[](const PostingBlock& b, VDocIdType id) noexcept { return b.lastId < id; }) -
+			   blocks_.begin();
+	}
+
+	State GetState() const noexcept { return blocks_.size(); }
+	void RestoreState(State st) { blocks_.resize(st); }
+	void ShrinkToFit() { blocks_.shrink_to_fit(); }
+	size_t HeapSize() const noexcept { return blocks_.capacity() * sizeof(PostingBlock); }
+
+private:
+	friend class PostingBlocksBuilder;
+
+	std::vector<PostingBlock> blocks_;
+};
+
+// Builds blocks for the documents of the single commit step. Words counts are indexed the same way as vdocsIds
+class [[nodiscard]] PostingBlocksBuilder {
+public:
+	class [[nodiscard]] Sink {
+	public:
+		Sink(const PostingBlocksBuilder& builder, PostingBlocks& blocks) noexcept : builder_(builder), blocks_(blocks.blocks_) {}
+
+		// Must be called for each document in the order of insertion into the posting list
+		void operator()(const IdRelType& relid, size_t offset, VDocIdType prevId, uint32_t prevField) {
+			if (!(count_++ % kPostingBlockSize)) {
+				blocks_.emplace_back(PostingBlock{.offset = offset,
+												  .prevId = prevId,
+												  .prevField = prevField,
+												  .lastId = relid.Id(),
+												  .maxTermFreq = 0,
+												  .minWordsInField = std::numeric_limits<uint32_t>::max()});
+			}
+			auto& block = blocks_.back();
+			assertrx_dbg(block.lastId <= relid.Id());
+			block.lastId = relid.Id();
+
+			// Positions are grouped by fields the same way as in the rank calculation
+			const auto& positions = relid.Pos();
+			for (size_t idx = 0; idx < positions.size();) {
+				const unsigned f = positions[idx].field();
+				size_t fieldEnd = idx + 1;
+				while (fieldEnd < positions.size() && positions[fieldEnd].field() == f) {
+					++fieldEnd;
+				}
+				block.maxTermFreq = std::max<uint32_t>(block.maxTermFreq, fieldEnd - idx);
+				block.minWordsInField = std::min<uint32_t>(block.minWordsInField, builder_.numWordsInField(relid.Id(), f));
+				idx = fieldEnd;
+			}
+		}
+
+	private:
+		const PostingBlocksBuilder& builder_;
+		std::vector<PostingBlock>& blocks_;
+		size_t count_ = 0;
+	};
+
+	PostingBlocksBuilder(const std::vector<uint32_t>& vdocsIds, const std::vector<h_vector<float, 3>>& wordsCounts)
+		: firstId_(vdocsIds.empty() ? 0 : vdocsIds.front()) {
+		assertrx_throw(vdocsIds.size() == wordsCounts.size());
+		if (!vdocsIds.empty()) {
+			wordsCounts_.resize(vdocsIds.back() - firstId_ + 1, nullptr);
+		}
+		for (size_t i = 0; i < vdocsIds.size(); ++i) {
+			wordsCounts_[vdocsIds[i] - firstId_] = &wordsCounts[i];
+		}
+	}
+
+	Sink MakeSink(PostingBlocks& blocks) const noexcept { return Sink(*this, blocks); }
+
+private:
+	// Same value as the one, which is returned by the index's NumWordsInField()
+	uint32_t numWordsInField(VDocIdType id, unsigned field) const noexcept {
+		assertrx_dbg(id >= firstId_ && id - firstId_ < wordsCounts_.size() && wordsCounts_[id - firstId_]);
+		const auto& counts = *wordsCounts_[id - firstId_];
+		return field < counts.size() ? uint32_t(counts[field]) : 0;
+	}
+
+	VDocIdType firstId_ = 0;
+	std::vector<const h_vector<float, 3>*> wordsCounts_;
+};
+
+// Iterates over the posting list and allows to skip its blocks without decoding
+template <typename IdCont>
+class [[nodiscard]] PostingCursor {
+	using IteratorT = decltype(std::declval<const IdCont&>().begin());
+
+public:
+	PostingCursor(const IdCont& vids, const PostingBlocks& blocks) : vids_(&vids), blocks_(&blocks), it_(vids.begin()), end_(vids.end()) {
+		update();
+	}
+
+	bool End() const noexcept { return block_ >= blocks_->Size(); }
+	VDocIdType Doc() const noexcept { return doc_; }
+	const IdRelType& Cur() { return *it_; }
+
+	void Next() {
+		++it_;
+		update();
+	}
+	// Moves to the first document with id greater or equal to 'target'
+	void Seek(VDocIdType target) {
+		if (End() || doc_ >= target) {
+			return;
+		}
+		if constexpr (std::is_same_v<IdCont, BlockPackedIdRelVec>) {
+			// The container has its own skip pointers with the same blocks layout
+			it_.SkipTo(target);
+			if (it_ != end_) {
+				block_ = blocks_->Find(block_, it_.Id());
+			}
+			update();
+		} else {
+			if (target > (*blocks_)[block_].lastId) {
+				const size_t block = blocks_->Find(block_ + 1, target);
+				if (block >= blocks_->Size()) {
+					block_ = blocks_->Size();
+					doc_ = kEndDoc;
+					return;
+				}
+				const PostingBlock& b = (*blocks_)[block];
+				if constexpr (std::is_same_v<IdCont, PackedIdRelVec>) {
+					it_ = vids_->iterator_at(b.offset, b.prevId, b.prevField);
+				} else {
+					it_ = vids_->begin() + b.offset;
+				}
+				block_ = block;
+				update();
+			}
+			while (doc_ < target) {
+				Next();
+			}
+		}
+	}
+	// Block, which may contain the document 'target', without decoding. Returns nullptr if there are no such blocks
+	const PostingBlock* ShallowSeek(VDocIdType target) noexcept {
+		shallowBlock_ = blocks_->Find(std::max(shallowBlock_, block_), target);
+		return shallowBlock_ < blocks_->Size() ? &(*blocks_)[shallowBlock_] : nullptr;
+	}
+	const PostingBlocks& Blocks() const noexcept { return *blocks_; }
+
+	static constexpr VDocIdType kEndDoc = std::numeric_limits<VDocIdType>::max();
+
+private:
+	void update() {
+		if (!(it_ != end_)) {
+			block_ = blocks_->Size();
+			doc_ = kEndDoc;
+			return;
+		}
+		if constexpr (std::is_same_v<IdCont, BlockPackedIdRelVec>) {
+			doc_ = it_.Id();
+		} else {
+			doc_ = (*it_).Id();
+		}
+		while (block_ < blocks_->Size() && doc_ > (*blocks_)[block_].lastId) {
+			++block_;
+		}
+		assertrx_dbg(block_ < blocks_->Size());
+	}
+
+	const IdCont* vids_;
+	const PostingBlocks* blocks_;
+	IteratorT it_;
+	IteratorT end_;
+	size_t block_ = 0;
+	size_t shallowBlock_ = 0;
+	VDocIdType doc_ = kEndDoc;
+};
+
+// Upper bound of the subterm's rank (see calcTermRankImpl()) for the documents of the posting block.
+// Each factor of the rank is bounded separately: bm25 grows with the number of the term's positions and decreases with the field length
+template <typename Calculator>
+class [[nodiscard]] BlockRankBound {
+public:
+	template <typename DocsStatsGetter>
+	BlockRankBound(const FtDslOpts& termOpts, float proc, Calculator bm25, const FTConfig& cfg, const DocsStatsGetter& docsStatsGetter)
+		: bm25_(bm25) {
+		for (size_t f = 0; f < cfg.fieldsCfg.size() && f < termOpts.fieldsOpts.size(); ++f) {
+			const auto& fldCfg = cfg.fieldsCfg[f];
+			const float positionRank = std::max(FTFieldConfig::bound(1.0, fldCfg.positionWeight, fldCfg.positionBoost),
+												FTFieldConfig::bound(0.0, fldCfg.positionWeight, fldCfg.positionBoost));
+			const float termLenBoost = FTFieldConfig::bound(termOpts.termLenBoost, fldCfg.termLenWeight, fldCfg.termLenBoost);
+			fields_.emplace_back(Field{.mult = termOpts.fieldsOpts[f].boost * positionRank * termLenBoost,
+									   .avgWordsCount = docsStatsGetter.AvgWordsCount(f),
+									   .bm25Weight = fldCfg.bm25Weight,
+									   .bm25Boost = fldCfg.bm25Boost});
+		}
+		// Ranks in the other fields are summed with the decreasing ratio
+		float sumRatio = 1.0, k = cfg.summationRanksByFieldsRatio;
+		for (size_t i = 0; k > 0.0 && i < fields_.size(); ++i) {
+			sumRatio += k;
+			k *= cfg.summationRanksByFieldsRatio;
+		}
+		mult_ = termOpts.boost * proc * sumRatio;
+	}
+
+	float operator()(const PostingBlock& block) const noexcept {
+		float res = 0.0;
+		for (const auto& f : fields_) {
+			const float bm25 = bm25_.Get(block.maxTermFreq, block.minWordsInField, f.avgWordsCount);
+			const float normBm25 =
+				std::max(FTFieldConfig::bound(bm25, f.bm25Weight, f.bm25Boost), FTFieldConfig::bound(0.0, f.bm25Weight, f.bm25Boost));
+			res = std::max(res, f.mult * normBm25);
+		}
+		return res * mult_;
+	}
+
+private:
+	struct [[nodiscard]] Field {
+		float mult = 0.0;
+		float avgWordsCount = 0.0;
+		double bm25Weight = 0.0;
+		double bm25Boost = 0.0;
+	};
+
+	Calculator bm25_;
+	h_vector<Field, 4> fields_;
+	float mult_ = 0.0;
+};
+
+}  // namespace ft
+}  // namespace reindexer
@@ -3,6 +3,7 @@
 #include "core/id_type.h"
 #include "estl/dynamic_bitset.h"
 #include "indextexttypes.h"
+#include "postingblocks.h"
 
 namespace reindexer {
 
@@ -18,10 +19,13 @@ public:
 
 	SubtermResults(const IdCont& vids, std::string&& pattern, WordIdType patternId, float proc, HoldT) noexcept
 		: proc_(proc), vids_(&vids), pattern_(std::move(pattern)), patternId_(patternId) {}
-	SubtermResults(const IdCont& vids, std::string_view pattern, WordIdType patternId, float proc, NoHoldT) noexcept
-		: proc_(proc), vids_(&vids), pattern_(std::move(pattern)), patternId_(patternId) {}
+	SubtermResults(const IdCont& vids, const PostingBlocks& blocks, std::string_view pattern, WordIdType patternId, float proc,
+				   NoHoldT) noexcept
+		: proc_(proc), vids_(&vids), blocks_(&blocks), pattern_(std::move(pattern)), patternId_(patternId) {}
 
 	const IdCont& Occurences() const noexcept { return *vids_; }
+	// May be empty, if block max pruning is disabled
+	const PostingBlocks* Blocks() const noexcept { return blocks_; }
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	std::string_view Pattern() const noexcept {
 		return std::visit([](const auto& v) { return std::string_view(v); }, pattern_);
@@ -37,6 +41,7 @@ private:
 	bool suppressed_ = false;
 
 	const IdCont* vids_ = nullptr;						   // indexes of documents (vdoc) containing the given word + position + field
+	const PostingBlocks* blocks_ = nullptr;				   // rank bounds for the blocks of vids_
 	std::variant<std::string, std::string_view> pattern_;  // word,translit,.....
 	WordIdType patternId_;
 };
@@ -56,8 +61,8 @@ public:
 	const std::wstring& Pattern() const noexcept { return term_.Pattern(); }
 	const FtDslOpts& Opts() const noexcept { return term_.Opts(); }
 
-	void AddSubterm(const IdCont& vids, std::string_view pattern, WordIdType patternId, float proc) {
-		subtermsResults_.emplace_back(vids, pattern, patternId, proc, typename ft::SubtermResults<IdCont>::NoHoldT{});
+	void AddSubterm(const IdCont& vids, const PostingBlocks& blocks, std::string_view pattern, WordIdType patternId, float proc) {
+		subtermsResults_.emplace_back(vids, blocks, pattern, patternId, proc, typename ft::SubtermResults<IdCont>::NoHoldT{});
 		maxVDocs_ += vids.size();
 	}
 
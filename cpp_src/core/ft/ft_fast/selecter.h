@@ -131,14 +131,45 @@ template <typename IdCont>
 class [[nodiscard]] Selector {
 public:
 	Selector(DataHolder<IdCont>& holder, const SplitOptions& splitOptions, size_t fieldSize, int maxAreasInDoc)
-		: holder_(holder), splitOptions_(splitOptions), fieldSize_(fieldSize), maxAreasInDoc_(maxAreasInDoc) {}
+		: holder_(holder),
+		  splitOptions_(splitOptions),
+		  fieldSize_(fieldSize),
+		  maxAreasInDoc_(maxAreasInDoc),
+		  maxThreads_(std::max(holder.cfg_->maxSelectParallelism, 1)) {}
+	// Selector for the parallel lookup worker. Buffers of the variants builders are not shared with the 'other'
+	Selector(const Selector& other, unsigned maxThreads)
+		: holder_(other.holder_),
+		  splitOptions_(other.splitOptions_),
+		  fieldSize_(other.fieldSize_),
+		  maxAreasInDoc_(other.maxAreasInDoc_),
+		  maxThreads_(maxThreads) {}
 
 	template <typename MergedDataType, typename DocsStatsGetter>
 	MergedDataType Process(size_t totalNumDocs, FtDSLQuery&& query, bool inTransaction, RankSortType rankSortType,
 						   FtMergeStatuses::Statuses&& docsExcluded, const RdxContext&, const DocsStatsGetter&);
 
 private:
-	float getTermBoost(std::string_view term) {
+	// Minimal number of the term variants, which are looked up by the single thread
+	static constexpr size_t kMinVariantsPerThread = 4;
+
+	// Term with its variants and the results of the variants lookup
+	struct [[nodiscard]] TermLookup {
+		TermVariants variants;
+		ft::TermResults<IdCont> results;
+		// Synonyms, built by the splitting of the term's variants
+		std::vector<ft::Synonym<IdCont>> splitSynonyms;
+	};
+	struct [[nodiscard]] VariantMatch {
+		WordIdType wordId;
+		std::string_view word;
+		float proc;
+	};
+	struct [[nodiscard]] VariantLookup {
+		std::vector<VariantMatch> matches;
+		size_t excludedCnt = 0;
+	};
+
+	float getTermBoost(std::string_view term) const {
 		if (holder_.stemmedTermsBoost.empty()) {
 			return -1.0f;
 		}
@@ -156,11 +187,18 @@ private:
 	void addSynonyms(TermVariants& termVariants);
 	void boostVariants(TermVariants& termVariants);
 
-	h_vector<size_t, 4> addSynonymsBySplittingTermVariants(TermVariants& termVariants, const FtMergeStatuses::Statuses& docsExcluded,
-														   ft::QueryMergeData<IdCont>& queryMergeData);
+	void addSynonymsBySplittingTermVariants(TermVariants& termVariants, const FtMergeStatuses::Statuses& docsExcluded,
+											std::vector<ft::Synonym<IdCont>>& synonyms);
 
+	template <typename F>
+	void lookupVariant(TermVariant& variant, const FtMergeStatuses::Statuses& docsExcluded, size_t& excludedCnt, F&& onMatch) const;
 	ft::TermResults<IdCont> buildTermResults(const FtDSLEntry& term, TermVariants& termVariants,
 											 const FtMergeStatuses::Statuses& docsExcluded);
+	TermLookup lookupTerm(const FtDSLQuery& query, size_t termIdx, const FtMergeStatuses::Statuses& docsExcluded);
+	// Runs 'task(selector, idx)' for each idx in [0, count) on 'threads' threads. Indexes are claimed dynamically and each thread uses
+	// its own copy of the selector, because the variants builders reuse the selector's buffers
+	template <typename F>
+	void runParallel(size_t count, unsigned threads, const RdxContext* rdxCtx, const F& task);
 
 	void buildQueryMergeData(FtDSLQuery&& query, const FtMergeStatuses::Statuses& docsExcluded, bool inTransaction,
 							 const RdxContext& rdxCtx, ft::QueryMergeData<IdCont>& queryMergeData);
@@ -174,6 +212,8 @@ private:
 	const SplitOptions& splitOptions_;
 	size_t fieldSize_;
 	int maxAreasInDoc_;
+	// Max threads count for the lookup of the query terms and their variants
+	unsigned maxThreads_;
 
 	h_vector<TermVariant, 5> newVariants;
 };
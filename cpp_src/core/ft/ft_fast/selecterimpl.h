@@ -1,7 +1,9 @@
 #include "core/ft/variants/typos.h"
+#include "core/nsselecter/selectworkerspool.h"
 #include "mergerimpl.h"
 #include "selecter.h"
 #include "tools/objects_pool.h"
+#include "tools/thread_exception_wrapper.h"
 
 namespace reindexer {
 
@@ -268,19 +270,76 @@ void Selector<IdCont>::addSynonyms(TermVariants& termVariants) {
 
 template <class VidsContainer>
 static bool allVidsExcluded(const FtMergeStatuses::Statuses& docsExcluded, const VidsContainer& wordVids) {
-	for (const auto& id : wordVids) {
-		if (!docsExcluded[id.Id()]) {
-			return false;
+	if constexpr (std::is_same_v<VidsContainer, BlockPackedIdRelVec>) {
+		// Only the ids sections of the blocks are decoded
+		return wordVids.AllOfIds([&docsExcluded](VDocIdType id) noexcept { return bool(docsExcluded[id]); });
+	} else {
+		for (const auto& id : wordVids) {
+			if (!docsExcluded[id.Id()]) {
+				return false;
+			}
 		}
+		return true;
 	}
+}
 
-	return true;
+template <typename IdCont>
+template <typename F>
+void Selector<IdCont>::lookupVariant(TermVariant& variant, const FtMergeStatuses::Statuses& docsExcluded, size_t& excludedCnt,
+									 F&& onMatch) const {
+	const FTRankingConfig& rankingCfg = holder_.cfg_->rankingConfig;
+	const std::string& patternUtf8 = variant.PatternUtf8();
+	const size_t patternBytes = patternUtf8.length();
+	for (const auto& step : holder_.steps) {
+		auto& suffixes = step.suffixes_;
+		bool needStop = false;
+		for (auto wordIt = suffixes.lower_bound(patternUtf8); wordIt != suffixes.end() && !needStop; ++wordIt) {
+			needStop = wordIt.lcp() < int(patternBytes);
+
+			const char* suffixPtr = wordIt->first;
+			const WordIdType wordId = wordIt->second;
+
+			const auto& wordEntry = holder_.GetWordEntry(wordId);
+			if (allVidsExcluded(docsExcluded, wordEntry.vids)) {
+				++excludedCnt;
+				continue;
+			}
+
+			const std::string_view word = holder_.GetWord(wordId);
+
+			const size_t wordLengthBeforePattern = suffixPtr - word.data();
+			const bool isPrefix = (wordLengthBeforePattern == 0);
+			const size_t wordLengthAfterPattern = word.length() - wordLengthBeforePattern - patternBytes;
+			const bool isSuffix = (wordLengthAfterPattern == 0);
+
+			if (!variant.suff && !isPrefix) {
+				continue;
+			}
+			if (!variant.pref && !isSuffix) {
+				break;
+			}
+
+			// ToDo fix it (broken for russian utf8 symbols)
+			const int matchDif = std::abs(long(word.length() - patternBytes + wordLengthBeforePattern));
+			const float boost = std::max(getTermBoost(std::string(word)), variant.boost);
+			const float decreasePenalty = static_cast<float>(holder_.cfg_->partialMatchDecrease * matchDif) /
+										  std::max<float>(patternBytes, kMinPartialMatchDenominator);
+			float proc = std::max<float>(variant.proc - decreasePenalty, isPrefix ? rankingCfg.PrefixMin() : rankingCfg.SuffixMin());
+			proc = std::min<float>(proc, variant.proc);
+			if (boost > 0.0f) {
+				proc *= boost;
+			}
+
+			if (!onMatch(wordId, word, proc)) {
+				return;
+			}
+		}
+	}
 }
 
 template <typename IdCont>
 ft::TermResults<IdCont> Selector<IdCont>::buildTermResults(const FtDSLEntry& term, TermVariants& termVariants,
 														   const FtMergeStatuses::Statuses& docsExcluded) {
-	const FTRankingConfig& rankingCfg = holder_.cfg_->rankingConfig;
 	ft::TermResults<IdCont> res(term);
 
 	__RX_VAR_FROM_POOL__(FoundWordsType, wordsFound)
@@ -289,72 +348,64 @@ ft::TermResults<IdCont> Selector<IdCont>::buildTermResults(const FtDSLEntry& ter
 	size_t totalVids = 0;
 	size_t lowRelevanceLimit = 4 * holder_.cfg_->mergeLimit;
 
-	for (auto& variant : termVariants) {
+	// Low relevance variants depend on the number of the documents, found by the previous variants, so they are looked up sequentially
+	std::vector<VariantLookup> lookups;
+	h_vector<size_t, 16> parallelVariants;
+	if (maxThreads_ > 1 && termVariants.size() >= 2 * kMinVariantsPerThread) {
+		for (size_t i = 0; i < termVariants.size(); ++i) {
+			if (!termVariants[i].lowRelevance) {
+				// Pattern is cached by the first call, so the variants are not modified by the workers
+				std::ignore = termVariants[i].PatternUtf8();
+				parallelVariants.emplace_back(i);
+			}
+		}
+		const unsigned threads = std::min<size_t>(maxThreads_, parallelVariants.size() / kMinVariantsPerThread);
+		if (threads > 1) {
+			lookups.resize(termVariants.size());
+			runParallel(parallelVariants.size(), threads, nullptr, [&](const Selector& selector, size_t idx) {
+				const size_t variantIdx = parallelVariants[idx];
+				auto& lookup = lookups[variantIdx];
+				selector.lookupVariant(termVariants[variantIdx], docsExcluded, lookup.excludedCnt,
+									   [&lookup](WordIdType wordId, std::string_view word, float proc) {
+										   lookup.matches.emplace_back(VariantMatch{wordId, word, proc});
+										   return true;
+									   });
+			});
+		}
+	}
+
+	for (size_t variantIdx = 0; variantIdx < termVariants.size(); ++variantIdx) {
+		auto& variant = termVariants[variantIdx];
 		size_t matched = 0, vids = 0, excludedCnt = 0;
-		const std::string& patternUtf8 = variant.PatternUtf8();
-		const size_t patternBytes = patternUtf8.length();
-		for (const auto& step : holder_.steps) {
+		const auto addMatch = [&](WordIdType wordId, std::string_view word, float proc) {
 			if (variant.lowRelevance && totalVids >= lowRelevanceLimit) {
-				break;
+				return false;
 			}
-
-			auto& suffixes = step.suffixes_;
-			bool needStop = false;
-			for (auto wordIt = suffixes.lower_bound(patternUtf8); wordIt != suffixes.end() && !needStop; ++wordIt) {
-				if (variant.lowRelevance && totalVids >= lowRelevanceLimit) {
-					break;
-				}
-				needStop = wordIt.lcp() < int(patternBytes);
-
-				const char* suffixPtr = wordIt->first;
-				const WordIdType wordId = wordIt->second;
-
+			if (auto it = wordsFound.find(wordId); it != wordsFound.end()) {
+				res.Subterm(it->second).SetProc(std::max(res.Subterm(it->second).Proc(), proc));
+			} else {
 				const auto& wordEntry = holder_.GetWordEntry(wordId);
-				if (allVidsExcluded(docsExcluded, wordEntry.vids)) {
-					++excludedCnt;
-					continue;
-				}
-
-				const std::string_view word = holder_.GetWord(wordId);
-
-				const size_t wordLengthBeforePattern = suffixPtr - word.data();
-				const bool isPrefix = (wordLengthBeforePattern == 0);
-				const size_t wordLengthAfterPattern = word.length() - wordLengthBeforePattern - patternBytes;
-				const bool isSuffix = (wordLengthAfterPattern == 0);
-
-				if (!variant.suff && !isPrefix) {
-					continue;
-				}
-				if (!variant.pref && !isSuffix) {
-					break;
-				}
+				res.AddSubterm(wordEntry.vids, wordEntry.blocks, word, wordId, proc);
+				wordsFound[wordId] = res.NumSubterms() - 1;
+				matched++;
+				totalVids += wordEntry.vids.size();
+				vids += wordEntry.vids.size();
 
-				// ToDo fix it (broken for russian utf8 symbols)
-				const int matchDif = std::abs(long(word.length() - variant.PatternUtf8().length() + wordLengthBeforePattern));
-				const float boost = std::max(getTermBoost(std::string(word)), variant.boost);
-				const float decreasePenalty = static_cast<float>(holder_.cfg_->partialMatchDecrease * matchDif) /
-											  std::max<float>(variant.PatternUtf8().length(), kMinPartialMatchDenominator);
-				float proc = std::max<float>(variant.proc - decreasePenalty, isPrefix ? rankingCfg.PrefixMin() : rankingCfg.SuffixMin());
-				proc = std::min<float>(proc, variant.proc);
-				if (boost > 0.0f) {
-					proc *= boost;
+				if (holder_.cfg_->logLevel >= LogTrace) [[unlikely]] {
+					logFmt(LogInfo, "Matched word '{}' (variant '{}'), {} vids, {}%", word, variant.FullPattern(), wordEntry.vids.size(),
+						   proc);
 				}
+			}
+			return true;
+		};
 
-				if (auto it = wordsFound.find(wordId); it != wordsFound.end()) {
-					res.Subterm(it->second).SetProc(std::max(res.Subterm(it->second).Proc(), proc));
-				} else {
-					res.AddSubterm(wordEntry.vids, word, wordId, proc);
-					wordsFound[wordId] = res.NumSubterms() - 1;
-					matched++;
-					totalVids += wordEntry.vids.size();
-					vids += wordEntry.vids.size();
-
-					if (holder_.cfg_->logLevel >= LogTrace) [[unlikely]] {
-						logFmt(LogInfo, "Matched word '{}' (variant '{}'), {} vids, {}%", word, variant.FullPattern(),
-							   wordEntry.vids.size(), proc);
-					}
-				}
+		if (!lookups.empty() && !variant.lowRelevance) {
+			excludedCnt = lookups[variantIdx].excludedCnt;
+			for (const VariantMatch& m : lookups[variantIdx].matches) {
+				std::ignore = addMatch(m.wordId, m.word, m.proc);
 			}
+		} else if (!variant.lowRelevance || totalVids < lowRelevanceLimit) {
+			lookupVariant(variant, docsExcluded, excludedCnt, addMatch);
 		}
 
 		if (holder_.cfg_->logLevel >= LogInfo) [[unlikely]] {
@@ -366,6 +417,38 @@ ft::TermResults<IdCont> Selector<IdCont>::buildTermResults(const FtDSLEntry& ter
 	return res;
 }
 
+template <typename IdCont>
+template <typename F>
+void Selector<IdCont>::runParallel(size_t count, unsigned threads, const RdxContext* rdxCtx, const F& task) {
+	std::atomic<size_t> next{0};
+	ExceptionPtrWrapper exWrp;
+	const auto worker = [&](bool isMainThread) noexcept {
+		try {
+			// Workers' selectors do not start the nested parallel lookups
+			Selector selector(*this, 1);
+			for (auto idx = next.fetch_add(1, std::memory_order_relaxed); idx < count; idx = next.fetch_add(1, std::memory_order_relaxed)) {
+				if (isMainThread && rdxCtx) {
+					ThrowOnCancel(*rdxCtx);
+				}
+				task(selector, idx);
+			}
+		} catch (...) {
+			exWrp.SetException(std::current_exception());
+			next.store(count, std::memory_order_relaxed);
+		}
+	};
+
+	// Workers run on the shared pool's threads, which are idle at the moment. If the pool is busy with the other selects,
+	// all of the tasks are executed by the calling thread, which also checks the cancellation
+	SelectWorkersPool::Workers workers(threads - 1);
+	for (unsigned i = 0; i < workers.Count(); ++i) {
+		workers.Run([&worker] { worker(false); });
+	}
+	worker(true);
+	workers.Wait();
+	exWrp.RethrowException();
+}
+
 template <typename IdCont>
 static FtDslOpts calcSubstitutionOptions(const ft::QueryMergeData<IdCont>& queryMergeData, const Synonyms::Substitution& subst) {
 	FtDslOpts substOpts = queryMergeData.queryParts[subst.positionsSubstituted[0]].Term().Opts();
@@ -393,14 +476,11 @@ static FtDslOpts calcSubstitutionOptions(const ft::QueryMergeData<IdCont>& query
 }
 
 template <typename IdCont>
-h_vector<size_t, 4> Selector<IdCont>::addSynonymsBySplittingTermVariants(TermVariants& termVariants,
-																		 const FtMergeStatuses::Statuses& docsExcluded,
-																		 ft::QueryMergeData<IdCont>& queryMergeData) {
+void Selector<IdCont>::addSynonymsBySplittingTermVariants(TermVariants& termVariants, const FtMergeStatuses::Statuses& docsExcluded,
+														  std::vector<ft::Synonym<IdCont>>& synonyms) {
 	const FTRankingConfig& rankingCfg = holder_.cfg_->rankingConfig;
 	const StopWordsSetT& stopWords = holder_.cfg_->stopWords;
 
-	h_vector<size_t, 4> synonymIds;
-
 	for (auto& tv : termVariants) {
 		if (!tv.split || tv.pattern.size() <= kMinSplitSize) {
 			continue;
@@ -438,10 +518,7 @@ h_vector<size_t, 4> Selector<IdCont>::addSynonymsBySplittingTermVariants(TermVar
 					v.boost = getTermBoost(v.PatternUtf8());
 				}
 
-				ft::TermResults<IdCont> firstPartTerm =
-					buildTermResults(FtDSLEntry(std::wstring(firstSplitPart), opts), firstPartVariants, docsExcluded);
-				queryMergeData.totalORVids += firstPartTerm.MaxVDocs();
-				synData.AddTerm(std::move(firstPartTerm));
+				synData.AddTerm(buildTermResults(FtDSLEntry(std::wstring(firstSplitPart), opts), firstPartVariants, docsExcluded));
 
 				// adding second synonym part
 				TermVariants secondPartVariants(opts);
@@ -457,21 +534,69 @@ h_vector<size_t, 4> Selector<IdCont>::addSynonymsBySplittingTermVariants(TermVar
 					v.boost = getTermBoost(v.PatternUtf8());
 				}
 
-				ft::TermResults<IdCont> secondPartTerm =
-					buildTermResults(FtDSLEntry(std::wstring(secondSplitPart), opts), secondPartVariants, docsExcluded);
-				queryMergeData.totalORVids += secondPartTerm.MaxVDocs();
-				synData.AddTerm(std::move(secondPartTerm));
+				synData.AddTerm(buildTermResults(FtDSLEntry(std::wstring(secondSplitPart), opts), secondPartVariants, docsExcluded));
 
-				queryMergeData.synonyms.emplace_back(std::move(synData));
-				synonymIds.push_back(queryMergeData.synonyms.size() - 1);
+				synonyms.emplace_back(std::move(synData));
 			}
 
 			std::ignore = utf8::unchecked::next(splitIt);
 			++splitIdx;
 		}
 	}
+}
+
+template <typename IdCont>
+typename Selector<IdCont>::TermLookup Selector<IdCont>::lookupTerm(const FtDSLQuery& query, size_t termIdx,
+																	   const FtMergeStatuses::Statuses& docsExcluded) {
+	const FTRankingConfig& rankingCfg = holder_.cfg_->rankingConfig;
+	const FtDSLEntry& term = query.GetTerm(termIdx);
+	TermVariants termVariants(term.Opts());
+	termVariants.emplace_back(term.Pattern(), rankingCfg.FullMatch());
+
+	const bool phraseTerm = term.Opts().phraseNum != -1;
+	const bool exact = term.Opts().exact;
+	std::vector<ft::Synonym<IdCont>> splitSynonyms;
+
+	if (phraseTerm) {
+		tryToCorrectKbLayout(termVariants);
+		tryToCorrectTypos(termVariants);
+		tryToSplit(termVariants, PhraseTerm_True);
+		addSynonyms(termVariants);
+
+		if (!exact) {
+			transliterate(termVariants);
+			stem(termVariants);
+		}
+	} else if (exact) {
+		tryToCorrectTypos(termVariants);
+	} else {
+		bool needJoinWithPrevTerm = holder_.cfg_->enableTermsConcat && termIdx > 0;
+		if (needJoinWithPrevTerm && term.CanBeJoinedWith(query.GetTerm(termIdx - 1))) {
+			FtDSLEntry joinedTerm = term.JoinWithPrevTerm(query.GetTerm(termIdx - 1));
+			termVariants.emplace_back(std::move(joinedTerm.Pattern()), rankingCfg.Concat(), joinedTerm.Opts());
+			termVariants.back().split = false;
+		}
+
+		tryToCorrectKbLayout(termVariants);
+		if (term.Opts().op == OpOr && holder_.cfg_->enableTermsSplit) {
+			addSynonymsBySplittingTermVariants(termVariants, docsExcluded, splitSynonyms);
+		}
 
-	return synonymIds;
+		tryToCorrectTypos(termVariants);
+		tryToSplit(termVariants, PhraseTerm_False);
+		transliterate(termVariants);
+		stem(termVariants);
+		addSynonyms(termVariants);
+		// stem synonyms
+		stem(termVariants);
+	}
+
+	for (auto& v : termVariants) {
+		v.boost = getTermBoost(v.PatternUtf8());
+	}
+
+	ft::TermResults<IdCont> results = buildTermResults(term, termVariants, docsExcluded);
+	return TermLookup{std::move(termVariants), std::move(results), std::move(splitSynonyms)};
 }
 
 template <typename IdCont>
@@ -485,14 +610,23 @@ void Selector<IdCont>::buildQueryMergeData(FtDSLQuery&& query, const FtMergeStat
 	__RX_VAR_FROM_POOL__(std::vector<TermVariants>, variantsForSubstitution)
 	__RX_VAR_FROM_POOL__(std::vector<size_t>, variantsForSubstitutionPositions)
 
-	for (size_t queryTermIdx = 0; queryTermIdx < query.NumTerms(); ++queryTermIdx) {
-		if (!inTransaction) {
-			ThrowOnCancel(rdxCtx);
+	// Terms are looked up independently from each other. Single term query may still use the threads to look up its variants
+	std::vector<std::optional<TermLookup>> lookups(query.NumTerms());
+	if (const unsigned threads = std::min<size_t>(maxThreads_, query.NumTerms()); threads > 1) {
+		runParallel(query.NumTerms(), threads, inTransaction ? nullptr : &rdxCtx,
+					[&](Selector& selector, size_t idx) { lookups[idx].emplace(selector.lookupTerm(query, idx, docsExcluded)); });
+	} else {
+		for (size_t queryTermIdx = 0; queryTermIdx < query.NumTerms(); ++queryTermIdx) {
+			if (!inTransaction) {
+				ThrowOnCancel(rdxCtx);
+			}
+			lookups[queryTermIdx].emplace(lookupTerm(query, queryTermIdx, docsExcluded));
 		}
+	}
 
+	for (size_t queryTermIdx = 0; queryTermIdx < query.NumTerms(); ++queryTermIdx) {
 		const FtDSLEntry& term = query.GetTerm(queryTermIdx);
-		TermVariants termVariants(term.Opts());
-		termVariants.emplace_back(term.Pattern(), rankingCfg.FullMatch());
+		TermLookup& lookup = *lookups[queryTermIdx];
 
 		const bool phraseTerm = term.Opts().phraseNum != -1;
 		if (!phraseTerm && nextPhrase.NumTerms()) {
@@ -501,49 +635,16 @@ void Selector<IdCont>::buildQueryMergeData(FtDSLQuery&& query, const FtMergeStat
 			nextPhrase.clear();
 		}
 
-		const bool exact = term.Opts().exact;
 		h_vector<size_t, 4> synonymIds;
-
-		if (phraseTerm) {
-			tryToCorrectKbLayout(termVariants);
-			tryToCorrectTypos(termVariants);
-			tryToSplit(termVariants, PhraseTerm_True);
-			addSynonyms(termVariants);
-
-			if (!exact) {
-				transliterate(termVariants);
-				stem(termVariants);
+		for (ft::Synonym<IdCont>& synData : lookup.splitSynonyms) {
+			for (const auto& synTerm : synData) {
+				queryMergeData.totalORVids += synTerm.MaxVDocs();
 			}
-		} else if (exact) {
-			tryToCorrectTypos(termVariants);
-		} else {
-			bool needJoinWithPrevTerm = holder_.cfg_->enableTermsConcat && queryTermIdx > 0;
-			if (needJoinWithPrevTerm && term.CanBeJoinedWith(query.GetTerm(queryTermIdx - 1))) {
-				FtDSLEntry joinedTerm = term.JoinWithPrevTerm(query.GetTerm(queryTermIdx - 1));
-				termVariants.emplace_back(std::move(joinedTerm.Pattern()), rankingCfg.Concat(), joinedTerm.Opts());
-				termVariants.back().split = false;
-			}
-
-			tryToCorrectKbLayout(termVariants);
-			if (term.Opts().op == OpOr && holder_.cfg_->enableTermsSplit) {
-				synonymIds = addSynonymsBySplittingTermVariants(termVariants, docsExcluded, queryMergeData);
-			}
-
-			tryToCorrectTypos(termVariants);
-			tryToSplit(termVariants, PhraseTerm_False);
-			transliterate(termVariants);
-			stem(termVariants);
-			addSynonyms(termVariants);
-			// stem synonyms
-			stem(termVariants);
-		}
-
-		for (auto& v : termVariants) {
-			v.boost = getTermBoost(v.PatternUtf8());
+			queryMergeData.synonyms.emplace_back(std::move(synData));
+			synonymIds.push_back(queryMergeData.synonyms.size() - 1);
 		}
 
-		ft::TermResults<IdCont> nextTerm = buildTermResults(term, termVariants, docsExcluded);
-		queryMergeData.totalORVids += nextTerm.MaxVDocs();
+		queryMergeData.totalORVids += lookup.results.MaxVDocs();
 		if (phraseTerm) {
 			if (nextPhrase.NumTerms() && curPhraseNum != term.Opts().phraseNum) {
 				queryMergeData.queryParts.emplace_back(std::move(nextPhrase));
@@ -552,15 +653,15 @@ void Selector<IdCont>::buildQueryMergeData(FtDSLQuery&& query, const FtMergeStat
 			}
 
 			curPhraseNum = term.Opts().phraseNum;
-			nextPhrase.Add(std::move(nextTerm));
+			nextPhrase.Add(std::move(lookup.results));
 		} else {
-			queryMergeData.queryParts.emplace_back(std::move(nextTerm));
+			queryMergeData.queryParts.emplace_back(std::move(lookup.results));
 			for (size_t synonymId : synonymIds) {
 				queryMergeData.queryParts.back().AddSynonymId(synonymId);
 			}
 
-			if (termVariants.Op() != OpNot) {
-				variantsForSubstitution.emplace_back(std::move(termVariants));
+			if (lookup.variants.Op() != OpNot) {
+				variantsForSubstitution.emplace_back(std::move(lookup.variants));
 				variantsForSubstitutionPositions.emplace_back(queryMergeData.queryParts.size() - 1);
 			}
 		}
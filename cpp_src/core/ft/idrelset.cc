@@ -234,4 +234,42 @@ size_t IdRelType::unpackWithoutArrayIdxs(const uint8_t* buf, uint32_t len, VDocI
 	return data - buf;
 }
 
+// Each position is stored as a single value (pos delta << 1) | 1, if its field and array index are the same as the ones of the previous
+// position. Otherwise it is stored as 3 values: pos << 1, field and array index
+size_t IdRelType::packPositions(std::vector<uint32_t>& values) const {
+	const size_t initialSize = values.size();
+	uint32_t field = 0, arrayIdx = 0, pos = 0;
+	for (const auto& p : pos_) {
+		if (p.field() == field && p.arrayIdx() == arrayIdx && p.pos() >= pos) {
+			values.emplace_back(((p.pos() - pos) << 1) | 1);
+		} else {
+			values.emplace_back(p.pos() << 1);
+			values.emplace_back(p.field());
+			values.emplace_back(p.arrayIdx());
+			field = p.field();
+			arrayIdx = p.arrayIdx();
+		}
+		pos = p.pos();
+	}
+	return values.size() - initialSize;
+}
+
+void IdRelType::unpackPositions(VDocIdType id, const uint32_t* values, size_t count) {
+	id_ = id;
+	pos_.clear<false>();
+	uint32_t field = 0, arrayIdx = 0, pos = 0;
+	for (const uint32_t* end = values + count; values < end; ++values) {
+		if (*values & 1) {
+			pos += (*values >> 1);
+		} else {
+			assertrx_dbg(end - values >= 3);
+			pos = (*values >> 1);
+			field = values[1];
+			arrayIdx = values[2];
+			values += 2;
+		}
+		pos_.emplace_back(pos, field, arrayIdx);
+	}
+}
+
 }  // namespace reindexer
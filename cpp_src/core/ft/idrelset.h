@@ -78,6 +78,10 @@ public:
 
 	size_t maxpackedsize() const { return 2 * (sizeof(VDocIdType) + 1) + (pos_.size() * (sizeof(uint32_t) + 1)); }
 
+	// BlockPackedIdRelVec callbacks. Positions are stored as the stream of uint32 values. Returns number of the appended values
+	size_t packPositions(std::vector<uint32_t>& values) const;
+	void unpackPositions(VDocIdType id, const uint32_t* values, size_t count);
+
 	void reserve(int s) { pos_.reserve(s); }
 	bool empty() const noexcept { return pos_.empty(); }
 
@@ -114,7 +118,7 @@ public:
 
 	size_t HeapSize() const noexcept { return pos_.heap_size(); }
 
-	bool ArrayDataFound() {
+	bool ArrayDataFound() const noexcept {
 		for (const auto& p : Pos()) {
 			if (p.arrayIdx() > 0) {
 				return true;
@@ -214,6 +218,15 @@ public:
 	using const_iterator = const iterator;
 	iterator begin() const { return iterator(this, data_.begin(), state(), arrayFoundPos_); }
 	iterator end() const { return iterator(this, data_.end(), state(), arrayFoundPos_); }
+	// Iterator, which starts decoding from the item at the data offset. The ids and fields are delta-encoded, so the previous item's values
+	// are required
+	iterator iterator_at(size_t dataOffset, VDocIdType prevId, unsigned prevField) const {
+		assertrx_dbg(dataOffset <= data_.size());
+		state st;
+		st.lastId = prevId;
+		st.lastField = prevField;
+		return iterator(this, data_.begin() + dataOffset, st, arrayFoundPos_);
+	}
 
 	void erase_back(state st, size_t dataSize) {
 		data_.resize(dataSize);
@@ -228,6 +241,11 @@ public:
 
 	template <typename InputIterator>
 	void insert_back(InputIterator from, InputIterator to) {
+		insert_back(from, to, [](const IdRelType&, size_t, VDocIdType, unsigned) noexcept {});
+	}
+	// onPack is called for each item with its data offset and the previous item's values, i.e. with the arguments for iterator_at()
+	template <typename InputIterator, typename OnPack>
+	void insert_back(InputIterator from, InputIterator to, OnPack&& onPack) {
 		data_.reserve((to - from) / 2);
 		int i = 0;
 		size_type p = data_.size();
@@ -246,6 +264,7 @@ public:
 				}
 			}
 
+			onPack(*it, p, st_.lastId, st_.lastField);
 			if (p >= arrayFoundPos_) {
 				p += it->pack(&*(data_.begin() + p), st_.lastId, st_.lastField);
 			} else {
@@ -262,7 +281,7 @@ public:
 	}
 
 	void shrink_to_fit() { data_.shrink_to_fit(); }
-	size_type heap_size() noexcept { return data_.capacity(); }
+	size_type heap_size() const noexcept { return data_.capacity(); }
 	void clear() noexcept {
 		data_.clear();
 		st_ = state();
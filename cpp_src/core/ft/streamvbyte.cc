@@ -0,0 +1,167 @@
+#include "streamvbyte.h"
+#include <array>
+#include "estl/defines.h"
+#include "tools/cpucheck.h"
+
+#if REINDEXER_WITH_SSE
+#include <immintrin.h>
+#endif	// REINDEXER_WITH_SSE
+
+namespace reindexer {
+
+namespace {
+
+struct [[nodiscard]] DecodeTables {
+	// Number of the data bytes in the group
+	std::array<uint8_t, 256> lengths{};
+	// Shuffle masks, which move the data bytes of the group into 4 little-endian uint32 values
+	std::array<std::array<uint8_t, 16>, 256> shuffles{};
+};
+
+constexpr DecodeTables makeDecodeTables() noexcept {
+	DecodeTables tables;
+	for (unsigned ctrl = 0; ctrl < 256; ++ctrl) {
+		uint8_t offset = 0;
+		for (unsigned v = 0; v < 4; ++v) {
+			const unsigned len = ((ctrl >> (2 * v)) & 3) + 1;
+			for (unsigned b = 0; b < 4; ++b) {
+				tables.shuffles[ctrl][4 * v + b] = (b < len) ? uint8_t(offset + b) : 0x80;
+			}
+			offset += len;
+		}
+		tables.lengths[ctrl] = offset;
+	}
+	return tables;
+}
+
+constexpr DecodeTables kDecodeTables = makeDecodeTables();
+
+constexpr size_t controlSize(size_t count) noexcept { return (count + 3) / 4; }
+
+const uint8_t* decodeScalar(const uint8_t* ctrl, const uint8_t* data, size_t from, size_t count, uint32_t* out) noexcept {
+	for (size_t i = from; i < count; ++i) {
+		const unsigned len = ((ctrl[i / 4] >> (2 * (i % 4))) & 3) + 1;
+		uint32_t val = 0;
+		for (unsigned b = 0; b < len; ++b) {
+			val |= uint32_t(data[b]) << (8 * b);
+		}
+		out[i] = val;
+		data += len;
+	}
+	return data;
+}
+
+#if REINDEXER_WITH_SSE
+
+// Each group requires 16 readable bytes, so the last groups are decoded by the scalar code
+inline const uint8_t* decodeGroupsSSE(const uint8_t* ctrl, const uint8_t* data, const uint8_t* end, size_t& group, size_t groups,
+									  uint32_t* out) noexcept {
+	for (; group < groups && end - data >= 16; ++group) {
+		const uint8_t c = ctrl[group];
+		const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kDecodeTables.shuffles[c].data()));
+		const __m128i vals = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), mask);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * group), vals);
+		data += kDecodeTables.lengths[c];
+	}
+	return data;
+}
+
+size_t decodeSSE(const uint8_t* in, size_t inSize, size_t count, uint32_t* out) noexcept {
+	const uint8_t* ctrl = in;
+	size_t group = 0;
+	const uint8_t* data = decodeGroupsSSE(ctrl, in + controlSize(count), in + inSize, group, count / 4, out);
+	return decodeScalar(ctrl, data, group * 4, count, out) - in;
+}
+
+// Two groups are decoded at once: one per 128-bit lane
+RX_AVX2_TARGET_ATTR size_t decodeAVX2(const uint8_t* in, size_t inSize, size_t count, uint32_t* out) noexcept {
+	const uint8_t* ctrl = in;
+	const uint8_t* data = in + controlSize(count);
+	const uint8_t* end = in + inSize;
+	const size_t groups = count / 4;
+	size_t group = 0;
+	for (; group + 1 < groups && end - data >= 32; group += 2) {
+		const uint8_t c0 = ctrl[group], c1 = ctrl[group + 1];
+		const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+		const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + kDecodeTables.lengths[c0]));
+		const __m128i maskLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kDecodeTables.shuffles[c0].data()));
+		const __m128i maskHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kDecodeTables.shuffles[c1].data()));
+		const __m256i mask = _mm256_inserti128_si256(_mm256_castsi128_si256(maskLo), maskHi, 1);
+		const __m256i vals = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), mask);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * group), vals);
+		data += kDecodeTables.lengths[c0] + kDecodeTables.lengths[c1];
+	}
+	data = decodeGroupsSSE(ctrl, data, end, group, groups, out);
+	return decodeScalar(ctrl, data, group * 4, count, out) - in;
+}
+
+#else	// REINDEXER_WITH_SSE
+
+size_t decodeScalarAll(const uint8_t* in, size_t /*inSize*/, size_t count, uint32_t* out) noexcept {
+	return decodeScalar(in, in + controlSize(count), 0, count, out) - in;
+}
+
+#endif	// REINDEXER_WITH_SSE
+
+using DecodeFnT = size_t (*)(const uint8_t* in, size_t inSize, size_t count, uint32_t* out) noexcept;
+
+DecodeFnT initDecodeFn() noexcept {
+#if REINDEXER_WITH_SSE
+	if (IsAVX2Allowed()) {
+		return decodeAVX2;
+	}
+	return decodeSSE;
+#else	// REINDEXER_WITH_SSE
+	return decodeScalarAll;
+#endif	// REINDEXER_WITH_SSE
+}
+
+const DecodeFnT decodeFn = initDecodeFn();
+
+}  // namespace
+
+size_t StreamVByteEncode(const uint32_t* in, size_t count, uint8_t* out) noexcept {
+	uint8_t* ctrl = out;
+	uint8_t* data = out + controlSize(count);
+	for (size_t i = 0; i < count; i += 4) {
+		uint8_t c = 0;
+		for (size_t v = 0; v < 4 && i + v < count; ++v) {
+			const uint32_t val = in[i + v];
+			const unsigned len = (val < (1u << 8)) ? 1 : (val < (1u << 16)) ? 2 : (val < (1u << 24)) ? 3 : 4;
+			for (unsigned b = 0; b < len; ++b) {
+				*(data++) = uint8_t(val >> (8 * b));
+			}
+			c |= uint8_t((len - 1) << (2 * v));
+		}
+		ctrl[i / 4] = c;
+	}
+	return data - out;
+}
+
+size_t StreamVByteDecode(const uint8_t* in, size_t inSize, size_t count, uint32_t* out) noexcept {
+	return decodeFn(in, inSize, count, out);
+}
+
+void DeltaDecode(uint32_t* values, size_t count, uint32_t base) noexcept {
+	size_t i = 0;
+#if REINDEXER_WITH_SSE
+	__m128i prev = _mm_set1_epi32(int(base));
+	for (; i + 4 <= count; i += 4) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+		v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+		v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+		v = _mm_add_epi32(v, prev);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), v);
+		prev = _mm_shuffle_epi32(v, 0xFF);
+	}
+	if (i) {
+		base = values[i - 1];
+	}
+#endif	// REINDEXER_WITH_SSE
+	for (; i < count; ++i) {
+		base += values[i];
+		values[i] = base;
+	}
+}
+
+}  // namespace reindexer
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace reindexer {
+
+// Stream VByte codec for the arrays of uint32 values. Each group of 4 values has a control byte with 2-bit lengths (1-4 bytes) of the
+// values. All of the control bytes are stored before the data bytes, so the groups may be decoded by the SIMD shuffles
+constexpr size_t StreamVByteMaxEncodedSize(size_t count) noexcept { return (count + 3) / 4 + count * sizeof(uint32_t); }
+
+// Returns number of the written bytes. 'out' must have at least StreamVByteMaxEncodedSize(count) bytes
+size_t StreamVByteEncode(const uint32_t* in, size_t count, uint8_t* out) noexcept;
+// Returns number of the read bytes. 'inSize' is the number of the bytes available for read: SIMD decoders may read up to 16 bytes at once
+size_t StreamVByteDecode(const uint8_t* in, size_t inSize, size_t count, uint32_t* out) noexcept;
+
+// Replaces the deltas with the prefix sums, starting from 'base'
+void DeltaDecode(uint32_t* values, size_t count, uint32_t base) noexcept;
+
+}  // namespace reindexer
@@ -267,9 +267,8 @@ public:
 		auto [set, isUsingBtree] = set_.Get(std::memory_order_relaxed);
 
 		if (size() >= kMaxPlainIdsetSize && !set) [[unlikely]] {
-			auto tmpSet = std::make_unique<base_idsetset>(begin(), end());
-			set = tmpSet.get();
-			set_.Reset(tmpSet.release(), std::memory_order_relaxed);
+			set_.Reset(new AtomicBtreePtr::SharedBtree(begin(), end()), std::memory_order_relaxed);
+			set = set_.Get(std::memory_order_relaxed).first;
 		}
 
 		if (!set) {
@@ -291,7 +290,7 @@ public:
 
 		assertrx_dbg(size() == 0);
 		assertrx_dbg(!IsCommitted());
-		return set->insert(id).second;
+		return set_.GetMutable()->insert(id).second;
 	}
 
 	/// @brief Adds a new ID into the end of the set without any ordering (O(1)).
@@ -316,7 +315,7 @@ public:
 	/// @brief Removes an ID from the set.
 	/// @note Assumes that the container is sorted (not filled through AddUnordered()).
 	/// @return the number of deleted items.
-	int Erase(IdType id) noexcept {
+	int Erase(IdType id) {
 		auto [set, isUsingBtree] = set_.Get(std::memory_order_relaxed);
 		if (!set) {
 			auto d = std::equal_range(base_idset::begin(), base_idset::end(), id);
@@ -329,7 +328,7 @@ public:
 		if (!isUsingBtree) {
 			setUsingBtree(true);
 		}
-		return set->erase(id);
+		return set_.GetMutable()->erase(id);
 	}
 	/// @note Has to be called either in background thread under namespace read lock or in foreground thread under namespace write lock
 	void Commit(base_idset::size_type sortedIdxCount);
@@ -385,19 +384,22 @@ protected:
 private:
 	void setUsingBtree(bool val) noexcept { set_.SetMark(val); }
 
+	/// Btree is shared between IdSet's copies (for example, between namespace and its copy, created for the large transaction)
+	/// and gets copied on the first modification only. Readonly accessors never modify btree, so shared btree is safe to read
+	/// from the different namespaces concurrently
 	class [[nodiscard]] AtomicBtreePtr {
 	public:
+		using SharedBtree = intrusive_atomic_rc_wrapper<base_idsetset>;
+
 		AtomicBtreePtr() noexcept = default;
-		~AtomicBtreePtr() { deleteMarkedPtr(set_.load()); }
-		AtomicBtreePtr(const AtomicBtreePtr& other) {
-			if (auto [oset, isMarked] = other.Get(std::memory_order_acquire); oset) {
-				auto tmp = std::make_unique<base_idsetset>(*oset);
-				set_.store(uint64_t(tmp.release()));
-				SetMark(isMarked);
-			}
+		~AtomicBtreePtr() { releaseMarkedPtr(set_.load()); }
+		AtomicBtreePtr(const AtomicBtreePtr& other) noexcept {
+			const auto ptr = other.set_.load(std::memory_order_acquire);
+			intrusive_ptr_add_ref(unmark(ptr).first);
+			set_.store(ptr);
 		}
 		AtomicBtreePtr(AtomicBtreePtr&& other) noexcept : set_{other.set_.load()} { other.set_ = 0; }
-		AtomicBtreePtr& operator=(const AtomicBtreePtr& other) {
+		AtomicBtreePtr& operator=(const AtomicBtreePtr& other) noexcept {
 			if (&other != this) {
 				AtomicBtreePtr tmp(other);
 				std::swap(*this, tmp);
@@ -407,17 +409,32 @@ private:
 		AtomicBtreePtr& operator=(AtomicBtreePtr&& other) noexcept {
 			if (&other != this) {
 				auto oldSet = set_.exchange(other.set_.load());
-				deleteMarkedPtr(oldSet);
+				releaseMarkedPtr(oldSet);
 				other.set_ = 0;
 			}
 			return *this;
 		}
 
-		std::pair<base_idsetset*, bool> Get(std::memory_order order) noexcept { return unmark(set_.load(order)); }
 		std::pair<const base_idsetset*, bool> Get(std::memory_order order) const noexcept { return unmark(set_.load(order)); }
-		void Reset(base_idsetset* ptr, std::memory_order order) noexcept {
+		/// @brief Returns btree for modification. Creates own copy of the btree, if it is shared with other IdSet
+		/// @note Has to be called under namespace write lock
+		base_idsetset* GetMutable() {
+			const auto ptr = set_.load(std::memory_order_relaxed);
+			auto [set, isMarked] = unmark(ptr);
+			assertrx_dbg(set);
+			if (!intrusive_ptr_is_unique(set)) {
+				auto tmp = new SharedBtree(static_cast<const base_idsetset&>(*set));
+				intrusive_ptr_add_ref(tmp);
+				set_.store(isMarked ? mark(uint64_t(tmp)) : uint64_t(tmp), std::memory_order_release);
+				intrusive_ptr_release(set);
+				set = tmp;
+			}
+			return set;
+		}
+		void Reset(SharedBtree* ptr, std::memory_order order) noexcept {
+			intrusive_ptr_add_ref(ptr);
 			auto cur = set_.exchange(uint64_t(ptr), order);
-			deleteMarkedPtr(cur);
+			releaseMarkedPtr(cur);
 		}
 		void SetMark(bool val) noexcept {
 			// Method is not really atomic, but it's ok for the current IdSet logic
@@ -431,11 +448,11 @@ private:
 
 	private:
 		constexpr static uint64_t kMark = uint64_t(0x1) << 63;
-		static std::pair<base_idsetset*, bool> unmark(uint64_t ptr) noexcept {
-			return std::make_pair(reinterpret_cast<base_idsetset*>(ptr & (~kMark)), ptr & kMark);
+		static std::pair<SharedBtree*, bool> unmark(uint64_t ptr) noexcept {
+			return std::make_pair(reinterpret_cast<SharedBtree*>(ptr & (~kMark)), ptr & kMark);
 		}
 		static uint64_t mark(uint64_t ptr) noexcept { return ptr | kMark; }
-		void deleteMarkedPtr(uint64_t ptr) noexcept { delete unmark(ptr).first; }
+		static void releaseMarkedPtr(uint64_t ptr) noexcept { intrusive_ptr_release(unmark(ptr).first); }
 
 		// Contains pointer and synchronization mark
 		std::atomic<uint64_t> set_{0};
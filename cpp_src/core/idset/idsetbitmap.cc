@@ -0,0 +1,297 @@
+#include "idsetbitmap.h"
+#include <algorithm>
+#include <ostream>
+
+namespace reindexer {
+
+// Sizes of the containers' heap representations in bytes
+static size_t arrayContainerSize(size_t cardinality) noexcept { return cardinality * sizeof(uint16_t); }
+static size_t runContainerSize(size_t runs) noexcept { return runs * 2 * sizeof(uint16_t); }
+constexpr static size_t kBitsetContainerSize = (size_t(1) << 16) / 8;
+
+IdSetBitmap::Container IdSetBitmap::Container::FromSortedLows(std::span<const uint16_t> lows) {
+	Container c;
+	c.cardinality = lows.size();
+	size_t runs = 0;
+	for (size_t i = 0; i < lows.size(); ++i) {
+		runs += (i == 0 || lows[i] != lows[i - 1] + 1) ? 1 : 0;
+	}
+
+	const size_t arraySize = arrayContainerSize(lows.size());
+	const size_t runSize = runContainerSize(runs);
+	if (runSize < std::min(arraySize, kBitsetContainerSize)) {
+		c.kind = Kind::Run;
+		c.values.reserve(runs * 2);
+		for (size_t i = 0; i < lows.size();) {
+			size_t j = i + 1;
+			while (j < lows.size() && lows[j] == lows[j - 1] + 1) {
+				++j;
+			}
+			c.values.emplace_back(lows[i]);
+			c.values.emplace_back(uint16_t(j - i - 1));
+			i = j;
+		}
+	} else if (lows.size() <= kMaxArraySize) {
+		c.kind = Kind::Array;
+		c.values.assign(lows.begin(), lows.end());
+	} else {
+		c.kind = Kind::Bitset;
+		c.words.assign(kBitsetWords, 0);
+		for (auto low : lows) {
+			c.words[low >> 6] |= uint64_t(1) << (low & 63);
+		}
+	}
+	return c;
+}
+
+bool IdSetBitmap::Container::Contains(uint32_t low) const noexcept {
+	switch (kind) {
+		case Kind::Array:
+			return std::binary_search(values.begin(), values.end(), low);
+		case Kind::Bitset:
+			return (words[low >> 6] >> (low & 63)) & 1;
+		case Kind::Run: {
+			uint32_t pos = kPosEnd;
+			return FindLE(low, pos) == int32_t(low);
+		}
+	}
+	return false;
+}
+
+int32_t IdSetBitmap::Container::FindGE(uint32_t low, uint32_t& pos) const noexcept {
+	assertrx_dbg(low <= kChunkMask);
+	switch (kind) {
+		case Kind::Array: {
+			const auto it = std::lower_bound(values.begin() + std::min<size_t>(pos, values.size()), values.end(), low);
+			if (it == values.end()) {
+				return -1;
+			}
+			pos = it - values.begin();
+			return *it;
+		}
+		case Kind::Bitset: {
+			size_t w = low >> 6;
+			uint64_t bits = words[w] & (~uint64_t(0) << (low & 63));
+			while (!bits) {
+				if (++w == kBitsetWords) {
+					return -1;
+				}
+				bits = words[w];
+			}
+			return int32_t(w * 64 + std::countr_zero(bits));
+		}
+		case Kind::Run: {
+			// Runs' ends are sorted, so looking for the first run, which ends after the low value
+			size_t l = std::min<size_t>(pos, values.size() / 2), r = values.size() / 2;
+			while (l < r) {
+				const size_t m = (l + r) / 2;
+				if (uint32_t(values[2 * m]) + values[2 * m + 1] < low) {
+					l = m + 1;
+				} else {
+					r = m;
+				}
+			}
+			if (l == values.size() / 2) {
+				return -1;
+			}
+			pos = l;
+			return std::max<int32_t>(values[2 * l], low);
+		}
+	}
+	return -1;
+}
+
+int32_t IdSetBitmap::Container::FindLE(uint32_t low, uint32_t& pos) const noexcept {
+	assertrx_dbg(low <= kChunkMask);
+	switch (kind) {
+		case Kind::Array: {
+			const auto begin = values.begin();
+			const auto it = std::upper_bound(begin, begin + std::min<size_t>(size_t(pos) + 1, values.size()), low);
+			if (it == begin) {
+				return -1;
+			}
+			pos = (it - begin) - 1;
+			return *(it - 1);
+		}
+		case Kind::Bitset: {
+			size_t w = low >> 6;
+			const unsigned bit = low & 63;
+			uint64_t bits = words[w] & ((bit == 63) ? ~uint64_t(0) : ((uint64_t(2) << bit) - 1));
+			while (!bits) {
+				if (w == 0) {
+					return -1;
+				}
+				bits = words[--w];
+			}
+			return int32_t(w * 64 + 63 - std::countl_zero(bits));
+		}
+		case Kind::Run: {
+			// Runs' starts are sorted, so looking for the last run, which starts before the low value
+			size_t l = 0, r = std::min<size_t>(size_t(pos) + 1, values.size() / 2);
+			while (l < r) {
+				const size_t m = (l + r) / 2;
+				if (values[2 * m] <= low) {
+					l = m + 1;
+				} else {
+					r = m;
+				}
+			}
+			if (l == 0) {
+				return -1;
+			}
+			pos = l - 1;
+			return std::min<int32_t>(int32_t(values[2 * pos]) + values[2 * pos + 1], low);
+		}
+	}
+	return -1;
+}
+
+bool IdSetBitmap::Cursor::SeekFwd(const IdSetBitmap& bitmap, IdType bound) noexcept {
+	if (end_) {
+		return false;
+	}
+	int64_t target = int64_t(bound.ToNumber()) + 1;
+	if (value_ >= 0 && target <= value_) {
+		return true;
+	}
+	target = std::max<int64_t>(target, 0);
+
+	const auto& keys = bitmap.keys_;
+	const int32_t chunksCount = keys.size();
+	const int64_t high = target >> kChunkBits;
+	if (chunk_ < chunksCount && keys[chunk_] < high) {
+		chunk_ = std::lower_bound(keys.begin() + chunk_, keys.end(), high) - keys.begin();
+		pos_ = 0;
+	}
+	for (; chunk_ < chunksCount; ++chunk_, pos_ = 0) {
+		const uint32_t low = (keys[chunk_] == high) ? uint32_t(target & kChunkMask) : 0;
+		if (const auto v = bitmap.containers_[chunk_].FindGE(low, pos_); v >= 0) {
+			value_ = (int64_t(keys[chunk_]) << kChunkBits) | v;
+			return true;
+		}
+	}
+	end_ = true;
+	return false;
+}
+
+bool IdSetBitmap::Cursor::SeekRev(const IdSetBitmap& bitmap, IdType bound) noexcept {
+	if (end_) {
+		return false;
+	}
+	const int64_t target = int64_t(bound.ToNumber()) - 1;
+	if (value_ >= 0 && target >= value_) {
+		return true;
+	}
+	if (target < 0) {
+		end_ = true;
+		return false;
+	}
+
+	const auto& keys = bitmap.keys_;
+	const int64_t high = target >> kChunkBits;
+	if (chunk_ >= 0 && keys[chunk_] > high) {
+		chunk_ = int32_t(std::upper_bound(keys.begin(), keys.begin() + chunk_ + 1, high) - keys.begin()) - 1;
+		pos_ = kPosEnd;
+	}
+	for (; chunk_ >= 0; --chunk_, pos_ = kPosEnd) {
+		const uint32_t low = (keys[chunk_] == high) ? uint32_t(target & kChunkMask) : kChunkMask;
+		if (const auto v = bitmap.containers_[chunk_].FindLE(low, pos_); v >= 0) {
+			value_ = (int64_t(keys[chunk_]) << kChunkBits) | v;
+			return true;
+		}
+	}
+	end_ = true;
+	return false;
+}
+
+IdSetBitmap::Ptr IdSetBitmap::Build(IdSetCRef ids) {
+	auto bitmap = make_intrusive<intrusive_atomic_rc_wrapper<IdSetBitmap>>();
+	std::vector<uint16_t> lows;
+	lows.reserve(std::min<size_t>(ids.size(), size_t(1) << kChunkBits));
+	for (size_t i = 0; i < ids.size();) {
+		assertrx_dbg(ids[i].IsValid());
+		const auto high = uint32_t(ids[i].ToNumber()) >> kChunkBits;
+		lows.clear();
+		for (; i < ids.size() && (uint32_t(ids[i].ToNumber()) >> kChunkBits) == high; ++i) {
+			assertrx_dbg(lows.empty() || lows.back() < (uint32_t(ids[i].ToNumber()) & kChunkMask));
+			lows.emplace_back(uint16_t(uint32_t(ids[i].ToNumber()) & kChunkMask));
+		}
+		bitmap->emplaceContainer(uint16_t(high), Container::FromSortedLows(lows));
+	}
+	bitmap->keys_.shrink_to_fit();
+	bitmap->containers_.shrink_to_fit();
+	return bitmap;
+}
+
+IdSetBitmap::Ptr IdSetBitmap::TryCompress(IdSetCRef ids) {
+	if (ids.size() < kMinIdsCount) {
+		return {};
+	}
+	// Each chunk requires at least one container, so there is no reason to build bitmap for the sparse sets
+	const size_t chunksCount = (uint32_t(ids.back().ToNumber()) >> kChunkBits) - (uint32_t(ids.front().ToNumber()) >> kChunkBits) + 1;
+	const size_t plainSize = ids.size() * sizeof(IdType);
+	if (chunksCount * sizeof(Container) * 2 > plainSize) {
+		return {};
+	}
+	auto bitmap = Build(ids);
+	if (bitmap->HeapSize() * 2 > plainSize) {
+		return {};
+	}
+	return bitmap;
+}
+
+bool IdSetBitmap::Contains(IdType id) const noexcept {
+	if (!id.IsValid()) {
+		return false;
+	}
+	const auto high = uint32_t(id.ToNumber()) >> kChunkBits;
+	const auto it = std::lower_bound(keys_.begin(), keys_.end(), high);
+	if (it == keys_.end() || *it != high) {
+		return false;
+	}
+	return containers_[it - keys_.begin()].Contains(uint32_t(id.ToNumber()) & kChunkMask);
+}
+
+size_t IdSetBitmap::IntersectSorted(std::span<IdType> ids) const noexcept {
+	if (keys_.empty()) {
+		return 0;
+	}
+	size_t kept = 0, chunk = 0;
+	for (const IdType id : ids) {
+		assertrx_dbg(id.IsValid());
+		const auto high = uint32_t(id.ToNumber()) >> kChunkBits;
+		if (keys_[chunk] < high) {
+			chunk = std::lower_bound(keys_.begin() + chunk, keys_.end(), high) - keys_.begin();
+			if (chunk == keys_.size()) {
+				break;
+			}
+		}
+		if (keys_[chunk] == high && containers_[chunk].Contains(uint32_t(id.ToNumber()) & kChunkMask)) {
+			ids[kept++] = id;
+		}
+	}
+	return kept;
+}
+
+size_t IdSetBitmap::HeapSize() const noexcept {
+	size_t size = keys_.capacity() * sizeof(uint16_t) + containers_.capacity() * sizeof(Container);
+	for (const auto& c : containers_) {
+		size += c.HeapSize();
+	}
+	return size;
+}
+
+void IdSetBitmap::Dump(std::ostream& os) const {
+	os << "[";
+	ForEach([&os](IdType id) { os << id.ToNumber() << ' '; });
+	os << ']';
+}
+
+void IdSetBitmap::emplaceContainer(uint16_t key, Container&& c) {
+	assertrx_dbg(keys_.empty() || keys_.back() < key);
+	size_ += c.cardinality;
+	keys_.emplace_back(key);
+	containers_.emplace_back(std::move(c));
+}
+
+}  // namespace reindexer
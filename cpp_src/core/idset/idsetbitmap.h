@@ -0,0 +1,136 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <vector>
+#include "core/idset/idset.h"
+
+namespace reindexer {
+
+/// @brief Compressed (roaring-like) representation of the sorted IDs set.
+/// @details IDs are split into chunks of 2^16 values by their high bits. Each chunk is stored in the most compact container:
+/// sorted array of the low bits (sparse chunks), bitset (dense chunks) or list of runs (continuous IDs ranges).
+/// Bitmap is immutable after construction, so it may be shared between threads without synchronization.
+class [[nodiscard]] IdSetBitmap {
+public:
+	using Ptr = intrusive_ptr<intrusive_atomic_rc_wrapper<IdSetBitmap>>;
+
+	/// Minimal IDs count to consider bitmap representation instead of the plain vector
+	constexpr static size_t kMinIdsCount = 4096;
+
+	/// @brief Iteration state, which is used by SelectIterator. Does not own bitmap
+	class [[nodiscard]] Cursor {
+	public:
+		/// @brief Moves cursor forward to the first ID, which is greater than bound. Never moves cursor backward
+		/// @return false if there are no such IDs
+		bool SeekFwd(const IdSetBitmap& bitmap, IdType bound) noexcept;
+		/// @brief Moves cursor backward to the first ID, which is less than bound. Never moves cursor forward
+		/// @return false if there are no such IDs
+		bool SeekRev(const IdSetBitmap& bitmap, IdType bound) noexcept;
+		IdType Value() const noexcept { return IdType::FromNumber(IdType::UnderlyingType(value_)); }
+		void StartFwd() noexcept { *this = Cursor{}; }
+		void StartRev(const IdSetBitmap& bitmap) noexcept {
+			*this = Cursor{};
+			chunk_ = int32_t(bitmap.keys_.size()) - 1;
+			pos_ = kPosEnd;
+		}
+		void SetEnd() noexcept { end_ = true; }
+		bool IsEnd() const noexcept { return end_; }
+
+	private:
+		int64_t value_ = -1;
+		int32_t chunk_ = 0;
+		uint32_t pos_ = 0;
+		bool end_ = false;
+	};
+
+	IdSetBitmap() = default;
+
+	/// @brief Builds bitmap from the sorted unique IDs
+	static Ptr Build(IdSetCRef ids);
+	/// @brief Builds bitmap only if IDs set is large enough and bitmap is at least twice as compact as the plain vector
+	static Ptr TryCompress(IdSetCRef ids);
+	/// @brief Intersects the sorted unique IDs with the bitmap in-place
+	/// @return count of the IDs, which were kept in the buffer
+	size_t IntersectSorted(std::span<IdType> ids) const noexcept;
+
+	bool Contains(IdType id) const noexcept;
+	size_t Size() const noexcept { return size_; }
+	bool IsEmpty() const noexcept { return !size_; }
+	size_t HeapSize() const noexcept;
+	/// Heap size of the same IDs set in the plain vector representation
+	size_t PlainHeapSize() const noexcept { return size_ * sizeof(IdType); }
+	void Dump(std::ostream&) const;
+
+	template <typename F>
+	void ForEach(F&& f) const {
+		for (size_t i = 0, sz = keys_.size(); i < sz; ++i) {
+			const int32_t high = int32_t(keys_[i]) << kChunkBits;
+			containers_[i].ForEach([&f, high](uint32_t low) { f(IdType::FromNumber(high | int32_t(low))); });
+		}
+	}
+
+private:
+	constexpr static unsigned kChunkBits = 16;
+	constexpr static uint32_t kChunkMask = (1u << kChunkBits) - 1;
+	constexpr static size_t kBitsetWords = (size_t(1) << kChunkBits) / 64;
+	constexpr static size_t kMaxArraySize = 4096;
+	// Position hint, which points to the end of the container
+	constexpr static uint32_t kPosEnd = std::numeric_limits<uint32_t>::max();
+
+	enum class [[nodiscard]] Kind : uint8_t { Array, Bitset, Run };
+
+	struct [[nodiscard]] Container {
+		using Words = std::vector<uint64_t>;
+
+		static Container FromSortedLows(std::span<const uint16_t> lows);
+
+		bool Contains(uint32_t low) const noexcept;
+		int32_t FindGE(uint32_t low, uint32_t& pos) const noexcept;
+		int32_t FindLE(uint32_t low, uint32_t& pos) const noexcept;
+		size_t HeapSize() const noexcept { return values.capacity() * sizeof(uint16_t) + words.capacity() * sizeof(uint64_t); }
+
+		template <typename F>
+		void ForEach(F&& f) const {
+			switch (kind) {
+				case Kind::Array:
+					for (auto v : values) {
+						f(uint32_t(v));
+					}
+					break;
+				case Kind::Run:
+					for (size_t i = 0, sz = values.size(); i < sz; i += 2) {
+						for (uint32_t v = values[i], end = uint32_t(values[i]) + values[i + 1]; v <= end; ++v) {
+							f(v);
+						}
+					}
+					break;
+				case Kind::Bitset:
+					for (size_t w = 0; w < words.size(); ++w) {
+						for (uint64_t bits = words[w]; bits; bits &= bits - 1) {
+							f(uint32_t(w * 64 + std::countr_zero(bits)));
+						}
+					}
+					break;
+			}
+		}
+
+		Kind kind = Kind::Array;
+		uint32_t cardinality = 0;
+		// Array: sorted low bits of the IDs; Run: pairs of {run start, run length - 1}
+		std::vector<uint16_t> values;
+		// Bitset: 2^16 bits
+		Words words;
+	};
+
+	void emplaceContainer(uint16_t key, Container&& c);
+
+	std::vector<uint16_t> keys_;
+	std::vector<Container> containers_;
+	size_t size_ = 0;
+};
+
+}  // namespace reindexer
@@ -2,6 +2,7 @@
 
 #include <utility>
 #include "core/idset/idset.h"
+#include "core/idset/idsetbitmap.h"
 #include "core/keyvalue/variant.h"
 #include "core/lrucache.h"
 #include "core/type_consts_helpers.h"
@@ -90,26 +91,38 @@ private:
 struct [[nodiscard]] IdSetCacheVal {
 	IdSetCacheVal() noexcept = default;
 	IdSetCacheVal(IdSetPlain::Ptr&& i) noexcept : ids(std::move(i)) {}
-	size_t Size() const noexcept { return ids ? (sizeof(*ids.get()) + ids->HeapSize()) : 0; }
-	bool IsInitialized() const noexcept { return bool(ids); }
+	IdSetCacheVal(IdSetBitmap::Ptr&& b) noexcept : bitmap(std::move(b)) {}
+	size_t Size() const noexcept {
+		if (bitmap) {
+			return sizeof(*bitmap.get()) + bitmap->HeapSize();
+		}
+		return ids ? (sizeof(*ids.get()) + ids->HeapSize()) : 0;
+	}
+	size_t SavedSize() const noexcept { return bitmap ? bitmap->PlainHeapSize() - bitmap->HeapSize() : 0; }
+	bool IsInitialized() const noexcept { return bool(ids) || bool(bitmap); }
 	void Dump(std::ostream& os) const {
-		if (ids) {
+		if (bitmap) {
+			bitmap->Dump(os);
+		} else if (ids) {
 			ids->Dump(os);
 		} else {
 			os << "[]";
 		}
 	}
 
+	// Only one of the representations is set
 	IdSetPlain::Ptr ids;
+	IdSetBitmap::Ptr bitmap;
 };
 
 using IdSetCacheBase =
-	LRUCache<LRUCacheImpl<IdSetCacheKey, IdSetCacheVal, IdSetCacheKey::Hash, IdSetCacheKey::Equal>, LRUWithAtomicPtr::Yes>;
+	LRUCache<ShardedLRUCacheImpl<IdSetCacheKey, IdSetCacheVal, IdSetCacheKey::Hash, IdSetCacheKey::Equal>, LRUWithAtomicPtr::Yes>;
 
 class [[nodiscard]] IdSetCache : public IdSetCacheBase {
 public:
 	IdSetCache() = default;
-	IdSetCache(size_t sizeLimit, uint32_t hitCount) : IdSetCacheBase(sizeLimit, hitCount) {}
+	IdSetCache(size_t sizeLimit, uint32_t hitCount, CachePolicy policy, size_t shardsCount)
+		: IdSetCacheBase(sizeLimit, hitCount, policy, shardsCount) {}
 };
 
 }  // namespace reindexer
@@ -0,0 +1,118 @@
+#include "idsetintersection.h"
+#include <algorithm>
+#include <bit>
+#include "tools/cpucheck.h"
+#include "tools/gallop_search.h"
+
+#if REINDEXER_WITH_SSE
+#include <immintrin.h>
+#endif	// REINDEXER_WITH_SSE
+
+namespace reindexer {
+
+static_assert(sizeof(IdType) == sizeof(int32_t), "SIMD intersection expects 32-bit IDs");
+
+using IntersectFnT = size_t (*)(const IdType* a, const IdType* aEnd, const IdType* b, const IdType* bEnd, IdType* out) noexcept;
+
+static size_t intersectScalar(const IdType* a, const IdType* aEnd, const IdType* b, const IdType* bEnd, IdType* out) noexcept {
+	IdType* const outBegin = out;
+	for (; a != aEnd && b != bEnd; ++a) {
+		const IdType v = *a;
+		b = GallopUpperBound(b, bEnd, v.Decr());
+		if (b != bEnd && *b == v) {
+			*(out++) = v;
+			++b;
+		}
+	}
+	return out - outBegin;
+}
+
+#if REINDEXER_WITH_SSE
+
+// Both SIMD implementations compare the next block of the larger set with the current value at once: count of the lesser values in the
+// block is the position of the value's lower bound. Galloping is used only if the whole block is less than the value
+RX_AVX2_TARGET_ATTR static size_t intersectAVX2(const IdType* a, const IdType* aEnd, const IdType* b, const IdType* bEnd,
+												IdType* out) noexcept {
+	constexpr ptrdiff_t kBlockSize = 8;
+	IdType* const outBegin = out;
+	for (; a != aEnd && b != bEnd; ++a) {
+		const IdType v = *a;
+		if (bEnd - b >= kBlockSize) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+			const __m256i less = _mm256_cmpgt_epi32(_mm256_set1_epi32(v.ToNumber()), block);
+			const auto pos = std::popcount(unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(less))));
+			b = (pos < kBlockSize) ? b + pos : GallopUpperBound(b + kBlockSize, bEnd, v.Decr());
+		} else {
+			b = GallopUpperBound(b, bEnd, v.Decr());
+		}
+		if (b != bEnd && *b == v) {
+			*(out++) = v;
+			++b;
+		}
+	}
+	return out - outBegin;
+}
+
+RX_AVX512_TARGET_ATTR static size_t intersectAVX512(const IdType* a, const IdType* aEnd, const IdType* b, const IdType* bEnd,
+													IdType* out) noexcept {
+	constexpr ptrdiff_t kBlockSize = 16;
+	IdType* const outBegin = out;
+	for (; a != aEnd && b != bEnd; ++a) {
+		const IdType v = *a;
+		if (bEnd - b >= kBlockSize) {
+			const __m512i block = _mm512_loadu_si512(b);
+			const auto pos = std::popcount(unsigned(_mm512_cmplt_epi32_mask(block, _mm512_set1_epi32(v.ToNumber()))));
+			b = (pos < kBlockSize) ? b + pos : GallopUpperBound(b + kBlockSize, bEnd, v.Decr());
+		} else {
+			b = GallopUpperBound(b, bEnd, v.Decr());
+		}
+		if (b != bEnd && *b == v) {
+			*(out++) = v;
+			++b;
+		}
+	}
+	return out - outBegin;
+}
+
+#endif	// REINDEXER_WITH_SSE
+
+static IntersectFnT initIntersectFn() noexcept {
+#if REINDEXER_WITH_SSE
+	if (IsAVX512Allowed()) {
+		return intersectAVX512;
+	}
+	if (IsAVX2Allowed()) {
+		return intersectAVX2;
+	}
+#endif	// REINDEXER_WITH_SSE
+	return intersectScalar;
+}
+
+static const IntersectFnT intersectFn = initIntersectFn();
+
+size_t IntersectIdsets(IdSetCRef smaller, IdSetCRef larger, IdType* out) noexcept {
+	assertrx_dbg(smaller.size() <= larger.size());
+	return intersectFn(smaller.data(), smaller.data() + smaller.size(), larger.data(), larger.data() + larger.size(), out);
+}
+
+void IntersectIdsets(std::span<const IdSetCRef> idsets, base_idset& result) {
+	result.clear();
+	if (idsets.empty()) {
+		return;
+	}
+	h_vector<IdSetCRef, 8> sorted(idsets.begin(), idsets.end());
+	std::sort(sorted.begin(), sorted.end(), [](IdSetCRef l, IdSetCRef r) noexcept { return l.size() < r.size(); });
+	if (sorted.size() == 1) {
+		result.assign(sorted[0].begin(), sorted[0].end());
+		return;
+	}
+
+	result.resize(sorted[0].size());
+	result.resize(IntersectIdsets(sorted[0], sorted[1], result.data()));
+	// Each next set is intersected in-place with the current (already smaller) result
+	for (size_t i = 2; i < sorted.size() && !result.empty(); ++i) {
+		result.resize(IntersectIdsets(IdSetCRef(result.data(), result.size()), sorted[i], result.data()));
+	}
+}
+
+}  // namespace reindexer
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <span>
+#include "core/idset/idset.h"
+
+namespace reindexer {
+
+/// @brief Intersects 2 sorted unique IDs sets.
+/// Each ID from the smaller set is searched in the larger one with SIMD block comparison (AVX512/AVX2 with scalar fallback) for the
+/// nearest values and galloping for the distant ones
+/// @param out - output buffer with capacity for at least smaller.size() IDs. May be the same buffer as @p smaller
+/// @return count of IDs in the intersection
+size_t IntersectIdsets(IdSetCRef smaller, IdSetCRef larger, IdType* out) noexcept;
+
+/// @brief Multi-way intersection of the sorted unique IDs sets. Sets are intersected from the smallest to the largest
+void IntersectIdsets(std::span<const IdSetCRef> idsets, base_idset& result);
+
+}  // namespace reindexer
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include "tools/assertrx.h"
+
+namespace reindexer {
+
+// Min/max values of the index column's chunks (zone map). The bounds are only widened on updates, so they always cover all of the values,
+// which are currently stored in the chunk, and allow to skip the chunks, which can not contain any matching value
+template <typename T>
+class [[nodiscard]] ColumnZoneMap {
+public:
+	static constexpr unsigned kChunkSizeBits = 10;
+	static constexpr size_t kChunkSize = size_t(1) << kChunkSizeBits;
+
+	struct [[nodiscard]] Zone {
+		// Both bounds are NaN, if the chunk has ever contained NaN value. Such zone never allows to skip the chunk
+		T min;
+		T max;
+	};
+
+	// Has to be called for each write into the column's row
+	void Update(size_t row, T value) {
+		if (row >= rows_) {
+			// The column's rows between the old end and the new row are value-initialized
+			for (size_t r = rows_; r < row; r = (r | (kChunkSize - 1)) + 1) {
+				widen(r, T{});
+			}
+			rows_ = row + 1;
+		}
+		widen(row, value);
+	}
+	// Count of the column's rows, covered by the zones
+	size_t Rows() const noexcept { return rows_; }
+	const Zone& ChunkZone(size_t chunk) const noexcept {
+		assertrx_dbg(chunk < zones_.size());
+		return zones_[chunk];
+	}
+	size_t HeapSize() const noexcept { return zones_.capacity() * sizeof(Zone); }
+
+private:
+	void widen(size_t row, T value) {
+		const size_t chunk = row >> kChunkSizeBits;
+		assertrx_dbg(chunk <= zones_.size());
+		if (chunk == zones_.size()) {
+			zones_.push_back({value, value});
+			return;
+		}
+		auto& zone = zones_[chunk];
+		if constexpr (std::is_floating_point_v<T>) {
+			if (std::isnan(value)) {
+				zone.min = zone.max = value;
+				return;
+			}
+		}
+		// std::min/std::max keep the NaN bounds as is
+		zone.min = std::min(zone.min, value);
+		zone.max = std::max(zone.max, value);
+	}
+
+	std::vector<Zone> zones_;
+	size_t rows_{0};
+};
+
+}  // namespace reindexer
@@ -518,9 +518,9 @@ uint64_t HnswIndexBase<hnswlib::BruteforceSearch>::GetHash(FloatVectorId id) con
 
 template <typename Map>
 bool HnswIndexBase<Map>::QuantizationAvailable() const {
-	return map_.QuantizationAvailable() &&
-		   (opts_.FloatVector().QuantizationConfig() &&
-			(map_.CurrentElementCount() >= opts_.FloatVector().QuantizationConfig()->quantizationThreshold));
+	const auto& config = opts_.FloatVector().QuantizationConfig();
+	return map_.QuantizationAvailable() && config && config->quantizationType == hnswlib::QuantizationType::ScalarQuantization8bit &&
+		   map_.CurrentElementCount() >= config->quantizationThreshold;
 }
 
 template <typename Map>
@@ -9,6 +9,7 @@
 #include "faiss/impl/AuxIndexStructures.h"
 #include "faiss/impl/io.h"
 #include "faiss/index_io.h"
+#include "faiss/utils/distances.h"
 #include "ivf_index.h"
 #include "knn_ctx.h"
 #include "knn_raw_result.h"
@@ -18,6 +19,7 @@
 #include "tools/logger.h"
 #include "tools/normalize.h"
 
+#include <cmath>
 #include <numeric>
 
 #ifdef RX_WITH_OPENMP
@@ -73,10 +75,12 @@ IvfIndex::IvfIndex(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&&
 IvfIndex::IvfIndex(const IvfIndex& other, IndexCloneKind kind)
 	: Base{other, kind},
 	  nCentroids_{other.nCentroids_},
-	  space_{other.map_ ? nullptr : static_cast<faiss::IndexFlat*>(faiss::clone_index(other.space_.get()))},
+	  space_{(other.map_ || other.IsQuantized()) ? nullptr : static_cast<faiss::IndexFlat*>(faiss::clone_index(other.space_.get()))},
 	  n2FvId_{other.n2FvId_},
 	  fvId2N_{other.fvId2N_},
-	  map_{other.map_ ? static_cast<faiss::IndexIVFFlat*>(faiss::clone_index(other.map_.get())) : nullptr} {}
+	  map_{(other.map_ && !other.pendingPQ_.ivf) ? static_cast<faiss::IndexIVFFlat*>(faiss::clone_index(other.map_.get())) : nullptr},
+	  // Copy switches on the pending quantized map the same way as the first write access does
+	  pq_{other.pendingPQ_.ivf ? other.pendingPQ_.Clone() : other.pq_.Clone()} {}
 
 // NOLINTBEGIN(bugprone-unchecked-string-to-number-conversion)
 static const int kIVFMTMode = std::getenv("RX_IVF_MT") ? atoi(std::getenv("RX_IVF_MT")) : 0;
@@ -85,7 +89,10 @@ static const unsigned kIVFOMPThreads =
 // NOLINTEND(bugprone-unchecked-string-to-number-conversion)
 
 Variant IvfIndex::upsert(ConstFloatVectorView vect, FloatVectorId id, bool& clearCache) {
-	if (map_) {
+	switchOnPendingPQ();
+	if (IsQuantized()) {
+		addToPQ(pq_, vect.Data(), &id, 1);
+	} else if (map_) {
 		const faiss::idx_t faissId = id.AsNumber();
 		map_->add_with_ids(1, vect.Data(), &faissId);
 	} else {
@@ -118,7 +125,12 @@ Variant IvfIndex::upsertConcurrent(ConstFloatVectorView, FloatVectorId, bool&) {
 
 void IvfIndex::del(FloatVectorId id, MustExist mustExist) {
 	(void)mustExist;
-	if (map_) {
+	switchOnPendingPQ();
+	if (IsQuantized()) {
+		const faiss::idx_t faissId = id.AsNumber();
+		pq_.ivf->remove_ids(faiss::IDSelectorArray{1, &faissId});
+		pq_.hashes.erase(id);
+	} else if (map_) {
 		const faiss::idx_t faissId = id.AsNumber();
 		map_->remove_ids(faiss::IDSelectorArray{1, &faissId});
 	} else {
@@ -308,7 +320,9 @@ SelectKeyResult IvfIndex::select(ConstFloatVectorView key, const KnnSearchParams
 	const auto prepareId = [this](size_t i) noexcept { return n2FvId_[i]; };
 	const bool withIVF = bool(map_);
 	const bool isArray = *Opts().IsArray();
-	if (isArray && withIVF) {
+	if (IsQuantized()) {
+		return isArray ? select<true>(key, p, ctx, pq_.ivf, std::identity{}) : select<false>(key, p, ctx, pq_.ivf, std::identity{});
+	} else if (isArray && withIVF) {
 		return select<true>(key, p, ctx, map_, std::identity{});
 	} else if (isArray && !withIVF) {
 		return select<true>(key, p, ctx, space_, prepareId);
@@ -371,10 +385,19 @@ SelectKeyResult IvfIndex::select(ConstFloatVectorView key, const KnnSearchParams
 	} else {
 		assertrx_throw(k > 0);
 
+		const auto searchK = [&](const auto& sortFn) {
+			if constexpr (std::is_same_v<std::remove_cvref_t<decltype(*map)>, faiss::IndexIVF>) {
+				if (const auto* config = pqConfig(); config && config->rerankFactor > 1 && ctx.GetOriginalVectorLoader()) {
+					return selectReranked<isArray>(idset, keyData, k, config->rerankFactor, *map, ctx.GetOriginalVectorLoader(),
+												   param.nprobe, sortFn);
+				}
+			}
+			return search<isArray>(idset, args, map, sortFn, prepareId);
+		};
 		if (withSort) {
-			dists = search<isArray>(idset, args, map, sortSameDist, prepareId);
+			dists = searchK(sortSameDist);
 		} else {
-			dists = search<isArray>(idset, args, map, empty, prepareId);
+			dists = searchK(empty);
 		}
 	}
 
@@ -388,6 +411,77 @@ SelectKeyResult IvfIndex::select(ConstFloatVectorView key, const KnnSearchParams
 	return result;
 }
 
+// Approximate PQ distances of the k * rerankFactor candidates are replaced by the exact ones over the original vectors
+template <bool isArray>
+h_vector<float, 128> IvfIndex::selectReranked(base_idset& idset, const float* keyData, size_t k, size_t rerankFactor,
+											  const faiss::IndexIVF& map, const KnnCtx::OriginalVectorLoader& loader, unsigned nprobe,
+											  const auto& sortSameDist) const {
+	const size_t candidatesCount = k * rerankFactor;
+	h_vector<faiss::idx_t, 128> ids(candidatesCount);
+	h_vector<float, 128> approxDists(candidatesCount);
+	faiss::IVFSearchParameters params;
+	params.nprobe = nprobe;
+	map.search(1, keyData, candidatesCount, approxDists.data(), ids.data(), &params);
+
+	const size_t dims = Dimension().Value();
+	std::vector<std::pair<float, faiss::idx_t>> candidates;
+	candidates.reserve(candidatesCount);
+	for (size_t i = 0; i < candidatesCount && ids[i] >= 0; ++i) {
+		const Variant vecVar = loader(FloatVectorId::FromNumber(ids[i]));
+		const ConstFloatVectorView vec =
+			vecVar.Type().Is<KeyValueType::FloatVector>() ? ConstFloatVectorView{vecVar} : ConstFloatVectorView{};
+		if (vec.IsStrippedOrEmpty() || vec.Dimension().Value() != dims) [[unlikely]] {
+			// Keep the approximate distance if the original vector is not available
+			candidates.emplace_back(approxDists[i], ids[i]);
+			continue;
+		}
+		float dist = 0.0f;
+		switch (metric_) {
+			case VectorMetric::L2:
+				dist = faiss::fvec_L2sqr(keyData, vec.Data(), dims);
+				break;
+			case VectorMetric::InnerProduct:
+				dist = faiss::fvec_inner_product(keyData, vec.Data(), dims);
+				break;
+			case VectorMetric::Cosine:
+				// Key is already normalized
+				if (const float norm = faiss::fvec_norm_L2sqr(vec.Data(), dims); norm > 0.0f) {
+					dist = faiss::fvec_inner_product(keyData, vec.Data(), dims) / std::sqrt(norm);
+				}
+				break;
+		}
+		candidates.emplace_back(dist, ids[i]);
+	}
+	if (metric_ == VectorMetric::L2) {
+		std::stable_sort(candidates.begin(), candidates.end(), [](const auto& l, const auto& r) noexcept { return l.first < r.first; });
+	} else {
+		std::stable_sort(candidates.begin(), candidates.end(), [](const auto& l, const auto& r) noexcept { return l.first > r.first; });
+	}
+
+	h_vector<float, 128> dists;
+	dists.reserve(k);
+	fast_hash_set<IdType> addedIds;
+	if constexpr (isArray) {
+		addedIds.reserve(k);
+	}
+	idset.reserve(idset.size() + k);
+	for (const auto& [dist, id] : candidates) {
+		const IdType rowId = FloatVectorId::FromNumber(id).RowId();
+		if constexpr (isArray) {
+			if (!addedIds.insert(rowId).second) {
+				continue;
+			}
+		}
+		dists.emplace_back(dist);
+		sortSameDist(idset.size(), dists.data());
+		idset.push_back(rowId);
+		if (idset.size() == k) {
+			break;
+		}
+	}
+	return dists;
+}
+
 KnnRawResult IvfIndex::selectRaw(ConstFloatVectorView vect, const KnnSearchParams& params) const {
 	if (*Opts().IsArray()) {
 		return selectRaw<true>(vect, params);
@@ -417,7 +511,9 @@ KnnRawResult IvfIndex::selectRaw(ConstFloatVectorView key, const KnnSearchParams
 
 	IVFSearchArgsKnn args{keyData, k, radius, param};
 	if (radius) {
-		if (map_) {
+		if (IsQuantized()) {
+			return {searchRaw<isArray>(args, pq_.ivf, metric_, std::identity{}), metric_};
+		} else if (map_) {
 			return {searchRaw<isArray>(args, map_, metric_, std::identity{}), metric_};
 		} else {
 			return {searchRaw<isArray>(args, space_, metric_, prepareId), metric_};
@@ -425,7 +521,9 @@ KnnRawResult IvfIndex::selectRaw(ConstFloatVectorView key, const KnnSearchParams
 	} else {
 		assertrx_throw(k > 0);
 		IvfKnnRawResult rawResults;
-		if (map_) {
+		if (IsQuantized()) {
+			rawResults = searchRaw(args, pq_.ivf, std::identity{});
+		} else if (map_) {
 			rawResults = searchRaw(args, *map_);
 		} else {
 			rawResults = searchRaw(args, space_, prepareId);
@@ -442,16 +540,22 @@ std::unique_ptr<Index> IvfIndex::Clone(size_t, IndexCloneKind kind) const { retu
 IndexMemStat IvfIndex::GetMemStat(const RdxContext& ctx) const noexcept {
 	auto stats = FloatVectorIndex::GetMemStat(ctx);
 	size_t uniqKeysCount;
-	if (map_) {
+	size_t codeSize = sizeof(float) * Dimension().Value();
+	if (IsQuantized()) {
+		uniqKeysCount = pq_.ivf->direct_map.unique_ids_count();
+		codeSize = pq_.ivf->code_size;
+		stats.indexingStructSize += pq_.ivf->allocated_mem_size() + pq_.hashes.allocated_mem_size();
+	} else if (map_) {
 		uniqKeysCount = map_->unique_ids_count();
 		stats.indexingStructSize += map_->allocated_mem_size();
 	} else {
 		uniqKeysCount = n2FvId_.size();
 		stats.indexingStructSize += n2FvId_.capacity() * sizeof(faiss::idx_t) + fvId2N_.allocated_mem_size() + space_->allocated_mem_size();
 	}
-	stats.isBuilt = bool(map_);
+	stats.isBuilt = map_ || IsQuantized();
+	stats.isQuantized = IsQuantized();
 	stats.uniqKeysCount += uniqKeysCount;
-	stats.dataSize += uniqKeysCount * sizeof(float) * Dimension().Value();
+	stats.dataSize += uniqKeysCount * codeSize;
 	stats.indexingStructSize -= stats.dataSize;	 // Do not calculate actual data size twice
 	return stats;
 }
@@ -466,8 +570,7 @@ void IvfIndex::reconstruct(FloatVectorId id, FloatVector& vect) const {
 	}
 }
 
-void IvfIndex::trainIdx(faiss::IndexIVFFlat& idx, const float* vecs, const float* norms, size_t vecsCount) {
-	idx.set_direct_map_type(faiss::DirectMap::Type::Hashtable);
+static void trainWithLowPriority(const auto& train) {
 #ifdef RX_WITH_OPENMP
 	// omp_set_num_teams(kIVFOMPThreads);
 	omp_set_num_threads(kIVFOMPThreads);
@@ -477,14 +580,25 @@ void IvfIndex::trainIdx(faiss::IndexIVFFlat& idx, const float* vecs, const float
 	const int prio = getpriority(PRIO_PROCESS, tid);
 	setpriority(PRIO_PROCESS, gettid_ivf(), 15);
 #endif	// __linux__
-	idx.train(vecsCount, vecs, norms);
+	train();
 #ifdef __linux__
 	setpriority(PRIO_PROCESS, tid, prio);
 #endif	// __linux__
 }
 
+void IvfIndex::trainIdx(faiss::IndexIVFFlat& idx, const float* vecs, const float* norms, size_t vecsCount) {
+	idx.set_direct_map_type(faiss::DirectMap::Type::Hashtable);
+	trainWithLowPriority([&] { idx.train(vecsCount, vecs, norms); });
+}
+
+void IvfIndex::trainIdx(faiss::IndexIVF& idx, const float* vecs, size_t vecsCount) {
+	trainWithLowPriority([&] { idx.train(vecsCount, vecs); });
+}
+
 ConstFloatVectorView IvfIndex::getFloatVectorViewImpl(FloatVectorId id) const {
-	if (map_) {
+	if (IsQuantized()) {
+		return ConstFloatVectorView::CreateStripped(Dimension());
+	} else if (map_) {
 		return map_->getView(id.AsNumber());
 	} else {
 		const auto it = fvId2N_.find(id);
@@ -495,7 +609,7 @@ ConstFloatVectorView IvfIndex::getFloatVectorViewImpl(FloatVectorId id) const {
 
 FloatVectorIndex::StorageCacheWriteResult IvfIndex::WriteIndexCache(WrSerializer& wser, PKGetterF&& getPK, bool isCompositePK,
 																	const std::atomic_int32_t& cancel) noexcept {
-	auto res = StorageCacheWriteResult{.err = {}, .isCacheable = map_ ? true : false};
+	auto res = StorageCacheWriteResult{.err = {}, .isCacheable = (map_ || IsQuantized()) ? true : false};
 
 	if (!getPK) [[unlikely]] {
 		res.err = Error(errParams, "IvfIndex::WriteIndexCache:{}: PK getter is nullptr", Name());
@@ -531,7 +645,23 @@ FloatVectorIndex::StorageCacheWriteResult IvfIndex::WriteIndexCache(WrSerializer
 	};
 
 	try {
-		if (map_) {	 // No cache required if map_ is not created yet
+		if (IsQuantized()) {
+			SerializerWriter writer(Name(), wser, std::move(getPK), isCompositePK, Opts().IsArray());
+			writer.PutVarUInt(kPQStorageMagic);
+			// PQ codes are not cached: only the trained quantizers and PKs are written. Codes are re-encoded from the original vectors
+			// on load, because the original vectors are required anyway to restore the hashes
+			std::unique_ptr<faiss::IndexIVF> trained{static_cast<faiss::IndexIVF*>(faiss::clone_index(pq_.ivf.get()))};
+			trained->reset();
+			faiss::write_index(trained.get(), &writer, cancel, false);
+			const auto& hashtable = pq_.ivf->direct_map.hashtable;
+			writer.PutVarUInt(hashtable.size());
+			for (const auto& idsPair : hashtable) {
+				writer.AppendPKByID(idsPair.first);
+				if (cancel.load(std::memory_order_relaxed)) [[unlikely]] {
+					throw Error(errCanceled, "IvfIndex::WriteIndexCache:{}: index cache saving was canceled", Name());
+				}
+			}
+		} else if (map_) {	// No cache required if map_ is not created yet
 			SerializerWriter writer(Name(), wser, std::move(getPK), isCompositePK, Opts().IsArray());
 			writer.PutVarUInt(kStorageMagic);
 			faiss::write_index(map_.get(), &writer, cancel, true);
@@ -550,7 +680,7 @@ FloatVectorIndex::StorageCacheWriteResult IvfIndex::WriteIndexCache(WrSerializer
 }
 
 Error IvfIndex::LoadIndexCache(std::string_view data, bool isCompositePK, FloatVectorIndexRawDataInserter&& getVectorData,
-							   LoadWithQuantizer) {
+							   LoadWithQuantizer withQuantizer) {
 	class [[nodiscard]] ViewReader final : public faiss::IOReader, private LoaderBase {
 	public:
 		ViewReader(std::string _name, std::string_view view, FloatVectorIndexRawDataInserter&& getVectorData, bool isCompositePK,
@@ -596,15 +726,54 @@ Error IvfIndex::LoadIndexCache(std::string_view data, bool isCompositePK, FloatV
 
 	map_.reset();
 	space_.reset();
+	pq_ = PQMap{};
+	pendingPQ_ = PQMap{};
 
 	try {
 		ViewReader reader(Name(), data, std::move(getVectorData), isCompositePK, Opts().IsArray());
 		const uint64_t magic = reader.GetVarUInt();
-		if (magic != kStorageMagic) {
+		if (magic != kStorageMagic && magic != kPQStorageMagic) {
 			throw std::runtime_error("Incorrect IVF storage magic");
 		}
 		std::unique_ptr<faiss::Index> idx(faiss::read_index(&reader));
-		if (auto map = dynamic_cast<faiss::IndexIVFFlat*>(idx.get()); map) {
+		if (magic == kPQStorageMagic) {
+			if (!isPQIdx(*idx)) {
+				throw Error(errLogic, "IVFPQ::LoadIndexCache:{} has unexpected index type", Name());
+			}
+			// Without the quantizer (e.g. on the dequantization) the flat IVF index is rebuilt from the original vectors
+			const bool withPQ = *withQuantizer && pqConfig();
+			PQMap pq;
+			if (withPQ) {
+				pq.ivf.reset(static_cast<faiss::IndexIVF*>(idx.release()));
+				pq.ivf->parallel_mode = kIVFMTMode;
+			} else {
+				space_ = newSpace(Dimension().Value(), metric_);
+			}
+			const size_t dims = Dimension().Value();
+			const size_t count = reader.GetVarUInt();
+			pq.hashes.reserve(withPQ ? count : 0);
+			std::vector<float> batch(dims * kPQAddBatchSize);
+			std::vector<FloatVectorId> batchIds;
+			batchIds.reserve(kPQAddBatchSize);
+			for (size_t i = 0; i < count; ++i) {
+				float* vec = batch.data() + batchIds.size() * dims;
+				const auto id = FloatVectorId::FromNumber(reader.ReadPKEncodedData(reinterpret_cast<uint8_t*>(vec)));
+				if (!withPQ) {
+					bool clearCache = false;
+					std::ignore = upsert(ConstFloatVectorView{std::span<const float>{vec, dims}}, id, clearCache);
+					continue;
+				}
+				batchIds.emplace_back(id);
+				if (batchIds.size() == kPQAddBatchSize) {
+					addToPQ(pq, batch.data(), batchIds.data(), batchIds.size());
+					batchIds.clear();
+				}
+			}
+			if (!batchIds.empty()) {
+				addToPQ(pq, batch.data(), batchIds.data(), batchIds.size());
+			}
+			pq_ = std::move(pq);
+		} else if (auto map = dynamic_cast<faiss::IndexIVFFlat*>(idx.get()); map) {
 			if (auto space = dynamic_cast<faiss::IndexFlat*>(map->quantizer); space) {
 				map_ = std::unique_ptr<faiss::IndexIVFFlat>(static_cast<faiss::IndexIVFFlat*>(idx.release()));
 				map_->own_fields = false;
@@ -635,6 +804,8 @@ Error IvfIndex::LoadIndexCache(std::string_view data, bool isCompositePK, FloatV
 }
 
 void IvfIndex::RebuildCentroids(float dataPart) {
+	switchOnPendingPQ();
+	// Quantized index has no flat map_ and keeps the centroids trained on quantization
 	if (map_) {
 		dataPart = std::min(dataPart, 1.0f);
 		dataPart = std::max(0.0f, dataPart);
@@ -697,6 +868,8 @@ std::unique_ptr<faiss::IndexFlat> IvfIndex::newSpace(size_t dimension, VectorMet
 
 void IvfIndex::clearMap() noexcept {
 	// This method is used in exception handling. It potentially may throw, but we will not be able to handle this exception properly
+	pq_ = PQMap{};
+	pendingPQ_ = PQMap{};
 	map_.reset();
 	space_.reset();
 	try {
@@ -707,6 +880,108 @@ void IvfIndex::clearMap() noexcept {
 	}
 }
 
+uint64_t IvfIndex::GetHash(FloatVectorId id) const {
+	if (IsQuantized()) {
+		const auto it = pq_.hashes.find(id);
+		assertrx_throw(it != pq_.hashes.end());
+		return it->second;
+	}
+	return FloatVectorIndex::getFloatVectorView(id).Hash();
+}
+
+const hnswlib::QuantizationConfig* IvfIndex::pqConfig() const noexcept {
+	const auto& config = Opts().FloatVector().QuantizationConfig();
+	return (config && config->quantizationType == hnswlib::QuantizationType::ProductQuantization) ? &*config : nullptr;
+}
+
+bool IvfIndex::QuantizationAvailable() const {
+	const auto* config = pqConfig();
+	// Each of the PQ codebooks requires at least 2^pqBits training vectors
+	return config && map_ && !IsQuantized() && !pendingPQ_.ivf &&
+		   map_->unique_ids_count() >= std::max(config->quantizationThreshold, size_t(1) << config->pqBits);
+}
+
+void IvfIndex::addToPQ(PQMap& pq, const float* vecs, const FloatVectorId* ids, size_t count) const {
+	const size_t dims = Dimension().Value();
+	h_vector<faiss::idx_t, 16> faissIds;
+	faissIds.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		pq.hashes[ids[i]] = ConstFloatVectorView{std::span<const float>{vecs + i * dims, dims}}.Hash();
+		faissIds.emplace_back(ids[i].AsNumber());
+	}
+	if (metric_ == VectorMetric::Cosine) {
+		const auto normalized = ann::NormalizeCopyVectors(vecs, count, int32_t(dims));
+		pq.ivf->add_with_ids(count, normalized.get(), faissIds.data());
+	} else {
+		pq.ivf->add_with_ids(count, vecs, faissIds.data());
+	}
+}
+
+void IvfIndex::Quantize() {
+	const auto* config = pqConfig();
+	if (!config) {
+		throw Error(errLogic, "Empty product quantization config");
+	}
+	assertrx_throw(map_ && !IsQuantized() && !pendingPQ_.ivf);
+	assertrx_dbg(map_->direct_map.type == faiss::DirectMap::Type::Hashtable);
+
+	const size_t dims = Dimension().Value();
+	const auto& hashtable = map_->direct_map.hashtable;
+	const auto copyVector = [&](faiss::idx_t lo, float* out) {
+		const auto listNo = faiss::lo_listno(lo);
+		const auto offset = faiss::lo_offset(lo);
+		std::memcpy(out, map_->invlists->get_single_code(listNo, offset), dims * sizeof(float));
+	};
+
+	PQMap pq;
+	pq.ivf = newPQIdx(*config);
+	pq.ivf->parallel_mode = kIVFMTMode;
+	{
+		const size_t sampleSize = std::max({config->sampleSize, ivfTrainingSize(nCentroids_), size_t(1) << config->pqBits});
+		const size_t vecsCount = std::min(hashtable.size(), sampleSize);
+		std::unique_ptr<float[]> data = std::make_unique<float[]>(dims * vecsCount);
+		auto it = hashtable.begin();
+		for (size_t i = 0; i < vecsCount; ++i, ++it) {
+			float* out = data.get() + i * dims;
+			copyVector(it->second, out);
+			if (metric_ == VectorMetric::Cosine) {
+				// IVFFlat keeps the original vectors and their norms separately
+				std::ignore = ann::NormalizeVector(out, int32_t(dims));
+			}
+		}
+		trainIdx(*pq.ivf, data.get(), vecsCount);
+	}
+
+	pq.hashes.reserve(hashtable.size());
+	std::vector<float> batch(dims * kPQAddBatchSize);
+	std::vector<FloatVectorId> batchIds;
+	batchIds.reserve(kPQAddBatchSize);
+	for (const auto& idsPair : hashtable) {
+		copyVector(idsPair.second, batch.data() + batchIds.size() * dims);
+		batchIds.emplace_back(FloatVectorId::FromNumber(idsPair.first));
+		if (batchIds.size() == kPQAddBatchSize) {
+			addToPQ(pq, batch.data(), batchIds.data(), batchIds.size());
+			batchIds.clear();
+		}
+	}
+	if (!batchIds.empty()) {
+		addToPQ(pq, batch.data(), batchIds.data(), batchIds.size());
+	}
+	pendingPQ_ = std::move(pq);
+}
+
+void IvfIndex::SwitchMapOnQuantized() { switchOnPendingPQ(); }
+
+void IvfIndex::switchOnPendingPQ() noexcept {
+	if (pendingPQ_.ivf) {
+		pq_ = std::move(pendingPQ_);
+		map_.reset();
+		space_.reset();
+		n2FvId_ = std::vector<faiss::idx_t>();
+		fvId2N_ = IDHashMapT<FloatVectorId, size_t>();
+	}
+}
+
 faiss::MetricType IvfIndex::faissMetric() const noexcept {
 	switch (metric_) {
 		case VectorMetric::L2:
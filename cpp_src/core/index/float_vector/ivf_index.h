@@ -4,10 +4,13 @@
 
 #include "faiss/MetricType.h"
 #include "float_vector_index.h"
+#include "knn_ctx.h"
 
 namespace faiss {
 
+struct Index;
 struct IndexFlat;
+struct IndexIVF;
 struct IndexIVFFlat;
 
 };	// namespace faiss
@@ -29,25 +32,43 @@ public:
 	Error LoadIndexCache(std::string_view data, bool isCompositePK, FloatVectorIndexRawDataInserter&&, LoadWithQuantizer) override;
 	void RebuildCentroids(float dataPart) override;
 
-	uint64_t GetHash(FloatVectorId id) const override { return FloatVectorIndex::getFloatVectorView(id).Hash(); }
+	uint64_t GetHash(FloatVectorId id) const override;
 
-	bool QuantizationAvailable() const override { return false; }
-	bool IsQuantized() const override { return false; }
-	void Quantize() override { assertrx(false); }
-	void SwitchMapOnQuantized() override { assertrx(false); }
+	bool QuantizationAvailable() const override;
+	bool IsQuantized() const override { return bool(pq_.ivf); }
+	void Quantize() override;
+	void SwitchMapOnQuantized() override;
 
 private:
 	template <typename K, typename V>
 	using IDHashMapT = tsl::hopscotch_sc_map<K, V, std::hash<K>, std::equal_to<K>, std::less<K>, std::allocator<std::pair<const K, V>>, 30,
 											 false, tsl::mod_growth_policy<std::ratio<3, 2>>>;
 
+	// Product quantized IVF. Original vectors are stored in the namespace storage only.
+	// Concrete IVFPQ type is used in ivf_index_pq.cc only, the rest of the index works with it via the IndexIVF interface
+	struct [[nodiscard]] PQMap {
+		PQMap() noexcept;
+		PQMap(PQMap&&) noexcept;
+		PQMap& operator=(PQMap&&) noexcept;
+		~PQMap();
+		PQMap Clone() const;
+
+		std::unique_ptr<faiss::IndexIVF> ivf;
+		IDHashMapT<FloatVectorId, uint64_t> hashes;	 // Hashes of the original vectors (for the namespace data hash)
+	};
+
 	constexpr static uint64_t kStorageMagic = 0x3B3B3B3B2A2A2A2A;
+	constexpr static uint64_t kPQStorageMagic = 0x3C3C3C3C2D2D2D2D;
+	constexpr static size_t kPQAddBatchSize = 4096;
 	IvfIndex(const IvfIndex&, IndexCloneKind);
 
 	template <bool isArray>
 	SelectKeyResult select(ConstFloatVectorView, const KnnSearchParams&, KnnCtx&, const auto& map, const auto& prepareId) const;
 	SelectKeyResult select(ConstFloatVectorView, const KnnSearchParams&, KnnCtx&) const override;
 	template <bool isArray>
+	h_vector<float, 128> selectReranked(base_idset&, const float* keyData, size_t k, size_t rerankFactor, const faiss::IndexIVF&,
+										const KnnCtx::OriginalVectorLoader&, unsigned nprobe, const auto& sortSameDist) const;
+	template <bool isArray>
 	KnnRawResult selectRaw(ConstFloatVectorView, const KnnSearchParams&) const;
 	KnnRawResult selectRaw(ConstFloatVectorView, const KnnSearchParams&) const override;
 
@@ -63,6 +84,12 @@ private:
 	faiss::MetricType faissMetric() const noexcept;
 	void reconstruct(FloatVectorId, FloatVector&) const;
 	static void trainIdx(faiss::IndexIVFFlat& idx, const float* vecs, const float* norms, size_t vecsCount);
+	static void trainIdx(faiss::IndexIVF& idx, const float* vecs, size_t vecsCount);
+	std::unique_ptr<faiss::IndexIVF> newPQIdx(const hnswlib::QuantizationConfig&) const;
+	static bool isPQIdx(const faiss::Index&) noexcept;
+	void addToPQ(PQMap&, const float* vecs, const FloatVectorId* ids, size_t count) const;
+	void switchOnPendingPQ() noexcept;
+	const hnswlib::QuantizationConfig* pqConfig() const noexcept;
 
 	size_t nCentroids_;
 	std::unique_ptr<faiss::IndexFlat> space_;
@@ -70,6 +97,8 @@ private:
 	std::vector<faiss::idx_t> n2FvId_;
 	IDHashMapT<FloatVectorId, size_t> fvId2N_;
 	std::unique_ptr<faiss::IndexIVFFlat> map_;
+	PQMap pq_;
+	PQMap pendingPQ_;  // Built by Quantize() under the namespace read lock and switched on by the first write access
 };
 
 std::unique_ptr<Index> IvfIndex_New(const IndexDef&, PayloadType&&, FieldsSet&&, LogCreation);
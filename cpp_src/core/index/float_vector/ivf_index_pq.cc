@@ -0,0 +1,49 @@
+#if RX_WITH_FAISS_ANN_INDEXES
+
+#include "ivf_index.h"
+
+#include "faiss/IndexFlat.h"
+#include "faiss/clone_index.h"
+#ifndef _MSC_VER
+// Product quantizer headers contain C-style casts
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+#include "faiss/IndexIVFPQ.h"
+#ifndef _MSC_VER
+#pragma GCC diagnostic pop
+#endif
+
+namespace reindexer {
+
+IvfIndex::PQMap::PQMap() noexcept = default;
+IvfIndex::PQMap::PQMap(PQMap&&) noexcept = default;
+IvfIndex::PQMap& IvfIndex::PQMap::operator=(PQMap&&) noexcept = default;
+IvfIndex::PQMap::~PQMap() = default;
+
+IvfIndex::PQMap IvfIndex::PQMap::Clone() const {
+	PQMap res;
+	if (ivf) {
+		res.ivf.reset(static_cast<faiss::IndexIVF*>(faiss::clone_index(ivf.get())));
+		res.hashes = hashes;
+	}
+	return res;
+}
+
+std::unique_ptr<faiss::IndexIVF> IvfIndex::newPQIdx(const hnswlib::QuantizationConfig& config) const {
+	const size_t dims = Dimension().Value();
+	// Cosine metric is handled as the inner product over the normalized vectors
+	auto space = newSpace(dims, metric_ == VectorMetric::Cosine ? VectorMetric::InnerProduct : metric_);
+	auto idx = std::make_unique<faiss::IndexIVFPQ>(space.get(), dims, nCentroids_, config.PQSubquantizers(dims), config.pqBits,
+												   faissMetric());
+	std::ignore = space.release();
+	idx->own_fields = true;
+	idx->set_direct_map_type(faiss::DirectMap::Type::Hashtable);
+	return idx;
+}
+
+bool IvfIndex::isPQIdx(const faiss::Index& idx) noexcept { return dynamic_cast<const faiss::IndexIVFPQ*>(&idx); }
+
+}  // namespace reindexer
+
+#endif	// RX_WITH_FAISS_ANN_INDEXES
@@ -1,22 +1,31 @@
 #pragma once
 
+#include <functional>
 #include <span>
 #include "core/enums.h"
+#include "core/keyvalue/variant.h"
 #include "core/nsselecter/ranks_holder.h"
+#include "float_vector_id.h"
 
 namespace reindexer {
 
 class [[nodiscard]] KnnCtx {
 public:
+	// Loads the original vector of the item (from the namespace storage) for the indexes, which do not hold it after quantization
+	using OriginalVectorLoader = std::function<Variant(FloatVectorId)>;
+
 	KnnCtx(RanksHolder::Ptr r) noexcept : ranks_{std::move(r)} { assertrx_dbg(ranks_); }
 	void Add(std::span<const float> r) { ranks_->Add(r); }
 	void Add(h_vector<RankT, 128>&& r) noexcept { ranks_->Add(std::move(r)); }
 	void NeedSort(reindexer::NeedSort needSort) noexcept { needSort_ = needSort; }
 	reindexer::NeedSort NeedSort() const noexcept { return needSort_; }
+	void SetOriginalVectorLoader(OriginalVectorLoader&& loader) noexcept { originalVectorLoader_ = std::move(loader); }
+	const OriginalVectorLoader& GetOriginalVectorLoader() const noexcept { return originalVectorLoader_; }
 
 private:
 	RanksHolder::Ptr ranks_;
 	reindexer::NeedSort needSort_{NeedSort_True};
+	OriginalVectorLoader originalVectorLoader_;
 };
 
 }  // namespace reindexer
@@ -102,8 +102,12 @@ template <typename T>
 Variant IndexStore<T>::Upsert(const Variant& key, IdType id, bool& /*clearCache*/) {
 	assertrx_dbg(!IsFulltext());
 	if (!IsColumnIndexDisabled() && !key.Type().Is<KeyValueType::Null>()) {
-		idx_data.resize(std::max<size_t>(id.ToNumber() + 1, idx_data.size()));
-		idx_data[id.ToNumber()] = static_cast<T>(key);
+		const size_t row = id.ToNumber();
+		idx_data.resize(std::max<size_t>(row + 1, idx_data.size()));
+		idx_data[row] = static_cast<T>(key);
+		if constexpr (kWithColumnZones) {
+			zones_.Update(row, idx_data[row]);
+		}
 	}
 	return Variant(key);
 }
@@ -154,7 +158,8 @@ SelectKeyResults IndexStore<T>::SelectKey(const VariantArray& keys, CondType con
 								IsDistinct(selectCtx.opts.distinct),
 								payloadType_,
 								Fields(),
-								opts_.collateOpts_};
+								opts_.collateOpts_,
+								ColumnZones()};
 }
 
 template <typename T>
@@ -163,6 +168,9 @@ IndexMemStat IndexStore<T>::GetMemStat(const RdxContext&) const {
 	ret.name = name_;
 	ret.uniqKeysCount = str_map.size();
 	ret.columnSize = idx_data.capacity() * sizeof(T);
+	if constexpr (kWithColumnZones) {
+		ret.columnSize += zones_.HeapSize();
+	}
 	return ret;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <variant>
+#include "core/index/columnzonemap.h"
 #include "core/index/index.h"
 
 namespace reindexer {
@@ -39,6 +41,13 @@ public:
 	virtual bool IsUuid() const noexcept override final { return std::is_same_v<T, Uuid>; }
 	virtual void ReconfigureCache(const NamespaceCacheConfigData&) override {}
 	const void* ColumnData() const noexcept override final { return idx_data.size() ? idx_data.data() : nullptr; }
+	const ColumnZoneMap<T>* ColumnZones() const noexcept {
+		if constexpr (kWithColumnZones) {
+			return idx_data.size() ? &zones_ : nullptr;
+		} else {
+			return nullptr;
+		}
+	}
 
 	bool IsColumnIndexDisabled() const noexcept { return opts_.IsArray() || opts_.IsSparse() || opts_.IsNoIndexColumn() || IsFulltext(); }
 
@@ -49,7 +58,7 @@ public:
 
 protected:
 	IndexStore(const IndexStore& store, IndexCloneKind kind)
-		: Index(store, kind), str_map(store.str_map), idx_data(store.idx_data), memStat_(store.memStat_) {}
+		: Index(store, kind), str_map(store.str_map), idx_data(store.idx_data), zones_(store.zones_), memStat_(store.memStat_) {}
 	bool shouldHoldOriginalValueInStrMap() const noexcept {
 		if constexpr (!std::is_same_v<T, key_string>) {
 			return false;
@@ -67,6 +76,9 @@ protected:
 	using IdxDataT =
 		std::conditional_t<std::is_same_v<T, bool>, unsigned char, std::conditional_t<std::is_same_v<T, key_string>, std::string_view, T>>;
 	h_vector<IdxDataT> idx_data;
+	// Zone map of the column is maintained for the numeric columns only. It is used by the vectorized column scan
+	static constexpr bool kWithColumnZones = std::is_same_v<T, int> || std::is_same_v<T, int64_t> || std::is_same_v<T, double>;
+	std::conditional_t<kWithColumnZones, ColumnZoneMap<T>, std::monostate> zones_;
 
 	IndexMemStat memStat_;
 
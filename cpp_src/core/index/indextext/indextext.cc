@@ -59,46 +59,56 @@ void IndexText<StoreType>::initSearchers() {
 }
 
 template <typename StoreType>
-void IndexText<StoreType>::initTermBoosts(FTConfig& cfg) {
-	holder_->stemmedTermsBoost.clear();
+void IndexText<StoreType>::initTermBoosts(IDataHolder& holder, const FTConfig& cfg) const {
+	holder.stemmedTermsBoost.clear();
 	std::string stemstr;
 	for (auto& [term, boost] : cfg.termsBoost) {
-		holder_->stemmedTermsBoost[term] = std::max(holder_->stemmedTermsBoost[term], boost);
-		for (auto& st : holder_->stemmers_) {
+		holder.stemmedTermsBoost[term] = std::max(holder.stemmedTermsBoost[term], boost);
+		for (auto& st : holder.stemmers_) {
 			stemstr.resize(0);
 			st.second.stem(term, stemstr);
 			if (getUTF8StringCharactersCount(stemstr) >= kMinStemRelevantLen) {
-				holder_->stemmedTermsBoost[stemstr] = std::max(holder_->stemmedTermsBoost[stemstr], boost);
+				holder.stemmedTermsBoost[stemstr] = std::max(holder.stemmedTermsBoost[stemstr], boost);
 			}
 		}
 	}
 }
 
 template <typename StoreType>
-void IndexText<StoreType>::initHolder(FTConfig& cfg) {
+std::unique_ptr<IDataHolder> IndexText<StoreType>::makeHolder(FTConfig& cfg) const {
+	std::unique_ptr<IDataHolder> holder;
 	switch (cfg.optimization) {
 		case FTConfig::Optimization::Memory:
-			holder_ = std::make_unique<DataHolder<PackedIdRelVec>>(&cfg);
+			if (cfg.postingsFormat == FTConfig::PostingsFormat::Blocks) {
+				holder = std::make_unique<DataHolder<BlockPackedIdRelVec>>(&cfg);
+			} else {
+				holder = std::make_unique<DataHolder<PackedIdRelVec>>(&cfg);
+			}
 			break;
 		case FTConfig::Optimization::CPU:
-			holder_ = std::make_unique<DataHolder<IdRelVec>>(&cfg);
+			holder = std::make_unique<DataHolder<IdRelVec>>(&cfg);
 			break;
 		default:
 			assertrx(0);
 	}
 
-	holder_->stemmers_.clear();
-	holder_->translit_ = std::make_unique<Translit>();
-	holder_->kbLayout_ = std::make_unique<KbLayout>();
-	holder_->synonyms_ = std::make_unique<Synonyms>();
+	holder->stemmers_.clear();
+	holder->translit_ = std::make_unique<Translit>();
+	holder->kbLayout_ = std::make_unique<KbLayout>();
+	holder->synonyms_ = std::make_unique<Synonyms>();
 	for (const char** lang = stemLangs; *lang; ++lang) {
-		holder_->stemmers_.emplace(*lang, *lang);
+		holder->stemmers_.emplace(*lang, *lang);
 	}
 
+	initTermBoosts(*holder, cfg);
+	return holder;
+}
+
+template <typename StoreType>
+void IndexText<StoreType>::initHolder(FTConfig& cfg) {
+	holder_ = makeHolder(cfg);
 	vdocsIndexed_ = 0;
 	vdocsCommited_ = 0;
-
-	initTermBoosts(cfg);
 }
 
 template <typename StoreType>
@@ -116,9 +126,10 @@ void IndexText<StoreType>::initConfig(const FTConfig* cfg) {
 template <typename StoreType>
 IndexText<StoreType>::IndexText(const IndexText<StoreType>& other, IndexCloneKind kind)
 	: Base(other, kind),
-	  cache_ft_(other.cacheMaxSize_, other.hitsToCache_),
+	  cache_ft_(other.cacheMaxSize_, other.hitsToCache_, other.cachePolicy_),
 	  cacheMaxSize_(other.cacheMaxSize_),
 	  hitsToCache_(other.hitsToCache_),
+	  cachePolicy_(other.cachePolicy_),
 	  rowId2Vdoc_(other.rowId2Vdoc_),
 	  vdocs_(other.vdocs_),
 	  vdocSet_(other.vdocSet_.begin(), other.vdocSet_.end(), other.vdocSet_.bucket_count(), hash_vdoc(payloadType_, fields_, vdocs_),
@@ -135,15 +146,17 @@ IndexText<StoreType>::IndexText(const IndexText<StoreType>& other, IndexCloneKin
 		vdocsHeapSize_ += vd.heap_size();
 		stringsHeapSize_ += vd.strings_heap_size();
 	}
+	vdocsRemoved_ = std::count_if(vdocs_.begin() + 1, vdocs_.end(), [](const VDoc<StoreType>& vd) noexcept { return vd.Removed(); });
 }
 
 template <typename StoreType>
 IndexText<StoreType>::IndexText(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
 								const NamespaceCacheConfigData& cacheCfg)
 	: Base(idef, std::move(payloadType), std::move(fields)),
-	  cache_ft_(cacheCfg.ftIdxCacheSize, cacheCfg.ftIdxHitsToCache),
+	  cache_ft_(cacheCfg.ftIdxCacheSize, cacheCfg.ftIdxHitsToCache, cacheCfg.ftIdxCachePolicy),
 	  cacheMaxSize_(cacheCfg.ftIdxCacheSize),
 	  hitsToCache_(cacheCfg.ftIdxHitsToCache),
+	  cachePolicy_(cacheCfg.ftIdxCachePolicy),
 	  vdocSet_(1000, hash_vdoc(payloadType_, fields_, vdocs_), equal_vdoc(payloadType_, fields_, vdocs_)) {
 	initSearchers();
 	initConfig();
@@ -180,11 +193,12 @@ void IndexText<StoreType>::SetOpts(const IndexOpts& opts) {
 
 	if (!stopWordsEq || oldCfg.stemmers != cfg_->stemmers || oldCfg.maxTypoLen != cfg_->maxTypoLen ||
 		oldCfg.enableNumbersSearch != cfg_->enableNumbersSearch || oldCfg.splitOptions != cfg_->splitOptions ||
-		oldCfg.maxTypos != cfg_->maxTypos || oldCfg.optimization != cfg_->optimization || oldCfg.splitterType != cfg_->splitterType) {
+		oldCfg.maxTypos != cfg_->maxTypos || oldCfg.optimization != cfg_->optimization || oldCfg.splitterType != cfg_->splitterType ||
+		oldCfg.enableBlockMaxPruning != cfg_->enableBlockMaxPruning || oldCfg.postingsFormat != cfg_->postingsFormat) {
 		logFmt(LogInfo, "FulltextIndex config changed, it will be rebuilt on next search");
 		this->isBuilt_ = false;
 		if (oldCfg.optimization != cfg_->optimization || oldCfg.splitterType != cfg_->splitterType ||
-			oldCfg.splitOptions != cfg_->splitOptions) {
+			oldCfg.splitOptions != cfg_->splitOptions || oldCfg.postingsFormat != cfg_->postingsFormat) {
 			initHolder(*cfg_);
 		} else {
 			holder_->Clear();
@@ -198,16 +212,18 @@ void IndexText<StoreType>::SetOpts(const IndexOpts& opts) {
 	}
 
 	holder_->synonyms_->SetConfig(cfg_.get());
-	initTermBoosts(*cfg_);
+	initTermBoosts(*holder_, *cfg_);
 }
 
 template <typename StoreType>
 void IndexText<StoreType>::ReconfigureCache(const NamespaceCacheConfigData& cacheCfg) {
-	if (cacheMaxSize_ != cacheCfg.ftIdxCacheSize || hitsToCache_ != cacheCfg.ftIdxHitsToCache) {
+	if (cacheMaxSize_ != cacheCfg.ftIdxCacheSize || hitsToCache_ != cacheCfg.ftIdxHitsToCache ||
+		cachePolicy_ != cacheCfg.ftIdxCachePolicy) {
 		cacheMaxSize_ = cacheCfg.ftIdxCacheSize;
 		hitsToCache_ = cacheCfg.ftIdxHitsToCache;
+		cachePolicy_ = cacheCfg.ftIdxCachePolicy;
 		if (cache_ft_.IsActive()) {
-			cache_ft_.Reinitialize(cacheMaxSize_, hitsToCache_);
+			cache_ft_.Reinitialize(cacheMaxSize_, hitsToCache_, cachePolicy_);
 		}
 	}
 }
@@ -221,6 +237,11 @@ IndexMemStat IndexText<StoreType>::GetMemStat(const RdxContext& ctx) const {
 	ret.indexingStructSize += rowId2Vdoc_.capacity() * sizeof(uint32_t);
 	ret.idsetCache = this->cache_ft_.GetMemStat();
 	ret.isBuilt = this->isBuilt_;
+	const auto postings = this->holder_->GetPostingsMemStat();
+	ret.ftPostingsSize = postings.size;
+	ret.ftPostingsVarintSize = postings.varintSize;
+	ret.ftSegmentsCount = this->holder_->steps.size();
+	ret.ftTombstonesCount = vdocsRemoved_;
 
 	ret.indexingStructSize += vdocsHeapSize_ + vdocs_.capacity() * sizeof(VDoc<StoreType>);
 	ret.dataSize += stringsHeapSize_;
@@ -246,6 +267,7 @@ void IndexText<StoreType>::excludeFromVdoc(IdType rowId, DataType& dataDetached)
 		// removing final row, need to remove vdoc
 		vdocSet_.erase(vdocId);
 		stringsHeapSize_ -= vdoc.strings_heap_size();
+		++vdocsRemoved_;
 	}
 
 	vdoc.RemoveRow(rowId, dataDetached);
@@ -645,6 +667,12 @@ IdSetPlain::Ptr IndexText<StoreType>::Select(FtCtx& ftCtx, FtDSLQuery&& dsl, boo
 											 FtMergeStatuses&& statuses, FtUseExternStatuses useExternSt, const RdxContext& rdxCtx) {
 	switch (holder_->cfg_->optimization) {
 		case FTConfig::Optimization::Memory: {
+			if (holder_->cfg_->postingsFormat == FTConfig::PostingsFormat::Blocks) {
+				DataHolder<BlockPackedIdRelVec>* d = dynamic_cast<DataHolder<BlockPackedIdRelVec>*>(holder_.get());
+				assertrx_throw(d);
+				return applyCtxTypeAndSelect<BlockPackedIdRelVec>(d, ftCtx, std::move(dsl), inTransaction, rankSortType,
+																  std::move(statuses), useExternSt, rdxCtx);
+			}
 			DataHolder<PackedIdRelVec>* d = dynamic_cast<DataHolder<PackedIdRelVec>*>(holder_.get());
 			assertrx_throw(d);
 			return applyCtxTypeAndSelect<PackedIdRelVec>(d, ftCtx, std::move(dsl), inTransaction, rankSortType, std::move(statuses),
@@ -682,7 +710,12 @@ SelectKeyResults IndexText<StoreType>::doSelectKey(std::string_view key, FtDSLQu
 			   ckey ? "(will cache)" : "");
 	}
 
-	IdSetPlain::Ptr mergedIds = Select(ftCtx, std::move(dsl), inTransaction, rankSortType, std::move(mergeStatuses), useExternSt, rdxCtx);
+	IdSetPlain::Ptr mergedIds;
+	{
+		// Holder may be replaced by the background merge
+		contexted_shared_lock lck(mtx_, rdxCtx);
+		mergedIds = Select(ftCtx, std::move(dsl), inTransaction, rankSortType, std::move(mergeStatuses), useExternSt, rdxCtx);
+	}
 	SelectKeyResult res;
 	if (mergedIds) {
 		auto ftCtxDataBase = ftCtx.GetData();
@@ -811,13 +844,121 @@ void IndexText<StoreType>::cleanRemovedVdocs() {
 	for (uint32_t& vdocId : vdocSet_) {
 		vdocId = newVdocsIds_[vdocId];
 	}
+	vdocsRemoved_ = 0;
+}
+
+template <typename StoreType>
+void IndexText<StoreType>::updateAvgWordsCount() {
+	// Calculate avg words count per document for bm25 calculation
+	avgWordsCount_.resize(Fields().size(), 0);
+	for (unsigned i = 0; i < Fields().size(); i++) {
+		avgWordsCount_[i] = 0;
+		size_t nonEmptyCnt = 0;
+		for (auto& vdoc : vdocs_) {
+			if (vdoc.NumRows() > 0) {
+				avgWordsCount_[i] += vdoc.wordCounts_[i];
+				++nonEmptyCnt;
+			}
+		}
+		if (nonEmptyCnt > 0) {
+			avgWordsCount_[i] /= nonEmptyCnt;
+		}
+	}
+}
+
+template <typename StoreType>
+bool IndexText<StoreType>::needMerge() const noexcept {
+	if (!this->isBuilt_ && holder_->NeedRebuild(false)) {
+		// Next commit has to rebuild the whole index anyway
+		return true;
+	}
+	return holder_->steps.size() >= size_t(cfg_->maxRebuildSteps);
+}
+
+template <typename StoreType>
+WasCanceled IndexText<StoreType>::backgroundCommit(const index::ICancelable& cancelable) {
+	// Background optimization holds the namespace's read lock, so the documents can not be changed here. The merged holder is built
+	// under the shared lock, while the queries are using the current one, and replaces it under the unique lock
+	const RdxContext rdxCtx;
+	{
+		contexted_shared_lock lck(mtx_, rdxCtx);
+		if (!this->isBuilt_ && needCompaction()) {
+			lck.unlock();
+			// Removed documents are compacted by the full rebuild. It is the first commit after the documents modification, so there
+			// are no running queries, which are bound to the current documents ids
+			build(rdxCtx);
+			return WasCanceled_False;
+		}
+		if (!needMerge()) {
+			if (this->isBuilt_) {
+				return WasCanceled_False;
+			}
+			lck.unlock();
+			// Only the new documents have to be indexed: the same incremental commit, as the select does
+			build(rdxCtx);
+			return WasCanceled_False;
+		}
+	}
+	RX_RETURN_IF_CANCELED(cancelable);
+
+	PerfStatCalculatorMT calc(mergePerfCounter_, true);
+	std::unique_ptr<IDataHolder> merged;
+	std::vector<uint32_t> vdocsIds;
+	std::vector<h_vector<float, 3>> wordCounts;
+	size_t vdocsCount = 0;
+	try {
+		contexted_shared_lock lck(mtx_, rdxCtx);
+		merged = makeHolder(*cfg_);
+		merged->synonyms_->SetConfig(cfg_.get());
+		merged->StartCommit(false);
+		assertrx_throw(merged->status_ == FullRebuild);
+
+		// Removed documents keep their ids: the merge statuses of the running queries are bound to them. They are compacted by the
+		// full rebuild of the next commit, when their count exceeds the limit
+		FieldsGetter gt(this->Fields(), this->payloadType_, this->KeyType());
+		VDocsTexts vdocsTexts;
+		std::vector<std::unique_ptr<std::string>> bufStrs;
+		vdocsCount = vdocs_.size();
+		for (uint32_t vdocId = 1; vdocId < vdocsCount; ++vdocId) {
+			if (!vdocs_[vdocId].Removed()) {
+				vdocsIds.emplace_back(vdocId);
+				vdocsTexts.emplace_back(gt.getDocFields(vdocs_[vdocId].DataRef(), bufStrs));
+			}
+		}
+		merged->Process(vdocsTexts, vdocsIds, vdocsCount, Fields().size(), *!this->opts_.IsDense(), wordCounts, &cancelable);
+	} catch (const Error& err) {
+		if (err.code() != errCanceled) {
+			throw;
+		}
+		calc.Disable();
+		logFmt(LogTrace, "IndexText[{}]: background merge was canceled", this->name_);
+		return WasCanceled_True;
+	}
+
+	contexted_unique_lock lck(mtx_, rdxCtx);
+	assertrx_throw(vdocsCount == vdocs_.size());
+	for (size_t i = 0; i < vdocsIds.size(); ++i) {
+		vdocs_[vdocsIds[i]].wordCounts_ = std::move(wordCounts[i]);
+	}
+	updateAvgWordsCount();
+	holder_ = std::move(merged);
+	// Same state, as after the full rebuild
+	vdocsIndexed_ = vdocsCount;
+	vdocsCommited_ = 0;
+	cache_ft_.Clear();
+	this->isBuilt_ = true;
+	if (cfg_->logLevel >= LogInfo) [[unlikely]] {
+		logFmt(LogInfo, "IndexText[{}]: {} documents were merged into the single step", this->name_, vdocsIds.size());
+	}
+	return WasCanceled_False;
 }
 
 template <typename StoreType>
 void IndexText<StoreType>::commitFulltextImpl() {
 	try {
-		holder_->StartCommit(false);
 		auto tm0 = system_clock_w::now();
+		holder_->StartCommit(needCompaction());
+		PerfStatCalculatorMT calc(rebuildPerfCounter_, tm0, holder_->status_ == FullRebuild);
 		FieldsGetter gt(this->Fields(), this->payloadType_, this->KeyType());
 
 		switch (holder_->status_) {
@@ -853,7 +994,7 @@ void IndexText<StoreType>::commitFulltextImpl() {
 		auto tm1 = system_clock_w::now();
 
 		std::vector<h_vector<float, 3>> wordCounts;
-		holder_->Process(vdocsTexts, vdocsIds, vdocs_.size(), Fields().size(), *!this->opts_.IsDense(), wordCounts);
+		holder_->Process(vdocsTexts, vdocsIds, vdocs_.size(), Fields().size(), *!this->opts_.IsDense(), wordCounts, nullptr);
 		size_t idx = 0;
 		for (uint32_t vdocId = vdocsIndexed_; vdocId < vdocs_.size(); ++vdocId) {
 			if (vdocs_[vdocId].NumRows() == 0) {
@@ -862,22 +1003,7 @@ void IndexText<StoreType>::commitFulltextImpl() {
 			vdocs_[vdocId].wordCounts_ = wordCounts[idx++];
 		}
 
-		// Calculate avg words count per document for bm25 calculation
-		avgWordsCount_.resize(Fields().size(), 0);
-		for (unsigned i = 0; i < Fields().size(); i++) {
-			avgWordsCount_[i] = 0;
-			size_t nonEmptyCnt = 0;
-			for (auto& vdoc : vdocs_) {
-				if (vdoc.NumRows() > 0) {
-					avgWordsCount_[i] += vdoc.wordCounts_[i];
-					++nonEmptyCnt;
-				}
-			}
-			if (nonEmptyCnt > 0) {
-				avgWordsCount_[i] /= nonEmptyCnt;
-			}
-		}
-
+		updateAvgWordsCount();
 		vdocsIndexed_ = vdocs_.size();
 
 		if (cfg_->logLevel >= LogInfo) [[unlikely]] {
@@ -177,14 +177,17 @@ public:
 	}
 	bool IsSupportSortedIdsBuild() const noexcept override { return false; }
 
-	WasCanceled Commit(const index::ICancelable&) override final {
-		// Do nothing
-		// Rebuild will be done on first select
-		return WasCanceled_False;
+	WasCanceled Commit(const index::ICancelable& cancelable) override final {
+		if (!cfg_->enableBackgroundMerge) {
+			// Do nothing
+			// Rebuild will be done on first select
+			return WasCanceled_False;
+		}
+		return backgroundCommit(cancelable);
 	}
 
 	void CommitFulltext() override final {
-		cache_ft_.Reinitialize(cacheMaxSize_, hitsToCache_);
+		cache_ft_.Reinitialize(cacheMaxSize_, hitsToCache_, cachePolicy_);
 		commitFulltextImpl();
 		this->isBuilt_ = true;
 	}
@@ -204,12 +207,16 @@ public:
 	IndexPerfStat GetIndexPerfStat() override final {
 		auto stats = Base::GetIndexPerfStat();
 		stats.cache = cache_ft_.GetPerfStat();
+		stats.ftRebuilds = rebuildPerfCounter_.Get<PerfStat>();
+		stats.ftMerges = mergePerfCounter_.Get<PerfStat>();
 		return stats;
 	}
 
 	void ResetIndexPerfStat() override final {
 		Base::ResetIndexPerfStat();
 		cache_ft_.ResetPerfStat();
+		rebuildPerfCounter_.Reset();
+		mergePerfCounter_.Reset();
 	}
 
 	QueryRankType RankedType() const noexcept override final { return QueryRankType::FullText; }
@@ -309,6 +316,9 @@ private:
 
 	SelectKeyResults resultFromCache(std::string_view key, FtIdSetCache::Iterator&&, FtCtx&, RanksHolder::Ptr&);
 	void build(const RdxContext& rdxCtx);
+	WasCanceled backgroundCommit(const index::ICancelable&);
+	bool needMerge() const noexcept;
+	bool needCompaction() const noexcept { return vdocsRemoved_ && vdocsRemoved_ * 2 >= vdocs_.size(); }
 
 	void initSearchers();
 
@@ -324,9 +334,11 @@ private:
 
 	void cleanRemovedVdocs();
 	void commitFulltextImpl();
+	void updateAvgWordsCount();
 	void initConfig(const FTConfig* = nullptr);
 	void initHolder(FTConfig&);
-	void initTermBoosts(FTConfig&);
+	std::unique_ptr<IDataHolder> makeHolder(FTConfig&) const;
+	void initTermBoosts(IDataHolder&, const FTConfig&) const;
 
 	uint32_t getVdocId(IdType rowId) const {
 		return static_cast<size_t>(rowId.ToNumber()) < rowId2Vdoc_.size() ? rowId2Vdoc_[rowId.ToNumber()] : kEmptyVDocId;
@@ -343,6 +355,7 @@ private:
 	FtIdSetCache cache_ft_;
 	size_t cacheMaxSize_;
 	uint32_t hitsToCache_;
+	CachePolicy cachePolicy_;
 
 	RHashMap<std::string, FtIndexFieldPros> ftFields_;
 	std::unique_ptr<FTConfig> cfg_;
@@ -353,12 +366,17 @@ private:
 
 	uint32_t vdocsCommited_ = 0;
 	uint32_t vdocsIndexed_ = 0;
+	// Documents, which were removed after the last full rebuild or merge. They are still kept in the posting lists
+	uint32_t vdocsRemoved_ = 0;
 
 	size_t stringsHeapSize_ = 0;
 
 	std::vector<VDoc<StoreType>> vdocs_;
 	std::vector<double> avgWordsCount_;
 	VDocSetType vdocSet_;
+
+	PerfStatCounterMT rebuildPerfCounter_;
+	PerfStatCounterMT mergePerfCounter_;
 };
 
 std::unique_ptr<Index> IndexText_New(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -27,7 +27,9 @@ IndexUnordered<T>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadTyp
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {
 	static_assert(!(is_str_map_v<T> || is_payload_map_v<T>));
 }
 
@@ -37,7 +39,9 @@ IndexUnordered<str_map<Index::KeyEntryPK>>::IndexUnordered(const IndexDef& idef,
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<str_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -45,7 +49,9 @@ IndexUnordered<str_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef& id
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<str_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -53,7 +59,9 @@ IndexUnordered<str_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& idef, P
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_str_map<Index::KeyEntryPK>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -61,7 +69,9 @@ IndexUnordered<unordered_str_map<Index::KeyEntryPK>>::IndexUnordered(const Index
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_str_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -69,7 +79,9 @@ IndexUnordered<unordered_str_map<Index::KeyEntry>>::IndexUnordered(const IndexDe
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_str_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -77,7 +89,9 @@ IndexUnordered<unordered_str_map<Index::KeyEntryPlain>>::IndexUnordered(const In
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(idef.Opts().collateOpts_),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_payload_map<Index::KeyEntryPK>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType,
@@ -85,7 +99,9 @@ IndexUnordered<unordered_payload_map<Index::KeyEntryPK>>::IndexUnordered(const I
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_payload_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -93,7 +109,9 @@ IndexUnordered<unordered_payload_map<Index::KeyEntry>>::IndexUnordered(const Ind
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<unordered_payload_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType,
@@ -101,7 +119,9 @@ IndexUnordered<unordered_payload_map<Index::KeyEntryPlain>>::IndexUnordered(cons
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<payload_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -109,7 +129,9 @@ IndexUnordered<payload_map<Index::KeyEntry>>::IndexUnordered(const IndexDef& ide
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<payload_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -117,7 +139,9 @@ IndexUnordered<payload_map<Index::KeyEntryPlain>>::IndexUnordered(const IndexDef
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <>
 IndexUnordered<payload_map<Index::KeyEntryPK>>::IndexUnordered(const IndexDef& idef, PayloadType&& payloadType, FieldsSet&& fields,
@@ -125,7 +149,9 @@ IndexUnordered<payload_map<Index::KeyEntryPK>>::IndexUnordered(const IndexDef& i
 	: Base(idef, std::move(payloadType), std::move(fields)),
 	  idx_map(PayloadType{Base::GetPayloadType()}, FieldsSet{Base::Fields()}),
 	  cacheMaxSize_(cacheCfg.idxIdsetCacheSize),
-	  hitsToCache_(cacheCfg.idxIdsetHitsToCache) {}
+	  hitsToCache_(cacheCfg.idxIdsetHitsToCache),
+	  cachePolicy_(cacheCfg.idxIdsetCachePolicy),
+	  cacheShards_(cacheCfg.idxIdsetCacheShards) {}
 
 template <typename T>
 bool IndexUnordered<T>::HoldsStrings() const noexcept {
@@ -138,6 +164,8 @@ IndexUnordered<T>::IndexUnordered(const IndexUnordered& other, IndexCloneKind ki
 	  idx_map(other.idx_map),
 	  cacheMaxSize_(other.cacheMaxSize_),
 	  hitsToCache_(other.hitsToCache_),
+	  cachePolicy_(other.cachePolicy_),
+	  cacheShards_(other.cacheShards_),
 	  empty_ids_(other.empty_ids_),
 	  tracker_(other.tracker_),
 	  pkSortedIds_(kind == IndexCloneKind::Snapshot ? other.pkSortedIds_ : std::vector<std::vector<IdType>>(this->sortedIdxCount_)),
@@ -335,9 +363,18 @@ bool IndexUnordered<T>::tryIdsetCache(const VariantArray& keys, CondType conditi
 				// Do not use generic sort, when expecting duplicates in the id sets
 				const bool useGenericSort =
 					res.deferedExplicitSort && !(this->opts_.IsArray() && (condition == CondEq || condition == CondSet));
-				cache_.Put(ckey,
-						   res.MergeIdsets(SelectKeyResult::MergeOptions{.genericSort = useGenericSort, .shrinkResult = true}, idsCount));
+				auto merged =
+					res.MergeIdsets(SelectKeyResult::MergeOptions{.genericSort = useGenericSort, .shrinkResult = true}, idsCount);
+				// Large and dense merged results are cached in the compressed form
+				if (auto bitmap = IdSetBitmap::TryCompress(*merged); bitmap) {
+					cache_.Put(ckey, IdSetCacheVal{std::move(bitmap)});
+				} else {
+					cache_.Put(ckey, IdSetCacheVal{std::move(merged)});
+				}
 			}
+		} else if (cached.val.bitmap) {
+			res.emplace_back(std::move(cached.val.bitmap));
+			res.MarkCached();
 		} else {
 			res.emplace_back(std::move(cached.val.ids));
 			res.MarkCached();
@@ -482,7 +519,7 @@ WasCanceled IndexUnordered<T>::Commit(const index::ICancelable& cancelable) {
 	this->empty_ids_.Unsorted().Commit(this->sortedIdxCount_);
 
 	if (!cache_.IsActive()) {
-		cache_.Reinitialize(cacheMaxSize_, hitsToCache_);
+		cache_.Reinitialize(cacheMaxSize_, hitsToCache_, cachePolicy_, cacheShards_);
 	}
 
 	if (!tracker_.isUpdated()) {
@@ -694,11 +731,14 @@ void IndexUnordered<T>::AddDestroyTask(tsl::detail_sparse_hash::ThreadTaskQueue&
 
 template <typename T>
 void IndexUnordered<T>::ReconfigureCache(const NamespaceCacheConfigData& cacheCfg) {
-	if (cacheMaxSize_ != cacheCfg.idxIdsetCacheSize || hitsToCache_ != cacheCfg.idxIdsetHitsToCache) {
+	if (cacheMaxSize_ != cacheCfg.idxIdsetCacheSize || hitsToCache_ != cacheCfg.idxIdsetHitsToCache ||
+		cachePolicy_ != cacheCfg.idxIdsetCachePolicy || cacheShards_ != cacheCfg.idxIdsetCacheShards) {
 		cacheMaxSize_ = cacheCfg.idxIdsetCacheSize;
 		hitsToCache_ = cacheCfg.idxIdsetHitsToCache;
+		cachePolicy_ = cacheCfg.idxIdsetCachePolicy;
+		cacheShards_ = cacheCfg.idxIdsetCacheShards;
 		if (cache_.IsActive()) {
-			cache_.Reinitialize(cacheMaxSize_, hitsToCache_);
+			cache_.Reinitialize(cacheMaxSize_, hitsToCache_, cachePolicy_, cacheShards_);
 		}
 	}
 }
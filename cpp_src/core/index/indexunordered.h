@@ -76,6 +76,8 @@ protected:
 	IdSetCache cache_;
 	size_t cacheMaxSize_;
 	uint32_t hitsToCache_;
+	CachePolicy cachePolicy_;
+	size_t cacheShards_;
 	// Empty ids
 	Index::KeyEntry empty_ids_;
 	// Tracker of updates
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <bit>
 
 #include "core/ft/ftsetcashe.h"
 #include "core/idset/idsetcache.h"
+#include "core/namespace/payloadstier.h"
 #include "core/nsselecter/joins/cache.h"
 #include "core/querycache.h"
 #include "tools/logger.h"
@@ -8,10 +11,80 @@
 namespace reindexer {
 
 constexpr uint32_t kMaxHitCountToCache = 1024;
+// W-TinyLFU regions proportions: window takes 1% of the cache and protected region takes 80% of the main region
+constexpr size_t kWindowSizePercent = 1;
+constexpr size_t kProtectedSizePercent = 80;
+
+void FrequencySketch::EnsureCapacity(size_t entriesCount) {
+	if (entriesCount <= capacity_) {
+		return;
+	}
+	// Sketch is rebuilt from scratch on growth. Frequencies are restored quickly, because the new entries are accessed anyway
+	capacity_ = std::max(std::bit_ceil(entriesCount), size_t(64));
+	width_ = capacity_ * kCountersPerEntry / kDepth;
+	table_.assign(width_ * kDepth / kCountersPerWord, 0);
+	additions_ = 0;
+	sampleSize_ = 10 * capacity_;
+}
+
+RX_ALWAYS_INLINE size_t FrequencySketch::counterIdx(uint64_t hash, unsigned row) const noexcept {
+	static constexpr uint64_t kSeeds[kDepth] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+	uint64_t h = (hash + kSeeds[row]) * kSeeds[row];
+	h ^= h >> 32;
+	return row * width_ + (h & (width_ - 1));
+}
+
+void FrequencySketch::Increment(uint64_t hash) noexcept {
+	if (!width_) {
+		return;
+	}
+	bool added = false;
+	for (unsigned row = 0; row < kDepth; ++row) {
+		const size_t idx = counterIdx(hash, row);
+		uint64_t& word = table_[idx / kCountersPerWord];
+		const unsigned shift = (idx % kCountersPerWord) * 4;
+		if (((word >> shift) & 0xF) != 0xF) {
+			word += uint64_t(1) << shift;
+			added = true;
+		}
+	}
+	if (added && ++additions_ >= sampleSize_) {
+		halve();
+	}
+}
+
+unsigned FrequencySketch::Frequency(uint64_t hash) const noexcept {
+	if (!width_) {
+		return 0;
+	}
+	unsigned freq = 0xF;
+	for (unsigned row = 0; row < kDepth; ++row) {
+		const size_t idx = counterIdx(hash, row);
+		freq = std::min(freq, unsigned(table_[idx / kCountersPerWord] >> ((idx % kCountersPerWord) * 4)) & 0xF);
+	}
+	return freq;
+}
+
+void FrequencySketch::Clear() noexcept {
+	std::fill(table_.begin(), table_.end(), 0);
+	additions_ = 0;
+}
+
+void FrequencySketch::halve() noexcept {
+	for (auto& word : table_) {
+		word = (word >> 1) & 0x7777777777777777ULL;
+	}
+	additions_ /= 2;
+}
 
 template <typename K, typename V, typename HashT, typename EqualT>
-LRUCacheImpl<K, V, HashT, EqualT>::LRUCacheImpl(size_t sizeLimit, uint32_t hitCount) noexcept
-	: totalCacheSize_(0), cacheSizeLimit_(sizeLimit), hitCountToCache_(hitCount) {}
+LRUCacheImpl<K, V, HashT, EqualT>::LRUCacheImpl(size_t sizeLimit, uint32_t hitCount, CachePolicy policy) noexcept
+	: totalCacheSize_(0),
+	  cacheSizeLimit_(sizeLimit),
+	  hitCountToCache_(hitCount),
+	  policy_(policy),
+	  windowSizeLimit_(sizeLimit * kWindowSizePercent / 100),
+	  protectedSizeLimit_((sizeLimit - windowSizeLimit_) * kProtectedSizePercent / 100) {}
 
 template <typename K, typename V, typename HashT, typename EqualT>
 typename LRUCacheImpl<K, V, HashT, EqualT>::Iterator LRUCacheImpl<K, V, HashT, EqualT>::Get(const K& key) {
@@ -21,23 +94,55 @@ typename LRUCacheImpl<K, V, HashT, EqualT>::Iterator LRUCacheImpl<K, V, HashT, E
 
 	lock_guard lk(lock_);
 
+	if (policy_ == CachePolicy::WTinyLFU) {
+		sketch_.Increment(keyHash(key));
+	}
 	auto [it, emplaced] = items_.try_emplace(key);
+	LRUCacheRegion region = LRUCacheRegion::None;
 	if (emplaced) {
-		totalCacheSize_ += kElemSizeOverhead + sizeof(Entry) + it->first.Size();
-		it->second.lruPos = lru_.insert(lru_.end(), &it->first);
-		if (!eraseLRU()) [[unlikely]] {
-			return Iterator();
+		const size_t size = kElemSizeOverhead + sizeof(Entry) + it->first.Size();
+		totalCacheSize_ += size;
+		auto& lru = lists_[size_t(LRUCacheRegion::Window)];
+		it->second.lruPos = lru.insert(lru.end(), &it->first);
+		if (policy_ == CachePolicy::LRU) {
+			if (!eraseLRU()) [[unlikely]] {
+				return Iterator();
+			}
+		} else {
+			region = LRUCacheRegion::Window;
+			regionSizes_[size_t(LRUCacheRegion::Window)] += size;
+			sketch_.EnsureCapacity(items_.size());
+			if (!evictTinyLFU()) [[unlikely]] {
+				return Iterator();
+			}
+			// New entry itself may be rejected by the admission filter
+			it = items_.find(key);
+			if (it == items_.end()) {
+				return Iterator(false, V(), region);
+			}
+		}
+	} else if (policy_ == CachePolicy::LRU) {
+		auto& lru = lists_[0];
+		if (std::next(it->second.lruPos) != lru.end()) {
+			lru.splice(lru.end(), lru, it->second.lruPos, std::next(it->second.lruPos));
+			it->second.lruPos = std::prev(lru.end());
+		}
+	} else {
+		region = it->second.region;
+		if (onAccessTinyLFU(it->second)) {
+			// Promotion may trigger eviction of the accessed entry itself
+			it = items_.find(key);
+			if (it == items_.end()) [[unlikely]] {
+				return Iterator(false, V(), region);
+			}
 		}
-	} else if (std::next(it->second.lruPos) != lru_.end()) {
-		lru_.splice(lru_.end(), lru_, it->second.lruPos, std::next(it->second.lruPos));
-		it->second.lruPos = std::prev(lru_.end());
 	}
 
 	if (++it->second.hitCount < int(hitCountToCache_)) {
-		return Iterator();
+		return Iterator(false, V(), region);
 	}
 	++getCount_;
-	return Iterator(true, it->second.val);
+	return Iterator(true, it->second.val, region);
 }
 
 template <typename K, typename V, typename HashT, typename EqualT>
@@ -53,13 +158,22 @@ void LRUCacheImpl<K, V, HashT, EqualT>::Put(const K& key, V&& v) {
 	}
 
 	totalCacheSize_ += v.Size() - it->second.val.Size();
+	if (policy_ == CachePolicy::WTinyLFU) {
+		regionSizes_[size_t(it->second.region)] += v.Size() - it->second.val.Size();
+	}
+	compressedSavings_ = compressedSavings_ + savedSize(v) - savedSize(it->second.val);
 	it->second.val = std::move(v);
 
 	++putCount_;
 
-	std::ignore = eraseLRU();
+	if (policy_ == CachePolicy::LRU) {
+		std::ignore = eraseLRU();
+	} else {
+		std::ignore = evictTinyLFU();
+	}
 
-	if (putCount_ * 16 > getCount_ && eraseCount_) [[unlikely]] {
+	// W-TinyLFU admission filter protects the cache from scans itself, so hits count is adjusted for LRU policy only
+	if (policy_ == CachePolicy::LRU && putCount_ * 16 > getCount_ && eraseCount_) [[unlikely]] {
 		logFmt(LogWarning, "IdSetCache::eraseLRU () cache invalidates too fast eraseCount={},putCount={},getCount={},hitCountToCache={}",
 			   eraseCount_, putCount_, eraseCount_, hitCountToCache_);
 		eraseCount_ = 0;
@@ -71,13 +185,14 @@ void LRUCacheImpl<K, V, HashT, EqualT>::Put(const K& key, V&& v) {
 
 template <typename K, typename V, typename HashT, typename EqualT>
 RX_ALWAYS_INLINE bool LRUCacheImpl<K, V, HashT, EqualT>::eraseLRU() {
-	typename LRUList::iterator it = lru_.begin();
+	auto& lru = lists_[0];
+	typename LRUList::iterator it = lru.begin();
 
 	while (totalCacheSize_ > cacheSizeLimit_) {
 		// just to save us if totalCacheSize_ >0 and lru is empty
 		// someone can make bad key or val with wrong size
 		// TODO: Probably we should remove this logic, since there is no access to sizes outside the lrucache
-		if (lru_.empty()) [[unlikely]] {
+		if (lru.empty()) [[unlikely]] {
 			clearAll();
 			logFmt(LogError, "IdSetCache::eraseLRU () Cache restarted because wrong cache size totalCacheSize_={}", totalCacheSize_);
 			return false;
@@ -85,7 +200,7 @@ RX_ALWAYS_INLINE bool LRUCacheImpl<K, V, HashT, EqualT>::eraseLRU() {
 		auto mIt = items_.find(**it);
 		assertrx_throw(mIt != items_.end());
 
-		const size_t oldSize = sizeof(Entry) + kElemSizeOverhead + mIt->first.Size() + mIt->second.val.Size();
+		const size_t oldSize = entrySize(mIt);
 
 		if (oldSize > totalCacheSize_) [[unlikely]] {
 			clearAll();
@@ -94,19 +209,127 @@ RX_ALWAYS_INLINE bool LRUCacheImpl<K, V, HashT, EqualT>::eraseLRU() {
 			return false;
 		}
 		totalCacheSize_ = totalCacheSize_ - oldSize;
+		compressedSavings_ -= savedSize(mIt->second.val);
 		items_.erase(mIt);
-		it = lru_.erase(it);
+		it = lru.erase(it);
 		++eraseCount_;
 	}
 
-	return !lru_.empty();
+	return !lru.empty();
+}
+
+template <typename K, typename V, typename HashT, typename EqualT>
+bool LRUCacheImpl<K, V, HashT, EqualT>::onAccessTinyLFU(Entry& entry) {
+	switch (entry.region) {
+		case LRUCacheRegion::Probation:
+			// Second access in the main region makes the entry protected. Overflow is handled by evictTinyLFU()
+			moveToRegion(**entry.lruPos, entry, LRUCacheRegion::Protected);
+			std::ignore = evictTinyLFU();
+			return true;
+		case LRUCacheRegion::Window:
+		case LRUCacheRegion::Protected: {
+			auto& lru = lists_[size_t(entry.region)];
+			if (std::next(entry.lruPos) != lru.end()) {
+				lru.splice(lru.end(), lru, entry.lruPos, std::next(entry.lruPos));
+				entry.lruPos = std::prev(lru.end());
+			}
+			return false;
+		}
+		case LRUCacheRegion::None:
+		default:
+			assertrx_dbg(false);
+			return false;
+	}
+}
+
+template <typename K, typename V, typename HashT, typename EqualT>
+void LRUCacheImpl<K, V, HashT, EqualT>::moveToRegion(const K& key, Entry& entry, LRUCacheRegion region) noexcept {
+	const size_t size = sizeof(Entry) + kElemSizeOverhead + key.Size() + entry.val.Size();
+	auto& from = lists_[size_t(entry.region)];
+	auto& to = lists_[size_t(region)];
+	to.splice(to.end(), from, entry.lruPos);
+	entry.lruPos = std::prev(to.end());
+	regionSizes_[size_t(entry.region)] -= size;
+	regionSizes_[size_t(region)] += size;
+	entry.region = region;
+}
+
+template <typename K, typename V, typename HashT, typename EqualT>
+void LRUCacheImpl<K, V, HashT, EqualT>::eraseEntry(const K& key) {
+	auto mIt = items_.find(key);
+	assertrx_throw(mIt != items_.end());
+	const size_t size = entrySize(mIt);
+	assertrx_throw(size <= totalCacheSize_ && size <= regionSizes_[size_t(mIt->second.region)]);
+	totalCacheSize_ -= size;
+	regionSizes_[size_t(mIt->second.region)] -= size;
+	compressedSavings_ -= savedSize(mIt->second.val);
+	lists_[size_t(mIt->second.region)].erase(mIt->second.lruPos);
+	items_.erase(mIt);
+	++eraseCount_;
+}
+
+template <typename K, typename V, typename HashT, typename EqualT>
+bool LRUCacheImpl<K, V, HashT, EqualT>::evictTinyLFU() {
+	auto& window = lists_[size_t(LRUCacheRegion::Window)];
+	auto& probation = lists_[size_t(LRUCacheRegion::Probation)];
+	auto& protectedList = lists_[size_t(LRUCacheRegion::Protected)];
+	const size_t mainSizeLimit = cacheSizeLimit_ - windowSizeLimit_;
+	const auto mainSize = [this] {
+		return regionSizes_[size_t(LRUCacheRegion::Probation)] + regionSizes_[size_t(LRUCacheRegion::Protected)];
+	};
+
+	// Protected region overflow: its LRU entries are demoted to the probation region
+	while (regionSizes_[size_t(LRUCacheRegion::Protected)] > protectedSizeLimit_ && !protectedList.empty()) {
+		const K& key = *protectedList.front();
+		moveToRegion(key, items_.find(key)->second, LRUCacheRegion::Probation);
+	}
+
+	// Window region overflow: its LRU entries become candidates for the main region and compete with the probation's LRU victims.
+	// The candidate is admitted only if it is accessed more frequently than the victim, so one-time scans can not flush the main region
+	while (regionSizes_[size_t(LRUCacheRegion::Window)] > windowSizeLimit_ && !window.empty()) {
+		const K& candidateKey = *window.front();
+		auto& candidate = items_.find(candidateKey)->second;
+		const size_t candidateSize = sizeof(Entry) + kElemSizeOverhead + candidateKey.Size() + candidate.val.Size();
+		const unsigned candidateFreq = sketch_.Frequency(keyHash(candidateKey));
+		bool admitted = true;
+		while (mainSize() + candidateSize > mainSizeLimit) {
+			auto& victims = probation.empty() ? protectedList : probation;
+			if (victims.empty() || candidateFreq <= sketch_.Frequency(keyHash(*victims.front()))) {
+				admitted = false;
+				break;
+			}
+			eraseEntry(*victims.front());
+		}
+		if (admitted) {
+			moveToRegion(candidateKey, candidate, LRUCacheRegion::Probation);
+		} else {
+			eraseEntry(candidateKey);
+		}
+	}
+
+	// Values sizes may be changed by Put() in any region
+	while (totalCacheSize_ > cacheSizeLimit_) {
+		auto& victims = !probation.empty() ? probation : (!protectedList.empty() ? protectedList : window);
+		if (victims.empty()) [[unlikely]] {
+			clearAll();
+			logFmt(LogError, "LRUCache::evictTinyLFU () Cache restarted because wrong cache size totalCacheSize_={}", totalCacheSize_);
+			return false;
+		}
+		eraseEntry(*victims.front());
+	}
+	return !items_.empty();
 }
 
 template <typename K, typename V, typename HashT, typename EqualT>
 void LRUCacheImpl<K, V, HashT, EqualT>::clearAll() {
 	totalCacheSize_ = 0;
+	compressedSavings_ = 0;
 	std::unordered_map<K, Entry, HashT, EqualT>().swap(items_);
-	LRUList().swap(lru_);
+	for (auto& lru : lists_) {
+		LRUList().swap(lru);
+	}
+	regionSizes_ = {0, 0, 0};
+	sketch_.Clear();
 	getCount_ = 0;
 	putCount_ = 0;
 	eraseCount_ = 0;
@@ -118,6 +341,7 @@ LRUCacheMemStat LRUCacheImpl<K, V, HashT, EqualT>::GetMemStat() const {
 
 	lock_guard lk(lock_);
 	ret.totalSize = totalCacheSize_;
+	ret.compressedSavings = compressedSavings_;
 	ret.itemsCount = items_.size();
 	// for (auto &item : items_) {
 	// 	if (item.second.val.Empty()) ret.emptyCount++;
@@ -138,5 +362,6 @@ template class LRUCacheImpl<IdSetCacheKey, IdSetCacheVal, IdSetCacheKey::Hash, I
 template class LRUCacheImpl<IdSetCacheKey, FtIdSetCacheVal, IdSetCacheKey::Hash, IdSetCacheKey::Equal>;
 template class LRUCacheImpl<QueryCacheKey, QueryCountCacheVal, HashQueryCacheKey, EqQueryCacheKey>;
 template class LRUCacheImpl<joins::CacheKey, joins::CacheVal, joins::hash_cache_key, joins::equal_cache_key>;
+template class LRUCacheImpl<ColdPayloadCacheKey, ColdPayloadCacheVal, ColdPayloadCacheKey::Hash, ColdPayloadCacheKey::Equal>;
 
 }  // namespace reindexer
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <unordered_map>
+#include <vector>
+#include "core/enums.h"
 #include "estl/atomic_unique_ptr.h"
 #include "estl/elist.h"
 #include "estl/lock.h"
@@ -11,27 +15,131 @@ namespace reindexer {
 
 constexpr size_t kElemSizeOverhead = 256;
 
+// Regions of the W-TinyLFU cache. New entries are placed into the small window region and then have to compete with the probation
+// region's victims by their access frequency to get into the main region. Entries, accessed in probation region, are promoted to the
+// protected one. Plain LRU cache does not have regions
+enum class [[nodiscard]] LRUCacheRegion : uint8_t { Window = 0, Probation = 1, Protected = 2, None = 3 };
+
+// Count-min sketch of the keys access frequencies with 4-bit counters. Counters are halved periodically, so the frequencies of the old
+// entries decay over time
+class [[nodiscard]] FrequencySketch {
+public:
+	void EnsureCapacity(size_t entriesCount);
+	void Increment(uint64_t hash) noexcept;
+	unsigned Frequency(uint64_t hash) const noexcept;
+	void Clear() noexcept;
+	size_t HeapSize() const noexcept { return table_.capacity() * sizeof(uint64_t); }
+
+private:
+	constexpr static unsigned kDepth = 4;
+	constexpr static unsigned kCountersPerWord = 16;
+	constexpr static unsigned kCountersPerEntry = 16;
+
+	size_t counterIdx(uint64_t hash, unsigned row) const noexcept;
+	void halve() noexcept;
+
+	std::vector<uint64_t> table_;
+	size_t capacity_ = 0;
+	size_t width_ = 0;
+	size_t additions_ = 0;
+	size_t sampleSize_ = 0;
+};
+
+// Hits and misses counters of the cache
+class [[nodiscard]] LRUCacheStats {
+public:
+	struct [[nodiscard]] RegionStats {
+		std::atomic_uint64_t hits{0};
+		std::atomic_uint64_t misses{0};
+	};
+
+	LRUCacheStats(uint64_t _hits = 0, uint64_t _misses = 0) noexcept : hits{_hits}, misses{_misses} {}
+	LRUCacheStats(const LRUCacheStats& o)
+		: hits(o.hits.load(std::memory_order_relaxed)), misses(o.misses.load(std::memory_order_relaxed)) {
+		copyRegions(o);
+	}
+	void Add(LRUCacheRegion region, bool hit) noexcept {
+		(hit ? hits : misses).fetch_add(1, std::memory_order_relaxed);
+		if (region != LRUCacheRegion::None) {
+			auto& regionStats = regions[size_t(region)];
+			(hit ? regionStats.hits : regionStats.misses).fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	void Add(const LRUCacheStats& o) noexcept {
+		hits.fetch_add(o.hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		misses.fetch_add(o.misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		for (size_t i = 0; i < regions.size(); ++i) {
+			regions[i].hits.fetch_add(o.regions[i].hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			regions[i].misses.fetch_add(o.regions[i].misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+	LRUCachePerfStat GetPerfStat(bool withRegions) const noexcept {
+		LRUCachePerfStat ret;
+		ret.hits = hits.load(std::memory_order_relaxed);
+		ret.misses = misses.load(std::memory_order_relaxed);
+		if (withRegions) {
+			auto& retRegions = ret.regions.emplace();
+			for (size_t i = 0; i < regions.size(); ++i) {
+				retRegions[i].hits = regions[i].hits.load(std::memory_order_relaxed);
+				retRegions[i].misses = regions[i].misses.load(std::memory_order_relaxed);
+			}
+		}
+		return ret;
+	}
+	void Reset() noexcept {
+		hits.store(0, std::memory_order_relaxed);
+		misses.store(0, std::memory_order_relaxed);
+		for (auto& r : regions) {
+			r.hits.store(0, std::memory_order_relaxed);
+			r.misses.store(0, std::memory_order_relaxed);
+		}
+	}
+	LRUCacheStats& operator=(const LRUCacheStats& o) {
+		if (&o != this) {
+			hits.store(o.hits.load());
+			misses.store(o.misses.load());
+			copyRegions(o);
+		}
+		return *this;
+	}
+
+	std::atomic_uint64_t hits;
+	std::atomic_uint64_t misses;
+	std::array<RegionStats, 3> regions;
+
+private:
+	void copyRegions(const LRUCacheStats& o) noexcept {
+		for (size_t i = 0; i < regions.size(); ++i) {
+			regions[i].hits.store(o.regions[i].hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			regions[i].misses.store(o.regions[i].misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+};
+
 template <typename K, typename V, typename HashT, typename EqualT>
 class [[nodiscard]] LRUCacheImpl {
 public:
 	using Key = K;
 	using Value = V;
-	LRUCacheImpl(size_t sizeLimit, uint32_t hitCount) noexcept;
+	LRUCacheImpl(size_t sizeLimit, uint32_t hitCount, CachePolicy policy = CachePolicy::LRU) noexcept;
 	struct [[nodiscard]] Iterator {
-		Iterator(bool k = false, const V& v = V()) : valid(k), val(v) {}
+		Iterator(bool k = false, const V& v = V(), LRUCacheRegion r = LRUCacheRegion::None) : valid(k), val(v), region(r) {}
 		Iterator(const Iterator& other) = delete;
 		Iterator& operator=(const Iterator& other) = delete;
-		Iterator(Iterator&& other) noexcept : valid(other.valid), val(std::move(other.val)) { other.valid = false; }
+		Iterator(Iterator&& other) noexcept : valid(other.valid), val(std::move(other.val)), region(other.region) { other.valid = false; }
 		Iterator& operator=(Iterator&& other) noexcept {
 			if (this != &other) {
 				valid = other.valid;
 				val = std::move(other.val);
+				region = other.region;
 				other.valid = false;
 			}
 			return *this;
 		}
 		bool valid;
 		V val;
+		// Region of the accessed entry (for W-TinyLFU policy only)
+		LRUCacheRegion region;
 	};
 	// Get cached val. Create new entry in cache if it does not exist
 	Iterator Get(const K& k);
@@ -39,6 +147,7 @@ public:
 	void Put(const K& k, V&& v);
 	LRUCacheMemStat GetMemStat() const;
 	void Clear();
+	CachePolicy Policy() const noexcept { return policy_; }
 
 	template <typename T>
 	void Dump(T& os, std::string_view step, std::string_view offset) const {
@@ -49,6 +158,7 @@ public:
 		os << totalCacheSize_ << ",\n"
 		   << newOffset << "cacheSizeLimit: " << cacheSizeLimit_ << ",\n"
 		   << newOffset << "hitCountToCache: " << hitCountToCache_ << ",\n"
+		   << newOffset << "policy: " << (policy_ == CachePolicy::LRU ? "lru" : "w_tinylfu") << ",\n"
 		   << newOffset << "getCount: " << getCount_ << ",\n"
 		   << newOffset << "putCount: " << putCount_ << ",\n"
 		   << newOffset << "eraseCount: " << eraseCount_ << ",\n"
@@ -64,12 +174,24 @@ public:
 			}
 			os << '\n' << newOffset;
 		}
-		os << "],\n" << newOffset << "lruList: [";
-		for (auto b = lru_.begin(), it = b, e = lru_.end(); it != e; ++it) {
-			if (it != b) {
-				os << ", ";
+		const auto dumpList = [&os](const LRUList& list) {
+			for (auto b = list.begin(), it = b, e = list.end(); it != e; ++it) {
+				if (it != b) {
+					os << ", ";
+				}
+				os << **it;
 			}
-			os << **it;
+		};
+		if (policy_ == CachePolicy::LRU) {
+			os << "],\n" << newOffset << "lruList: [";
+			dumpList(lists_[0]);
+		} else {
+			os << "],\n" << newOffset << "windowList: [";
+			dumpList(lists_[size_t(LRUCacheRegion::Window)]);
+			os << "],\n" << newOffset << "probationList: [";
+			dumpList(lists_[size_t(LRUCacheRegion::Probation)]);
+			os << "],\n" << newOffset << "protectedList: [";
+			dumpList(lists_[size_t(LRUCacheRegion::Protected)]);
 		}
 		os << "]\n" << offset << '}';
 	}
@@ -80,6 +202,7 @@ private:
 		V val;
 		typename LRUList::iterator lruPos;
 		int hitCount = 0;
+		LRUCacheRegion region = LRUCacheRegion::Window;
 		template <typename T>
 		void Dump(T& os) const {
 			os << "{val: ";
@@ -90,22 +213,144 @@ private:
 
 	bool eraseLRU();
 	void clearAll();
+	static size_t entrySize(const typename std::unordered_map<K, Entry, HashT, EqualT>::const_iterator& it) noexcept {
+		return sizeof(Entry) + kElemSizeOverhead + it->first.Size() + it->second.val.Size();
+	}
+
+	// W-TinyLFU helpers
+	// Returns true if the eviction was performed
+	bool onAccessTinyLFU(Entry& entry);
+	bool evictTinyLFU();
+	void moveToRegion(const K& key, Entry& entry, LRUCacheRegion region) noexcept;
+	void eraseEntry(const K& key);
+	uint64_t keyHash(const K& key) const noexcept { return HashT()(key); }
+	// Memory, saved by the compressed representation of the cached value (if value supports it)
+	static size_t savedSize(const V& v) noexcept {
+		if constexpr (requires { v.SavedSize(); }) {
+			return v.SavedSize();
+		} else {
+			(void)v;
+			return 0;
+		}
+	}
 
 	std::unordered_map<K, Entry, HashT, EqualT> items_;
-	LRUList lru_;
+	// LRU policy uses the first list only. W-TinyLFU policy has separate list for each region
+	std::array<LRUList, 3> lists_;
+	std::array<size_t, 3> regionSizes_{0, 0, 0};
+	FrequencySketch sketch_;
 	mutable mutex lock_;
 	size_t totalCacheSize_;
+	size_t compressedSavings_ = 0;
 	const size_t cacheSizeLimit_;
 	uint32_t hitCountToCache_;
+	const CachePolicy policy_;
+	const size_t windowSizeLimit_;
+	const size_t protectedSizeLimit_;
 
 	uint64_t getCount_ = 0, putCount_ = 0, eraseCount_ = 0;
 };
 
+// Lock-striped cache: keys are distributed between the independent shards by hash, so the concurrent lookups of the different keys do
+// not contend on the single mutex. Hits and misses are counted by each shard separately for the same reason.
+// Size limit is split equally between the shards, so the single value larger than sizeLimit / shardsCount is never cached
+template <typename K, typename V, typename HashT, typename EqualT>
+class [[nodiscard]] ShardedLRUCacheImpl {
+	using ShardT = LRUCacheImpl<K, V, HashT, EqualT>;
+
+public:
+	using Key = K;
+	using Value = V;
+	using Iterator = typename ShardT::Iterator;
+
+	ShardedLRUCacheImpl(size_t sizeLimit, uint32_t hitCount, CachePolicy policy = CachePolicy::LRU, size_t shardsCount = 1) {
+		shardsCount = std::max(shardsCount, size_t(1));
+		shards_.reserve(shardsCount);
+		for (size_t i = 0; i < shardsCount; ++i) {
+			shards_.emplace_back(std::make_unique<Shard>(sizeLimit / shardsCount, hitCount, policy));
+		}
+	}
+
+	Iterator Get(const K& k) {
+		auto& s = shard(k);
+		auto it = s.cache.Get(k);
+		s.stats.Add(it.region, it.valid && it.val.IsInitialized());
+		return it;
+	}
+	void Put(const K& k, V&& v) { shard(k).cache.Put(k, std::move(v)); }
+	LRUCacheMemStat GetMemStat() const {
+		LRUCacheMemStat ret;
+		for (const auto& s : shards_) {
+			const auto stat = s->cache.GetMemStat();
+			ret.totalSize += stat.totalSize;
+			ret.itemsCount += stat.itemsCount;
+			ret.emptyCount += stat.emptyCount;
+			ret.compressedSavings += stat.compressedSavings;
+			ret.hitCountLimit = std::max(ret.hitCountLimit, stat.hitCountLimit);
+		}
+		return ret;
+	}
+	void Clear() {
+		for (auto& s : shards_) {
+			s->cache.Clear();
+		}
+	}
+	// Adds the hits and misses of all of the shards to 'stats'
+	void AddPerfStatTo(LRUCacheStats& stats) const noexcept {
+		for (const auto& s : shards_) {
+			stats.Add(s->stats);
+		}
+	}
+	void ResetPerfStat() noexcept {
+		for (auto& s : shards_) {
+			s->stats.Reset();
+		}
+	}
+	CachePolicy Policy() const noexcept { return shards_.front()->cache.Policy(); }
+	size_t ShardsCount() const noexcept { return shards_.size(); }
+
+	template <typename T>
+	void Dump(T& os, std::string_view step, std::string_view offset) const {
+		if (shards_.size() == 1) {
+			shards_.front()->cache.Dump(os, step, offset);
+			return;
+		}
+		std::string newOffset{offset};
+		newOffset += step;
+		os << "{\n" << newOffset << "shards: [";
+		for (size_t i = 0; i < shards_.size(); ++i) {
+			os << (i ? ",\n" : "\n") << newOffset;
+			shards_[i]->cache.Dump(os, step, newOffset);
+		}
+		os << "]\n" << offset << '}';
+	}
+
+private:
+	struct [[nodiscard]] Shard {
+		Shard(size_t sizeLimit, uint32_t hitCount, CachePolicy policy) noexcept : cache(sizeLimit, hitCount, policy) {}
+
+		ShardT cache;
+		LRUCacheStats stats;
+	};
+
+	Shard& shard(const K& k) const noexcept {
+		if (shards_.size() == 1) {
+			return *shards_.front();
+		}
+		// High bits of the mixed hash are used, because the low ones select the bucket inside the shard's hash map
+		return *shards_[((uint64_t(HashT()(k)) * 0x9E3779B97F4A7C15ULL) >> 32) % shards_.size()];
+	}
+
+	std::vector<std::unique_ptr<Shard>> shards_;
+};
+
 enum class [[nodiscard]] LRUWithAtomicPtr : bool { Yes, No };
 
 template <typename CacheT, LRUWithAtomicPtr withAtomicPtr>
 class [[nodiscard]] LRUCache {
 	using CachePtrT = std::conditional_t<withAtomicPtr == LRUWithAtomicPtr::Yes, atomic_unique_ptr<CacheT>, std::unique_ptr<CacheT>>;
+	// Sharded caches count hits and misses by themselves to avoid the contention on the shared counters
+	static constexpr bool kCacheCountsStats = requires(const CacheT& c, LRUCacheStats& s) { c.AddPerfStatTo(s); };
 
 public:
 	using Iterator = typename CacheT::Iterator;
@@ -116,7 +361,7 @@ public:
 		(void)alignment1_;
 		(void)alignment2_;
 #if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86)
-		static_assert(sizeof(LRUCache) == 128, "Unexpected size. Check alignment");
+		static_assert(sizeof(LRUCache) == 176, "Unexpected size. Check alignment");
 #endif	// defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86)
 	}
 	virtual ~LRUCache() = default;
@@ -125,10 +370,8 @@ public:
 		typename CacheT::Iterator it;
 		if (ptr_) {
 			it = ptr_->Get(k);
-			if (it.valid && it.val.IsInitialized()) {
-				stats_.hits.fetch_add(1, std::memory_order_relaxed);
-			} else {
-				stats_.misses.fetch_add(1, std::memory_order_relaxed);
+			if constexpr (!kCacheCountsStats) {
+				stats_.Add(it.region, it.valid && it.val.IsInitialized());
 			}
 		}
 		return it;
@@ -140,11 +383,29 @@ public:
 	}
 	LRUCacheMemStat GetMemStat() const { return ptr_ ? ptr_->GetMemStat() : LRUCacheMemStat(); }
 	LRUCachePerfStat GetPerfStat() const noexcept {
-		auto stats = stats_.GetPerfStat();
-		stats.state = ptr_ ? LRUCachePerfStat::State::Active : LRUCachePerfStat::State::Inactive;
+		const CacheT* cache = ptr_.get();
+		const bool withRegions = cache && cache->Policy() == CachePolicy::WTinyLFU;
+		LRUCachePerfStat stats;
+		if constexpr (kCacheCountsStats) {
+			LRUCacheStats total(stats_);
+			if (cache) {
+				cache->AddPerfStatTo(total);
+			}
+			stats = total.GetPerfStat(withRegions);
+		} else {
+			stats = stats_.GetPerfStat(withRegions);
+		}
+		stats.state = cache ? LRUCachePerfStat::State::Active : LRUCachePerfStat::State::Inactive;
 		return stats;
 	}
-	void ResetPerfStat() noexcept { stats_.Reset(); }
+	void ResetPerfStat() noexcept {
+		stats_.Reset();
+		if constexpr (kCacheCountsStats) {
+			if (ptr_) {
+				ptr_->ResetPerfStat();
+			}
+		}
+	}
 	void Clear() {
 		if (ptr_) {
 			ptr_->Clear();
@@ -165,49 +426,46 @@ public:
 			os << "<empty>";
 		}
 	}
-	void ResetImpl() noexcept { ptr_.reset(); }
+	void ResetImpl() noexcept {
+		keepPerfStat();
+		ptr_.reset();
+	}
 	template <typename... Args>
 	void Reinitialize(Args&&... args) {
-		ptr_ = makePtr(std::forward<Args>(args)...);
+		auto ptr = makePtr(std::forward<Args>(args)...);
+		keepPerfStat();
+		ptr_ = std::move(ptr);
 	}
 	bool IsActive() const noexcept { return ptr_.get(); }
-	void CopyInternalPerfStatsFrom(const LRUCache& o) noexcept { stats_ = o.stats_; }
+	void CopyInternalPerfStatsFrom(const LRUCache& o) noexcept {
+		stats_ = o.stats_;
+		if constexpr (kCacheCountsStats) {
+			if (o.ptr_) {
+				o.ptr_->AddPerfStatTo(stats_);
+			}
+		}
+	}
 
 private:
+	// Moves the counters of the cache implementation, which is going to be destroyed, into the own stats
+	void keepPerfStat() noexcept {
+		if constexpr (kCacheCountsStats) {
+			if (ptr_) {
+				ptr_->AddPerfStatTo(stats_);
+			}
+		}
+	}
 	template <typename... Args>
 	CachePtrT makePtr(Args&&... args) {
 		return CachePtrT(new CacheT(std::forward<Args>(args)...));
 	}
 
-	class [[nodiscard]] Stats {
-	public:
-		Stats(uint64_t _hits = 0, uint64_t _misses = 0) noexcept : hits{_hits}, misses{_misses} {}
-		Stats(const Stats& o) : hits(o.hits.load(std::memory_order_relaxed)), misses(o.misses.load(std::memory_order_relaxed)) {}
-		LRUCachePerfStat GetPerfStat() const noexcept {
-			return LRUCachePerfStat{.hits = hits.load(std::memory_order_relaxed), .misses = misses.load(std::memory_order_relaxed)};
-		}
-		void Reset() noexcept {
-			hits.store(0, std::memory_order_relaxed);
-			misses.store(0, std::memory_order_relaxed);
-		}
-		Stats& operator=(const Stats& o) {
-			if (&o != this) {
-				hits.store(o.hits.load());
-				misses.store(o.misses.load());
-			}
-			return *this;
-		}
-
-		std::atomic_uint64_t hits;
-		std::atomic_uint64_t misses;
-	};
-
 	// Cache line alignment to avoid contention between atomic cache ptr and cache stats (alignas would be better, but it does not work
 	// properly with tcmalloc on CentOS7)
 	uint8_t alignment1_[48];
 	CachePtrT ptr_;
 	uint8_t alignment2_[48];
-	mutable Stats stats_;
+	mutable LRUCacheStats stats_;
 };
 
 }  // namespace reindexer
@@ -1,5 +1,6 @@
 #include "asyncstorage.h"
 #include "core/storage/storagefactory.h"
+#include "items_image.h"
 #include "tools/logger.h"
 
 namespace reindexer {
@@ -53,6 +54,7 @@ void AsyncStorage::Destroy() {
 
 	if (storage_) {
 		clearUpdates();
+		items_image::Remove(path_);
 		storage_->Destroy(path_);
 		reset();
 	}
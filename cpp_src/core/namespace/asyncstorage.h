@@ -154,6 +154,7 @@ public:
 		lock_guard lck(storageMtx_);
 		return storage_.get();
 	}
+	bool HasUnflushedUpdates() const noexcept { return totalUpdatesCount_.load(std::memory_order_acquire); }
 	Status GetStatusCached() const noexcept { return statusCache_.GetStatus(); }
 	std::string GetPathCached() const noexcept { return statusCache_.GetPath(); }
 	std::string GetPath() const noexcept;
@@ -0,0 +1,43 @@
+#include "datahashtree.h"
+#include <algorithm>
+#include <bit>
+
+namespace reindexer {
+
+// Expected average count of the items in the single bucket
+constexpr static size_t kItemsPerBucket = 64;
+
+uint32_t DataHashTree::LeavesCountFor(size_t itemsCount) noexcept {
+	const size_t leaves = std::bit_ceil(std::max<size_t>(itemsCount / kItemsPerBucket, 1));
+	return uint32_t(std::clamp<size_t>(leaves, kMinLeavesCount, kMaxLeavesCount));
+}
+
+DataHashTree::DataHashTree(uint32_t leavesCount) : leavesCount_(leavesCount), depth_(std::countr_zero(leavesCount)) {
+	if (!std::has_single_bit(leavesCount) || leavesCount < kMinLeavesCount || leavesCount > kMaxLeavesCount) {
+		throw Error(errParams, "Unexpected leaves count of the data hash tree: {}", leavesCount);
+	}
+	nodes_.resize(size_t(leavesCount) * 2, 0);
+}
+
+uint32_t DataHashTree::Bucket(uint64_t pkHash) const noexcept {
+	// Hashes of the integer keys may have poor low bits, so they are mixed before the bucket choice (splitmix64 finalizer)
+	pkHash ^= pkHash >> 30;
+	pkHash *= 0xbf58476d1ce4e5b9ull;
+	pkHash ^= pkHash >> 27;
+	pkHash *= 0x94d049bb133111ebull;
+	pkHash ^= pkHash >> 31;
+	return uint32_t(pkHash & (leavesCount_ - 1));
+}
+
+void DataHashTree::GetNodes(std::span<const uint32_t> nodes, std::vector<uint64_t>& hashes) const {
+	hashes.clear();
+	hashes.reserve(nodes.size());
+	for (auto node : nodes) {
+		if (node == 0 || node >= nodes_.size()) {
+			throw Error(errParams, "Unexpected data hash tree node: {}. Tree has {} leaves", node, leavesCount_);
+		}
+		hashes.emplace_back(nodes_[node]);
+	}
+}
+
+}  // namespace reindexer
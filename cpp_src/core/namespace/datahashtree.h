@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <vector>
+#include "tools/errors.h"
+
+namespace reindexer {
+
+/// Hash tree over the namespace's items. Items are grouped into the buckets by the hash of their PK, each leaf holds XOR of the
+/// checksums of the bucket's items and each inner node holds XOR of its children, so the root is equal to the namespace's datahash.
+/// Leader and follower compare their trees from the root to find the diverged buckets and resync only the items of these buckets.
+/// Nodes are stored in the heap layout: root is the node 1, children of the node N are 2N and 2N+1, leaves are [LeavesCount(), 2 *
+/// LeavesCount())
+class [[nodiscard]] DataHashTree {
+public:
+	constexpr static uint32_t kMinLeavesCount = 1 << 10;
+	constexpr static uint32_t kMaxLeavesCount = 1 << 20;
+	// Levels, compared by the single request to the other tree
+	constexpr static uint32_t kLevelsPerRequest = 4;
+
+	/// Leaves count for the namespace with this items count. Both of the trees must have the same leaves count to be compared
+	static uint32_t LeavesCountFor(size_t itemsCount) noexcept;
+	/// Limit for the diverged buckets count. If there are more of them, full force sync is cheaper than the buckets resync
+	static size_t MaxDivergedBuckets(uint32_t leavesCount) noexcept { return leavesCount / 8; }
+
+	/// Throws errParams, if leaves count is not the power of 2 or out of [kMinLeavesCount, kMaxLeavesCount]
+	explicit DataHashTree(uint32_t leavesCount);
+
+	uint32_t LeavesCount() const noexcept { return leavesCount_; }
+	uint32_t Bucket(uint64_t pkHash) const noexcept;
+	uint64_t Root() const noexcept { return nodes_[1]; }
+	uint64_t Leaf(uint32_t bucket) const noexcept { return nodes_[leavesCount_ + bucket]; }
+	void Xor(uint32_t bucket, uint64_t checksum) noexcept {
+		for (uint32_t node = leavesCount_ + bucket; node; node >>= 1) {
+			nodes_[node] ^= checksum;
+		}
+	}
+	/// Throws errParams on the unknown node
+	void GetNodes(std::span<const uint32_t> nodes, std::vector<uint64_t>& hashes) const;
+
+	/// Returns the buckets, which differ from the other tree with the same leaves count. 'getOtherNodes(nodes, hashes)' must return
+	/// the hashes of the other tree's nodes, so only the subtrees with the different hashes are requested level by level.
+	/// Returns std::nullopt, if there are more than 'maxBuckets' of the diverged buckets
+	template <typename GetNodesF>
+	std::optional<std::vector<uint32_t>> DivergedBuckets(GetNodesF&& getOtherNodes, size_t maxBuckets) const {
+		std::vector<uint32_t> diverged{1}, nodes;
+		std::vector<uint64_t> hashes;
+		getOtherNodes(std::span<const uint32_t>(diverged), hashes);
+		checkResponse(diverged.size(), hashes.size());
+		if (hashes[0] == Root()) {
+			return std::vector<uint32_t>();
+		}
+		for (uint32_t level = 0; level < depth_;) {
+			const uint32_t step = std::min(kLevelsPerRequest, depth_ - level);
+			nodes.clear();
+			nodes.reserve(diverged.size() << step);
+			for (auto node : diverged) {
+				for (uint32_t i = 0; i < (1u << step); ++i) {
+					nodes.emplace_back((node << step) + i);
+				}
+			}
+			getOtherNodes(std::span<const uint32_t>(nodes), hashes);
+			checkResponse(nodes.size(), hashes.size());
+			diverged.clear();
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				if (nodes_[nodes[i]] != hashes[i]) {
+					diverged.emplace_back(nodes[i]);
+				}
+			}
+			// Each of the diverged nodes has at least one diverged leaf
+			if (diverged.size() > maxBuckets) {
+				return std::nullopt;
+			}
+			level += step;
+		}
+		for (auto& node : diverged) {
+			node -= leavesCount_;
+		}
+		return diverged;
+	}
+
+private:
+	static void checkResponse(size_t requested, size_t received) {
+		if (requested != received) {
+			throw Error(errLogic, "Unexpected count of the data hash tree nodes: {} ({} were requested)", received, requested);
+		}
+	}
+
+	uint32_t leavesCount_;
+	uint32_t depth_;
+	std::vector<uint64_t> nodes_;
+};
+
+/// Result of the comparison of the leader's tree ('baseline') with the follower's one. Leader also resyncs the buckets, which were
+/// changed after the comparison, so the baseline is required to find them
+struct [[nodiscard]] DataHashTreeDiff {
+	DataHashTree baseline;
+	std::vector<uint32_t> buckets;
+};
+
+}  // namespace reindexer
@@ -0,0 +1,270 @@
+#include "items_image.h"
+#include <algorithm>
+#include <cstdio>
+#include "core/itemimpl.h"
+#include "core/storage/storage_prefixes.h"
+#include "namespaceimpl.h"
+#include "tools/fsops.h"
+#include "tools/logger.h"
+#include "tools/serilize/serializer.h"
+#include "tools/serilize/wrserializer.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif	// _WIN32
+
+namespace reindexer::items_image {
+
+// Image layout:
+// header:  magic(uint32), version(varuint), payload type(vstring), tags matcher state token(uint32), tags matcher version(varint),
+//          records count(varuint)
+// records: storage key(vstring), LSN(uint64), record(vstring) - sorted by storage key
+// record:  tuple(slice), then for each indexed field: values count(varuint) and values(variant)
+// trailer: records count(uint64), magic(uint32) - allows to detect truncated files
+constexpr uint32_t kMagic = 0x49494452;	 // 'RDII'
+constexpr uint64_t kVersion = 1;
+constexpr size_t kTrailerSize = sizeof(uint64_t) + sizeof(uint32_t);
+constexpr size_t kWriteChunkSize = 1 << 20;
+
+std::string FilePath(const std::string& storagePath) { return fs::JoinPath(storagePath, kFileName); }
+
+void Remove(const std::string& storagePath) noexcept {
+	if (!storagePath.empty()) {
+		std::ignore = std::remove(FilePath(storagePath).c_str());
+	}
+}
+
+void Writer::Write(const std::string& storagePath) const {
+	const FieldsSet* pkFields = ns_.pkFields();
+	assertrx_throw(pkFields);
+	const PayloadType& pt = ns_.payloadType_;
+
+	std::vector<std::pair<std::string, IdType>> keys;
+	keys.reserve(ns_.items_.size() - ns_.free_.size());
+	WrSerializer keySer;
+	for (size_t id = 0, s = ns_.items_.size(); id < s; ++id) {
+		const auto rowId = IdType::FromNumber(id);
+		const auto& pv = ns_.items_[rowId];
+		if (pv.IsFree()) {
+			continue;
+		}
+		keySer.Reset();
+		keySer << kRxStorageItemPrefix;
+		ConstPayload(pt, pv).SerializeFields(keySer, *pkFields);
+		keys.emplace_back(std::string(keySer.Slice()), rowId);
+	}
+	// Image records must have the same order as the storage items
+	std::sort(keys.begin(), keys.end(), [](const auto& l, const auto& r) noexcept { return l.first < r.first; });
+
+	const std::string path = FilePath(storagePath);
+	const std::string tmpPath = path + ".tmp";
+	std::unique_ptr<FILE, int (*)(FILE*)> file(std::fopen(tmpPath.c_str(), "wb"), std::fclose);
+	if (!file) {
+		throw Error(errParams, "Unable to create items image file '{}': {}", tmpPath, strerror(errno));
+	}
+	WrSerializer ser, recordSer;
+	const auto flush = [&](size_t minSize) {
+		if (ser.Len() >= minSize && ser.Len()) {
+			if (std::fwrite(ser.Buf(), 1, ser.Len(), file.get()) != ser.Len()) {
+				throw Error(errLogic, "Unable to write items image file '{}': {}", tmpPath, strerror(errno));
+			}
+			ser.Reset();
+		}
+	};
+
+	ser.PutUInt32(kMagic);
+	ser.PutVarUint(kVersion);
+	ser.PutVString(pt.ToString());
+	ser.PutUInt32(ns_.tagsMatcher_.stateToken());
+	ser.PutVarint(ns_.tagsMatcher_.version());
+	ser.PutVarUint(keys.size());
+
+	VariantArray values;
+	for (const auto& [key, rowId] : keys) {
+		const auto& pv = ns_.items_[rowId];
+		ConstPayload pl(pt, pv);
+		recordSer.Reset();
+		pl.Get(0, values);
+		recordSer.PutSlice(std::string_view(values[0]));
+		for (int field = 1, cnt = pt.NumFields(); field < cnt; ++field) {
+			pl.Get(field, values);
+			recordSer.PutVarUint(values.size());
+			for (const auto& v : values) {
+				recordSer.PutVariant(v);
+			}
+		}
+		ser.PutVString(key);
+		ser.PutUInt64(uint64_t(pv.GetLSN()));
+		ser.PutVString(recordSer.Slice());
+		flush(kWriteChunkSize);
+	}
+
+	ser.PutUInt64(keys.size());
+	ser.PutUInt32(kMagic);
+	flush(0);
+	if (std::fclose(file.release()) != 0) {
+		throw Error(errLogic, "Unable to close items image file '{}': {}", tmpPath, strerror(errno));
+	}
+	if (fs::Rename(tmpPath, path) != 0) {
+		const int err = errno;
+		std::ignore = std::remove(tmpPath.c_str());
+		throw Error(errLogic, "Unable to rename items image file '{}': {}", tmpPath, strerror(err));
+	}
+	logFmt(LogInfo, "[{}] Items image with {} items was written", ns_.name_, keys.size());
+}
+
+class [[nodiscard]] Reader::Mapping {
+public:
+	static std::unique_ptr<Mapping> Create(const std::string& path) {
+		auto mapping = std::make_unique<Mapping>();
+#ifndef _WIN32
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return {};
+		}
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+			::close(fd);
+			return {};
+		}
+		void* addr = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (addr == MAP_FAILED) {
+			return {};
+		}
+		mapping->data_ = std::string_view(static_cast<const char*>(addr), size_t(st.st_size));
+#else	// _WIN32
+		if (fs::ReadFile(path, mapping->buf_) <= 0) {
+			return {};
+		}
+		mapping->data_ = mapping->buf_;
+#endif	// _WIN32
+		return mapping;
+	}
+	Mapping() = default;
+	Mapping(const Mapping&) = delete;
+	Mapping& operator=(const Mapping&) = delete;
+	~Mapping() {
+#ifndef _WIN32
+		if (!data_.empty()) {
+			::munmap(const_cast<char*>(data_.data()), data_.size());
+		}
+#endif	// _WIN32
+	}
+
+	std::string_view Data() const noexcept { return data_; }
+
+private:
+	std::string_view data_;
+#ifdef _WIN32
+	std::string buf_;
+#endif	// _WIN32
+};
+
+Reader::Reader(std::unique_ptr<Mapping>&& mapping, std::string_view records, size_t count) noexcept
+	: mapping_(std::move(mapping)), records_(records), count_(count) {}
+
+Reader::~Reader() = default;
+
+std::unique_ptr<Reader> Reader::Open(std::string_view nsName, const std::string& storagePath, const PayloadType& pt,
+									 const TagsMatcher& tm) {
+	auto mapping = Mapping::Create(FilePath(storagePath));
+	if (!mapping) {
+		return {};
+	}
+	try {
+		const std::string_view data = mapping->Data();
+		if (data.size() < sizeof(kMagic) + kTrailerSize) {
+			throw Error(errParseBin, "File is too short");
+		}
+		Serializer trailer(data.substr(data.size() - kTrailerSize));
+		const uint64_t count = trailer.GetUInt64();
+		if (trailer.GetUInt32() != kMagic) {
+			throw Error(errParseBin, "File is truncated");
+		}
+
+		Serializer ser(data.substr(0, data.size() - kTrailerSize));
+		if (ser.GetUInt32() != kMagic) {
+			throw Error(errParseBin, "Unexpected file format");
+		}
+		if (const auto version = ser.GetVarUInt(); version != kVersion) {
+			throw Error(errParseBin, "Unsupported image version: {}", version);
+		}
+		if (ser.GetVString() != pt.ToString()) {
+			logFmt(LogInfo, "[{}] Items image is outdated: payload type was changed", nsName);
+			return {};
+		}
+		const uint32_t stateToken = ser.GetUInt32();
+		const int64_t tmVersion = ser.GetVarint();
+		// Tags are only appended to the tags matcher, so the tuples from the image are still valid for the newer tags matcher's version
+		if (stateToken != tm.stateToken() || tmVersion > tm.version()) {
+			logFmt(LogInfo, "[{}] Items image is outdated: tags matcher was changed", nsName);
+			return {};
+		}
+		if (ser.GetVarUInt() != count) {
+			throw Error(errParseBin, "Records count mismatch");
+		}
+		const std::string_view records = data.substr(ser.Pos(), ser.Len() - ser.Pos());
+		return std::unique_ptr<Reader>(new Reader(std::move(mapping), records, count));
+	} catch (const Error& err) {
+		logFmt(LogWarning, "[{}] Unable to use items image: {}", nsName, err.what());
+	}
+	return {};
+}
+
+std::optional<std::string_view> Reader::Find(std::string_view key, uint64_t lsn) {
+	if (!hasCur_ && !readNext()) {
+		return std::nullopt;
+	}
+	while (curKey_ < key) {
+		if (!readNext()) {
+			return std::nullopt;
+		}
+	}
+	if (curKey_ == key && curLSN_ == lsn) {
+		return curRecord_;
+	}
+	return std::nullopt;
+}
+
+bool Reader::readNext() {
+	if (read_ >= count_) {
+		hasCur_ = false;
+		return false;
+	}
+	Serializer ser(records_);
+	ser.SetPos(pos_);
+	curKey_ = ser.GetVString();
+	curLSN_ = ser.GetUInt64();
+	curRecord_ = ser.GetVString();
+	pos_ = ser.Pos();
+	++read_;
+	hasCur_ = true;
+	return true;
+}
+
+void Reader::FillItem(std::string_view record, ItemImpl& item) const {
+	item.Value().Clone();
+	Payload pl = item.GetPayload();
+	pl.Reset();
+
+	Serializer ser(record);
+	pl.Set(0, Variant(ser.GetPSlice(), Variant::noHold));
+	VariantArray values;
+	for (int field = 1, cnt = pl.NumFields(); field < cnt; ++field) {
+		const uint64_t len = ser.GetVarUInt();
+		values.clear<false>();
+		for (uint64_t i = 0; i < len; ++i) {
+			values.emplace_back(ser.GetVariant());
+		}
+		pl.Set(field, values);
+	}
+	if (!ser.Eof()) {
+		throw Error(errParseBin, "Unexpected data in the items image record");
+	}
+}
+
+}  // namespace reindexer::items_image
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace reindexer {
+
+class NamespaceImpl;
+class ItemImpl;
+class PayloadType;
+class TagsMatcher;
+
+/// Items image is the binary dump of the namespace payloads, which is written into the storage directory on the namespace close.
+/// On the next startup items with unchanged storage key and LSN are restored from the memory-mapped image without CJSON decoding.
+/// Indexes are built from the restored payloads as usual.
+namespace items_image {
+
+constexpr std::string_view kFileName = "items.image";
+
+std::string FilePath(const std::string& storagePath);
+void Remove(const std::string& storagePath) noexcept;
+
+class [[nodiscard]] Writer {
+public:
+	explicit Writer(const NamespaceImpl& ns) noexcept : ns_(ns) {}
+
+	/// Writes image into the temporary file and replaces the previous one
+	void Write(const std::string& storagePath) const;
+
+private:
+	const NamespaceImpl& ns_;
+};
+
+class [[nodiscard]] Reader {
+public:
+	/// Opens and validates the image. Returns nullptr if there is no image or the image is not compatible with the current namespace state
+	static std::unique_ptr<Reader> Open(std::string_view nsName, const std::string& storagePath, const PayloadType&, const TagsMatcher&);
+	~Reader();
+
+	/// Looks for the record of the item with the same storage key and LSN. Keys must be requested in the storage iteration order
+	std::optional<std::string_view> Find(std::string_view key, uint64_t lsn);
+	void FillItem(std::string_view record, ItemImpl& item) const;
+	size_t Size() const noexcept { return count_; }
+
+private:
+	class Mapping;
+
+	Reader(std::unique_ptr<Mapping>&& mapping, std::string_view records, size_t count) noexcept;
+	bool readNext();
+
+	std::unique_ptr<Mapping> mapping_;
+	std::string_view records_;
+	size_t count_ = 0;
+	size_t pos_ = 0;
+	size_t read_ = 0;
+	std::string_view curKey_;
+	uint64_t curLSN_ = 0;
+	std::string_view curRecord_;
+	bool hasCur_ = false;
+};
+
+}  // namespace items_image
+}  // namespace reindexer
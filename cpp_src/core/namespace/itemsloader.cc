@@ -12,6 +12,9 @@ ItemsLoader::LoadData ItemsLoader::Load() {
 	logFmt(LogTrace, "Loading items to '{}' from storage", ns_.name_);
 
 	prepareANNData();
+	if (ns_.config_.itemsImage && annIndexes_.empty()) {
+		image_ = items_image::Reader::Open(ns_.name_, ns_.storage_.GetPath(), ns_.payloadType_, ns_.tagsMatcher_);
+	}
 
 	std::thread readingTh = std::thread([this] {
 		try {
@@ -38,6 +41,11 @@ ItemsLoader::LoadData ItemsLoader::Load() {
 
 	loadCachedANNIndexes();
 
+	if (image_) {
+		logFmt(LogInfo, "[{}] {} items were restored from the items image ({} records in the image)", ns_.name_,
+			   loadingData_.restoredFromImage, image_->Size());
+		image_.reset();
+	}
 	clearIndexCache();
 	if (loadingData_.ex) {
 		std::rethrow_exception(loadingData_.ex);
@@ -70,6 +78,8 @@ void ItemsLoader::reading() {
 	int64_t maxLSN = -1;
 	int64_t minLSN = std::numeric_limits<int64_t>::max();
 	const bool nsIsSystem = ns_.isSystem();
+	size_t restoredFromImage = 0;
+	bool useImage = bool(image_);
 	auto dbIter = ns_.storage_.GetCursor(opts);
 	unsigned sliceId = 0;
 	for (dbIter->Seek(kRxStorageItemPrefix);
@@ -101,6 +111,17 @@ void ItemsLoader::reading() {
 			minLSN = std::min(minLSN, l.Counter());
 			dataSlice = dataSlice.substr(sizeof(lsn));
 
+			std::optional<std::string_view> imageRecord;
+			if (useImage) {
+				try {
+					imageRecord = image_->Find(dbIter->Key(), uint64_t(lsn));
+				} catch (const Error& err) {
+					logFmt(LogWarning, "[{}] Items image is corrupted, the rest of items will be loaded from storage: '{}'", ns_.name_,
+						   err.what());
+					useImage = false;
+				}
+			}
+
 			unique_lock lck(mtx_);
 			cv_.wait(lck, [this] { return !items_.IsFull() || terminated_; });
 			if (terminated_) {
@@ -109,17 +130,32 @@ void ItemsLoader::reading() {
 			auto& item = items_.PlaceItem();
 			lck.unlock();
 
-			auto& sliceStorageP = slices_[sliceId];
-			if (sliceStorageP.len < dataSlice.size()) {
-				sliceStorageP.len = dataSlice.size() * 1.1;
-				sliceStorageP.data.reset(new char[sliceStorageP.len]);
-			}
-			memcpy(sliceStorageP.data.get(), dataSlice.data(), dataSlice.size());
-			dataSlice = std::string_view(sliceStorageP.data.get(), dataSlice.size());
-			sliceId = (sliceId + 1) % slices_.size();
 			item.impl.Unsafe(true);
+			bool restored = false;
+			if (imageRecord) {
+				// Unchanged item's payload refers to the image memory and does not require CJSON decoding
+				try {
+					image_->FillItem(*imageRecord, item.impl);
+					restored = true;
+					++restoredFromImage;
+				} catch (const Error& err) {
+					logFmt(LogWarning, "[{}] Items image is corrupted, the rest of items will be loaded from storage: '{}'", ns_.name_,
+						   err.what());
+					useImage = false;
+				}
+			}
 			try {
-				item.impl.FromCJSON(dataSlice);
+				if (!restored) {
+					auto& sliceStorageP = slices_[sliceId];
+					if (sliceStorageP.len < dataSlice.size()) {
+						sliceStorageP.len = dataSlice.size() * 1.1;
+						sliceStorageP.data.reset(new char[sliceStorageP.len]);
+					}
+					memcpy(sliceStorageP.data.get(), dataSlice.data(), dataSlice.size());
+					dataSlice = std::string_view(sliceStorageP.data.get(), dataSlice.size());
+					sliceId = (sliceId + 1) % slices_.size();
+					item.impl.FromCJSON(dataSlice);
+				}
 			} catch (const Error& err) {
 				logFmt(LogTrace, "Error load item to '{}' from storage: '{}'", ns_.name_, err.what());
 				++errCount;
@@ -176,6 +212,7 @@ void ItemsLoader::reading() {
 	loadingData_.lastErr = std::move(lastErr);
 	loadingData_.errCount = errCount;
 	loadingData_.ldcount = ldcount;
+	loadingData_.restoredFromImage = restoredFromImage;
 	if (items_.HasNoWrittenItems()) {
 		cv_.notify_all();
 	}
@@ -3,6 +3,7 @@
 #include "core/itemimpl.h"
 #include "estl/condition_variable.h"
 #include "estl/mutex.h"
+#include "items_image.h"
 #include "namespaceimpl.h"
 
 namespace reindexer {
@@ -18,6 +19,7 @@ public:
 		Error lastErr;
 		unsigned errCount = 0;
 		size_t ldcount = 0;
+		size_t restoredFromImage = 0;
 		std::exception_ptr ex;
 	};
 
@@ -121,6 +123,9 @@ private:
 	std::unique_ptr<ann_storage_cache::Reader> annCacheReader_;
 	std::vector<ANNIndexInfo> annIndexes_;
 	fast_hash_map<size_t, std::vector<h_vector<FloatVector, 1>>> vectorsData_;
+
+	// Payloads of the restored items refer to the image memory, so it must be kept until the end of the loading
+	std::unique_ptr<items_image::Reader> image_;
 };
 
 class [[nodiscard]] IndexInserters {
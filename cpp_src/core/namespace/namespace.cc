@@ -60,6 +60,9 @@ void Namespace::CommitTransaction(LocalTransaction& tx, LocalQueryResults& resul
 					*nsl, !lvectorIndexes.empty() ? tx.CalculateNewCapacity(nsl->itemsCount()) : nsl->itemsCount(), storageLock));
 				cg.Reset();
 				nsCopyCalc.HitManualy();
+				if (enablePerfCounters) {
+					copyMemoryCounter_.Count(nsCopy->copiedMemorySize(ctx.rdxContext));
+				}
 				NsContext nsCtx(ctx);
 				nsCtx.isCopiedNsRequest = true;
 				tmCommitStart = system_clock_w::now();
@@ -141,6 +144,10 @@ NamespacePerfStat Namespace::GetPerfStat(const RdxContext& ctx) {
 	stats.transactions.minCopyTimeUs = copyStats.minTimeUs;
 	stats.transactions.maxCopyTimeUs = copyStats.maxTimeUs;
 	stats.transactions.avgCopyTimeUs = copyStats.totalAvgTimeUs;
+	const auto copyMemoryStats = copyMemoryCounter_.Get();
+	stats.transactions.avgCopyMemory = static_cast<size_t>(copyMemoryStats.avg);
+	stats.transactions.minCopyMemory = copyMemoryStats.minValue;
+	stats.transactions.maxCopyMemory = copyMemoryStats.maxValue;
 	auto commitStats = commitStatsCounter_.Get<PerfStat>();
 	stats.transactions.totalCount = commitStats.totalHitCount;
 	stats.transactions.minCommitTimeUs = commitStats.minTimeUs;
@@ -131,6 +131,7 @@ public:
 		txStatsCounter_.Reset();
 		commitStatsCounter_.Reset();
 		copyStatsCounter_.Reset();
+		copyMemoryCounter_.Reset();
 		nsFuncWrapper<&NamespaceImpl::ResetPerfStat>(ctx);
 	}
 	std::vector<std::string> EnumMeta(const RdxContext& ctx) { return nsFuncWrapper<&NamespaceImpl::EnumMeta>(ctx); }
@@ -202,6 +203,12 @@ public:
 		nsFuncWrapper<&NamespaceImpl::GetSnapshot>(snapshot, opts, ctx);
 	}
 	void ApplySnapshotChunk(const SnapshotChunk& ch, bool isInitialLeaderSync, const RdxContext& ctx);
+	DataHashTree GetDataHashTree(uint32_t leavesCount, const RdxContext& ctx) {
+		return nsFuncWrapper<&NamespaceImpl::GetDataHashTree>(leavesCount, ctx);
+	}
+	std::vector<uint64_t> GetDataHashTreeNodes(uint32_t leavesCount, std::span<const uint32_t> nodes, const RdxContext& ctx) {
+		return nsFuncWrapper<&NamespaceImpl::GetDataHashTreeNodes>(leavesCount, nodes, ctx);
+	}
 	void SetTagsMatcher(TagsMatcher&& tm, const RdxContext& ctx) { nsFuncWrapper<&NamespaceImpl::SetTagsMatcher>(std::move(tm), ctx); }
 	void DropANNStorageCache(std::string_view index, const RdxContext& ctx) {
 		nsFuncWrapper<&NamespaceImpl::DropANNStorageCache>(index, ctx);
@@ -296,6 +303,7 @@ private:
 	TxStatCounter txStatsCounter_{};
 	PerfStatCounterMT commitStatsCounter_;
 	PerfStatCounterMT copyStatsCounter_;
+	QuantityCounterMT<size_t> copyMemoryCounter_;
 	std::atomic<LongTxLoggingParams> longTxLoggingParams_;
 	std::atomic<LongQueriesLoggingParams> longUpdDelLoggingParams_;
 };
@@ -25,6 +25,7 @@
 #include "core/namespace/migrations/pk_migration_service.h"
 #include "core/nsselecter/nsselecter.h"
 #include "core/payload/payloadiface.h"
+#include "core/query/fields_names_filter.h"
 #include "core/query/functions_optimizations.h"
 #include "core/querystat.h"
 #include "core/rdxcontext.h"
@@ -32,6 +33,7 @@
 #include "debug/crashqueryreporter.h"
 #include "estl/gift_str.h"
 #include "hashmapstatsloading.h"
+#include "items_image.h"
 #include "itemsloader.h"
 #include "snapshot/snapshothandler.h"
 #include "threadtaskqueueimpl.h"
@@ -100,10 +102,12 @@ NamespaceImpl::NamespaceImpl(const NamespaceImpl& src, size_t newCapacity, Async
 	  schema_(src.schema_),
 	  enablePerfCounters_{src.enablePerfCounters_.load()},
 	  config_{src.config_},
-	  queryCountCache_{config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache},
-	  joinCache_{config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache},
+	  queryCountCache_{config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache,
+					   config_.cacheConfig.queryCountCachePolicy},
+	  joinCache_{config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache, config_.cacheConfig.joinCachePolicy},
 	  wal_{src.wal_, storage_},
 	  repl_{src.repl_},
+	  dataHashTree_{src.dataHashTree_ ? std::make_unique<DataHashTree>(*src.dataHashTree_) : nullptr},
 	  storageOpts_{src.storageOpts_},
 	  lastSelectTime_{0},
 	  cancelCommitCnt_{0},
@@ -117,7 +121,9 @@ NamespaceImpl::NamespaceImpl(const NamespaceImpl& src, size_t newCapacity, Async
 	  dbDestroyed_{false},
 	  incarnationTag_{src.incarnationTag_},
 	  observers_{src.observers_},
-	  embeddersCache_{src.embeddersCache_} {
+	  embeddersCache_{src.embeddersCache_},
+	  payloadsTier_{src.payloadsTier_, config_.cacheConfig.coldPayloadsCacheSize, config_.cacheConfig.coldPayloadsHitsToCache,
+					config_.cacheConfig.coldPayloadsCachePolicy} {
 	for (auto& idxIt : src.indexes_) {
 		indexes_.push_back(idxIt->Clone(newCapacity, IndexCloneKind::Logical));
 	}
@@ -140,8 +146,9 @@ NamespaceImpl::NamespaceImpl(const std::string& name, std::optional<int32_t> sta
 	  tagsMatcher_(payloadType_, {}, stateToken.has_value() ? stateToken.value() : tools::RandomGenerator::gets32()),
 	  locker_(syncer, *this),
 	  enablePerfCounters_{false},
-	  queryCountCache_{config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache},
-	  joinCache_{config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache},
+	  queryCountCache_{config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache,
+					   config_.cacheConfig.queryCountCachePolicy},
+	  joinCache_{config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache, config_.cacheConfig.joinCachePolicy},
 	  wal_{getWalSize(config_)},
 	  lastSelectTime_{0},
 	  cancelCommitCnt_{0},
@@ -151,7 +158,9 @@ NamespaceImpl::NamespaceImpl(const std::string& name, std::optional<int32_t> sta
 	  dbDestroyed_{false},
 	  incarnationTag_(GetCurrentTimeUS() % lsn_t::kDefaultCounter, 0),
 	  observers_{observers},
-	  embeddersCache_{embeddersCache} {
+	  embeddersCache_{embeddersCache},
+	  payloadsTier_{config_.cacheConfig.coldPayloadsCacheSize, config_.cacheConfig.coldPayloadsHitsToCache,
+					config_.cacheConfig.coldPayloadsCachePolicy} {
 	logFmt(LogTrace, "NamespaceImpl::NamespaceImpl ({})", name_);
 	FlagGuardT nsLoadingGuard(nsIsLoading_);
 	items_.reserve(10000);
@@ -288,6 +297,7 @@ void NamespaceImpl::OnConfigUpdated(const DBConfigProvider& configProvider, cons
 	const bool needReconfigureIdxCache = !config_.cacheConfig.IsIndexesCacheEqual(configData.cacheConfig);
 	const bool needReconfigureJoinCache = !config_.cacheConfig.IsJoinCacheEqual(configData.cacheConfig);
 	const bool needReconfigureQueryCountCache = !config_.cacheConfig.IsQueryCountCacheEqual(configData.cacheConfig);
+	const bool needReconfigureColdPayloadsCache = !config_.cacheConfig.IsColdPayloadsCacheEqual(configData.cacheConfig);
 	config_ = configData;
 	storage_.SetForceFlushLimit(config_.syncStorageFlushLimit);
 
@@ -302,21 +312,30 @@ void NamespaceImpl::OnConfigUpdated(const DBConfigProvider& configProvider, cons
 			idx->ReconfigureCache(config_.cacheConfig);
 		}
 		logFmt(LogTrace,
-			   "[{}] Indexes cache has been reconfigured. IdSets cache (for each index): {{ max_size {} KB; hits: {} }}. FullTextIdSets "
-			   "cache (for each ft-index): {{ max_size {} KB; hits: {} }}",
+			   "[{}] Indexes cache has been reconfigured. IdSets cache (for each index): {{ max_size {} KB; hits: {}; shards: {} }}. "
+			   "FullTextIdSets cache (for each ft-index): {{ max_size {} KB; hits: {} }}",
 			   name_, config_.cacheConfig.idxIdsetCacheSize / 1024, config_.cacheConfig.idxIdsetHitsToCache,
-			   config_.cacheConfig.ftIdxCacheSize / 1024, config_.cacheConfig.ftIdxHitsToCache);
+			   config_.cacheConfig.idxIdsetCacheShards, config_.cacheConfig.ftIdxCacheSize / 1024, config_.cacheConfig.ftIdxHitsToCache);
 	}
 	if (needReconfigureJoinCache) {
-		joinCache_.Reinitialize(config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache);
+		joinCache_.Reinitialize(config_.cacheConfig.joinCacheSize, config_.cacheConfig.joinHitsToCache,
+								config_.cacheConfig.joinCachePolicy);
 		logFmt(LogTrace, "[{}] Join cache has been reconfigured: {{ max_size {} KB; hits: {} }}", name_,
 			   config_.cacheConfig.joinCacheSize / 1024, config_.cacheConfig.joinHitsToCache);
 	}
 	if (needReconfigureQueryCountCache) {
-		queryCountCache_.Reinitialize(config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache);
+		queryCountCache_.Reinitialize(config_.cacheConfig.queryCountCacheSize, config_.cacheConfig.queryCountHitsToCache,
+									  config_.cacheConfig.queryCountCachePolicy);
 		logFmt(LogTrace, "[{}] Queries count cache has been reconfigured: {{ max_size {} KB; hits: {} }}", name_,
 			   config_.cacheConfig.queryCountCacheSize / 1024, config_.cacheConfig.queryCountHitsToCache);
 	}
+	if (needReconfigureColdPayloadsCache) {
+		payloadsTier_.Cache().Reinitialize(config_.cacheConfig.coldPayloadsCacheSize, config_.cacheConfig.coldPayloadsHitsToCache,
+										   config_.cacheConfig.coldPayloadsCachePolicy);
+		logFmt(LogTrace, "[{}] Cold payloads cache has been reconfigured: {{ max_size {} KB; hits: {} }}", name_,
+			   config_.cacheConfig.coldPayloadsCacheSize / 1024, config_.cacheConfig.coldPayloadsHitsToCache);
+	}
+	updatePayloadsTierState();
 	indexOptimizer_.SetConfig(name_, indexes_,
 							  IndexOptimizer::Config{.optimizationTimeout = std::chrono::milliseconds{configData.optimizationTimeout},
 													 .optimizationSortWorkers = configData.optimizationSortWorkers});
@@ -487,6 +506,7 @@ public:
 		}
 		if (!items_.empty()) {
 			ns_.repl_.dataHash = dataHash_;
+			ns_.dataHashTree_.reset();
 			ns_.itemsDataSize_ = itemsDataSize_;
 		}
 		if (tuple_) {
@@ -648,6 +668,7 @@ NamespaceImpl::RollBack_updateItems<needRollBack> NamespaceImpl::updateItems(con
 	ItemImpl newItem(payloadType_, tagsMatcher_);
 	newItem.Unsafe(true);
 	repl_.dataHash.Set(PayloadChecksum());
+	dataHashTree_.reset();
 	itemsDataSize_ = 0;
 	auto indexesCacheCleaner{GetIndexesCacheCleaner()};
 
@@ -754,6 +775,10 @@ NamespaceImpl::RollBack_updateItems<needRollBack> NamespaceImpl::updateItems(con
 }
 
 PayloadChecksum NamespaceImpl::calculateItemChecksum(IdType rowId, int removedIdxId) const noexcept {
+	if (payloadsTier_.IsCold(rowId)) [[unlikely]] {
+		// Checksum of the full item, which was calculated before the eviction
+		return payloadsTier_.ColdChecksum(rowId);
+	}
 	return ConstPayload{payloadType_, items_[rowId]}.GetChecksum(
 		[this, rowId, removedIdxId](unsigned field, ConstFloatVectorView vec, unsigned arrayIndex) noexcept -> uint64_t {
 			if (vec.IsStripped()) {
@@ -769,6 +794,84 @@ PayloadChecksum NamespaceImpl::calculateItemChecksum(IdType rowId, int removedId
 		});
 }
 
+void NamespaceImpl::xorItemChecksum(const PayloadChecksum& checksum, const PayloadValue& pkSource) {
+	repl_.dataHash ^= checksum;
+	if (dataHashTree_) {
+		dataHashTree_->Xor(dataHashTreeBucket(*dataHashTree_, pkSource), checksum.hashV2);
+	}
+}
+
+uint32_t NamespaceImpl::dataHashTreeBucket(const DataHashTree& tree, const PayloadValue& pv) const {
+	const FieldsSet* pk = pkFields();
+	return pk ? tree.Bucket(ConstPayload{payloadType_, pv}.GetHash(*pk)) : 0;
+}
+
+const DataHashTree& NamespaceImpl::dataHashTree(uint32_t leavesCount) {
+	if (!dataHashTree_ || dataHashTree_->LeavesCount() != leavesCount) {
+		auto tree = std::make_unique<DataHashTree>(leavesCount);
+		for (size_t i = 0, sz = items_.size(); i < sz; ++i) {
+			const auto rowId = IdType::FromNumber(i);
+			if (!items_[rowId].IsFree()) {
+				tree->Xor(dataHashTreeBucket(*tree, items_[rowId]), calculateItemChecksum(rowId).hashV2);
+			}
+		}
+		assertrx_dbg(!repl_.dataHash.hashV2 || *repl_.dataHash.hashV2 == tree->Root());
+		logFmt(LogInfo, "[{}] Data hash tree with {} leaves was built", name_, leavesCount);
+		dataHashTree_ = std::move(tree);
+	}
+	return *dataHashTree_;
+}
+
+DataHashTree NamespaceImpl::GetDataHashTree(uint32_t leavesCount, const RdxContext& ctx) {
+	{
+		auto rlck = rLock(ctx);
+		if (dataHashTree_ && dataHashTree_->LeavesCount() == leavesCount) {
+			return *dataHashTree_;
+		}
+	}
+	auto wlck = simpleWLock(ctx);
+	return dataHashTree(leavesCount);
+}
+
+std::vector<uint64_t> NamespaceImpl::GetDataHashTreeNodes(uint32_t leavesCount, std::span<const uint32_t> nodes, const RdxContext& ctx) {
+	std::vector<uint64_t> hashes;
+	{
+		auto rlck = rLock(ctx);
+		if (dataHashTree_ && dataHashTree_->LeavesCount() == leavesCount) {
+			dataHashTree_->GetNodes(nodes, hashes);
+			return hashes;
+		}
+	}
+	auto wlck = simpleWLock(ctx);
+	dataHashTree(leavesCount).GetNodes(nodes, hashes);
+	return hashes;
+}
+
+void NamespaceImpl::deleteDataHashTreeBuckets(uint32_t leavesCount, std::span<const uint32_t> buckets) {
+	const auto& tree = dataHashTree(leavesCount);
+	std::vector<bool> diverged(leavesCount, false);
+	for (auto bucket : buckets) {
+		if (bucket >= leavesCount) {
+			throw Error(errParams, "Unexpected data hash tree bucket: {}. Tree has {} leaves", bucket, leavesCount);
+		}
+		diverged[bucket] = true;
+	}
+	std::vector<IdType> ids;
+	for (size_t i = 0, sz = items_.size(); i < sz; ++i) {
+		const auto rowId = IdType::FromNumber(i);
+		if (!items_[rowId].IsFree() && diverged[dataHashTreeBucket(tree, items_[rowId])]) {
+			ids.emplace_back(rowId);
+		}
+	}
+	for (auto id : ids) {
+		doDelete(id, nullptr);
+	}
+	if (!ids.empty()) {
+		markUpdated(IndexOptimization::Partial);
+	}
+	logFmt(LogInfo, "[{}] {} items were deleted from {} diverged buckets", name_, ids.size(), buckets.size());
+}
+
 void NamespaceImpl::addToWAL(const IndexDef& indexDef, WALRecType type, const NsContext& ctx) {
 	WrSerializer ser;
 	indexDef.GetJSON(ser);
@@ -1081,6 +1184,8 @@ void NamespaceImpl::dropIndex(const IndexDef& index, bool disableTmVersionInc) {
 	auto itIdxName = indexesNames_.find(index.Name());
 
 	verifyDropIndex(index, itIdxName);
+	// Items are rebuilt with the new payload type, so they have to contain actual tuples
+	restoreColdPayloads();
 
 	// Guard approach is a bit suboptimal, but simpler
 	const auto compositesMappingGuard =
@@ -1312,16 +1417,34 @@ void NamespaceImpl::verifyUpsertQuantizationConfigHNSWIndex(std::string_view act
 		return;
 	}
 
-	if (indexDef.IndexType() != IndexType::IndexHnsw) {
-		throw Error(errParams,
-					"Cannot {} quantization config in index '{}' in namespace '{}'. Only the HNSW float vector index can have a "
-					"quantization config.",
-					action, indexDef.Name(), name_);
-	}
-
-	if (config->quantizationType != hnswlib::QuantizationType::ScalarQuantization8bit) {
-		throw Error(errParams, "Cannot {} quantization config in index '{}' in namespace '{}'. Unsupported quantization type - {}", action,
-					indexDef.Name(), name_, int(config->quantizationType));
+	switch (config->quantizationType) {
+		case hnswlib::QuantizationType::ScalarQuantization8bit:
+			if (indexDef.IndexType() != IndexType::IndexHnsw) {
+				throw Error(errParams,
+							"Cannot {} quantization config in index '{}' in namespace '{}'. Only the HNSW float vector index can have a "
+							"scalar quantization config.",
+							action, indexDef.Name(), name_);
+			}
+			break;
+		case hnswlib::QuantizationType::ProductQuantization: {
+			if (indexDef.IndexType() != IndexType::IndexIvf) {
+				throw Error(errParams,
+							"Cannot {} quantization config in index '{}' in namespace '{}'. Only the IVF float vector index can have a "
+							"product quantization config.",
+							action, indexDef.Name(), name_);
+			}
+			const size_t dim = indexDefOpts.FloatVector().Dimension();
+			if (const size_t m = config->PQSubquantizers(dim); dim % m != 0) {
+				throw Error(errParams,
+							"Cannot {} quantization config in index '{}' in namespace '{}'. The index dimension {} must be a multiple of the "
+							"pq_subquantizers value {}",
+							action, indexDef.Name(), name_, dim, m);
+			}
+			break;
+		}
+		default:
+			throw Error(errParams, "Cannot {} quantization config in index '{}' in namespace '{}'. Unsupported quantization type - {}",
+						action, indexDef.Name(), name_, int(config->quantizationType));
 	}
 
 	if (config->sampleSize == 0) {
@@ -1352,10 +1475,10 @@ void NamespaceImpl::verifyUpdateQuantizationConfigHNSWIndex(const Index* curInde
 	}
 
 	if (const auto& curConfig = curIndexDefOpts.FloatVector().QuantizationConfig();
-		curConfig && curFloatIndex->Type() != IndexType::IndexHnsw) {
+		curConfig && curFloatIndex->Type() != IndexType::IndexHnsw && curFloatIndex->Type() != IndexType::IndexIvf) {
 		logFmt(LogWarning,
 			   "An incorrect float vector options were detected during update index '{}' in namespace '{}': the quantization config of "
-			   "an index with a type other than 'hnsw'",
+			   "an index with a type other than 'hnsw' or 'ivf'",
 			   curFloatIndex->Name(), name_);
 	}
 
@@ -1681,6 +1804,8 @@ void NamespaceImpl::addIndex(const IndexDef& indexDef, bool disableTmVersionInc,
 		return;
 	}
 
+	restoreColdPayloads();
+
 	const auto currentPKIndex = indexesNames_.find(kPKIndexName);
 	const auto& indexName = indexDef.Name();
 	// New index case. Just add
@@ -1794,6 +1919,7 @@ bool NamespaceImpl::updateIndex(const IndexDef& indexDef, bool disableTmVersionI
 		return false;
 	}
 
+	restoreColdPayloads();
 	if (!IndexFastUpdate::Try(*this, foundIndex, indexDef)) {
 		verifyUpdateIndex(indexDef);
 		dropIndex(indexDef, disableTmVersionInc);
@@ -1956,6 +2082,7 @@ void NamespaceImpl::Delete(Item& item, const RdxContext& ctx) { ModifyItem(item,
 
 void NamespaceImpl::doDelete(IdType id, TransactionContext* txCtx) {
 	assertrx(items_.exists(id));
+	restoreColdPayload(id);
 
 	Payload pl(payloadType_, items_[id]);
 	const FieldsSet* pk = pkFields();
@@ -1965,7 +2092,7 @@ void NamespaceImpl::doDelete(IdType id, TransactionContext* txCtx) {
 	pkBuf << kRxStorageItemPrefix;
 	pl.SerializeFields(pkBuf, pk ? *pk : FieldsSet{});
 
-	repl_.dataHash ^= calculateItemChecksum(id);
+	xorItemChecksum(id);
 	std::ignore = wal_.Set(WALRecord(), items_[id].GetLSN(), false);
 
 	storage_.Remove(pkBuf.Slice());
@@ -2067,7 +2194,9 @@ void NamespaceImpl::doTruncate(UpdatesContainer& pendedRepl, const NsContext& ct
 	}
 	items_.clear();
 	free_.clear();
+	payloadsTier_.Clear();
 	repl_.dataHash.Set(PayloadChecksum());
+	dataHashTree_.reset();
 	itemsDataSize_ = 0;
 	for (size_t i = 0; i < indexes_.size(); ++i) {
 		if (indexes_[i]->IsFloatVector()) {
@@ -2337,7 +2466,7 @@ void NamespaceImpl::doUpsert(ItemImpl& item, IdType id, bool doUpdate, Transacti
 		}
 		plData.Clone(pl.RealSize());
 
-		repl_.dataHash ^= calculateItemChecksum(id);
+		xorItemChecksum(id);
 		itemsDataSize_ -= plData.GetCapacity() + sizeof(PayloadValue::dataHeader);
 
 		needUpdateCompIndexes = h_vector<bool, 32>(compIndexesCount, false);
@@ -2489,7 +2618,7 @@ void NamespaceImpl::doUpsert(ItemImpl& item, IdType id, bool doUpdate, Transacti
 			indexesCacheCleaner.Add(idxRef);
 		}
 	}
-	repl_.dataHash ^= calculateItemChecksum(id);
+	xorItemChecksum(id);
 	itemsDataSize_ += plData.GetCapacity() + sizeof(PayloadValue::dataHeader);
 	item.RealValue() = plData;
 }
@@ -2640,6 +2769,12 @@ void NamespaceImpl::doModifyItem(Item& item, ItemModifyMode mode, UpdatesContain
 		throw Error(errParams, "Suggested ID doesn't correspond to real ID: {} vs {}", suggestedId, realItem.first);
 	}
 	const IdType id = exists ? realItem.first : createItem(newPl.RealSize(), suggestedId, ctx);
+	if (exists) {
+		// Old tuple is required to update the tuple's index and the sparse indexes
+		restoreColdPayload(id);
+	}
+	// Modified item (or the new one in the reused row) must not be evicted until the next clock turn
+	payloadsTier_.Touch(id);
 
 	replicateTmUpdateIfRequired(pendedRepl, oldTmV, ctx);
 	lsn_t lsn;
@@ -2826,6 +2961,9 @@ void NamespaceImpl::doUpdateTr(LocalQueryResults& result, UpdatesContainer& pend
 	selCtx.inTransaction = ctx.IsInTransaction();
 	selCtx.selectBeforeUpdate = true;
 	selCtx.explain = nullptr;  // No explain for tx updates
+	if (payloadsTier_.HasColdItems() && queryNeedsColdPayloads(query)) {
+		restoreColdPayloads();
+	}
 	selecter(result, selCtx, ctx.rdxContext);
 	doUpdate(result, pendedRepl, query, ctx, precomputedValues);
 }
@@ -2874,6 +3012,8 @@ void NamespaceImpl::doUpdate(LocalQueryResults& result, UpdatesContainer& pended
 	for (auto& it : result) {
 		ItemRef& item = it.GetItemRef();
 		assertrx(items_.exists(item.Id()));
+		restoreColdPayload(item.Id());
+		payloadsTier_.Touch(item.Id());
 		const auto oldTmV = tagsMatcher_.version();
 		PayloadValue& pv(items_[item.Id()]);
 		Payload pl(payloadType_, pv);
@@ -2961,8 +3101,8 @@ void NamespaceImpl::replicateItem(IdType itemId, const NsContext& ctx, bool stat
 		}
 	}
 
-	repl_.dataHash ^= oldItemHash;
-	repl_.dataHash ^= calculateItemChecksum(itemId);
+	xorItemChecksum(oldItemHash, modifyData.has_value() ? modifyData->pv : pv);
+	xorItemChecksum(itemId);
 	itemsDataSize_ -= oldItemCapacity;
 	itemsDataSize_ += pl.Value()->GetCapacity();
 
@@ -2998,6 +3138,9 @@ void NamespaceImpl::doDeleteTr(LocalQueryResults& result, UpdatesContainer& pend
 	selCtx.explain = nullptr;  // No explain for tx deletes
 	FtFunctionsHolder func;
 	selCtx.functions = &func;
+	if (payloadsTier_.HasColdItems() && queryNeedsColdPayloads(query)) {
+		restoreColdPayloads();
+	}
 	selecter(result, selCtx, ctx.rdxContext);
 	doDelete(result, pendedRepl, query, ctx, precomputedValues);
 }
@@ -3165,8 +3308,11 @@ NamespaceMemStat NamespaceImpl::GetMemStat(const RdxContext& ctx) {
 
 	ret.emptyItemsCount = free_.size();
 
+	ret.coldItemsCount = payloadsTier_.ColdCount();
+	ret.coldPayloadsCache = payloadsTier_.Cache().GetMemStat();
+
 	ret.Total.dataSize = itemsDataSize_ + items_.capacity() * sizeof(PayloadValue);
-	ret.Total.cacheSize = ret.joinCache.totalSize + ret.queryCache.totalSize;
+	ret.Total.cacheSize = ret.joinCache.totalSize + ret.queryCache.totalSize + ret.coldPayloadsCache.totalSize;
 	ret.Total.indexOptimizerMemory = indexOptimizer_.UpdateSortedContextMemory();
 	ret.Storage.proxySize = storage_.GetProxyMemStat();
 	ret.Total.inmemoryStorageSize = ret.Storage.proxySize;
@@ -3230,6 +3376,9 @@ NamespacePerfStat NamespaceImpl::GetPerfStat(const RdxContext& ctx) {
 	ret.updates = updatePerfCounter_.Get<PerfStat>();
 	ret.joinCache = joinCache_.GetPerfStat();
 	ret.queryCountCache = queryCountCache_.GetPerfStat();
+	if (payloadsTier_.Enabled() || payloadsTier_.HasColdItems()) {
+		ret.coldPayloadsCache = payloadsTier_.Cache().GetPerfStat();
+	}
 	ret.indexes.reserve(indexes_.size() - 1);
 	for (unsigned i = 1; i < indexes_.size(); i++) {
 		ret.indexes.emplace_back(indexes_[i]->GetIndexPerfStat());
@@ -3246,6 +3395,7 @@ void NamespaceImpl::ResetPerfStat(const RdxContext& ctx) {
 	}
 	queryCountCache_.ResetPerfStat();
 	joinCache_.ResetPerfStat();
+	payloadsTier_.Cache().ResetPerfStat();
 	if (embeddersCache_) {
 		embeddersCache_->ResetPerfStat();
 	}
@@ -3692,6 +3842,7 @@ void NamespaceImpl::LoadFromStorage(unsigned threadsCount, const RdxContext& ctx
 
 	const auto dataHash = repl_.dataHash;
 	repl_.dataHash.Set(PayloadChecksum());
+	dataHashTree_.reset();
 
 	migrations::PKMigrationService pkMigrationService{*this};
 	pkMigrationService.RemoveItemsWithObsoletePK();
@@ -3822,6 +3973,309 @@ void NamespaceImpl::optimizeFloatVectorKeeper(RdxActivityContext* ctx) {
 	}
 }
 
+NamespaceImpl::ColdPayloadsPin::ColdPayloadsPin(Ptr ns) noexcept : ns_{std::move(ns)} { ns_->payloadsTier_.Pin(); }
+
+NamespaceImpl::ColdPayloadsPin::~ColdPayloadsPin() {
+	if (ns_) {
+		ns_->payloadsTier_.Unpin();
+	}
+}
+
+NamespaceImpl::ColdPayloadsPin NamespaceImpl::PrepareColdPayloads(const Query& q, const RdxContext& ctx) {
+	ColdPayloadsPin pin;
+	if (!payloadsTier_.Enabled() && !payloadsTier_.HasColdItems()) {
+		return pin;
+	}
+	if (auto jq = dynamic_cast<const JoinedQuery*>(&q); !jq || jq->joinType == JoinType::Merge) {
+		// Selects of the main and merged namespaces load the required cold payloads by themselves
+		return pin;
+	}
+	{
+		auto rlck = rLock(ctx);
+		// Eviction is performed under the exclusive lock, so there are no new cold items after this point
+		pin = ColdPayloadsPin{Ptr(this)};
+		if (!payloadsTier_.HasColdItems()) {
+			return pin;
+		}
+	}
+	auto wlck = simpleWLock(ctx);
+	restoreColdPayloads();
+	return pin;
+}
+
+bool NamespaceImpl::isPayloadFieldResident(std::string_view field) const {
+	if (field.empty() || field == "*"sv || field[0] == '#' || iequals(field, FieldsNamesFilter::kRankFieldName)) {
+		return true;
+	}
+	int idxNo = -1;
+	if (!tryGetIndexByNameOrJsonPath(field, idxNo)) {
+		return false;
+	}
+	const auto& index = *indexes_[idxNo];
+	return !index.Opts().IsSparse() && index.Fields().getTagsPathsLength() == 0;
+}
+
+bool NamespaceImpl::queryNeedsColdPayloads(const Query& q) const {
+	if (auto jq = dynamic_cast<const JoinedQuery*>(&q); jq && jq->joinType != JoinType::Merge) {
+		// Joined items are not held in the results, so all of the tuples of the right namespace are required
+		return true;
+	}
+	bool needPayloads = false;
+	const auto checkField = [&](std::string_view field) {
+		if (!needPayloads && !isPayloadFieldResident(field)) {
+			needPayloads = true;
+		}
+	};
+	q.Entries().VisitForEach(
+		Skip<QueryEntriesBracket, JoinQueryEntry, AlwaysFalse, AlwaysTrue, SubQueryEntry, KnnQueryEntry>{},
+		[&](const concepts::OneOf<QueryEntry, SubQueryFieldEntry> auto& qe) { checkField(qe.FieldName()); },
+		[&](const BetweenFieldsQueryEntry& qe) {
+			checkField(qe.LeftFieldName());
+			checkField(qe.RightFieldName());
+		},
+		[&](const concepts::OneOf<MultiDistinctQueryEntry, QueryFunctionEntry, SubQueryFunctionEntry, KnnRawSelectResult> auto&) {
+			needPayloads = true;
+		});
+	for (const auto& se : q.GetSortingEntries()) {
+		// Sort expressions are not parsed here, so anything except the plain indexed field requires the tuples
+		checkField(se.expression);
+	}
+	for (const auto& agg : q.aggregations_) {
+		for (const auto& field : agg.Fields()) {
+			checkField(field);
+		}
+	}
+	for (const auto& jq : q.GetJoinQueries()) {
+		for (const auto& je : jq.joinEntries_) {
+			checkField(je.LeftFieldName());
+		}
+	}
+	return needPayloads;
+}
+
+void NamespaceImpl::updatePayloadsTierState() {
+	payloadsTier_.SetEnabled(config_.payloadsMemoryLimit > 0 && !isSystem() && !isTemporary());
+	if (!payloadsTier_.Enabled() && payloadsTier_.HasColdItems()) {
+		try {
+			restoreColdPayloads();
+		} catch (const std::exception& e) {
+			logFmt(LogError, "[{}] Unable to restore cold payloads: {}", name_, e.what());
+		}
+	}
+}
+
+bool NamespaceImpl::canEvictPayloads() const noexcept {
+	if (!storage_.IsValid() || !pkFields()) {
+		return false;
+	}
+	// Composite indexes over the non-indexed fields read the tuples on each update
+	for (int i = indexes_.firstCompositePos(); i < indexes_.totalSize(); ++i) {
+		if (indexes_[i]->Fields().getTagsPathsLength() > 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void NamespaceImpl::evictColdPayloads(RdxActivityContext* ctx) {
+	// Do not evict more than this count of the tuples per single background routine call to avoid long exclusive locks
+	constexpr static size_t kMaxEvictionsPerCall = 10'000;
+
+	if (!payloadsTier_.Enabled() || payloadsTier_.IsPinned()) {
+		return;
+	}
+	const RdxContext rdxCtx{ctx};
+	{
+		auto rlck = rLock(rdxCtx);
+		if (!canEvictPayloads() || indexes_[0]->GetMemStat(rdxCtx).dataSize <= size_t(config_.payloadsMemoryLimit)) {
+			return;
+		}
+	}
+
+	auto wlck = simpleWLock(rdxCtx);
+	if (!payloadsTier_.Enabled() || payloadsTier_.IsPinned() || !canEvictPayloads()) {
+		return;
+	}
+	const size_t limit = config_.payloadsMemoryLimit;
+	size_t resident = indexes_[0]->GetMemStat(rdxCtx).dataSize;
+	if (resident <= limit) {
+		return;
+	}
+	// Evicted tuples are loaded from the storage, so it has to contain the actual versions of the recently modified items
+	try {
+		storage_.Flush(StorageFlushOpts());
+	} catch (const std::exception& e) {
+		logFmt(LogWarning, "[{}] Payloads eviction is skipped: unable to flush the storage: {}", name_, e.what());
+		return;
+	}
+	if (storage_.HasUnflushedUpdates()) {
+		return;
+	}
+	// Evict a bit more, than required, so the sweep is not triggered by each insertion
+	const size_t target = limit - limit / 10;
+	payloadsTier_.Resize(items_.size());
+	size_t& hand = payloadsTier_.ClockHand();
+	size_t evicted = 0;
+	for (size_t steps = 0, maxSteps = 2 * items_.size(); steps < maxSteps && resident > target && evicted < kMaxEvictionsPerCall;
+		 ++steps) {
+		if (hand >= items_.size()) {
+			hand = 0;
+		}
+		const auto id = IdType::FromNumber(hand++);
+		if (items_[id].IsFree() || payloadsTier_.IsCold(id) || payloadsTier_.TestAndClearReferenced(id)) {
+			continue;
+		}
+		const size_t freed = evictColdPayload(id);
+		if (freed) {
+			resident -= std::min(resident, freed);
+			++evicted;
+		}
+	}
+	if (evicted) {
+		logFmt(LogTrace, "[{}] {} payloads were evicted into the storage. Cold items: {}; resident tuples size: ~{} KB", name_, evicted,
+			   payloadsTier_.ColdCount(), resident / 1024);
+	}
+}
+
+size_t NamespaceImpl::evictColdPayload(IdType id) {
+	// Eviction of the tiny tuples does not save any memory, but requires storage reads
+	constexpr static size_t kMinColdTupleSize = 64;
+
+	PayloadValue& pv = items_[id];
+	VariantArray tuple;
+	ConstPayload{payloadType_, pv}.Get(0, tuple);
+	assertrx_dbg(tuple.size() == 1);
+	const size_t tupleSize = std::string_view(tuple[0]).size();
+	if (tupleSize < kMinColdTupleSize) {
+		return 0;
+	}
+
+	const PayloadChecksum checksum = calculateItemChecksum(id);
+	bool needClearCache{false};
+	indexes_[0]->Delete(tuple, id, MustExist_True, *strHolder_, needClearCache);
+	pv.Clone();
+	Payload{payloadType_, pv}.Set(0, Variant{p_string(""), Variant::noHold});
+	refreshCompositeKeys(id);
+	payloadsTier_.MarkCold(id, checksum);
+	if (needClearCache) {
+		IndexesCacheCleaner cleaner{*this};
+		cleaner.Add(*indexes_[0]);
+	}
+	return tupleSize + sizeof(key_string_impl);
+}
+
+void NamespaceImpl::restoreColdPayload(IdType id, std::optional<ColdPayloadsLoader>& loader) {
+	assertrx_dbg(payloadsTier_.IsCold(id));
+	key_string tuple = loadColdPayload(id, loader);
+	PayloadValue& pv = items_[id];
+
+	VariantArray keys;
+	bool needClearCache{false};
+	indexes_[0]->Upsert(keys, VariantArray{Variant{std::move(tuple)}}, id, needClearCache);
+	pv.Clone();
+	Payload{payloadType_, pv}.Set(0, keys);
+	refreshCompositeKeys(id);
+
+	const PayloadChecksum oldChecksum = payloadsTier_.MarkWarm(id);
+	if (const PayloadChecksum newChecksum = calculateItemChecksum(id); newChecksum != oldChecksum) [[unlikely]] {
+		// May happen, if the tagsmatcher was changed, while the item was cold
+		xorItemChecksum(oldChecksum, pv);
+		xorItemChecksum(newChecksum, pv);
+	}
+	if (needClearCache) {
+		IndexesCacheCleaner cleaner{*this};
+		cleaner.Add(*indexes_[0]);
+	}
+}
+
+void NamespaceImpl::restoreColdPayloads() {
+	if (!payloadsTier_.HasColdItems()) {
+		return;
+	}
+	const size_t coldCount = payloadsTier_.ColdCount();
+	std::optional<ColdPayloadsLoader> loader;
+	for (size_t i = 0, sz = items_.size(); i < sz && payloadsTier_.HasColdItems(); ++i) {
+		const auto id = IdType::FromNumber(i);
+		if (payloadsTier_.IsCold(id)) {
+			restoreColdPayload(id, loader);
+		}
+	}
+	logFmt(LogTrace, "[{}] {} cold payloads were restored from the storage", name_, coldCount);
+}
+
+key_string NamespaceImpl::loadColdPayload(IdType id, std::optional<ColdPayloadsLoader>& loader) const {
+	const PayloadValue& pv = items_[id];
+	const ColdPayloadCacheKey ckey{.rowId = id, .lsn = int64_t(pv.GetLSN())};
+	auto& cache = payloadsTier_.Cache();
+	auto cached = cache.Get(ckey);
+	if (cached.valid && cached.val.IsInitialized()) {
+		return cached.val.tuple;
+	}
+	if (!loader) {
+		const FieldsSet* pk = pkFields();
+		assertrx_throw(pk);
+		loader.emplace(storage_, payloadType_, tagsMatcher_, *pk);
+	}
+	key_string tuple = loader->Load(pv);
+	if (cached.valid) {
+		cache.Put(ckey, ColdPayloadCacheVal{tuple});
+	}
+	return tuple;
+}
+
+const PayloadValue& NamespaceImpl::loadColdPayload(IdType id, ColdPayloadsHolder& holder) const {
+	if (const auto* loaded = holder.Find(id)) {
+		return loaded->pv;
+	}
+	key_string tuple = loadColdPayload(id, holder.Loader());
+	PayloadValue pv = items_[id];
+	pv.Clone();
+	Payload{payloadType_, pv}.Set(0, Variant{p_string(tuple), Variant::noHold});
+	return holder.Add(id, std::move(pv), std::move(tuple));
+}
+
+void NamespaceImpl::holdColdPayloads(LocalQueryResults& result, size_t offset, bool markHot, const ColdPayloadsHolder* loaded) const {
+	if (!payloadsTier_.Enabled() && !payloadsTier_.HasColdItems()) {
+		return;
+	}
+	std::optional<ColdPayloadsLoader> loader;
+	auto& items = result.Items();
+	for (size_t i = offset, sz = items.Size(); i < sz; ++i) {
+		ItemRef& itemRef = items.GetItemRef(i);
+		if (itemRef.Raw() || !itemRef.ValueInitialized() || !items_.exists(itemRef.Id())) {
+			continue;
+		}
+		if (markHot) {
+			payloadsTier_.Touch(itemRef.Id());
+		}
+		if (payloadsTier_.IsCold(itemRef.Id())) {
+			if (const auto* e = loaded ? loaded->Find(itemRef.Id()) : nullptr) {
+				itemRef.Value() = e->pv;
+				continue;
+			}
+			key_string tuple = loadColdPayload(itemRef.Id(), loader);
+			PayloadValue& pv = itemRef.Value();
+			pv.Clone();
+			Payload{payloadType_, pv}.Set(0, Variant{p_string(tuple), Variant::noHold});
+			result.HoldString(std::move(tuple));
+		}
+	}
+	if (loaded) {
+		loaded->HoldTuples([&result](key_string&& tuple) { result.HoldString(std::move(tuple)); });
+	}
+}
+
+void NamespaceImpl::refreshCompositeKeys(IdType id) {
+	for (int field = indexes_.firstCompositePos(); field < indexes_.totalSize(); ++field) {
+		auto& idxRef = *indexes_[field];
+		bool refreshed = idxRef.RefreshCompositeKey(Variant{items_[id]}, id);
+		assertrx_dbg(refreshed);
+		if (!refreshed) [[unlikely]] {
+			logFmt(LogError, "[{}]: Unable to refresh key for {} during cold payload update", name_, idxRef.Name());
+		}
+	}
+}
+
 void NamespaceImpl::setSchema(std::string_view schema, UpdatesContainer& pendedRepl, const NsContext& ctx) {
 	// NOLINTNEXTLINE (bugprone-suspicious-stringview-data-usage)
 	std::string_view schemaPrint(schema.data(), std::min(schema.size(), kMaxSchemaCharsToPrint));
@@ -3900,6 +4354,7 @@ void NamespaceImpl::BackgroundRoutine(RdxActivityContext* ctx) {
 	}
 	removeExpiredStrings(ctx);
 	optimizeFloatVectorKeeper(ctx);
+	evictColdPayloads(ctx);
 	backgroundHNSWIndexesQuantization(ctx);
 }
 
@@ -4028,11 +4483,32 @@ void NamespaceImpl::CloseStorage(const RdxContext& ctx) {
 
 	auto wlck = simpleWLock(ctx);
 
+	saveItemsImage();
 	saveReplStateToStorage(true);
 	replStateUpdates_.store(0, std::memory_order_relaxed);
 	storage_.Close();
 }
 
+void NamespaceImpl::saveItemsImage() noexcept {
+	try {
+		const std::string path = storage_.GetPath();
+		if (path.empty()) {
+			return;
+		}
+		// Float vectors are not stored in the payloads, so ANN-indexes use their own storage cache. The same is true for the cold tuples
+		if (!config_.itemsImage || isSystem() || isTemporary() || haveFloatVectorsIndexes() || !pkFields() ||
+			payloadsTier_.HasColdItems()) {
+			items_image::Remove(path);
+			return;
+		}
+		items_image::Writer(*this).Write(path);
+	} catch (const Error& err) {
+		logFmt(LogWarning, "[{}] Unable to write items image: {}", name_, err.what());
+	} catch (...) {
+		logFmt(LogWarning, "[{}] Unable to write items image: <unknown exception>", name_);
+	}
+}
+
 std::string NamespaceImpl::sysRecordName(std::string_view sysTag, uint64_t version) {
 	std::string backupRecord(sysTag);
 	static_assert(kSysRecordsBackupCount && ((kSysRecordsBackupCount & (kSysRecordsBackupCount - 1)) == 0),
@@ -4147,6 +4623,15 @@ void NamespaceImpl::deleteMeta(const std::string& key, UpdatesContainer& pendedR
 	pendedRepl.emplace_back(updates::URType::DeleteMeta, name_, wal_.LastLSN(), repl_.nsVersion, ctx.EmitterServerId(), key, std::string());
 }
 
+size_t NamespaceImpl::copiedMemorySize(const RdxContext& ctx) const {
+	size_t size = items_.capacity() * sizeof(PayloadValue) + free_.capacity() * sizeof(IdType);
+	for (const auto& idx : indexes_) {
+		const auto istat = idx->GetMemStat(ctx);
+		size += istat.GetFullIndexStructSize() - istat.idsetBTreeSize;
+	}
+	return size;
+}
+
 void NamespaceImpl::warmupFtIndexes() {
 	for (auto& idx : indexes_) {
 		if (idx->IsFulltext()) {
@@ -20,6 +20,7 @@
 #include "core/storage/storagetype.h"
 #include "core/transaction/localtransaction.h"
 #include "core/type_consts.h"
+#include "datahashtree.h"
 #include "estl/contexted_locks.h"
 #include "estl/fast_hash_map.h"
 #include "estl/shared_mutex.h"
@@ -28,6 +29,7 @@
 #include "float_vectors_indexes.h"
 #include "index_optimizer.h"
 #include "namespacename.h"
+#include "payloadstier.h"
 #include "stringsholder.h"
 #include "wal/waltracker.h"
 
@@ -77,6 +79,10 @@ namespace migrations {
 class PKMigrationService;
 }
 
+namespace items_image {
+class Writer;
+}  // namespace items_image
+
 namespace functions {
 class PrecomputedValues;
 }
@@ -182,6 +188,7 @@ class [[nodiscard]] NamespaceImpl final : public intrusive_atomic_rc_base {	 //
 	friend class TransactionContext;
 	friend class TransactionConcurrentInserter;
 	friend class ann_storage_cache::Writer;
+	friend class items_image::Writer;
 	friend class FloatVectorsHolderMap;
 	friend class FieldsFilter;
 	friend class ExpressionEvaluator;
@@ -234,6 +241,24 @@ public:
 	using Ptr = intrusive_ptr<NamespaceImpl>;
 	using Mutex = MarkedMutex<shared_timed_mutex, MutexMark::Namespace>;
 
+	// Forbids eviction of the payloads into the storage until destruction
+	class [[nodiscard]] ColdPayloadsPin {
+	public:
+		ColdPayloadsPin() noexcept = default;
+		explicit ColdPayloadsPin(Ptr ns) noexcept;
+		ColdPayloadsPin(const ColdPayloadsPin&) = delete;
+		ColdPayloadsPin(ColdPayloadsPin&&) noexcept = default;
+		ColdPayloadsPin& operator=(const ColdPayloadsPin&) = delete;
+		ColdPayloadsPin& operator=(ColdPayloadsPin&& o) noexcept {
+			std::swap(ns_, o.ns_);
+			return *this;
+		}
+		~ColdPayloadsPin();
+
+	private:
+		Ptr ns_;
+	};
+
 	class [[nodiscard]] Locker {
 	public:
 		class [[nodiscard]] NsWLock {
@@ -425,6 +450,9 @@ public:
 	void SetClusterOperationStatus(ClusterOperationStatus&& status, const RdxContext& ctx);
 	void ApplySnapshotChunk(const SnapshotChunk& ch, bool isInitialLeaderSync, const RdxContext& ctx);
 	void GetSnapshot(Snapshot& snapshot, const SnapshotOpts& opts, const RdxContext& ctx);
+	// Returns the copy of the data hash tree with the requested leaves count. The tree is built on the first request
+	DataHashTree GetDataHashTree(uint32_t leavesCount, const RdxContext& ctx);
+	std::vector<uint64_t> GetDataHashTreeNodes(uint32_t leavesCount, std::span<const uint32_t> nodes, const RdxContext& ctx);
 	void SetTagsMatcher(TagsMatcher&& tm, const RdxContext& ctx);
 	void SetDestroyFlag() noexcept { dbDestroyed_ = true; }
 	Error FlushStorage(const RdxContext& ctx) {
@@ -435,6 +463,10 @@ public:
 	}
 	void RebuildFreeItemsStorage(const RdxContext& ctx);
 	std::shared_ptr<const reindexer::QueryEmbedder> QueryEmbedder(std::string_view fieldName, const RdxContext& ctx) const;
+	// Restores the evicted payloads, if the query joins this namespace (joined items are not held in the results),
+	// and pins the namespace to prevent their eviction until the query is done.
+	// The other queries load the cold tuples lazily under the shared lock (see loadColdPayload())
+	ColdPayloadsPin PrepareColdPayloads(const Query& q, const RdxContext& ctx);
 
 private:
 	void loadHashMapStats() noexcept;
@@ -471,6 +503,7 @@ private:
 	Error loadLatestSysRecord(std::string_view baseSysTag, uint64_t& version, std::string& content);
 	bool loadIndexesFromStorage();
 	void saveReplStateToStorage(bool direct = true);
+	void saveItemsImage() noexcept;
 	void saveTagsMatcherToStorage(bool clearUpdate);
 	void loadReplStateFromStorage();
 	void loadMetaFromStorage();
@@ -524,6 +557,7 @@ private:
 	void removeExpiredItems(RdxActivityContext*);
 	void removeExpiredStrings(RdxActivityContext*);
 	void optimizeFloatVectorKeeper(RdxActivityContext*);
+	void evictColdPayloads(RdxActivityContext*);
 	void backgroundHNSWIndexesQuantization(RdxActivityContext*);
 	void setSchema(std::string_view schema, UpdatesContainer& pendedRepl, const NsContext& ctx);
 	void setTagsMatcher(TagsMatcher&& tm, UpdatesContainer& pendedRepl, const NsContext& ctx);
@@ -566,6 +600,9 @@ private:
 	std::vector<std::string> enumMeta() const;
 
 	void warmupFtIndexes();
+	/// Approximate size of the memory, allocated by the copy CTOR. Has to be called for the fresh namespace copy:
+	/// keys data and idsets btrees are shared with the source namespace and are not included
+	size_t copiedMemorySize(const RdxContext&) const;
 	void updateSelectTime() noexcept {
 		using namespace std::chrono;
 		lastSelectTime_ = duration_cast<seconds>(system_clock_w::now().time_since_epoch()).count();
@@ -592,6 +629,38 @@ private:
 
 	void rebuildIndexesToCompositeMapping() noexcept;
 	PayloadChecksum calculateItemChecksum(IdType rowId, int removedIdxId = -1) const noexcept;
+	// Updates datahash and data hash tree (if it was built) with the checksum of the item. PK for the tree is taken from 'pkSource'
+	void xorItemChecksum(const PayloadChecksum& checksum, const PayloadValue& pkSource);
+	void xorItemChecksum(IdType rowId) { xorItemChecksum(calculateItemChecksum(rowId), items_[rowId]); }
+	uint32_t dataHashTreeBucket(const DataHashTree& tree, const PayloadValue& pv) const;
+	// Requires exclusive lock. Rebuilds the tree, if it does not exist or has another leaves count
+	const DataHashTree& dataHashTree(uint32_t leavesCount);
+	// Deletes all of the items from the data hash tree's buckets without WAL records (partial force sync)
+	void deleteDataHashTreeBuckets(uint32_t leavesCount, std::span<const uint32_t> buckets);
+
+	bool isPayloadFieldResident(std::string_view field) const;
+	// Returns true, if the query's result depends on the non-indexed fields of this namespace's items
+	bool queryNeedsColdPayloads(const Query& q) const;
+	void updatePayloadsTierState();
+	bool canEvictPayloads() const noexcept;
+	// Returns the approximate size of the evicted tuple
+	size_t evictColdPayload(IdType id);
+	// Requires exclusive lock. Returns the tuple of the cold item into the tuple's index
+	void restoreColdPayload(IdType id, std::optional<ColdPayloadsLoader>& loader);
+	void restoreColdPayload(IdType id) {
+		if (payloadsTier_.IsCold(id)) {
+			std::optional<ColdPayloadsLoader> loader;
+			restoreColdPayload(id, loader);
+		}
+	}
+	void restoreColdPayloads();
+	key_string loadColdPayload(IdType id, std::optional<ColdPayloadsLoader>& loader) const;
+	// Requires shared lock. Returns the full payload of the cold item, loading it into the select's holder on the first call
+	const PayloadValue& loadColdPayload(IdType id, ColdPayloadsHolder& holder) const;
+	// Replaces payloads of the cold items in the results with their full copies. Items, which were already loaded by the select,
+	// are taken from the 'loaded' holder
+	void holdColdPayloads(LocalQueryResults& result, size_t offset, bool markHot, const ColdPayloadsHolder* loaded = nullptr) const;
+	void refreshCompositeKeys(IdType id);
 
 	IndexesStorage indexes_;
 	IndexNamesMap indexesNames_;
@@ -701,6 +770,8 @@ private:
 	// Replication variables
 	WALTracker wal_;
 	ReplicationState repl_;
+	// Is built on demand for the incremental resync. Always matches repl_.dataHash, when exists
+	std::unique_ptr<DataHashTree> dataHashTree_;
 
 	StorageOpts storageOpts_;
 	std::atomic_int64_t lastSelectTime_{0};
@@ -725,6 +796,7 @@ private:
 	UpdatesObservers& observers_;
 
 	const std::shared_ptr<EmbeddersCache> embeddersCache_;
+	PayloadsTier payloadsTier_;
 };
 
 }  // namespace reindexer
@@ -23,6 +23,9 @@ void NamespaceMemStat::GetJSON(WrSerializer& ser) const {
 	if (emptyItemsCount) {
 		builder.Put("empty_items_count", emptyItemsCount);
 	}
+	if (coldItemsCount) {
+		builder.Put("cold_items_count", coldItemsCount);
+	}
 
 	builder.Put("strings_waiting_to_be_deleted_size", stringsWaitingToBeDeletedSize);
 	builder.Put("storage_ok", storageOK);
@@ -56,6 +59,10 @@ void NamespaceMemStat::GetJSON(WrSerializer& ser) const {
 			auto obj = builder.Object("query_cache");
 			queryCache.GetJSON(obj);
 		}
+		if (coldPayloadsCache.itemsCount || coldItemsCount) {
+			auto obj = builder.Object("cold_payloads_cache");
+			coldPayloadsCache.GetJSON(obj);
+		}
 
 		{
 			auto arr = builder.Array("indexes");
@@ -84,6 +91,7 @@ void LRUCacheMemStat::GetJSON(JsonBuilder& builder) const {
 	builder.Put("items_count", itemsCount);
 	builder.Put("empty_count", emptyCount);
 	builder.Put("hit_count_limit", hitCountLimit);
+	builder.Put("compressed_savings", compressedSavings);
 }
 
 void EmbedderStatus::GetJSON(JsonBuilder& builder) const {
@@ -135,6 +143,18 @@ void IndexMemStat::GetJSON(JsonBuilder& builder) const {
 	if (isBuilt.has_value()) {
 		builder.Put("is_built", isBuilt.value());
 	}
+	if (ftPostingsSize.has_value()) {
+		builder.Put("ft_postings_size", ftPostingsSize.value());
+	}
+	if (ftPostingsVarintSize.has_value()) {
+		builder.Put("ft_postings_varint_size", ftPostingsVarintSize.value());
+	}
+	if (ftSegmentsCount.has_value()) {
+		builder.Put("ft_segments_count", ftSegmentsCount.value());
+	}
+	if (ftTombstonesCount.has_value()) {
+		builder.Put("ft_tombstones_count", ftTombstonesCount.value());
+	}
 	if (isQuantized.has_value()) {
 		builder.Put("is_quantized", isQuantized.value());
 	}
@@ -210,6 +230,10 @@ void NamespacePerfStat::GetJSON(WrSerializer& ser) const {
 		auto obj = builder.Object("join_cache");
 		joinCache.GetJSON(obj);
 	}
+	if (coldPayloadsCache.state != LRUCachePerfStat::State::DoesNotExist) {
+		auto obj = builder.Object("cold_payloads_cache");
+		coldPayloadsCache.GetJSON(obj);
+	}
 
 	auto arr = builder.Array("indexes");
 
@@ -224,6 +248,38 @@ void EmbedderCachePerfStat::GetJSON(JsonBuilder& builder) const {
 	LRUCachePerfStat::GetJSON(builder);
 }
 
+void HistogramBucketStat::GetJSON(JsonBuilder& builder) const {
+	if (upperBound != std::numeric_limits<uint64_t>::max()) {
+		builder.Put("le", upperBound);
+	}
+	builder.Put("count", count);
+}
+
+void EmbedderBatchingPerfStat::GetJSON(JsonBuilder& builder) const {
+	builder.Put("total_batches_count", totalBatchesCount);
+	builder.Put("total_batched_documents_count", totalBatchedDocumentsCount);
+	builder.Put("total_deduplicated_documents_count", totalDeduplicatedDocumentsCount);
+	builder.Put("last_sec_batches", lastSecBatches);
+	builder.Put("last_sec_batched_dps", lastSecBatchedDps);
+	builder.Put("last_sec_avg_batch_size", lastSecAvgBatchSize);
+	builder.Put("total_avg_batch_latency_us", totalAvgBatchLatencyUs);
+	builder.Put("last_sec_avg_batch_latency_us", lastSecAvgBatchLatencyUs);
+	{
+		auto arr = builder.Array("batch_size_histogram");
+		for (const auto& bucket : batchSizeHistogram) {
+			auto obj = arr.Object();
+			bucket.GetJSON(obj);
+		}
+	}
+	{
+		auto arr = builder.Array("batch_latency_histogram_us");
+		for (const auto& bucket : batchLatencyHistogramUs) {
+			auto obj = arr.Object();
+			bucket.GetJSON(obj);
+		}
+	}
+}
+
 void EmbedderPerfStat::GetJSON(JsonBuilder& builder) const {
 	if (!cacheStat.tag.empty()) {
 		auto cacheNode = builder.Object("cache");
@@ -254,6 +310,10 @@ void EmbedderPerfStat::GetJSON(JsonBuilder& builder) const {
 	builder.Put("min_cache_latency_us", minCacheLatencyUs);
 	builder.Put("input_traffic_total_bytes", inputTrafficTotalBytes);
 	builder.Put("output_traffic_total_bytes", outputTrafficTotalBytes);
+	if (batching.has_value()) {
+		auto batchingNode = builder.Object("batching");
+		batching->GetJSON(batchingNode);
+	}
 }
 
 void IndexPerfStat::GetJSON(JsonBuilder& builder) const {
@@ -280,6 +340,16 @@ void IndexPerfStat::GetJSON(JsonBuilder& builder) const {
 		auto obj = builder.Object("query_embedder");
 		queryEmbedder->GetJSON(obj);
 	}
+
+	if (ftRebuilds.has_value()) {
+		auto obj = builder.Object("ft_rebuilds");
+		ftRebuilds->GetJSON(obj);
+	}
+
+	if (ftMerges.has_value()) {
+		auto obj = builder.Object("ft_merges");
+		ftMerges->GetJSON(obj);
+	}
 }
 
 void ReplicationDataHash::GetJSON(JsonBuilder& builder) const {
@@ -397,6 +467,9 @@ void TxPerfStat::GetJSON(JsonBuilder& builder) const {
 	builder.Put("avg_copy_time_us", avgCopyTimeUs);
 	builder.Put("min_copy_time_us", minCopyTimeUs);
 	builder.Put("max_copy_time_us", maxCopyTimeUs);
+	builder.Put("avg_copy_memory", avgCopyMemory);
+	builder.Put("min_copy_memory", minCopyMemory);
+	builder.Put("max_copy_memory", maxCopyMemory);
 }
 
 void TxPerfStat::FromJSON(const gason::JsonNode& node) {
@@ -414,6 +487,9 @@ void TxPerfStat::FromJSON(const gason::JsonNode& node) {
 	avgCopyTimeUs = node["avg_copy_time_us"].As<size_t>(avgCopyTimeUs);
 	minCopyTimeUs = node["min_copy_time_us"].As<size_t>(minCopyTimeUs);
 	maxCopyTimeUs = node["max_copy_time_us"].As<size_t>(maxCopyTimeUs);
+	avgCopyMemory = node["avg_copy_memory"].As<size_t>(avgCopyMemory);
+	minCopyMemory = node["min_copy_memory"].As<size_t>(minCopyMemory);
+	maxCopyMemory = node["max_copy_memory"].As<size_t>(maxCopyMemory);
 }
 
 void LRUCachePerfStat::GetJSON(JsonBuilder& builder) const {
@@ -430,6 +506,15 @@ void LRUCachePerfStat::GetJSON(JsonBuilder& builder) const {
 
 	builder.Put("total_queries", TotalQueries());
 	builder.Put("cache_hit_rate", HitRate());
+	if (regions) {
+		auto regionsNode = builder.Object("regions");
+		constexpr std::array<std::string_view, 3> kRegionNames = {"window"sv, "probation"sv, "protected"sv};
+		for (size_t i = 0; i < kRegionNames.size(); ++i) {
+			auto regionNode = regionsNode.Object(kRegionNames[i]);
+			regionNode.Put("hits", (*regions)[i].hits);
+			regionNode.Put("misses", (*regions)[i].misses);
+		}
+	}
 }
 
 uint64_t LRUCachePerfStat::TotalQueries() const noexcept { return hits + misses; }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <stdlib.h>
+#include <array>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -20,6 +22,7 @@ struct [[nodiscard]] LRUCacheMemStat {
 	size_t itemsCount = 0;
 	size_t emptyCount = 0;
 	size_t hitCountLimit = 0;
+	size_t compressedSavings = 0;
 };
 
 struct [[nodiscard]] EmbedderStatus {
@@ -44,10 +47,14 @@ struct [[nodiscard]] IndexMemStat {
 	size_t trackedUpdatesSize = 0;
 	size_t trackedUpdatesOverflow = 0;
 	std::optional<bool> isBuilt;  // KNN-indexes|fast-text indexes only
+	std::optional<size_t> ftPostingsSize;		 // fast-text indexes only
+	std::optional<size_t> ftPostingsVarintSize;	 // fast-text indexes with compressed posting lists only
+	std::optional<size_t> ftSegmentsCount;		 // fast-text indexes only
+	std::optional<size_t> ftTombstonesCount;	 // fast-text indexes only
 	LRUCacheMemStat idsetCache;
 	std::optional<EmbedderStatus> upsertEmbedderStatus;
 	std::optional<EmbedderStatus> queryEmbedderStatus;
-	std::optional<bool> isQuantized;  // HNSW-indexes only
+	std::optional<bool> isQuantized;  // HNSW and IVF indexes only
 	size_t GetFullIndexStructSize() const noexcept {
 		return idsetPlainSize + idsetBTreeSize + sortOrdersSize + columnSize + trackedUpdatesSize + indexingStructSize + vectorsKeeperSize;
 	}
@@ -186,6 +193,7 @@ struct [[nodiscard]] NamespaceMemStat {
 	bool optimizationCompleted = false;
 	size_t itemsCount = 0;
 	size_t emptyItemsCount = 0;
+	size_t coldItemsCount = 0;
 	size_t stringsWaitingToBeDeletedSize = 0;
 	struct [[nodiscard]] {
 		size_t dataSize = 0;
@@ -202,6 +210,7 @@ struct [[nodiscard]] NamespaceMemStat {
 	ReplicationStat replication;
 	LRUCacheMemStat joinCache;
 	LRUCacheMemStat queryCache;
+	LRUCacheMemStat coldPayloadsCache;
 	std::vector<IndexMemStat> indexes;
 	std::vector<EmbeddersCacheMemStat> embedders;
 	TagsMatcherStat tagsMatcher;
@@ -214,9 +223,16 @@ struct [[nodiscard]] LRUCachePerfStat {
 	uint64_t TotalQueries() const noexcept;
 	double HitRate() const noexcept;
 
+	struct [[nodiscard]] RegionStat {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+	};
+
 	State state = State::DoesNotExist;
 	uint64_t hits = 0;
 	uint64_t misses = 0;
+	// Hits and misses by the regions of W-TinyLFU cache: window, probation and protected. Not set for LRU caches
+	std::optional<std::array<RegionStat, 3>> regions;
 };
 
 struct [[nodiscard]] PerfStat {
@@ -251,6 +267,9 @@ struct [[nodiscard]] TxPerfStat {
 	size_t avgCopyTimeUs;
 	size_t minCopyTimeUs;
 	size_t maxCopyTimeUs;
+	size_t avgCopyMemory;
+	size_t minCopyMemory;
+	size_t maxCopyMemory;
 };
 
 struct [[nodiscard]] EmbedderCachePerfStat : LRUCachePerfStat {
@@ -259,6 +278,27 @@ struct [[nodiscard]] EmbedderCachePerfStat : LRUCachePerfStat {
 	std::string tag;
 };
 
+struct [[nodiscard]] HistogramBucketStat {
+	void GetJSON(JsonBuilder& builder) const;
+
+	uint64_t upperBound = 0;  // std::numeric_limits<uint64_t>::max() for the last bucket
+	uint64_t count = 0;
+};
+
+struct [[nodiscard]] EmbedderBatchingPerfStat {
+	void GetJSON(JsonBuilder& builder) const;
+	unsigned int totalBatchesCount = 0;
+	unsigned int totalBatchedDocumentsCount = 0;
+	unsigned int totalDeduplicatedDocumentsCount = 0;
+	unsigned int lastSecBatches = 0;
+	unsigned int lastSecBatchedDps = 0;
+	unsigned int lastSecAvgBatchSize = 0;
+	unsigned int totalAvgBatchLatencyUs = 0;
+	unsigned int lastSecAvgBatchLatencyUs = 0;
+	std::vector<HistogramBucketStat> batchSizeHistogram;
+	std::vector<HistogramBucketStat> batchLatencyHistogramUs;
+};
+
 struct [[nodiscard]] EmbedderPerfStat {
 	void GetJSON(JsonBuilder& builder) const;
 	unsigned int totalQueriesCount = 0;
@@ -286,6 +326,7 @@ struct [[nodiscard]] EmbedderPerfStat {
 	unsigned int inputTrafficTotalBytes = 0;
 	unsigned int outputTrafficTotalBytes = 0;
 	EmbedderCachePerfStat cacheStat;
+	std::optional<EmbedderBatchingPerfStat> batching;
 };
 
 struct [[nodiscard]] IndexPerfStat {
@@ -301,6 +342,9 @@ struct [[nodiscard]] IndexPerfStat {
 
 	std::optional<EmbedderPerfStat> upsertEmbedder;
 	std::optional<EmbedderPerfStat> queryEmbedder;
+
+	std::optional<PerfStat> ftRebuilds;	 // fast-text indexes only
+	std::optional<PerfStat> ftMerges;	 // fast-text indexes only
 };
 
 struct [[nodiscard]] NamespacePerfStat {
@@ -313,6 +357,7 @@ struct [[nodiscard]] NamespacePerfStat {
 	std::vector<IndexPerfStat> indexes;
 	LRUCachePerfStat joinCache;
 	LRUCachePerfStat queryCountCache;
+	LRUCachePerfStat coldPayloadsCache;
 };
 
 }  // namespace reindexer
@@ -0,0 +1,34 @@
+#include "payloadstier.h"
+#include "core/itemimpl.h"
+#include "core/namespace/asyncstorage.h"
+#include "core/payload/payloadiface.h"
+#include "core/storage/storage_prefixes.h"
+
+namespace reindexer {
+
+key_string ColdPayloadsLoader::Load(const PayloadValue& pv) {
+	assertrx_throw(storage_.IsValid());
+	ConstPayload pl(pt_, pv);
+
+	pkSer_.Reset();
+	pkSer_ << kRxStorageItemPrefix;
+	pl.SerializeFields(pkSer_, pkFields_);
+	if (auto err = storage_.Read(StorageOpts{}, pkSer_.Slice(), storageItem_); !err.ok()) {
+		throw Error(err.code(), "Error while searching for a cold item with pk='{}' in the storage: {}", pkSer_.Slice(), err.what());
+	}
+	// Cold items are never modified without the tuple restoration and the storage is flushed before the eviction,
+	// so the storage contains the actual version of the cold item
+	if (storageItem_.size() < sizeof(int64_t)) [[unlikely]] {
+		throw Error(errLogic, "Unexpected storage record size for a cold item with pk='{}': {}", pkSer_.Slice(), storageItem_.size());
+	}
+
+	ItemImpl item(pt_, tm_);
+	item.Unsafe(true);
+	item.FromCJSON(std::string_view(storageItem_).substr(sizeof(int64_t)));	 // skip lsn (int64_t)
+	VariantArray tuple;
+	item.GetPayload().Get(0, tuple);
+	assertrx_throw(tuple.size() == 1);
+	return make_key_string(std::string_view(tuple[0]));
+}
+
+}  // namespace reindexer
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <vector>
+#include "core/id_type.h"
+#include "core/keyvalue/key_string.h"
+#include "core/lrucache.h"
+#include "core/payload/payload_checksum.h"
+#include "core/payload/payloadvalue.h"
+#include "estl/fast_hash_map.h"
+#include "tools/assertrx.h"
+#include "tools/serilize/wrserializer.h"
+
+namespace reindexer {
+
+class AsyncStorage;
+class FieldsSet;
+class PayloadType;
+class TagsMatcher;
+
+struct [[nodiscard]] ColdPayloadCacheKey {
+	struct [[nodiscard]] Hash {
+		size_t operator()(const ColdPayloadCacheKey& k) const noexcept {
+			return std::hash<IdType>()(k.rowId) ^ (std::hash<int64_t>()(k.lsn) << 1);
+		}
+	};
+	struct [[nodiscard]] Equal {
+		bool operator()(const ColdPayloadCacheKey& lhs, const ColdPayloadCacheKey& rhs) const noexcept {
+			return lhs.rowId == rhs.rowId && lhs.lsn == rhs.lsn;
+		}
+	};
+
+	size_t Size() const noexcept { return sizeof(ColdPayloadCacheKey); }
+	template <typename T>
+	friend T& operator<<(T& os, const ColdPayloadCacheKey& k) {
+		return os << "{row_id: " << k.rowId << ", lsn: " << k.lsn << '}';
+	}
+
+	IdType rowId;
+	int64_t lsn = 0;
+};
+
+struct [[nodiscard]] ColdPayloadCacheVal {
+	ColdPayloadCacheVal() = default;
+	explicit ColdPayloadCacheVal(key_string t) noexcept : tuple(std::move(t)) {}
+
+	size_t Size() const noexcept { return tuple.heap_size(); }
+	bool IsInitialized() const noexcept { return bool(tuple); }
+	template <typename T>
+	void Dump(T& os) const {
+		os << "{tuple_size: " << (tuple ? tuple.size() : 0) << '}';
+	}
+
+	key_string tuple;
+};
+
+using ColdPayloadsCache =
+	LRUCache<LRUCacheImpl<ColdPayloadCacheKey, ColdPayloadCacheVal, ColdPayloadCacheKey::Hash, ColdPayloadCacheKey::Equal>,
+			 LRUWithAtomicPtr::No>;
+
+/// Tracks the items, whose tuples (CJSON with the non-indexed fields) were evicted from RAM into the storage.
+/// Indexed fields of the cold items stay in the payload, the tuple field is replaced with the empty string.
+/// Hot items are detected with the clock algorithm: selects set 'referenced' bit of the returned items and the eviction sweep
+/// clears it, so only the items, which were not requested during the whole clock turn, are evicted.
+class [[nodiscard]] PayloadsTier {
+public:
+	PayloadsTier(size_t cacheSize, uint32_t hitsToCache, CachePolicy policy) : cache_{cacheSize, hitsToCache, policy} {}
+	PayloadsTier(const PayloadsTier& o, size_t cacheSize, uint32_t hitsToCache, CachePolicy policy)
+		: flags_{o.flags_},
+		  cold_{o.cold_},
+		  hand_{o.hand_},
+		  coldCount_{o.coldCount_.load(std::memory_order_relaxed)},
+		  enabled_{o.enabled_.load(std::memory_order_relaxed)},
+		  cache_{cacheSize, hitsToCache, policy} {
+		cache_.CopyInternalPerfStatsFrom(o.cache_);
+	}
+
+	// Thread-safe for the concurrent calls under the namespace's read lock
+	void Touch(IdType id) const noexcept {
+		const auto idx = size_t(id.ToNumber());
+		if (idx < flags_.size()) {
+			std::atomic_ref<uint8_t>(flags_[idx]).fetch_or(kReferenced, std::memory_order_relaxed);
+		}
+	}
+	bool IsCold(IdType id) const noexcept {
+		const auto idx = size_t(id.ToNumber());
+		return coldCount_.load(std::memory_order_relaxed) && idx < flags_.size() &&
+			   (std::atomic_ref<uint8_t>(flags_[idx]).load(std::memory_order_relaxed) & kCold);
+	}
+	bool HasColdItems() const noexcept { return coldCount_.load(std::memory_order_relaxed) != 0; }
+	size_t ColdCount() const noexcept { return coldCount_.load(std::memory_order_relaxed); }
+	const PayloadChecksum& ColdChecksum(IdType id) const {
+		const auto it = cold_.find(id);
+		assertrx_throw(it != cold_.end());
+		return it->second;
+	}
+
+	// Methods below require exclusive lock
+	// New items are considered as referenced, so they are not evicted until the next clock turn
+	void Resize(size_t itemsCount) { flags_.resize(itemsCount, kReferenced); }
+	// Returns true and clears the bit, if the item was referenced since the last sweep
+	bool TestAndClearReferenced(IdType id) noexcept {
+		uint8_t& f = flags_[size_t(id.ToNumber())];
+		const bool referenced = f & kReferenced;
+		f &= ~kReferenced;
+		return referenced;
+	}
+	void MarkCold(IdType id, const PayloadChecksum& checksum) {
+		cold_[id] = checksum;
+		flags_[size_t(id.ToNumber())] |= kCold;
+		coldCount_.fetch_add(1, std::memory_order_relaxed);
+	}
+	// Returns saved checksum of the cold item
+	PayloadChecksum MarkWarm(IdType id) {
+		const auto it = cold_.find(id);
+		assertrx_throw(it != cold_.end());
+		const auto checksum = it->second;
+		cold_.erase(it);
+		flags_[size_t(id.ToNumber())] = kReferenced;
+		coldCount_.fetch_sub(1, std::memory_order_relaxed);
+		return checksum;
+	}
+	void Clear() {
+		flags_.clear();
+		cold_.clear();
+		hand_ = 0;
+		coldCount_.store(0, std::memory_order_relaxed);
+		cache_.Clear();
+	}
+	size_t& ClockHand() noexcept { return hand_; }
+	void SetEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+	bool Enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+	// Pinned tier does not evict anything. Selects, which require tuples of all items, pin it for the time of the execution
+	void Pin() const noexcept { pins_.fetch_add(1, std::memory_order_acq_rel); }
+	void Unpin() const noexcept { pins_.fetch_sub(1, std::memory_order_acq_rel); }
+	bool IsPinned() const noexcept { return pins_.load(std::memory_order_acquire) != 0; }
+
+	// Cache is thread-safe itself
+	ColdPayloadsCache& Cache() const noexcept { return cache_; }
+
+private:
+	static constexpr uint8_t kReferenced = 0x1;
+	static constexpr uint8_t kCold = 0x2;
+
+	mutable std::vector<uint8_t> flags_;
+	fast_hash_map<IdType, PayloadChecksum> cold_;
+	size_t hand_ = 0;
+	std::atomic<size_t> coldCount_{0};
+	std::atomic<bool> enabled_{false};
+	mutable std::atomic<int32_t> pins_{0};
+	mutable ColdPayloadsCache cache_;
+};
+
+/// Loads tuples of the cold items from the storage. Not thread-safe: each reader has to create its own loader
+class [[nodiscard]] ColdPayloadsLoader {
+public:
+	ColdPayloadsLoader(const AsyncStorage& storage, const PayloadType& pt, const TagsMatcher& tm, const FieldsSet& pkFields) noexcept
+		: storage_(storage), pt_(pt), tm_(tm), pkFields_(pkFields) {}
+
+	key_string Load(const PayloadValue& pv);
+
+private:
+	const AsyncStorage& storage_;
+	const PayloadType& pt_;
+	const TagsMatcher& tm_;
+	const FieldsSet& pkFields_;
+	WrSerializer pkSer_;
+	std::string storageItem_;
+};
+
+/// Cold items, loaded by a single select under the namespace's read lock. Loaded payloads are the copies of the namespace's payloads
+/// with the restored tuple, so the comparators, sorting and aggregations handle them as the hot ones. Not thread-safe
+class [[nodiscard]] ColdPayloadsHolder {
+public:
+	struct [[nodiscard]] Entry {
+		PayloadValue pv;
+		key_string tuple;
+	};
+
+	const Entry* Find(IdType id) const noexcept {
+		const auto it = items_.find(id);
+		return it == items_.end() ? nullptr : &it->second;
+	}
+	// Returns the loaded payload or the namespace's one, if the item was not loaded
+	const PayloadValue& Get(IdType id, const PayloadValue& nsPayload) const noexcept {
+		const Entry* e = Find(id);
+		return e ? e->pv : nsPayload;
+	}
+	// Returned reference is valid until the next Add() call
+	const PayloadValue& Add(IdType id, PayloadValue&& pv, key_string&& tuple) {
+		return items_.insert_or_assign(id, Entry{std::move(pv), std::move(tuple)}).first->second.pv;
+	}
+	void Erase(IdType id) noexcept { items_.erase(id); }
+	// Tuples may be referenced by the results and the aggregations of the select, so they have to be held, while those are alive
+	template <typename HoldF>
+	void HoldTuples(HoldF&& hold) const {
+		for (const auto& [id, e] : items_) {
+			hold(key_string{e.tuple});
+		}
+	}
+	std::optional<ColdPayloadsLoader>& Loader() noexcept { return loader_; }
+
+private:
+	fast_hash_map<IdType, Entry> items_;
+	std::optional<ColdPayloadsLoader> loader_;
+};
+
+}  // namespace reindexer
@@ -39,6 +39,30 @@ Snapshot::Snapshot(PayloadType pt, TagsMatcher tm, lsn_t nsVersion, lsn_t lastLs
 	lockItems(true);
 }
 
+Snapshot::Snapshot(PayloadType pt, TagsMatcher tm, lsn_t nsVersion, lsn_t lastLsn, PayloadChecksum expectedDataHash, uint64_t expectedDataCount,
+				   ClusterOperationStatus clusterStatus, LocalQueryResults&& raw, uint32_t leavesCount,
+				   std::vector<uint32_t>&& resyncBuckets)
+	: pt_(std::move(pt)),
+	  tm_(std::move(tm)),
+	  expectedDataHash_(expectedDataHash),
+	  expectedDataCount_(expectedDataCount),
+	  clusterOperationStatus_(std::move(clusterStatus)),
+	  lastLsn_(lastLsn),
+	  nsVersion_(nsVersion),
+	  partialLeavesCount_(leavesCount),
+	  resyncBuckets_(std::move(resyncBuckets)) {
+	// Raw part is required even without the items: it carries the buckets to delete and resets the target's WAL
+	rawData_.AddItem(ItemRef(IdType::NotSet(), createTmItem(), 0, true));
+	addRawData(std::move(raw));
+
+	PackedWALRecord wr;
+	wr.Pack(WALRecord(WalEmpty));
+	PayloadValue val(wr.size(), wr.data());
+	val.SetLSN(lastLsn_);
+	walData_.AddItem(ItemRef(IdType::NotSet(), val, 0, true));
+	lockItems(true);
+}
+
 Snapshot& Snapshot::operator=(Snapshot&& other) noexcept {
 	lockItems(false);
 	pt_ = std::move(other.pt_);
@@ -50,6 +74,8 @@ Snapshot& Snapshot::operator=(Snapshot&& other) noexcept {
 	clusterOperationStatus_ = other.clusterOperationStatus_;
 	lastLsn_ = other.lastLsn_;
 	nsVersion_ = other.nsVersion_;
+	partialLeavesCount_ = other.partialLeavesCount_;
+	resyncBuckets_ = std::move(other.resyncBuckets_);
 	return *this;
 }
 
@@ -217,6 +243,12 @@ SnapshotChunk Snapshot::Iterator::Chunk() const {
 	chunk.MarkWAL(wal);
 	chunk.MarkTx(chunks[idx].txChunk);
 	chunk.MarkLast(idx_ == sn_->Size() - 1);
+	if (sn_->partialLeavesCount_) {
+		chunk.MarkPartial(sn_->partialLeavesCount_);
+		if (idx_ == 0) {
+			chunk.resyncBuckets = sn_->resyncBuckets_;
+		}
+	}
 	return chunk;
 }
 
@@ -14,6 +14,9 @@ public:
 			 ClusterOperationStatus clusterStatus);
 	Snapshot(PayloadType pt, TagsMatcher tm, lsn_t nsVersion, lsn_t lastLsn, PayloadChecksum expectedDataHash, uint64_t expectedDataCount,
 			 ClusterOperationStatus clusterStatus, LocalQueryResults&& wal, LocalQueryResults&& raw = LocalQueryResults());
+	// Partial force sync snapshot: contains the items of the diverged data hash tree buckets and resets target's WAL to the 'lastLsn'
+	Snapshot(PayloadType pt, TagsMatcher tm, lsn_t nsVersion, lsn_t lastLsn, PayloadChecksum expectedDataHash, uint64_t expectedDataCount,
+			 ClusterOperationStatus clusterStatus, LocalQueryResults&& raw, uint32_t leavesCount, std::vector<uint32_t>&& resyncBuckets);
 	Snapshot(const Snapshot&) = delete;
 	Snapshot(Snapshot&&) = default;
 	Snapshot& operator=(const Snapshot&) = delete;
@@ -54,6 +57,8 @@ public:
 	ClusterOperationStatus ClusterOperationStat() const noexcept { return clusterOperationStatus_; }
 	lsn_t LastLSN() const noexcept { return lastLsn_; }
 	lsn_t NsVersion() const noexcept { return nsVersion_; }
+	bool IsPartial() const noexcept { return partialLeavesCount_; }
+	size_t ResyncBucketsCount() const noexcept { return resyncBuckets_.size(); }
 	std::string Dump();
 
 private:
@@ -94,6 +99,8 @@ private:
 	ClusterOperationStatus clusterOperationStatus_;
 	lsn_t lastLsn_;
 	lsn_t nsVersion_;
+	uint32_t partialLeavesCount_ = 0;
+	std::vector<uint32_t> resyncBuckets_;
 	friend class Iterator;
 };
 
@@ -34,6 +34,11 @@ Snapshot SnapshotHandler::CreateSnapshot(const SnapshotOpts& opts) const {
 		if (err.code() != errOutdatedWAL) {
 			throw err;
 		}
+		if (opts.dataHashTreeDiff) {
+			if (auto snapshot = createPartialSnapshot(*opts.dataHashTreeDiff, datahash); snapshot) {
+				return std::move(*snapshot);
+			}
+		}
 		logFmt(LogInfo, "[repl:{}]:{} Creating RAW (force sync) snapshot. Reason: {}", ns_.name_, ns_.wal_.GetServer(), err.what());
 		const auto minLsn = ns_.wal_.LSNByOffset(opts.maxWalDepthOnForceSync);
 		if (minLsn.isEmpty()) {
@@ -66,11 +71,71 @@ Snapshot SnapshotHandler::CreateSnapshot(const SnapshotOpts& opts) const {
 	}
 }
 
+std::optional<Snapshot> SnapshotHandler::createPartialSnapshot(const DataHashTreeDiff& diff, const PayloadChecksum& datahash) const {
+	const auto leavesCount = diff.baseline.LeavesCount();
+	if (!ns_.dataHashTree_ || ns_.dataHashTree_->LeavesCount() != leavesCount || ns_.wal_.LastLSN().isEmpty()) {
+		// Tree was reset by the indexes update or truncate. Buckets can not be compared with the baseline
+		return std::nullopt;
+	}
+	const auto& tree = *ns_.dataHashTree_;
+	std::vector<bool> resync(leavesCount, false);
+	for (auto bucket : diff.buckets) {
+		if (bucket >= leavesCount) {
+			throw Error(errParams, "Unexpected data hash tree bucket: {}. Tree has {} leaves", bucket, leavesCount);
+		}
+		resync[bucket] = true;
+	}
+	// Buckets, changed after the comparison with the follower's tree, also have to be resynced
+	std::vector<uint32_t> buckets;
+	for (uint32_t bucket = 0; bucket < leavesCount; ++bucket) {
+		if (resync[bucket] || tree.Leaf(bucket) != diff.baseline.Leaf(bucket)) {
+			resync[bucket] = true;
+			buckets.emplace_back(bucket);
+		}
+	}
+	if (buckets.size() > DataHashTree::MaxDivergedBuckets(leavesCount)) {
+		return std::nullopt;
+	}
+
+	LocalQueryResults rawQr;
+	rawQr.addNSContext(ns_.payloadType_, ns_.tagsMatcher_, FieldsFilter::AllFields(), ns_.schema_, ns_.incarnationTag_);
+	for (size_t i = 0, sz = ns_.items_.size(); i < sz; ++i) {
+		const auto rowId = IdType::FromNumber(i);
+		const auto& pv = ns_.items_[rowId];
+		if (!pv.IsFree() && resync[ns_.dataHashTreeBucket(tree, pv)]) {
+			rawQr.AddItemRef(rowId, pv);
+		}
+	}
+	ns_.holdColdPayloads(rawQr, 0, false);
+	rawQr.GetFloatVectorsHolder().Add(ns_, rawQr.begin(), rawQr.end(), FieldsFilter::AllFields());
+	logFmt(LogInfo, "[repl:{}]:{} Creating partial (force sync) snapshot: {} items of {} diverged buckets", ns_.name_,
+		   ns_.wal_.GetServer(), rawQr.Count(), buckets.size());
+	return Snapshot(ns_.payloadType_, ns_.tagsMatcher_, ns_.repl_.nsVersion, ns_.wal_.LastLSN(), datahash, ns_.itemsCount(),
+					ns_.repl_.clusterStatus, std::move(rawQr), leavesCount, std::move(buckets));
+}
+
 void SnapshotHandler::ApplyChunk(const SnapshotChunk& ch, bool isInitialLeaderSync, UpdatesContainer& repl) {
 	ChunkContext ctx;
 	ctx.wal = ch.IsWAL();
 	ctx.shallow = ch.IsShallow();
 	ctx.initialLeaderSync = isInitialLeaderSync;
+	ctx.partial = ch.IsPartial();
+
+	if (ctx.partial && !ch.resyncBuckets.empty()) {
+		// Tagsmatcher record goes first and has to be checked before any of the items are deleted
+		auto& records = ch.Records();
+		size_t i = 0;
+		if (!records.empty() && records.front().Unpack().type == WalTagsMatcher) {
+			applyRecord(records.front(), ctx, repl);
+			++i;
+		}
+		ns_.deleteDataHashTreeBuckets(ch.DataHashTreeLeavesCount(), ch.resyncBuckets);
+		for (; i < records.size(); ++i) {
+			applyRecord(records[i], ctx, repl);
+		}
+		ns_.storage_.TryForceFlush();
+		return;
+	}
 
 	for (auto& rec : ch.Records()) {
 		applyRecord(rec, ctx, repl);
@@ -229,7 +294,8 @@ void SnapshotHandler::applyRealRecord(lsn_t lsn, const SnapshotRecord& snRec, co
 			if (!err.ok()) {
 				throw err;
 			}
-			ns_.doModifyItem(item, ModeUpsert, pendedRepl, ctx, (chCtx.wal) ? IdType::NotSet() : rec.rawItem.id);
+			// Partial snapshot is applied to the non-empty namespace, so the source's item ID may be occupied
+			ns_.doModifyItem(item, ModeUpsert, pendedRepl, ctx, (chCtx.wal || chCtx.partial) ? IdType::NotSet() : rec.rawItem.id);
 			break;
 		}
 		case WalTagsMatcher: {
@@ -240,6 +306,10 @@ void SnapshotHandler::applyRealRecord(lsn_t lsn, const SnapshotRecord& snRec, co
 			tm.deserialize(ser, version, stateToken);
 			logFmt(LogInfo, "[{}]: Changing tm's statetoken on {}: {:#08x}->{:#08x}", ns_.name_, ns_.wal_.GetServer(),
 				   ns_.tagsMatcher_.stateToken(), stateToken);
+			if (chCtx.partial && !ns_.tagsMatcher_.IsSubsetOf(tm)) {
+				// Namespace's items are not resynced, so their tags have to be valid for the new tagsmatcher
+				throw Error(errDataHashMismatch, "[{}]: Unable to apply partial snapshot: tagsmatchers are not compatible", ns_.name_);
+			}
 			ns_.tagsMatcher_ = std::move(tm);
 			ns_.tagsMatcher_.UpdatePayloadType(ns_.payloadType_, ns_.indexes_.SparseIndexes(), NeedChangeTmVersion::No);
 			ns_.tagsMatcher_.setUpdated();
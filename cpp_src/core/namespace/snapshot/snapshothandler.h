@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include "snapshot.h"
 #include "updates/updaterecord.h"
 
@@ -21,8 +22,11 @@ private:
 		bool shallow = false;
 		bool tx = false;
 		bool initialLeaderSync = false;
+		bool partial = false;
 	};
 
+	std::optional<Snapshot> createPartialSnapshot(const DataHashTreeDiff& diff, const PayloadChecksum& datahash) const;
+
 	void applyRecord(const SnapshotRecord& rec, const ChunkContext& ctx, UpdatesContainer& repl);
 	void applyShallowRecord(lsn_t lsn, WALRecType type, const PackedWALRecord& wrec, const ChunkContext& chCtx);
 	void applyRealRecord(lsn_t lsn, const SnapshotRecord& snRec, const ChunkContext& chCtx, UpdatesContainer& repl);
@@ -23,6 +23,13 @@ void SnapshotChunk::Deserialize(Serializer& ser) {
 	for (auto& rec : records) {
 		rec.Deserialize(ser);
 	}
+	if (IsPartial()) {
+		leavesCount_ = ser.GetVarUInt();
+		resyncBuckets.resize(ser.GetVarUInt());
+		for (auto& bucket : resyncBuckets) {
+			bucket = ser.GetVarUInt();
+		}
+	}
 }
 
 void SnapshotChunk::Serilize(WrSerializer& ser) const {
@@ -31,6 +38,21 @@ void SnapshotChunk::Serilize(WrSerializer& ser) const {
 	for (auto& rec : records) {
 		rec.Serilize(ser);
 	}
+	if (IsPartial()) {
+		ser.PutVarUint(leavesCount_);
+		ser.PutVarUint(resyncBuckets.size());
+		for (auto bucket : resyncBuckets) {
+			ser.PutVarUint(bucket);
+		}
+	}
+}
+
+size_t SnapshotChunk::DataSize() const noexcept {
+	size_t size = 0;
+	for (auto& rec : records) {
+		size += rec.Record().size();
+	}
+	return size;
 }
 
 using namespace std::string_view_literals;
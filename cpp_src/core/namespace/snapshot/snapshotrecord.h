@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include "tools/lsn.h"
 #include "wal/walrecord.h"
 
@@ -7,12 +8,14 @@ namespace reindexer {
 
 class Serializer;
 class WrSerializer;
+struct DataHashTreeDiff;
 
 enum [[nodiscard]] SnapshotRecordOpts {
 	kShallowSnapshotChunk = 1 << 0,
 	kWALSnapshotChunk = 1 << 1,
 	kTxSnapshotChunk = 1 << 2,
-	kLastSnapshotChunk = 1 << 3
+	kLastSnapshotChunk = 1 << 3,
+	kPartialSnapshotChunk = 1 << 4
 };
 
 class [[nodiscard]] SnapshotRecord {
@@ -41,16 +44,27 @@ public:
 	void MarkWAL(bool v = true) noexcept { opts_ = v ? opts_ | kWALSnapshotChunk : opts_ & ~(kWALSnapshotChunk); }
 	void MarkTx(bool v = true) noexcept { opts_ = v ? opts_ | kTxSnapshotChunk : opts_ & ~(kTxSnapshotChunk); }
 	void MarkLast(bool v = true) noexcept { opts_ = v ? opts_ | kLastSnapshotChunk : opts_ & ~(kLastSnapshotChunk); }
+	void MarkPartial(uint32_t leavesCount) noexcept {
+		opts_ |= kPartialSnapshotChunk;
+		leavesCount_ = leavesCount;
+	}
 
 	bool IsShallow() const noexcept { return opts_ & kShallowSnapshotChunk; }
 	bool IsWAL() const noexcept { return opts_ & kWALSnapshotChunk; }
 	bool IsTx() const noexcept { return opts_ & kTxSnapshotChunk; }
 	bool IsLastChunk() const noexcept { return opts_ & kLastSnapshotChunk; }
+	// Chunk of the partial force sync: contains the items of the diverged data hash tree buckets only
+	bool IsPartial() const noexcept { return opts_ & kPartialSnapshotChunk; }
+	uint32_t DataHashTreeLeavesCount() const noexcept { return leavesCount_; }
+	size_t DataSize() const noexcept;
 
 	std::vector<SnapshotRecord> records;
+	// Buckets, which items have to be deleted before the chunk's records are applied. Set for the first partial chunk only
+	std::vector<uint32_t> resyncBuckets;
 
 private:
 	uint16_t opts_ = 0;
+	uint32_t leavesCount_ = 0;
 };
 
 enum [[nodiscard]] SnapshotOptsEnum {
@@ -69,6 +83,9 @@ struct [[nodiscard]] SnapshotOpts {
 
 	ExtendedLsn from;
 	int64_t maxWalDepthOnForceSync;
+	// Diverged buckets of the follower's data hash tree. If set, force sync snapshot may contain the items of these buckets only.
+	// Local option: is not serialized
+	std::shared_ptr<const DataHashTreeDiff> dataHashTreeDiff;
 };
 
 }  // namespace reindexer
@@ -3,6 +3,7 @@
 #include "core/payload/payload_access.h"
 #include "core/queryresults/aggregationresult.h"
 #include "estl/overloaded.h"
+#include "tools/serilize/wrserializer.h"
 
 namespace {
 
@@ -232,13 +233,16 @@ Aggregator::Aggregator(Aggregator&&) noexcept = default;
 Aggregator::~Aggregator() = default;
 
 Aggregator::Aggregator(const PayloadType& payloadType, const FieldsSet& fields, AggType aggType, const h_vector<std::string, 1>& names,
-					   const h_vector<SortingEntry, 1>& sort, size_t limit, size_t offset, bool compositeIndexFields)
+					   const h_vector<SortingEntry, 1>& sort, size_t limit, size_t offset, bool compositeIndexFields,
+					   const h_vector<double, 1>& percentiles, bool keepSketch)
 	: payloadType_(payloadType),
 	  fields_(fields),
 	  aggType_(aggType),
 	  names_(names),
 	  limit_(limit),
 	  offset_(offset),
+	  percentiles_(percentiles),
+	  keepSketch_(keepSketch),
 	  compositeIndexFields_(compositeIndexFields) {
 	switch (aggType_) {
 		case AggFacet:
@@ -261,6 +265,19 @@ Aggregator::Aggregator(const PayloadType& payloadType, const FieldsSet& fields,
 							   DistinctHelpers::CompareVariantVector<DistinctHelpers::IsCompositeSupported::Yes>(payloadType, fields),
 							   DistinctHelpers::LessDistinctVector<DistinctHelpers::IsCompositeSupported::Yes>(payloadType, fields));
 			break;
+		case AggApproxCountDistinct:
+			sketch_ = std::make_unique<Sketch>(sketch::HyperLogLog{});
+			break;
+		case AggPercentile:
+			sketch_ = std::make_unique<Sketch>(sketch::TDigest{});
+			break;
+		case AggTopKApprox:
+			if (limit_ == QueryEntry::kDefaultLimit) {
+				limit_ = kDefaultTopK;
+			}
+			// Space-Saving guarantees the errors are less than N / capacity, so the capacity is taken with the reserve
+			sketch_ = std::make_unique<Sketch>(sketch::SpaceSaving{std::max<size_t>(100, limit_ * 10)});
+			break;
 		case AggMin:
 		case AggMax:
 		case AggAvg:
@@ -355,6 +372,28 @@ AggregationResult Aggregator::MoveResult() && {
 			}
 			return AggregationResult{aggType_, std::move(names_), std::move(payloadType_), std::move(fields_), std::move(d)};
 		}
+		case AggApproxCountDistinct:
+		case AggPercentile:
+		case AggTopKApprox: {
+			assertrx_dbg(sketch_);
+			WrSerializer ser;
+			std::visit(overloaded{[&ser](sketch::HyperLogLog& s) { s.Serialize(ser); }, [&ser](sketch::TDigest& s) { s.Serialize(ser); },
+								  [&ser, this](sketch::SpaceSaving& s) {
+									  ser.PutVarUint(limit_);
+									  s.Serialize(ser);
+								  }},
+					   *sketch_);
+			std::vector<PercentileResult> percentiles;
+			percentiles.reserve(percentiles_.size());
+			for (double rank : percentiles_) {
+				percentiles.push_back({rank, 0.0});
+			}
+			AggregationResult ret{aggType_, std::move(names_), std::string(ser.Slice()), std::move(percentiles)};
+			if (!keepSketch_) {
+				ret.FinalizeSketch();
+			}
+			return ret;
+		}
 		case AggCount:
 		case AggCountCached:
 		case AggUnknown:
@@ -446,6 +485,21 @@ void Aggregator::aggregate(const Variant& v) {
 			assertrx_dbg(distincts_);
 			distincts_->insert({v});  // NOLINT(bugprone-unchecked-optional-access)
 			break;
+		case AggApproxCountDistinct:
+			if (!v.IsNullValue()) {
+				std::get<sketch::HyperLogLog>(*sketch_).Add(sketch::HashValue(v));
+			}
+			break;
+		case AggPercentile:
+			if (!v.IsNullValue()) {
+				std::get<sketch::TDigest>(*sketch_).Add(v.As<double>());
+			}
+			break;
+		case AggTopKApprox:
+			if (!v.IsNullValue()) {
+				std::get<sketch::SpaceSaving>(*sketch_).Add(v.As<std::string>());
+			}
+			break;
 		case AggUnknown:
 		case AggCount:
 		case AggCountCached:
@@ -4,6 +4,7 @@
 #include "core/index/payload_map.h"
 #include "core/query/queryentry.h"
 #include "distincthelpers.h"
+#include "sketches.h"
 #include "estl/fast_hash_set.h"
 #include "vendor/cpp-btree/btree_map.h"
 
@@ -20,9 +21,13 @@ public:
 		enum { Count = -1 };
 	};
 
+	// Number of the items in the top_k_approx result, if the limit is not set
+	static constexpr size_t kDefaultTopK = 10;
+
 	Aggregator(const PayloadType&, const FieldsSet&, AggType aggType, const h_vector<std::string, 1>& names,
 			   const h_vector<SortingEntry, 1>& sort = {}, size_t limit = QueryEntry::kDefaultLimit,
-			   size_t offset = QueryEntry::kDefaultOffset, bool compositeIndexFields = false);
+			   size_t offset = QueryEntry::kDefaultOffset, bool compositeIndexFields = false, const h_vector<double, 1>& percentiles = {},
+			   bool keepSketch = false);
 	Aggregator(Aggregator&&) noexcept;
 	~Aggregator();
 
@@ -55,6 +60,7 @@ private:
 	using SinglefieldOrderedMap = btree::btree_map<Variant, int, SinglefieldComparator>;
 	using SinglefieldUnorderedMap = fast_hash_map<Variant, int>;
 	using Facets = std::variant<MultifieldOrderedMap, MultifieldUnorderedMap, SinglefieldOrderedMap, SinglefieldUnorderedMap>;
+	using Sketch = std::variant<sketch::HyperLogLog, sketch::TDigest, sketch::SpaceSaving>;
 
 	void aggregate(const Variant& variant);
 
@@ -68,6 +74,9 @@ private:
 	size_t offset_ = QueryEntry::kDefaultOffset;
 
 	std::unique_ptr<Facets> facets_;
+	std::unique_ptr<Sketch> sketch_;
+	h_vector<double, 1> percentiles_;
+	bool keepSketch_ = false;
 
 	std::vector<DistinctHelpers::DataType> distinctDataVector_;
 	bool isValid_ = true;
@@ -0,0 +1,204 @@
+#include "columnscan.h"
+#include <algorithm>
+#include "tools/assertrx.h"
+#include "tools/cpucheck.h"
+#include "tools/float_comparison.h"
+
+#if REINDEXER_WITH_SSE
+#include <immintrin.h>
+#endif	// REINDEXER_WITH_SSE
+
+namespace reindexer::comparators {
+
+template <typename T, CondType Cond>
+RX_ALWAYS_INLINE static bool matchScalar(T v, T value, T value2) noexcept {
+	if constexpr (Cond == CondEq) {
+		if constexpr (std::is_floating_point_v<T>) {
+			return fp::ExactlyEqual(v, value);
+		} else {
+			return v == value;
+		}
+	} else if constexpr (Cond == CondLt) {
+		return v < value;
+	} else if constexpr (Cond == CondLe) {
+		return v <= value;
+	} else if constexpr (Cond == CondGt) {
+		return v > value;
+	} else if constexpr (Cond == CondGe) {
+		return v >= value;
+	} else {
+		static_assert(Cond == CondRange);
+		return value <= v && v <= value2;
+	}
+}
+
+template <typename T, CondType Cond>
+static void compareScalar(const T* data, size_t count, T value, T value2, uint64_t* bitmap) noexcept {
+	CompareColumnScalar(data, count, bitmap, [value, value2](T v) noexcept { return matchScalar<T, Cond>(v, value, value2); });
+}
+
+#if REINDEXER_WITH_SSE
+
+// Lanes of the 256-bit register. Each Match() returns the bit mask of the lanes, satisfying the condition.
+// Non-strict integer comparisons are the negations of the strict ones. Floating point comparisons are ordered, i.e. they are false for NaN
+// in the same way as the scalar ones
+template <typename T>
+struct [[nodiscard]] Avx2Lanes;
+
+template <>
+struct [[nodiscard]] Avx2Lanes<int> {
+	using Vec = __m256i;
+	static constexpr size_t kCount = 8;
+	static constexpr unsigned kAll = 0xFF;
+
+	RX_AVX2_TARGET_ATTR static Vec Load(const int* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	RX_AVX2_TARGET_ATTR static Vec Set(int v) noexcept { return _mm256_set1_epi32(v); }
+	template <CondType Cond>
+	RX_AVX2_TARGET_ATTR static unsigned Match(Vec x, Vec v, Vec v2) noexcept {
+		if constexpr (Cond == CondEq) {
+			return mask(_mm256_cmpeq_epi32(x, v));
+		} else if constexpr (Cond == CondLt) {
+			return mask(_mm256_cmpgt_epi32(v, x));
+		} else if constexpr (Cond == CondLe) {
+			return ~mask(_mm256_cmpgt_epi32(x, v)) & kAll;
+		} else if constexpr (Cond == CondGt) {
+			return mask(_mm256_cmpgt_epi32(x, v));
+		} else if constexpr (Cond == CondGe) {
+			return ~mask(_mm256_cmpgt_epi32(v, x)) & kAll;
+		} else {
+			static_assert(Cond == CondRange);
+			return ~mask(_mm256_or_si256(_mm256_cmpgt_epi32(v, x), _mm256_cmpgt_epi32(x, v2))) & kAll;
+		}
+	}
+
+private:
+	RX_AVX2_TARGET_ATTR static unsigned mask(Vec m) noexcept { return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+};
+
+template <>
+struct [[nodiscard]] Avx2Lanes<int64_t> {
+	using Vec = __m256i;
+	static constexpr size_t kCount = 4;
+	static constexpr unsigned kAll = 0xF;
+
+	RX_AVX2_TARGET_ATTR static Vec Load(const int64_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	RX_AVX2_TARGET_ATTR static Vec Set(int64_t v) noexcept { return _mm256_set1_epi64x(v); }
+	template <CondType Cond>
+	RX_AVX2_TARGET_ATTR static unsigned Match(Vec x, Vec v, Vec v2) noexcept {
+		if constexpr (Cond == CondEq) {
+			return mask(_mm256_cmpeq_epi64(x, v));
+		} else if constexpr (Cond == CondLt) {
+			return mask(_mm256_cmpgt_epi64(v, x));
+		} else if constexpr (Cond == CondLe) {
+			return ~mask(_mm256_cmpgt_epi64(x, v)) & kAll;
+		} else if constexpr (Cond == CondGt) {
+			return mask(_mm256_cmpgt_epi64(x, v));
+		} else if constexpr (Cond == CondGe) {
+			return ~mask(_mm256_cmpgt_epi64(v, x)) & kAll;
+		} else {
+			static_assert(Cond == CondRange);
+			return ~mask(_mm256_or_si256(_mm256_cmpgt_epi64(v, x), _mm256_cmpgt_epi64(x, v2))) & kAll;
+		}
+	}
+
+private:
+	RX_AVX2_TARGET_ATTR static unsigned mask(Vec m) noexcept { return unsigned(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+};
+
+template <>
+struct [[nodiscard]] Avx2Lanes<double> {
+	using Vec = __m256d;
+	static constexpr size_t kCount = 4;
+
+	RX_AVX2_TARGET_ATTR static Vec Load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+	RX_AVX2_TARGET_ATTR static Vec Set(double v) noexcept { return _mm256_set1_pd(v); }
+	template <CondType Cond>
+	RX_AVX2_TARGET_ATTR static unsigned Match(Vec x, Vec v, Vec v2) noexcept {
+		if constexpr (Cond == CondEq) {
+			return mask(_mm256_cmp_pd(x, v, _CMP_EQ_OQ));
+		} else if constexpr (Cond == CondLt) {
+			return mask(_mm256_cmp_pd(x, v, _CMP_LT_OQ));
+		} else if constexpr (Cond == CondLe) {
+			return mask(_mm256_cmp_pd(x, v, _CMP_LE_OQ));
+		} else if constexpr (Cond == CondGt) {
+			return mask(_mm256_cmp_pd(x, v, _CMP_GT_OQ));
+		} else if constexpr (Cond == CondGe) {
+			return mask(_mm256_cmp_pd(x, v, _CMP_GE_OQ));
+		} else {
+			static_assert(Cond == CondRange);
+			return mask(_mm256_and_pd(_mm256_cmp_pd(x, v, _CMP_GE_OQ), _mm256_cmp_pd(x, v2, _CMP_LE_OQ)));
+		}
+	}
+
+private:
+	RX_AVX2_TARGET_ATTR static unsigned mask(Vec m) noexcept { return unsigned(_mm256_movemask_pd(m)); }
+};
+
+template <typename T, CondType Cond>
+RX_AVX2_TARGET_ATTR static void compareAVX2(const T* data, size_t count, T value, T value2, uint64_t* bitmap) noexcept {
+	using Lanes = Avx2Lanes<T>;
+	static_assert(64 % Lanes::kCount == 0);
+	const auto vec = Lanes::Set(value);
+	const auto vec2 = Lanes::Set(value2);
+	for (size_t from = 0; from < count; from += 64, ++bitmap) {
+		const T* block = data + from;
+		const size_t n = std::min<size_t>(64, count - from);
+		uint64_t word = 0;
+		size_t i = 0;
+		for (; i + Lanes::kCount <= n; i += Lanes::kCount) {
+			word |= uint64_t(Lanes::template Match<Cond>(Lanes::Load(block + i), vec, vec2)) << i;
+		}
+		for (; i < n; ++i) {
+			word |= uint64_t(matchScalar<T, Cond>(block[i], value, value2)) << i;
+		}
+		*bitmap = word;
+	}
+}
+
+#endif	// REINDEXER_WITH_SSE
+
+template <typename T, CondType Cond>
+static void compare(const T* data, size_t count, T value, T value2, uint64_t* bitmap) noexcept {
+#if REINDEXER_WITH_SSE
+	static const bool useAVX2 = IsAVX2Allowed();
+	if (useAVX2) {
+		compareAVX2<T, Cond>(data, count, value, value2, bitmap);
+		return;
+	}
+#endif	// REINDEXER_WITH_SSE
+	compareScalar<T, Cond>(data, count, value, value2, bitmap);
+}
+
+template <typename T>
+void CompareColumn(const T* data, size_t count, CondType cond, T value, T value2, uint64_t* bitmap) noexcept {
+	switch (cond) {
+		case CondEq:
+			return compare<T, CondEq>(data, count, value, value2, bitmap);
+		case CondLt:
+			return compare<T, CondLt>(data, count, value, value2, bitmap);
+		case CondLe:
+			return compare<T, CondLe>(data, count, value, value2, bitmap);
+		case CondGt:
+			return compare<T, CondGt>(data, count, value, value2, bitmap);
+		case CondGe:
+			return compare<T, CondGe>(data, count, value, value2, bitmap);
+		case CondRange:
+			return compare<T, CondRange>(data, count, value, value2, bitmap);
+		case CondAny:
+		case CondSet:
+		case CondAllSet:
+		case CondEmpty:
+		case CondLike:
+		case CondDWithin:
+		case CondKnn:
+		default:
+			assertrx_dbg(false);
+			std::fill_n(bitmap, ColumnBitmapWords(count), 0);
+	}
+}
+
+template void CompareColumn<int>(const int*, size_t, CondType, int, int, uint64_t*) noexcept;
+template void CompareColumn<int64_t>(const int64_t*, size_t, CondType, int64_t, int64_t, uint64_t*) noexcept;
+template void CompareColumn<double>(const double*, size_t, CondType, double, double, uint64_t*) noexcept;
+
+}  // namespace reindexer::comparators
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "core/type_consts.h"
+#include "estl/defines.h"
+
+namespace reindexer::comparators {
+
+// Result of the condition check over the column chunk's zone (min/max values)
+enum class [[nodiscard]] ZoneMatch { None, Some, All };
+
+// Selection bitmap of the column chunk: bit 'i % 64' of the word 'i / 64' is set, if the condition is true for the row 'i'.
+// The tail bits of the last word are always zero
+constexpr size_t ColumnBitmapWords(size_t count) noexcept { return (count + 63) / 64; }
+
+// Vectorized evaluation of the CondEq/CondLt/CondLe/CondGt/CondGe/CondRange conditions for 'count' values of the column.
+// For CondRange 'value' is the left boundary and 'value2' is the right one. Uses AVX2, if it is allowed, or the scalar fallback otherwise.
+// Implemented for int, int64_t and double columns
+template <typename T>
+void CompareColumn(const T* data, size_t count, CondType cond, T value, T value2, uint64_t* bitmap) noexcept;
+
+// Scalar evaluation of the arbitrary predicate for the conditions without the vectorized kernel
+template <typename T, typename Pred>
+RX_ALWAYS_INLINE void CompareColumnScalar(const T* data, size_t count, uint64_t* bitmap, const Pred& pred) {
+	for (size_t from = 0; from < count; from += 64, ++bitmap) {
+		const size_t n = (count - from < 64) ? (count - from) : 64;
+		uint64_t word = 0;
+		for (size_t i = 0; i < n; ++i) {
+			word |= uint64_t(pred(data[from + i])) << i;
+		}
+		*bitmap = word;
+	}
+}
+
+}  // namespace reindexer::comparators
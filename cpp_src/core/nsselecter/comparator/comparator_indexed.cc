@@ -1,4 +1,5 @@
 #include "comparator_indexed.h"
+#include <array>
 #include <cwchar>
 #include "core/formatters/key_string_fmt.h"
 #include "core/formatters/uuid_fmt.h"
@@ -564,6 +565,83 @@ std::string ComparatorIndexedJsonPathDWithinDistinct::ConditionStr() const { ret
 
 std::string ComparatorIndexedFloatVectorAny::ConditionStr() const { return anyComparatorCondStr(); }
 
+// Small sets are checked by the vectorized equality kernel for each of the values
+constexpr size_t kMaxVectorizedSetSize = 8;
+// Zone is compared with each of the set's values only for the sets of the limited size
+constexpr size_t kMaxZoneCheckedSetSize = 64;
+
+template <typename T>
+ZoneMatch ComparatorIndexedColumnScalar<T>::MatchZone(const typename ColumnZoneMap<T>::Zone& zone) const noexcept {
+	// Any comparison with the NaN bounds is false, so such zones are always matched partially
+	const T& min = zone.min;
+	const T& max = zone.max;
+	const T& value = this->value_;
+	switch (this->cond_) {
+		case CondEq:
+			if (value < min || max < value) {
+				return ZoneMatch::None;
+			}
+			return (SafeEqualWithFP(min, value) && SafeEqualWithFP(max, value)) ? ZoneMatch::All : ZoneMatch::Some;
+		case CondLt:
+			return (max < value) ? ZoneMatch::All : ((min >= value) ? ZoneMatch::None : ZoneMatch::Some);
+		case CondLe:
+			return (max <= value) ? ZoneMatch::All : ((min > value) ? ZoneMatch::None : ZoneMatch::Some);
+		case CondGt:
+			return (min > value) ? ZoneMatch::All : ((max <= value) ? ZoneMatch::None : ZoneMatch::Some);
+		case CondGe:
+			return (min >= value) ? ZoneMatch::All : ((max < value) ? ZoneMatch::None : ZoneMatch::Some);
+		case CondRange:
+			if (max < value || this->value2_ < min) {
+				return ZoneMatch::None;
+			}
+			return (value <= min && max <= this->value2_) ? ZoneMatch::All : ZoneMatch::Some;
+		case CondSet: {
+			assertrx_dbg(this->setPtr_);
+			const auto& set = *this->setPtr_;
+			if (set.size() > kMaxZoneCheckedSetSize) {
+				return ZoneMatch::Some;
+			}
+			if (std::none_of(set.cbegin(), set.cend(), [&min, &max](const T& v) noexcept { return !(v < min || max < v); })) {
+				return ZoneMatch::None;
+			}
+			return (SafeEqualWithFP(min, max) && set.find(min) != set.cend()) ? ZoneMatch::All : ZoneMatch::Some;
+		}
+		case CondAllSet:
+		case CondAny:
+		case CondEmpty:
+		case CondLike:
+		case CondDWithin:
+		case CondKnn:
+		default:
+			return ZoneMatch::Some;
+	}
+}
+
+template <typename T>
+void ComparatorIndexedColumnScalar<T>::CompareChunk(size_t from, size_t count, uint64_t* bitmap) const noexcept {
+	assertrx_dbg(count <= ColumnZoneMap<T>::kChunkSize);
+	const T* data = rawData_ + from;
+	if (this->cond_ != CondSet) {
+		CompareColumn(data, count, this->cond_, this->value_, this->value2_, bitmap);
+		return;
+	}
+	assertrx_dbg(this->setPtr_);
+	const auto& set = *this->setPtr_;
+	if (set.size() > kMaxVectorizedSetSize) {
+		CompareColumnScalar(data, count, bitmap, [&set](T v) noexcept { return set.find(v) != set.cend(); });
+		return;
+	}
+	const size_t words = ColumnBitmapWords(count);
+	std::fill_n(bitmap, words, 0);
+	std::array<uint64_t, ColumnBitmapWords(ColumnZoneMap<T>::kChunkSize)> matched;
+	for (const T& v : set) {
+		CompareColumn(data, count, CondEq, v, v, matched.data());
+		for (size_t i = 0; i < words; ++i) {
+			bitmap[i] |= matched[i];
+		}
+	}
+}
+
 }  // namespace comparators
 
 template <typename T>
@@ -583,6 +661,33 @@ std::string ComparatorIndexed<FloatVector>::ConditionStr() const {
 	return std::visit([](const auto& impl) { return impl.ConditionStr(); }, impl_);
 }
 
+template <typename T>
+bool ComparatorIndexed<T>::IsColumnScanAvailable(size_t rows) const noexcept {
+	const auto* impl = std::get_if<comparators::ComparatorIndexedColumnScalar<T>>(&impl_);
+	return impl && columnZones_ && columnZones_->Rows() >= rows && impl->IsColumnScanSupported();
+}
+
+template <typename T>
+comparators::ZoneMatch ComparatorIndexed<T>::MatchColumnZone(size_t chunk) const noexcept {
+	assertrx_dbg(columnZones_);
+	return std::get_if<comparators::ComparatorIndexedColumnScalar<T>>(&impl_)->MatchZone(columnZones_->ChunkZone(chunk));
+}
+
+template <typename T>
+void ComparatorIndexed<T>::CompareColumnChunk(size_t chunk, size_t count, uint64_t* bitmap) const noexcept {
+	std::get_if<comparators::ComparatorIndexedColumnScalar<T>>(&impl_)->CompareChunk(chunk * ColumnZoneMap<T>::kChunkSize, count, bitmap);
+}
+
+template bool ComparatorIndexed<int>::IsColumnScanAvailable(size_t) const noexcept;
+template bool ComparatorIndexed<int64_t>::IsColumnScanAvailable(size_t) const noexcept;
+template bool ComparatorIndexed<double>::IsColumnScanAvailable(size_t) const noexcept;
+template comparators::ZoneMatch ComparatorIndexed<int>::MatchColumnZone(size_t) const noexcept;
+template comparators::ZoneMatch ComparatorIndexed<int64_t>::MatchColumnZone(size_t) const noexcept;
+template comparators::ZoneMatch ComparatorIndexed<double>::MatchColumnZone(size_t) const noexcept;
+template void ComparatorIndexed<int>::CompareColumnChunk(size_t, size_t, uint64_t*) const noexcept;
+template void ComparatorIndexed<int64_t>::CompareColumnChunk(size_t, size_t, uint64_t*) const noexcept;
+template void ComparatorIndexed<double>::CompareColumnChunk(size_t, size_t, uint64_t*) const noexcept;
+
 template <typename T>
 comparators::ComparatorIndexedVariant<T> ComparatorIndexed<T>::createImpl(CondType cond, const VariantArray& values, const void* rawData,
 																		  reindexer::IsDistinct distinct, IsArray isArray,
@@ -2,9 +2,11 @@
 
 #include <variant>
 
+#include "columnscan.h"
 #include "comparator_indexed_distinct.h"
 #include "const.h"
 #include "core/id_type.h"
+#include "core/index/columnzonemap.h"
 #include "core/index/payload_map.h"
 #include "core/index/string_map.h"
 #include "core/keyvalue/geometry.h"
@@ -232,6 +234,31 @@ public:
 	reindexer::IsDistinct IsDistinct() const noexcept { return IsDistinct_False; }
 	void ExcludeDistinctValues(const PayloadValue&, IdType /*rowId*/) const noexcept {}
 
+	// Vectorized evaluation of the condition for the column chunks. Implemented for int, int64_t and double columns only
+	bool IsColumnScanSupported() const noexcept {
+		switch (this->cond_) {
+			case CondEq:
+			case CondLt:
+			case CondLe:
+			case CondGt:
+			case CondGe:
+			case CondRange:
+			case CondSet:
+				return true;
+			case CondAllSet:
+			case CondAny:
+			case CondEmpty:
+			case CondLike:
+			case CondDWithin:
+			case CondKnn:
+			default:
+				return false;
+		}
+	}
+	ZoneMatch MatchZone(const typename ColumnZoneMap<T>::Zone&) const noexcept;
+	// Writes the selection bitmap of the column's rows [from, from + count). 'count' is limited by the zone map's chunk size
+	void CompareChunk(size_t from, size_t count, uint64_t* bitmap) const noexcept;
+
 private:
 	const T* rawData_;
 };
@@ -1784,8 +1811,10 @@ class [[nodiscard]] ComparatorIndexed {
 public:
 	ComparatorIndexed(std::string_view indexName, CondType cond, const VariantArray& values, const void* rawData, IsArray isArray,
 					  reindexer::IsDistinct distinct, const PayloadType& payloadType, const FieldsSet& fields,
-					  const CollateOpts& collateOpts = CollateOpts())
-		: impl_{createImpl(cond, values, rawData, distinct, isArray, payloadType, fields, collateOpts)}, indexName_{indexName} {}
+					  const CollateOpts& collateOpts = CollateOpts(), const ColumnZoneMap<T>* columnZones = nullptr)
+		: impl_{createImpl(cond, values, rawData, distinct, isArray, payloadType, fields, collateOpts)},
+		  indexName_{indexName},
+		  columnZones_{columnZones} {}
 
 	std::string_view Name() const noexcept { return indexName_; }
 	std::string ConditionStr() const;
@@ -1794,6 +1823,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const ComparatorIndexed& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	double Cost(double expectedIterations) const noexcept {
 		const auto val = expectedIterations * costMultiplier();
 		return val + 1.0 + (isNotOperation_ ? val : 0.0);
@@ -1884,6 +1917,13 @@ public:
 	}
 	bool IsIndexed() const noexcept { return true; }
 
+	// Vectorized chunk by chunk scan of the column. Available for the int, int64_t and double scalar columns with the zone maps only.
+	// 'rows' is the count of the scanned rows, which have to be covered by the column
+	bool IsColumnScanAvailable(size_t rows) const noexcept;
+	comparators::ZoneMatch MatchColumnZone(size_t chunk) const noexcept;
+	// Writes the selection bitmap of the chunk's first 'count' rows
+	void CompareColumnChunk(size_t chunk, size_t count, uint64_t* bitmap) const noexcept;
+
 private:
 	static comparators::ComparatorIndexedVariant<T> createImpl(CondType cond, const VariantArray&, const void* rawData,
 															   reindexer::IsDistinct distinct, IsArray isArray, const PayloadType&,
@@ -1901,6 +1941,7 @@ private:
 	int matchedCount_{0};
 	comparators::ComparatorIndexedVariant<T> impl_;
 	std::string_view indexName_;
+	const ColumnZoneMap<T>* columnZones_{nullptr};
 	bool isNotOperation_{false};
 };
 
@@ -283,6 +283,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const ComparatorNotIndexed& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	double Cost(double expectedIterations) const noexcept {
 		return comparators::kNonIdxFieldComparatorCostMultiplier * double(expectedIterations) + 1.0 +
 			   (isNotOperation_ ? expectedIterations : 0.0);
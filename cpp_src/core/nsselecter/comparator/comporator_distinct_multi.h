@@ -22,6 +22,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const ComparatorDistinctMulti& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	double Cost(double expectedIterations) const noexcept { return expectedIterations + 2.0; }
 	bool Compare(const PayloadValue& item, IdType rowId);
 	void ExcludeDistinctValues(const PayloadValue& item, IdType rowId);
@@ -67,6 +71,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const ComparatorDistinctMultiScalarBase& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	double Cost(double expectedIterations) const noexcept { return expectedIterations + 2.0; }
 	bool Compare(const PayloadValue& item, IdType rowId) {
 		++totalCalls_;
@@ -209,6 +217,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const ComparatorDistinctMultiArray& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	double Cost(double expectedIterations) const noexcept { return expectedIterations + 2.0; }
 	bool Compare(const PayloadValue& item, IdType rowId);
 	void ExcludeDistinctValues(const PayloadValue& item, IdType rowId);
@@ -37,6 +37,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const EqualPositionComparator& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	int FieldsCount() const noexcept { return ctx_.size(); }
 	const std::string& Name() const& noexcept { return name_; }
 	const std::string& Dump() const& noexcept { return Name(); }
@@ -131,6 +135,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const GroupingEqualPositionComparator& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	int FieldsCount() const noexcept { return ctx_.size(); }
 	const std::string& Name() const& noexcept { return name_; }
 	const std::string& Dump() const& noexcept { return Name(); }
@@ -56,6 +56,10 @@ public:
 		assertrx_dbg(totalCalls_ >= matchedCount_);
 		return invert ? (totalCalls_ - matchedCount_) : matchedCount_;
 	}
+	void MergeMatchedCount(const FieldsComparator& other) noexcept {
+		totalCalls_ += other.totalCalls_;
+		matchedCount_ += other.matchedCount_;
+	}
 	void ExcludeDistinctValues(const PayloadValue& /*item*/, IdType /*rowId*/) const noexcept {}
 	reindexer::IsDistinct IsDistinct() const noexcept { return IsDistinct_False; }
 
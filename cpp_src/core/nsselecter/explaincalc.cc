@@ -64,12 +64,15 @@ void SingleQueryExplainCalc::LogDump(int logLevel) {
 
 		if (jitemsprocessors_) {
 			for (auto& js : *jitemsprocessors_) {
-				if (js.Type() == JoinType::LeftJoin || js.Type() == JoinType::Merge) {
+				if (js.Type() == JoinType::Merge) {
 					logFmt(LogInfo, "{} {}: called {}", joins::JoinTypeName(js.Type()), js.RightNsName(), js.Called());
+				} else if (js.Type() == JoinType::LeftJoin) {
+					logFmt(LogInfo, "{} {}: called {}, strategy {}", joins::JoinTypeName(js.Type()), js.RightNsName(), js.Called(),
+						   joins::JoinStrategyName(js.Strategy()));
 				} else {
 					// Using js.Matched(false), because there are no information about actual operation
-					logFmt(LogInfo, "{} {}: called {}, matched {}", joins::JoinTypeName(js.Type()), js.RightNsName(), js.Called(),
-						   js.Matched(false));
+					logFmt(LogInfo, "{} {}: called {}, matched {}, strategy {}", joins::JoinTypeName(js.Type()), js.RightNsName(),
+						   js.Called(), js.Matched(false), joins::JoinStrategyName(js.Strategy()));
 				}
 			}
 		}
@@ -200,6 +203,11 @@ static std::string addToJSON(JsonBuilder& builder, const joins::ItemsProcessor&
 									  jsonSel.Put("keys"sv, iterators.Size());
 								  }},
 					   js.PreSelectResults().payload);
+			jsonSel.Put("join_strategy"sv, joins::JoinStrategyName(js.Strategy()));
+			if (js.Strategy() != joins::JoinStrategy::NestedLoop) {
+				jsonSel.Put("join_build_us"sv, To_us(js.KeyJoinBuildTime()));
+				jsonSel.Put("join_probe_us"sv, To_us(js.KeyJoinProbeTime()));
+			}
 			if (!js.PreSelectResults().explainPreSelect.empty()) {
 				jsonSel.Raw("explain_preselect"sv, js.PreSelectResults().explainPreSelect);
 			}
@@ -404,6 +412,9 @@ std::string SelectIteratorContainer::explainJSON(const_iterator begin, const_ite
 				jsonSel.Put("matched"sv, siter.GetMatchedCount(it->operation == OpNot));
 				jsonSel.Put("method"sv, method(isScanIterator, siter.IsCached()));
 				jsonSel.Put("type"sv, siter.TypeName());
+				if (siter.IntersectedCount()) {
+					jsonSel.Put("intersected_with"sv, siter.IntersectedCount());
+				}
 				name << opName(it->operation, it == begin) << siter.name;
 			},
 			[&](const JoinSelectIterator& jiter) {
@@ -471,4 +482,17 @@ std::string SelectIteratorContainer::explainJSON(const_iterator begin, const_ite
 	return name.str();
 }
 
+void SelectIteratorContainer::explainParallelScanJSON(int iters, JsonBuilder& builder,
+													  const std::vector<joins::ItemsProcessor>* jitemsprocessors) const {
+	using namespace std::string_view_literals;
+
+	auto jsonSel = builder.Object();
+	auto jsonSelArr = jsonSel.Array("selectors"sv);
+	const std::string name{explainJSON(parallelScanned_.cbegin(), parallelScanned_.cend(), iters, jsonSelArr, jitemsprocessors)};
+	jsonSelArr.End();
+	jsonSel.Put("field"sv, "-parallel-scan" + name);
+	jsonSel.Put("method"sv, "scan"sv);
+	jsonSel.Put("type"sv, "ParallelScan"sv);
+}
+
 }  // namespace reindexer
@@ -325,9 +325,9 @@ ComparationResult ItemComparator::compareFields(IdType lId, IdType rId, size_t&
 			cmpRes =
 				values.first.template Compare<NotComparable::Throw, kDefaultNullsHandling>(values.second, opts ? *opts : CollateOpts());
 		} else {
-			cmpRes = ConstPayload(ns_.payloadType_, ns_.items_[lId])
+			cmpRes = ConstPayload(ns_.payloadType_, NsSelecter::ItemPayload(ns_, ctx_, lId))
 						 .CompareField<WithString::No, NotComparable::Throw, kDefaultNullsHandling>(
-							 ns_.items_[rId], field, fields_, tagPathIdx, opts ? *opts : CollateOpts());
+							 NsSelecter::ItemPayload(ns_, ctx_, rId), field, fields_, tagPathIdx, opts ? *opts : CollateOpts());
 		}
 		if (cmpRes != ComparationResult::Eq) {
 			firstDifferentFieldIdx = i;
@@ -16,6 +16,8 @@ using namespace reindexer;
 
 namespace {
 constexpr size_t kMaxIterationsScaleForInnerJoinOptimization = 100;
+// Expected cost of the single nested loop join's select (in the scanned rows) without the cost of the preselected rows scan
+constexpr int64_t kNestedLoopSelectCost = 64;
 
 bool isSortedByJoinedField(std::string_view sortExpr, std::string_view joinedNs) {
 	constexpr static estl::Charset kJoinedIndexNameSyms{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q',
@@ -81,6 +83,38 @@ bool ItemsProcessor::Process(IdType rowId, int nsId, ConstPayload payload, Float
 	}
 
 	const auto startTime = Explain::Clock::now();
+	const unsigned limit = (withJoinedItems && !limit0_) ? joinQuery_.Limit() : 0;
+	bool found = false;
+	bool matchedAtLeastOnce = false;
+	LocalQueryResults joinItemR;
+	if (const auto matched = selectByKeyJoin(payload, limit, joinItemR); matched) {
+		found = joinItemR.Count();
+		matchedAtLeastOnce = *matched;
+	} else {
+		selectByItemQuery(payload, limit, floatVectorsHolder, joinItemR, found, matchedAtLeastOnce);
+	}
+	if (withJoinedItems && found) {
+		assertrx_throw(nsId < static_cast<int>(result_.joined_.size()));
+		joins::NamespaceResults& nsJoinRes = result_.joined_[nsId];
+		assertrx_dbg(nsJoinRes.GetJoinItemsProcessorsCount());
+		if (floatVectorsHolder) {
+			std::visit(overloaded{[&](const PreSelect::Values&) noexcept {},
+								  [&]<concepts::OneOf<IdSetPlain, SelectIteratorContainer> T>(const T&) {
+									  floatVectorsHolder->Add(*RightNs(), joinItemR.begin(), joinItemR.end(), fieldsFilter_);
+								  }},
+					   PreSelectResults().payload);
+		}
+		nsJoinRes.Insert(rowId, joinedFieldIdx_, std::move(joinItemR));
+	}
+	if (matchedAtLeastOnce) {
+		++matched_;
+	}
+	selectTime_ += (Explain::Clock::now() - startTime);
+	return matchedAtLeastOnce;
+}
+
+void ItemsProcessor::selectByItemQuery(ConstPayload payload, unsigned limit, FloatVectorsHolderMap* floatVectorsHolder,
+									   LocalQueryResults& joinItemR, bool& found, bool& matchedAtLeastOnce) {
 	// Put values to join conditions
 	size_t i = 0;
 	if (itemQuery_.NeedExplain() && !explainOneSelect_.empty()) {
@@ -123,34 +157,98 @@ bool ItemsProcessor::Process(IdType rowId, int nsId, ConstPayload payload, Float
 
 		i += changedCount;
 	}
-	itemQueryPtr->Limit((withJoinedItems && !limit0_) ? joinQuery_.Limit() : 0);
+	itemQueryPtr->Limit(limit);
 
-	bool found = false;
-	bool matchedAtLeastOnce = false;
-	LocalQueryResults joinItemR;
 	std::visit(overloaded{[&](const PreSelect::Values&) { selectFromPreSelectValues(joinItemR, *itemQueryPtr, found, matchedAtLeastOnce); },
 						  [&]<concepts::OneOf<IdSetPlain, SelectIteratorContainer> T>(const T&) {
 							  selectFromRightNs(joinItemR, *itemQueryPtr, floatVectorsHolder, found, matchedAtLeastOnce);
 						  }},
 			   PreSelectResults().payload);
-	if (withJoinedItems && found) {
-		assertrx_throw(nsId < static_cast<int>(result_.joined_.size()));
-		joins::NamespaceResults& nsJoinRes = result_.joined_[nsId];
-		assertrx_dbg(nsJoinRes.GetJoinItemsProcessorsCount());
-		if (floatVectorsHolder) {
-			std::visit(overloaded{[&](const PreSelect::Values&) noexcept {},
-								  [&]<concepts::OneOf<IdSetPlain, SelectIteratorContainer> T>(const T&) {
-									  floatVectorsHolder->Add(*RightNs(), joinItemR.begin(), joinItemR.end(), fieldsFilter_);
-								  }},
-					   PreSelectResults().payload);
+}
+
+std::optional<bool> ItemsProcessor::selectByKeyJoin(const ConstPayload& payload, unsigned limit, LocalQueryResults& joinItemR) {
+	if (!keyJoin_) {
+		if (!keyJoinCandidate_) {
+			keyJoinCandidate_ = chooseKeyJoinStrategy();
+		}
+		if (*keyJoinCandidate_ == JoinStrategy::NestedLoop) {
+			return std::nullopt;
+		}
+		const auto& preselect = PreSelectResults();
+		const auto& ids = std::get<IdSetPlain>(preselect.payload);
+		// Building of the key join costs about the single scan of the preselected rows. It pays off, when the nested loop join would
+		// have already spent the same time on the selects of the processed items
+		if (int64_t(called_) * nestedLoopSelectCost_ < int64_t(ids.Size())) {
+			return std::nullopt;
+		}
+		const auto startTime = Explain::Clock::now();
+		const std::vector<IdType>* sortOrders = preselect.sortOrder.index ? &preselect.sortOrder.index->SortOrders() : nullptr;
+		std::vector<IdType> rows;
+		rows.reserve(ids.Size());
+		for (IdType id : ids) {
+			rows.emplace_back(sortOrders ? (*sortOrders)[id.ToNumber()] : id);
+		}
+		h_vector<KeyValueType, 1> keyTypes;
+		for (const auto& je : joinQuery_.joinEntries_) {
+			keyTypes.emplace_back(je.IsRightFieldIndexed() ? je.RightFieldType() : KeyValueType::Undefined{});
+		}
+		auto keyJoin = std::make_unique<KeyJoin>(*keyJoinCandidate_, joinQuery_, std::move(keyTypes), rightNs_->payloadType_,
+												 rightNs_->items_);
+		const bool built = keyJoin->Build(rows);
+		keyJoinBuildTime_ = Explain::Clock::now() - startTime;
+		if (!built) {
+			keyJoinCandidate_ = JoinStrategy::NestedLoop;
+			return std::nullopt;
+		}
+		keyJoin_ = std::move(keyJoin);
+		rightNs_->getInsideFromJoinCache(joinRes_);
+		if (joinRes_.needPut) {
+			rightNs_->putToJoinCache(joinRes_, preSelectCtx_.ResultPtr());
 		}
-		nsJoinRes.Insert(rowId, joinedFieldIdx_, std::move(joinItemR));
 	}
-	if (matchedAtLeastOnce) {
-		++matched_;
+	const auto startTime = Explain::Clock::now();
+	auto matched = keyJoin_->Probe(payload, limit, joinItemR);
+	keyJoinProbeTime_ += Explain::Clock::now() - startTime;
+	return matched;
+}
+
+JoinStrategy ItemsProcessor::chooseKeyJoinStrategy() {
+	const auto& preselect = PreSelectResults();
+	const auto* ids = std::get_if<IdSetPlain>(&preselect.payload);
+	if (!ids || !rightNs_ || preSelectCtx_.Mode() != PreSelectMode::Execute) {
+		return JoinStrategy::NestedLoop;
 	}
-	selectTime_ += (Explain::Clock::now() - startTime);
-	return matchedAtLeastOnce;
+	// Joined items are returned in the order of the preselect
+	const auto& sortingEntries = joinQuery_.GetSortingEntries();
+	if (!sortingEntries.empty() && (sortingEntries.size() > 1 || !preselect.sortOrder.index || *sortingEntries[0].desc)) {
+		return JoinStrategy::NestedLoop;
+	}
+	bool withScan = false;
+	for (const QueryJoinEntry& je : joinQuery_.joinEntries_) {
+		if (je.Operation() != OpAnd || (je.Condition() != CondEq && je.Condition() != CondSet) ||
+			je.LeftFieldType().Is<KeyValueType::Composite>() || je.RightFieldType().Is<KeyValueType::Composite>()) {
+			return JoinStrategy::NestedLoop;
+		}
+		if (je.IsRightFieldIndexed()) {
+			const Index& index = *rightNs_->indexes_[je.RightIdxNo()];
+			if (IsFullText(index.Type()) || IsComposite(index.Type()) || index.Opts().GetCollateMode() != CollateNone) {
+				return JoinStrategy::NestedLoop;
+			}
+			// Store indexes have no lookup: the nested loop join scans all of the preselected rows
+			withScan = withScan || IsStore(index.Type());
+		} else {
+			withScan = true;
+		}
+	}
+	nestedLoopSelectCost_ = kNestedLoopSelectCost + (withScan ? int64_t(ids->Size()) : 0);
+
+	// The merge join doesn't require the hashing, if the rows are preselected in the order of the numeric join field
+	const QueryJoinEntry& keyEntry = joinQuery_.joinEntries_[0];
+	if (keyEntry.IsRightFieldIndexed() && preselect.sortOrder.index == rightNs_->indexes_[keyEntry.RightIdxNo()].get() &&
+		keyEntry.RightFieldType().IsOneOf<KeyValueType::Int, KeyValueType::Int64, KeyValueType::Double>()) {
+		return JoinStrategy::Merge;
+	}
+	return JoinStrategy::Hash;
 }
 
 void ItemsProcessor::BuildSelectIteratorsOfIndexedFields(int* maxIterations, unsigned sortId, const FtFunction::Ptr& ftFunc,
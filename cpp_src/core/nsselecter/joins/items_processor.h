@@ -3,6 +3,7 @@
 #include "core/nsselecter/explaincalc.h"
 #include "core/nsselecter/joins/cache.h"
 #include "core/queryresults/fields_filter.h"
+#include "key_join.h"
 #include "preselect.h"
 
 namespace reindexer {
@@ -83,6 +84,9 @@ public:
 	PreSelectMode PreSelectStrategy() const noexcept { return preSelectCtx_.Mode(); }
 	const NamespaceImpl::Ptr& RightNs() const noexcept { return rightNs_; }
 	Explain::Duration SelectTime() const noexcept { return selectTime_; }
+	JoinStrategy Strategy() const noexcept { return keyJoin_ ? keyJoin_->Strategy() : JoinStrategy::NestedLoop; }
+	Explain::Duration KeyJoinBuildTime() const noexcept { return keyJoinBuildTime_; }
+	Explain::Duration KeyJoinProbeTime() const noexcept { return keyJoinProbeTime_; }
 	const std::string& ExplainOneSelect() const& noexcept { return explainOneSelect_; }
 
 	auto ExplainOneSelect() const&& = delete;
@@ -93,6 +97,10 @@ private:
 	VariantArray readValuesFromPreSelect(const QueryJoinEntry&) const;
 	template <typename Cont, typename Fn>
 	VariantArray readValuesOfRightNsFrom(const Cont& from, const Fn& createPayload, const QueryJoinEntry&, const PayloadType&) const;
+	void selectByItemQuery(ConstPayload, unsigned limit, FloatVectorsHolderMap*, LocalQueryResults& joinItemR, bool& found,
+						   bool& matchedAtLeastOnce);
+	std::optional<bool> selectByKeyJoin(const ConstPayload&, unsigned limit, LocalQueryResults& joinItemR);
+	JoinStrategy chooseKeyJoinStrategy();
 	void selectFromRightNs(LocalQueryResults& joinItemR, const Query&, FloatVectorsHolderMap*, bool& found, bool& matchedAtLeastOnce);
 	void selectFromPreSelectValues(LocalQueryResults& joinItemR, const Query&, bool& found, bool& matchedAtLeastOnce) const;
 
@@ -119,6 +127,12 @@ private:
 	Explain::Duration selectTime_ = Explain::Duration::zero();
 	SetLimit0ForChangeJoin limit0_ = SetLimit0ForChangeJoin_False;
 	VariantArray tmpValues_;
+	// Key (hash or merge) join is chosen lazily, when the count of the processed items makes it cheaper than the nested loop join
+	std::optional<JoinStrategy> keyJoinCandidate_;
+	int64_t nestedLoopSelectCost_ = 0;
+	std::unique_ptr<KeyJoin> keyJoin_;
+	Explain::Duration keyJoinBuildTime_ = Explain::Duration::zero();
+	Explain::Duration keyJoinProbeTime_ = Explain::Duration::zero();
 };
 using ItemsProcessors = std::vector<ItemsProcessor>;
 
@@ -0,0 +1,292 @@
+#include "key_join.h"
+#include <algorithm>
+#include <limits>
+#include "core/queryresults/localqueryresults.h"
+#include "estl/algorithm.h"
+
+namespace reindexer::joins {
+
+constexpr static uint32_t kNoGroup = std::numeric_limits<uint32_t>::max();
+
+std::string_view JoinStrategyName(JoinStrategy strategy) noexcept {
+	using namespace std::string_view_literals;
+	switch (strategy) {
+		case JoinStrategy::NestedLoop:
+			return "nested_loop"sv;
+		case JoinStrategy::Hash:
+			return "hash"sv;
+		case JoinStrategy::Merge:
+			return "merge"sv;
+	}
+	assertrx(false);
+	return "unknown"sv;
+}
+
+// Numbers, which are equal in the relaxed comparison, have to get the same hash regardless of their types
+static size_t numberHash(double v) noexcept {
+	// -0.0 + 0.0 is 0.0
+	return std::hash<double>()(v + 0.0);
+}
+
+KeyJoin::KeyJoin(JoinStrategy strategy, const JoinedQuery& joinQuery, h_vector<KeyValueType, 1>&& keyTypes,
+				 const PayloadType& rightPayloadType, const std::vector<PayloadValue>& rightItems)
+	: strategy_{strategy},
+	  joinQuery_{joinQuery},
+	  keyTypes_{std::move(keyTypes)},
+	  payloadType_{rightPayloadType},
+	  items_{rightItems},
+	  leftValues_(joinQuery.joinEntries_.size()) {
+	assertrx_throw(strategy_ != JoinStrategy::NestedLoop);
+	assertrx_throw(keyTypes_.size() == joinQuery_.joinEntries_.size());
+}
+
+bool KeyJoin::Build(std::span<const IdType> rows) {
+	rows_.assign(rows.begin(), rows.end());
+	if (rows_.size() >= kNoGroup) {
+		return false;
+	}
+	std::vector<std::pair<uint32_t, uint32_t>> links;  // Group and position of each of the rows' values
+	links.reserve(rows_.size());
+	if (!buildGroups(links)) {
+		return false;
+	}
+	if (strategy_ == JoinStrategy::Merge) {
+		sortGroups(links);
+	}
+	// While building, 'end' is the count of the group's positions
+	uint32_t offset = 0;
+	for (Group& g : groups_) {
+		g.begin = offset;
+		offset += g.end;
+		g.end = g.begin;
+	}
+	positions_.resize(offset);
+	for (const auto& [group, position] : links) {
+		positions_[groups_[group].end++] = position;
+	}
+	return true;
+}
+
+bool KeyJoin::buildGroups(std::vector<std::pair<uint32_t, uint32_t>>& links) {
+	const QueryJoinEntry& entry = joinQuery_.joinEntries_[0];
+	for (uint32_t position = 0, size = rows_.size(); position < size; ++position) {
+		const PayloadValue& pv = items_[rows_[position].ToNumber()];
+		if (pv.IsFree()) {
+			continue;
+		}
+		ConstPayload{payloadType_, pv}.GetByFieldsSet(entry.RightFields(), buffer_, entry.RightFieldType(),
+													  entry.RightCompositeFieldsTypes());
+		for (Variant& v : buffer_) {
+			if (v.IsNullValue()) {
+				continue;
+			}
+			if (!normalize(v, 0)) {
+				return false;
+			}
+			const auto h = hash(v, 0);
+			if (!h) {
+				return false;
+			}
+			const auto it = heads_.find(*h);
+			uint32_t group = (it == heads_.end()) ? kNoGroup : it->second;
+			// Groups are built by the exact values (with the same type), the relaxed comparison is used for the probe only
+			while (group != kNoGroup && !(groups_[group].key.Type().IsSame(v.Type()) && keysEqual(groups_[group].key, v))) {
+				group = groups_[group].next;
+			}
+			if (group == kNoGroup) {
+				group = groups_.size();
+				const uint32_t next = (it == heads_.end()) ? kNoGroup : it->second;
+				groups_.emplace_back(Group{.key = std::move(v), .next = next, .begin = 0, .end = 0});
+				heads_[*h] = group;
+			} else if (groups_[group].begin == position + 1) {
+				// The same value in the array field of the same row
+				continue;
+			}
+			groups_[group].begin = position + 1;
+			++groups_[group].end;
+			links.emplace_back(group, position);
+		}
+	}
+	return true;
+}
+
+void KeyJoin::sortGroups(std::vector<std::pair<uint32_t, uint32_t>>& links) {
+	heads_ = {};
+	const auto less = [](const Group& lhs, const Group& rhs) { return keysLess(lhs.key, rhs.key); };
+	// The rows are usually preselected in the order of the join field already
+	if (std::is_sorted(groups_.begin(), groups_.end(), less)) {
+		return;
+	}
+	std::vector<uint32_t> order(groups_.size());
+	for (uint32_t i = 0, size = order.size(); i < size; ++i) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) { return less(groups_[lhs], groups_[rhs]); });
+	std::vector<uint32_t> newIndexes(groups_.size());
+	std::vector<Group> sorted;
+	sorted.reserve(groups_.size());
+	for (uint32_t group : order) {
+		newIndexes[group] = sorted.size();
+		sorted.emplace_back(std::move(groups_[group]));
+	}
+	groups_ = std::move(sorted);
+	for (auto& link : links) {
+		link.first = newIndexes[link.first];
+	}
+}
+
+std::optional<bool> KeyJoin::Probe(const ConstPayload& left, unsigned limit, LocalQueryResults& result) {
+	const auto& entries = joinQuery_.joinEntries_;
+	for (size_t i = 0, size = entries.size(); i < size; ++i) {
+		VariantArray& values = leftValues_[i];
+		left.GetByFieldsSet(entries[i].LeftFields(), values, entries[i].LeftFieldType(), entries[i].LeftCompositeFieldsTypes());
+		values.erase(unstable_remove_if(values.begin(), values.end(), [](const Variant& v) noexcept { return v.IsNullValue(); }),
+					 values.cend());
+		if (values.empty()) {
+			return false;
+		}
+		for (Variant& v : values) {
+			if (!normalize(v, i)) {
+				return std::nullopt;
+			}
+		}
+	}
+
+	matchedGroups_.clear();
+	for (const Variant& key : leftValues_[0]) {
+		if (strategy_ == JoinStrategy::Merge) {
+			findMergeGroups(key);
+		} else if (!findGroups(key)) {
+			return std::nullopt;
+		}
+	}
+	if (matchedGroups_.empty()) {
+		return false;
+	}
+	std::span<const uint32_t> positions;
+	if (matchedGroups_.size() == 1) {
+		const Group& g = groups_[matchedGroups_[0]];
+		positions = {positions_.data() + g.begin, positions_.data() + g.end};
+	} else {
+		// The rows have to be returned in the order of the preselect as for the nested loop join
+		candidates_.clear();
+		for (uint32_t group : matchedGroups_) {
+			const Group& g = groups_[group];
+			candidates_.insert(candidates_.end(), positions_.begin() + g.begin, positions_.begin() + g.end);
+		}
+		std::sort(candidates_.begin(), candidates_.end());
+		candidates_.erase(std::unique(candidates_.begin(), candidates_.end()), candidates_.end());
+		positions = candidates_;
+	}
+
+	bool matched = false;
+	unsigned count = 0;
+	for (uint32_t position : positions) {
+		if (entries.size() > 1 && !matchOtherEntries(position)) {
+			continue;
+		}
+		matched = true;
+		if (count >= limit) {
+			break;
+		}
+		const IdType rowId = rows_[position];
+		result.AddItemRef(rowId, items_[rowId.ToNumber()]);
+		++count;
+	}
+	return matched;
+}
+
+bool KeyJoin::findGroups(const Variant& key) {
+	const auto h = hash(key, 0);
+	if (!h) {
+		return false;
+	}
+	const auto it = heads_.find(*h);
+	if (it == heads_.end()) {
+		return true;
+	}
+	for (uint32_t group = it->second; group != kNoGroup; group = groups_[group].next) {
+		if (keysEqual(groups_[group].key, key)) {
+			matchedGroups_.emplace_back(group);
+		}
+	}
+	return true;
+}
+
+void KeyJoin::findMergeGroups(const Variant& key) {
+	size_t from = 0;
+	if (mergeKey_ && !keysLess(key, *mergeKey_)) {
+		// The left items are ordered by the join field: continue from the previous position
+		from = mergeCursor_;
+	}
+	// Exponential search of the range, containing the lower bound
+	size_t to = from;
+	for (size_t step = 1; to < groups_.size() && keysLess(groups_[to].key, key); step *= 2) {
+		from = to + 1;
+		to += step;
+	}
+	to = std::min(to, groups_.size());
+	const auto it = std::lower_bound(groups_.begin() + from, groups_.begin() + to, key,
+									 [](const Group& g, const Variant& k) { return keysLess(g.key, k); });
+	mergeCursor_ = it - groups_.begin();
+	mergeKey_ = key;
+	if (it != groups_.end() && keysEqual(it->key, key)) {
+		matchedGroups_.emplace_back(mergeCursor_);
+	}
+}
+
+bool KeyJoin::matchOtherEntries(uint32_t position) {
+	const auto& entries = joinQuery_.joinEntries_;
+	const ConstPayload right{payloadType_, items_[rows_[position].ToNumber()]};
+	for (size_t i = 1, size = entries.size(); i < size; ++i) {
+		right.GetByFieldsSet(entries[i].RightFields(), buffer_, entries[i].RightFieldType(), entries[i].RightCompositeFieldsTypes());
+		const bool found = std::any_of(buffer_.begin(), buffer_.end(), [&](Variant& v) {
+			if (v.IsNullValue() || !normalize(v, i)) {
+				return false;
+			}
+			return std::any_of(leftValues_[i].cbegin(), leftValues_[i].cend(), [&](const Variant& l) { return keysEqual(v, l); });
+		});
+		if (!found) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::optional<size_t> KeyJoin::hash(const Variant& v, size_t entry) const {
+	if (!keyTypes_[entry].Is<KeyValueType::Undefined>()) {
+		return v.Hash();
+	}
+	// Relaxed comparison: the numbers are compared by their values and the strings are compared with the numbers and bools after the
+	// conversion
+	return v.Type().EvaluateOneOf(
+		[&v](concepts::OneOf<KeyValueType::Int, KeyValueType::Int64, KeyValueType::Double, KeyValueType::Float, KeyValueType::Bool> auto)
+			-> std::optional<size_t> { return numberHash(v.As<double>()); },
+		[&v](KeyValueType::String) -> std::optional<size_t> {
+			if (const auto number = v.tryConvert(KeyValueType::Double{}); number) {
+				return numberHash(number->As<double>());
+			}
+			if (const auto boolean = v.tryConvert(KeyValueType::Bool{}); boolean) {
+				return numberHash(boolean->As<double>());
+			}
+			return v.Hash();
+		},
+		[](concepts::OneOf<KeyValueType::Uuid, KeyValueType::Tuple, KeyValueType::Undefined, KeyValueType::Composite, KeyValueType::Null,
+						   KeyValueType::FloatVector> auto) -> std::optional<size_t> { return std::nullopt; });
+}
+
+bool KeyJoin::normalize(Variant& v, size_t entry) const {
+	const KeyValueType type = keyTypes_[entry];
+	// Values are converted into the type of the right namespace's index in the same way as for the index select
+	return type.Is<KeyValueType::Undefined>() || v.Type().IsSame(type) || v.tryConvert(type);
+}
+
+bool KeyJoin::keysEqual(const Variant& lhs, const Variant& rhs) {
+	return lhs.RelaxCompare<WithString::Yes, NotComparable::Return, kDefaultNullsHandling>(rhs) == ComparationResult::Eq;
+}
+
+bool KeyJoin::keysLess(const Variant& lhs, const Variant& rhs) {
+	return lhs.Compare<NotComparable::Throw, kDefaultNullsHandling>(rhs) == ComparationResult::Lt;
+}
+
+}  // namespace reindexer::joins
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include "core/id_type.h"
+#include "core/payload/payloadiface.h"
+#include "core/query/query.h"
+#include "estl/fast_hash_map.h"
+
+namespace reindexer {
+
+class LocalQueryResults;
+
+namespace joins {
+
+enum class [[nodiscard]] JoinStrategy { NestedLoop, Hash, Merge };
+std::string_view JoinStrategyName(JoinStrategy) noexcept;
+
+// Join of the preselected rows of the right namespace by the equality of the ON-conditions' fields.
+// Instead of the separate select from the right namespace for each of the left items (nested loop join), the preselected rows are indexed
+// once by the values of the first ON-condition (build) and the left items look up their values in this index (probe). The hash join
+// uses the hash table of the values, the merge join uses the ordered array of the values and continues the lookup from the previous
+// position, so the left items, ordered by the join field, are matched with the single pass over this array.
+// Both of them return the same rows in the same order as the nested loop join does
+class [[nodiscard]] KeyJoin {
+public:
+	// 'keyTypes' are the types of the values for each ON-condition: the type of the right namespace's index or KeyValueType::Undefined
+	// for the non-indexed field (the values are compared in the same relaxed way as for the non-indexed fields conditions)
+	KeyJoin(JoinStrategy, const JoinedQuery&, h_vector<KeyValueType, 1>&& keyTypes, const PayloadType& rightPayloadType,
+			const std::vector<PayloadValue>& rightItems);
+
+	// Indexes the preselected rows of the right namespace (in the order of the preselect).
+	// Returns false, if some of the values can not be processed by the key join, i.e. the nested loop join has to be used
+	bool Build(std::span<const IdType> rows);
+	// Adds the right namespace's rows, matching the left item, into the results (but no more than 'limit' of them).
+	// Returns std::nullopt, if the left item's values can not be processed by the key join and the item has to be joined by the nested
+	// loop join. Otherwise returns true, if at least one row was matched
+	std::optional<bool> Probe(const ConstPayload& left, unsigned limit, LocalQueryResults&);
+
+	JoinStrategy Strategy() const noexcept { return strategy_; }
+
+private:
+	struct [[nodiscard]] Group {
+		Variant key;
+		uint32_t next;	 // Hash join: the next group with the same hash
+		uint32_t begin;	 // Range of the group's positions
+		uint32_t end;
+	};
+
+	std::optional<size_t> hash(const Variant&, size_t entry) const;
+	bool normalize(Variant&, size_t entry) const;
+	static bool keysEqual(const Variant& lhs, const Variant& rhs);
+	static bool keysLess(const Variant& lhs, const Variant& rhs);
+	bool buildGroups(std::vector<std::pair<uint32_t, uint32_t>>& links);
+	void sortGroups(std::vector<std::pair<uint32_t, uint32_t>>& links);
+	bool findGroups(const Variant& key);
+	void findMergeGroups(const Variant& key);
+	bool matchOtherEntries(uint32_t position);
+
+	const JoinStrategy strategy_;
+	const JoinedQuery& joinQuery_;
+	const h_vector<KeyValueType, 1> keyTypes_;
+	const PayloadType payloadType_;
+	const std::vector<PayloadValue>& items_;
+
+	std::vector<IdType> rows_;			  // Row ids of the preselected rows
+	std::vector<Group> groups_;			  // Groups of the rows with the same value of the first ON-condition's field
+	std::vector<uint32_t> positions_;	  // Positions in 'rows_' for each of the groups (ascending inside the group)
+	fast_hash_map<size_t, uint32_t> heads_;	 // Hash join: the first group in the chain of the groups with the same hash
+
+	// Merge join: the lower bound of the previous key
+	size_t mergeCursor_{0};
+	std::optional<Variant> mergeKey_;
+
+	VariantArray buffer_;
+	std::vector<VariantArray> leftValues_;
+	h_vector<uint32_t, 4> matchedGroups_;
+	std::vector<uint32_t> candidates_;
+};
+
+}  // namespace joins
+}  // namespace reindexer
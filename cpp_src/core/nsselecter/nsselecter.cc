@@ -20,7 +20,9 @@
 #include "qresexplainholder.h"
 #include "querypreprocessor.h"
 #include "sorting_heuristics.h"
+#include "topksortbuffer.h"
 #include "tools/assertrx.h"
+#include "tools/hardware_concurrency.h"
 #include "tools/logger.h"
 
 using namespace std::string_view_literals;
@@ -72,6 +74,15 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 	using SelectCtxT = SelectAndPreSelectCtx<JoinPreSelectCtx>;
 
 	const size_t resultInitSize = result.Count();
+	if (ns_->payloadsTier_.HasColdItems() && ns_->queryNeedsColdPayloads(ctx.query)) [[unlikely]] {
+		if constexpr (IsMainSelectCtx<SelectCtxT>) {
+			// Tuples of the cold items are loaded by the select loop for the candidate items only
+			ctx.coldPayloads.emplace();
+		} else {
+			// Joined items are not held in the results, so those payloads have to be restored by the caller, before the namespace is locked
+			throw Error(errLogic, "Query requires evicted payloads of the namespace '{}'", ns_->name_);
+		}
+	}
 	ctx.sortingContext.enableSortOrders = ns_->SortOrdersBuilt();
 	const LogLevel logLevel = std::max(ns_->config_.logLevel, LogLevel(ctx.query.GetDebugLevel()));
 
@@ -117,7 +128,8 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 		}
 	}
 
-	auto aggregators = getAggregators(aggregationQueryRef.aggregations_, aggregationQueryRef.GetStrictMode());
+	auto aggregators =
+		getAggregators(aggregationQueryRef.aggregations_, aggregationQueryRef.GetStrictMode(), rdxCtx.IsShardingParallelExecution());
 	QueryPreprocessor qPreproc(QueryEntries{ctx.query.Entries()}, ns_, ctx);
 	qPreproc.InitIndexedQueries();
 
@@ -259,11 +271,16 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 		const bool reverse = !isRanked && ctx.sortingContext.sortIndex() &&
 							 std::visit([](const auto& e) noexcept { return e.data.desc; }, ctx.sortingContext.entries[0].AsVariant());
 
-		bool hasComparators = false;
-		qres.VisitForEach([](const KnnRawSelectResult&) { throw_as_assert; },
-						  Skip<JoinSelectIterator, SelectIteratorsBracket, AlwaysTrue, SelectIterator>{},
-						  [&hasComparators](const concepts::OneOf<ComparatorsPackT> auto&) noexcept { hasComparators = true; });
+		const auto containsComparators = [&qres] {
+			bool hasComparators = false;
+			qres.VisitForEach([](const KnnRawSelectResult&) { throw_as_assert; },
+							  Skip<JoinSelectIterator, SelectIteratorsBracket, AlwaysTrue, SelectIterator>{},
+							  [&hasComparators](const concepts::OneOf<ComparatorsPackT> auto&) noexcept { hasComparators = true; });
+			return hasComparators;
+		};
+		bool hasComparators = containsComparators();
 
+		bool isIdsRangeScan = false;
 		if (!qres.HasIdsets()) {
 			SelectKeyResult scan;
 			std::string_view scanName = "-scan"sv;
@@ -292,6 +309,7 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 				} else {
 					// Use ids range
 					scan.emplace_back(IdType::Zero(), IdType::FromNumber(maxIterations));
+					isIdsRangeScan = true;
 				}
 			}
 			// Iterator Field Kind: -scan. Sorting Context! -> None
@@ -310,6 +328,33 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 		// Check IdSet must be 1st
 		qres.CheckFirstQuery();
 
+		const bool isFullScanRequired = ctx.isForceAll || needCalcTotal || !ctx.HasLimit();
+		// Intersect plain idsets of the AND-chain before the select loop. With the small limit and without total the loop stops after
+		// a few iterations, so the eager intersection is not worth it
+		if (!isRanked && !qres.IsStreamingKnnMode()) {
+			const size_t requiredMatches =
+				isFullScanRequired ? std::numeric_limits<size_t>::max() : size_t(qPreproc.Start()) + size_t(qPreproc.Count());
+			qres.IntersectIdsets(reverse, maxIterations, requiredMatches);
+		}
+
+		// Numeric column conditions of the full scan are evaluated by the vectorized kernels, if the select loop has to check all the items
+		// anyway. The scan over the sort orders is not the scan over the columns' rows, so it is not supported
+		if (isIdsRangeScan && hasComparators && !isRanked && isFullScanRequired && !ctx.sortingContext.sortIndexIfOrdered() &&
+			qres.ColumnScan(*ns_, reverse, maxIterations, rdxCtx)) {
+			isIdsRangeScan = false;
+			hasComparators = containsComparators();
+		}
+
+		// Conditions of the full scan are evaluated by the parallel workers, if the select loop has to check all the items anyway.
+		// Cold items' tuples are loaded by the select loop only
+		if (isIdsRangeScan && hasComparators && !isRanked && !ctx.inTransaction && !ctx.coldPayloads && isFullScanRequired) {
+			if (const unsigned threads = parallelScanThreads(ctx.query);
+				threads > 1 &&
+				qres.ParallelScan(*ns_, ctx.sortingContext.sortIndexIfOrdered(), threads, reverse, maxIterations, rdxCtx)) {
+				hasComparators = false;
+			}
+		}
+
 		explain.AddPostprocessTime();
 
 		// do not calc total by loop, if we have only 1 condition with 1 IdSet
@@ -370,7 +415,7 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 	const bool hasOnlyDistinctAgg = aggregators.size() == 1 && aggregators[0].Type() == AggDistinct;
 	if ((aggregationsOnlyOrig || hasOnlyDistinctAgg) && !lctx.calcAggsImmediately) {
 		for (auto it = result.begin() + initTotalCount; it != result.end(); ++it) {
-			auto& pl = ns_->items_[it.GetItemRef().Id()];
+			auto& pl = ItemPayload(*ns_, ctx, it.GetItemRef().Id());
 			for (auto& aggregator : aggregators) {
 				aggregator.Aggregate(pl);
 			}
@@ -386,6 +431,9 @@ void NsSelecter::operator()(LocalQueryResults& result, SelectAndPreSelectCtx<Joi
 		joinSelectStrategy.SetPreSelectValuesAfterSorting();
 		resultHandler.SetItemsValuesAfterSorting(ns_->items_, resultInitSize);
 	}
+	if constexpr (IsMainSelectCtx<SelectCtxT>) {
+		ns_->holdColdPayloads(result, resultInitSize, true, ctx.coldPayloads ? &*ctx.coldPayloads : nullptr);
+	}
 	holdFloatVectors(result, ctx, resultInitSize, fieldsFilter);
 	if (ctx.isMergeQuerySubQuery()) [[unlikely]] {
 		writeAggregationResultMergeSubQuery(result, std::move(aggregators), ctx);
@@ -505,6 +553,16 @@ bool NsSelecter::detectStreamingKnn(const QueryPreprocessor& qPreproc, QueryRank
 	return true;
 }
 
+unsigned NsSelecter::parallelScanThreads(const Query& q) const noexcept {
+	static const unsigned kHardwareConcurrency = hardware_concurrency();
+	const auto& cfg = ns_->config_;
+	if (ns_->itemsCount() < size_t(cfg.minParallelScanItems)) {
+		return 1;
+	}
+	const unsigned maxThreads = std::min<unsigned>(cfg.maxSelectParallelism, kHardwareConcurrency);
+	return q.GetParallelism() ? std::min(q.GetParallelism(), maxThreads) : maxThreads;
+}
+
 size_t NsSelecter::GetMaxScanIterations(const NamespaceImpl& ns, const SortingContext& sortingCtx) {
 	const size_t itemsCount{ns.itemsCount()};
 	if (sortingCtx.isOptimizationEnabled()) {
@@ -527,29 +585,31 @@ size_t NsSelecter::GetMaxScanIterations(const NamespaceImpl& ns, const SortingCo
 template <>
 class [[nodiscard]] NsSelecter::MainNsValueGetter<ItemRefVector::Iterator::RankedIt> {
 public:
-	explicit MainNsValueGetter(const NamespaceImpl& ns) noexcept : ns_{ns} {}
-	const PayloadValue& Value(const ItemRef& itemRef) const noexcept { return ns_.items_[itemRef.Id()]; }
+	MainNsValueGetter(const NamespaceImpl& ns, const SelectCtx& ctx) noexcept : ns_{ns}, ctx_{ctx} {}
+	const PayloadValue& Value(const ItemRef& itemRef) const noexcept { return ItemPayload(ns_, ctx_, itemRef.Id()); }
 	ConstPayload Payload(const ItemRef& itemRef) const { return ConstPayload{ns_.payloadType_, Value(itemRef)}; }
 
 private:
 	const NamespaceImpl& ns_;
+	const SelectCtx& ctx_;
 };
 
 template <>
 class [[nodiscard]] NsSelecter::MainNsValueGetter<ItemRefVector::Iterator::NotRankedIt> {
 public:
-	explicit MainNsValueGetter(const NamespaceImpl& ns) noexcept : ns_{ns} {}
-	const PayloadValue& Value(const ItemRef& itemRef) const noexcept { return ns_.items_[itemRef.Id()]; }
+	MainNsValueGetter(const NamespaceImpl& ns, const SelectCtx& ctx) noexcept : ns_{ns}, ctx_{ctx} {}
+	const PayloadValue& Value(const ItemRef& itemRef) const noexcept { return ItemPayload(ns_, ctx_, itemRef.Id()); }
 	ConstPayload Payload(const ItemRef& itemRef) const { return ConstPayload{ns_.payloadType_, Value(itemRef)}; }
 
 private:
 	const NamespaceImpl& ns_;
+	const SelectCtx& ctx_;
 };
 
 template <>
 class [[nodiscard]] NsSelecter::MainNsValueGetter<joins::PreSelect::Values::Iterator> {
 public:
-	explicit MainNsValueGetter(const NamespaceImpl& ns) noexcept : ns_{ns} {}
+	MainNsValueGetter(const NamespaceImpl& ns, const SelectCtx&) noexcept : ns_{ns} {}
 	const PayloadValue& Value(const ItemRef& itemRef) const noexcept { return itemRef.Value(); }
 	ConstPayload Payload(const ItemRef& itemRef) const { return ConstPayload{ns_.payloadType_, Value(itemRef)}; }
 
@@ -591,7 +651,7 @@ It NsSelecter::applyForcedSort(It begin, It end, const ItemComparator& compare,
 			[](const SortingContext::ExpressionEntry&) -> It { throw Error(errLogic, "Force sort could not be performed by expression"); },
 			[&](const SortingContext::FieldEntry& e) {
 				return applyForcedSortImpl<desc, multiColumnSort, It>(*ns_, begin, end, compare, ctx.query.ForcedSortOrder(),
-																	  e.data.expression, MainNsValueGetter<It>{*ns_});
+																	  e.data.expression, MainNsValueGetter<It>{*ns_, ctx});
 			},
 			[&](const SortingContext::JoinedFieldEntry& e) {
 				assertrx_throw(ctx.joinItemsProcessors);
@@ -727,6 +787,11 @@ void NsSelecter::setLimitAndOffset(ItemRefVector& queryResult, size_t offset, si
 	}
 }
 
+const PayloadValue& NsSelecter::ItemPayload(const NamespaceImpl& ns, const SelectCtx& ctx, IdType rowId) noexcept {
+	const PayloadValue& pv = ns.items_[rowId];
+	return ctx.coldPayloads ? ctx.coldPayloads->Get(rowId, pv) : pv;
+}
+
 void NsSelecter::processLeftJoins(LocalQueryResults& qr, SelectCtx& sctx, size_t startPos, const RdxContext& rdxCtx) {
 	if (!checkIfThereAreLeftJoins(sctx)) {
 		return;
@@ -734,7 +799,7 @@ void NsSelecter::processLeftJoins(LocalQueryResults& qr, SelectCtx& sctx, size_t
 	for (size_t i = startPos; i < qr.Count(); ++i) {
 		const auto it = qr[i];
 		IdType rowid = it.GetItemRef().Id();
-		ConstPayload pl(ns_->payloadType_, ns_->items_[rowid]);
+		ConstPayload pl(ns_->payloadType_, ItemPayload(*ns_, sctx, rowid));
 		for (auto& joinItemsProcessor : *sctx.joinItemsProcessors) {
 			if (joinItemsProcessor.Type() == JoinType::LeftJoin) {
 				std::ignore = joinItemsProcessor.Process(rowid, sctx.nsid, pl, sctx.floatVectorsHolder, true);
@@ -833,6 +898,17 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 	VariantArray prevValues;
 	size_t multisortLimitLeft = 0;
 
+	// The general sort with limit requires only 'offset + limit' of the best items, so the rest of them are not held until the sort
+	std::optional<TopKSortBuffer> topKBuffer;
+	if constexpr (!kPreprocessingBeforeFT && !aggregationsOnly && !IsJoinPreSelectCtx<SelectCtxT>) {
+		if (sctx.isForceAll && (sortingOptions.multiColumn || sortingOptions.usingGeneralAlgorithm) && !sortingOptions.forcedMode &&
+			!sortingOptions.multiColumnByBtreeIndex && ctx.qPreproc.Count() != QueryEntry::kDefaultLimit && ctx.qPreproc.Count() > 0 &&
+			sctx.query.GetMergeQueries().size() <= 1) {
+			topKBuffer.emplace(*ns_, sctx, sctx.nsid < result.joined_.size() ? &result.joined_[sctx.nsid] : nullptr, initCount,
+							   size_t(ctx.qPreproc.Start()) + ctx.qPreproc.Count());
+		}
+	}
+
 	const auto distinctNodeIndexes = qres.CollectDistinctConditions();
 
 	assertrx_throw(!qres.Empty());
@@ -843,6 +919,7 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 	const CollateOpts* multisortCollateOpts = nullptr;
 	const auto& nsItems = ns_->items_;
 	const auto nsItemsSize = ns_->items_.size();
+	auto& coldPayloads = sctx.coldPayloads;
 	while (firstIterator.Next(rowId) && !finish) {
 		if ((rowId.ToNumber() % kCancelCheckFrequency == 0) && !sctx.inTransaction) {
 			ThrowOnCancel(rdxCtx);
@@ -860,10 +937,11 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 		if (static_cast<size_t>(properRowId.ToNumber()) > nsItemsSize) [[unlikely]] {
 			throwUnexpectedItemID(rowId, properRowId);
 		}
-		const PayloadValue& pv = nsItems[properRowId];
-		if (pv.IsFree()) {
+		if (nsItems[properRowId].IsFree()) {
 			continue;
 		}
+		const bool isCold = coldPayloads && ns_->payloadsTier_.IsCold(properRowId);
+		const PayloadValue& pv = isCold ? ns_->loadColdPayload(properRowId, *coldPayloads) : nsItems[properRowId];
 		const bool withJoinedItems = (!ctx.start && ctx.count) || (sortingOptions.multiColumnByBtreeIndex && !multiSortFinished);
 		if (qres.Process<reverse>(pv, &finish, &rowId, properRowId, withJoinedItems, distinctNodeIndexes)) {
 			if (streamingKnnIterator) {
@@ -880,7 +958,7 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 					if (!multisortCollateOpts) {
 						multisortCollateOpts = &getSortIndexCollateOpts(sctx.sortingContext, joinItemsProcessors);
 					}
-					getSortIndexValue(sctx.sortingContext, properRowId, recentValues, rank,
+					getSortIndexValue(sctx.sortingContext, properRowId, pv, recentValues, rank,
 									  sctx.nsid < result.joined_.size() ? &result.joined_[sctx.nsid] : nullptr, joinItemsProcessors,
 									  rdxCtx.ShardId());
 					if (prevValues.empty() && result.Items().Empty()) {
@@ -901,7 +979,7 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 					}
 
 					if (!multiSortFinished) {
-						addSelectResult<aggregationsOnly, ResultsT>(sctx, resultHandler, rank, rowId, properRowId, ctx.aggregators,
+						addSelectResult<aggregationsOnly, ResultsT>(sctx, resultHandler, rank, rowId, properRowId, pv, ctx.aggregators,
 																	ctx.calcAggsImmediately, ctx.preselectForFt);
 					}
 					if (lastResSize < result.Count()) {
@@ -913,11 +991,14 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 				if (ctx.start) {
 					--ctx.start;
 				} else if (ctx.count) {
-					addSelectResult<aggregationsOnly, ResultsT>(sctx, resultHandler, rank, rowId, properRowId, ctx.aggregators,
+					addSelectResult<aggregationsOnly, ResultsT>(sctx, resultHandler, rank, rowId, properRowId, pv, ctx.aggregators,
 																ctx.calcAggsImmediately, ctx.preselectForFt);
+					if (topKBuffer) {
+						topKBuffer->Push(result);
+					}
 					--ctx.count;
 					if (!ctx.count && sortingOptions.multiColumnByBtreeIndex && !multiSortFinished) {
-						getSortIndexValue(sctx.sortingContext, properRowId, prevValues, rank,
+						getSortIndexValue(sctx.sortingContext, properRowId, pv, prevValues, rank,
 										  sctx.nsid < result.joined_.size() ? &result.joined_[sctx.nsid] : nullptr, joinItemsProcessors,
 										  rdxCtx.ShardId());
 					}
@@ -934,6 +1015,9 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 				}
 				result.rowIds[properRowId.ToNumber()] = true;
 			}
+		} else if (isCold) {
+			// Tuples of the filtered out items are not required anymore
+			coldPayloads->Erase(properRowId);
 		}
 	}
 
@@ -949,6 +1033,8 @@ void NsSelecter::selectLoop(LoopCtx<SelectCtxT>& ctx, ResultsT& result, const Rd
 				}
 			}
 			if (sortingOptions.postLoopSortingRequired()) {
+				result.sortPeakMemory = std::max({result.sortPeakMemory, SortBufferMemory(result, sctx.sortingContext, initCount),
+												  topKBuffer ? topKBuffer->PeakMemory() : 0});
 				const size_t offset = sctx.isForceAll ? ctx.qPreproc.Start() : multisortLimitLeft;
 				if (result.Count() > offset) {
 					if (result.haveRank) {
@@ -1008,12 +1094,12 @@ bool NsSelecter::sortPreSelectBuildValues(LoopCtx<SelectCtxT>& ctx, size_t initS
 	}
 }
 
-void NsSelecter::getSortIndexValue(const SortingContext& sortCtx, IdType rowId, VariantArray& value, RankT rank,
+void NsSelecter::getSortIndexValue(const SortingContext& sortCtx, IdType rowId, const PayloadValue& item, VariantArray& value, RankT rank,
 								   const joins::NamespaceResults* joinResults, const joins::ItemsProcessors& js, int shardId) {
 	std::visit(
 		overloaded{[&](const SortingContext::ExpressionEntry& e) {
 					   assertrx_throw(e.expression < sortCtx.expressions.size());
-					   ConstPayload pv(ns_->payloadType_, ns_->items_[rowId]);
+					   ConstPayload pv(ns_->payloadType_, item);
 					   value = VariantArray{Variant{
 						   sortCtx.expressions[e.expression].Calculate(rowId, pv, joinResults, js, rank, ns_->tagsMatcher_, shardId)}};
 				   },
@@ -1052,7 +1138,7 @@ void NsSelecter::getSortIndexValue(const SortingContext& sortCtx, IdType rowId,
 						   return;
 					   }
 					   // No column data available
-					   ConstPayload pv(ns_->payloadType_, ns_->items_[rowId]);
+					   ConstPayload pv(ns_->payloadType_, item);
 					   if ((e.data.index == IndexValueType::SetByJsonPath) || ns_->indexes_[e.data.index]->Opts().IsSparse()) {
 						   pv.GetByJsonPath(e.data.expression, ns_->tagsMatcher_, value, KeyValueType::Undefined{});
 						   return;
@@ -1109,21 +1195,21 @@ const CollateOpts& NsSelecter::getSortIndexCollateOpts(const SortingContext& sor
 
 template <bool aggregationsOnly, typename ResultType, typename SelectCtxT>
 void NsSelecter::addSelectResult(SelectCtxT& ctx, ResultHandler<ResultType, SelectCtxT>& resultHandler, RankT rank, IdType rowId,
-								 IdType properRowId, h_vector<Aggregator, 4>& aggregators, bool needCalcAggs, bool preselectForFt) {
+								 IdType properRowId, const PayloadValue& pv, h_vector<Aggregator, 4>& aggregators, bool needCalcAggs,
+								 bool preselectForFt) {
 	if (preselectForFt) {
 		return;
 	}
 
 	if (needCalcAggs) {
 		for (auto& aggregator : aggregators) {
-			aggregator.Aggregate(ns_->items_[properRowId]);
+			aggregator.Aggregate(pv);
 		}
 	}
 	if constexpr (aggregationsOnly) {
 		return;
 	}
 
-	const PayloadValue& pv{ns_->items_[properRowId]};
 	resultHandler.AddItem(ctx, rank, rowId, properRowId, pv, ns_->tagsMatcher_, ns_->payloadType_, ns_->name_);
 }
 
@@ -1152,7 +1238,8 @@ RX_NO_INLINE void NsSelecter::throwUnexpectedItemID(IdType rowId, IdType properR
 	throw Error(errAssert, "Unexpected rowID ({}:{}). Items size: {}", rowId, properRowId, ns_->items_.size());
 }
 
-h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEntry>& aggEntries, StrictMode strictMode) const {
+h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEntry>& aggEntries, StrictMode strictMode,
+												   bool keepSketches) const {
 	static constexpr int NotFilled = -2;
 	h_vector<Aggregator, 4> ret;
 	h_vector<size_t, 4> distinctIndexes;
@@ -1161,6 +1248,9 @@ h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEn
 		if (ag.Type() == AggCount || ag.Type() == AggCountCached) {
 			continue;
 		}
+		if (ag.Type() == AggPercentile && ag.Percentiles().empty()) [[unlikely]] {
+			throw Error(errQueryExec, "Percentile aggregation requires at least one rank");
+		}
 		bool compositeIndexFields = false;
 
 		FieldsSet fields;
@@ -1221,7 +1311,8 @@ h_vector<Aggregator, 4> NsSelecter::getAggregators(const std::vector<AggregateEn
 		if (ag.Type() == AggDistinct) {
 			distinctIndexes.push_back(ret.size());
 		}
-		ret.emplace_back(ns_->payloadType_, fields, ag.Type(), ag.Fields(), sortingEntries, ag.Limit(), ag.Offset(), compositeIndexFields);
+		ret.emplace_back(ns_->payloadType_, fields, ag.Type(), ag.Fields(), sortingEntries, ag.Limit(), ag.Offset(), compositeIndexFields,
+						 ag.Percentiles(), keepSketches);
 	}
 
 	if (distinctIndexes.size() <= 1) {
@@ -1463,6 +1554,9 @@ void NsSelecter::writeAggregationResultMergeSubQuery(LocalQueryResults& result,
 			case AggDistinct:
 			case AggCount:
 			case AggCountCached:
+			case AggApproxCountDistinct:
+			case AggPercentile:
+			case AggTopKApprox:
 			case AggUnknown:
 				throw_as_assert;
 		}
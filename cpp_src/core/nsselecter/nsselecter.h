@@ -28,6 +28,8 @@ public:
 	void operator()(LocalQueryResults& result, SelectAndPreSelectCtx<JoinPreSelectCtx>& ctx, const RdxContext&);
 
 	static size_t GetMaxScanIterations(const NamespaceImpl& ns, const SortingContext& sortingCtx);
+	// Returns the item's payload. Cold items, loaded by the select, are returned with their tuples
+	static const PayloadValue& ItemPayload(const NamespaceImpl&, const SelectCtx&, IdType rowId) noexcept;
 
 protected:
 	template <typename SelectCtxT>
@@ -60,20 +62,21 @@ protected:
 
 	template <bool aggregationsOnly, typename ResultType, typename SelectCtxT>
 	void addSelectResult(SelectCtxT& ctx, ResultHandler<ResultType, SelectCtxT>& resultHandler, RankT, IdType rowId, IdType properRowId,
-						 h_vector<Aggregator, 4>& aggregators, bool needAggsCalc, bool preselectForFt);
+						 const PayloadValue&, h_vector<Aggregator, 4>& aggregators, bool needAggsCalc, bool preselectForFt);
 
 	template <typename SelectCtxT, typename Results>
 	bool sortPreSelectBuildValues(LoopCtx<SelectCtxT>& ctx, size_t initSize, const SortingOptions& sortingOptions, Results& results);
 
-	h_vector<Aggregator, 4> getAggregators(const std::vector<AggregateEntry>& aggEntrys, StrictMode strictMode) const;
+	// 'keepSketches' keeps the mergeable state of the approximate aggregations for the sharding proxy
+	h_vector<Aggregator, 4> getAggregators(const std::vector<AggregateEntry>& aggEntrys, StrictMode strictMode, bool keepSketches) const;
 	void setLimitAndOffset(ItemRefVector& result, size_t offset, size_t limit);
 	void prepareSortingContext(SortingEntries& sortBy, SelectCtx& ctx, QueryRankType, int rankedIndexNo,
 							   bool availableSelectBySortIndex) const;
 	static void prepareSortIndex(const NamespaceImpl&, std::string& column, int& index, StrictMode, IsRanked);
 	static void prepareSortJoinedIndex(size_t nsIdx, std::string_view column, int& index, const std::vector<joins::ItemsProcessor>&,
 									   StrictMode);
-	void getSortIndexValue(const SortingContext& sortCtx, IdType rowId, VariantArray& value, RankT, const joins::NamespaceResults*,
-						   const joins::ItemsProcessors&, int shardId);
+	void getSortIndexValue(const SortingContext& sortCtx, IdType rowId, const PayloadValue& item, VariantArray& value, RankT,
+						   const joins::NamespaceResults*, const joins::ItemsProcessors&, int shardId);
 	const CollateOpts& getSortIndexCollateOpts(const SortingContext& sortCtx, const joins::ItemsProcessors&);
 	void processLeftJoins(LocalQueryResults& qr, SelectCtx& sctx, size_t startPos, const RdxContext&);
 	bool checkIfThereAreLeftJoins(SelectCtx& sctx) const;
@@ -92,6 +95,7 @@ protected:
 	template <typename SelectCtxT>
 	void holdFloatVectors(LocalQueryResults&, SelectCtxT&, size_t offset, const FieldsFilter&) const;
 
+	unsigned parallelScanThreads(const Query&) const noexcept;
 	bool detectStreamingKnn(const QueryPreprocessor& qPreproc, QueryRankType queryRankType, const SelectCtx& ctx) const;
 
 	NamespaceImpl* ns_;
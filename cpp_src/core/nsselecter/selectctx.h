@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/enums.h"
+#include "core/namespace/payloadstier.h"
 #include "core/query/query.h"
 #include "core/query/queryentry.h"
 #include "explaincalc.h"
@@ -43,6 +44,8 @@ struct [[nodiscard]] SelectCtx {
 	bool requiresCrashTracking = false;
 	std::vector<SubQueryExplain> subQueriesExplains;
 	FloatVectorsHolderMap* floatVectorsHolder = nullptr;
+	// Cold items of the main namespace, loaded by the select loop, if the query requires their tuples
+	std::optional<ColdPayloadsHolder> coldPayloads;
 
 	RX_ALWAYS_INLINE bool isMergeQuerySubQuery() const noexcept { return isMergeQuery == IsMergeQuery_True && parentQuery; }
 };
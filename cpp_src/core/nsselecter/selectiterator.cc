@@ -56,6 +56,9 @@ std::string SelectIterator::Dump() const {
 			case SingleSelectKeyResult::Collection::TreeIdSet:
 				ret += "btree;";
 				break;
+			case SingleSelectKeyResult::Collection::BitmapIdSet:
+				ret += "bitmap;";
+				break;
 			case SingleSelectKeyResult::Collection::Range:
 				ret += "range;";
 				break;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <optional>
 #include "core/enums.h"
 #include "core/id_type.h"
 #include "core/selectkeyresult.h"
@@ -73,6 +74,7 @@ public:
 					break;
 				case SingleSelectKeyResult::Collection::FlatIdSet:
 				case SingleSelectKeyResult::Collection::TreeIdSet:
+				case SingleSelectKeyResult::Collection::BitmapIdSet:
 					if (isReverse_) {
 						type_ = explicitSort ? Type::RevSingleIdSetWithDeferedSort : Type::RevSingleIdset;
 					} else {
@@ -188,6 +190,8 @@ public:
 				} else {
 					curRes.treeIds_.u.fwd.it = curRes.treeIds_.u.fwd.end;
 				}
+			} else if (curRes.collectionType_ == SingleSelectKeyResult::Collection::BitmapIdSet) {
+				curRes.bitmapIds_.cursor.SetEnd();
 			} else {
 				assertrx_throw(curRes.collectionType_ == SingleSelectKeyResult::Collection::FlatIdSet);
 				if (isReverse_) {
@@ -249,6 +253,62 @@ public:
 	reindexer::IsDistinct IsDistinct() const noexcept { return distinct_; }
 	int IndexNo() const noexcept { return indexNo_; }
 
+	/// @return view of the ids, if started iterator holds single sorted plain idset
+	std::optional<IdSetCRef> SingleFlatIdsView() const noexcept {
+		switch (type_) {
+			case Type::SingleIdset:
+			case Type::SingleIdSetWithDeferedSort:
+			case Type::RevSingleIdset:
+			case Type::RevSingleIdSetWithDeferedSort:
+				if (begin()->collectionType_ == SingleSelectKeyResult::Collection::FlatIdSet) {
+					return begin()->flatIds_.view;
+				}
+				return std::nullopt;
+			case Type::None:
+			case Type::Forward:
+			case Type::Reverse:
+			case Type::SingleRange:
+			case Type::RevSingleRange:
+			case Type::Unsorted:
+			case Type::UnbuiltSortOrdersIndex:
+			default:
+				return std::nullopt;
+		}
+	}
+	/// @return compressed ids, if started iterator holds single bitmap idset (i.e. cached merged result)
+	const IdSetBitmap* SingleBitmapIds() const noexcept {
+		switch (type_) {
+			case Type::SingleIdset:
+			case Type::SingleIdSetWithDeferedSort:
+			case Type::RevSingleIdset:
+			case Type::RevSingleIdSetWithDeferedSort:
+				if (begin()->collectionType_ == SingleSelectKeyResult::Collection::BitmapIdSet) {
+					return begin()->bitmapIds_.ptr.get();
+				}
+				return nullptr;
+			case Type::None:
+			case Type::Forward:
+			case Type::Reverse:
+			case Type::SingleRange:
+			case Type::RevSingleRange:
+			case Type::Unsorted:
+			case Type::UnbuiltSortOrdersIndex:
+			default:
+				return nullptr;
+		}
+	}
+	/// Replaces iterator's ids with the result of their intersection with the other iterators. Iterator must be restarted after this call
+	/// @param ids - intersection result
+	/// @param intersectedCount - number of the other iterators, which took part in the intersection
+	void SetIntersection(IdSetPlain::Ptr&& ids, unsigned intersectedCount) {
+		clear();
+		emplace_back(std::move(ids));
+		deferedExplicitSort = false;
+		type_ = Type::None;
+		intersectedCount_ = intersectedCount;
+	}
+	unsigned IntersectedCount() const noexcept { return intersectedCount_; }
+
 	std::string name;
 
 private:
@@ -297,6 +357,12 @@ private:
 					}
 				}
 				break;
+			case SingleSelectKeyResult::Collection::BitmapIdSet:
+				if (it.bitmapIds_.cursor.SeekFwd(*it.bitmapIds_.ptr, bound)) {
+					value = it.bitmapIds_.cursor.Value();
+					return true;
+				}
+				break;
 			case SingleSelectKeyResult::Collection::Range:
 				if (it.range_.u.fwd.it != it.range_.u.fwd.end) {
 					it.range_.u.fwd.it = std::min(it.range_.u.fwd.end, std::max(it.range_.u.fwd.it, bound.Incr()));
@@ -340,6 +406,12 @@ private:
 					}
 				}
 				break;
+			case SingleSelectKeyResult::Collection::BitmapIdSet:
+				if (it.bitmapIds_.cursor.SeekRev(*it.bitmapIds_.ptr, bound)) {
+					value = it.bitmapIds_.cursor.Value();
+					return true;
+				}
+				break;
 			case SingleSelectKeyResult::Collection::Range:
 				if (it.range_.u.rev.it != it.range_.u.rev.end) {
 					it.range_.u.rev.it = std::max(it.range_.u.rev.end, std::min(it.range_.u.rev.it, bound.Decr()));
@@ -511,6 +583,9 @@ private:
 				it->treeIds_.u.fwd.it = it->treeIds_.ptr->upper_bound(lastVal);
 			}
 			lastVal_ = (it->treeIds_.u.fwd.it != it->treeIds_.u.fwd.end) ? *it->treeIds_.u.fwd.it : IdType::Max();
+		} else if (it->collectionType_ == SingleSelectKeyResult::Collection::BitmapIdSet) {
+			auto& cursor = it->bitmapIds_.cursor;
+			lastVal_ = cursor.SeekFwd(*it->bitmapIds_.ptr, lastVal) ? cursor.Value() : IdType::Max();
 		} else {
 			assertrx_dbg(it->collectionType_ == SingleSelectKeyResult::Collection::FlatIdSet);
 			it->flatIds_.u.fwd.it = GallopUpperBound(it->flatIds_.u.fwd.it, it->flatIds_.u.fwd.end, lastVal);
@@ -550,6 +625,9 @@ private:
 				it->treeIds_.u.rev.it = std::make_reverse_iterator(lower);
 				lastVal_ = *it->treeIds_.u.rev.it;
 			}
+		} else if (it->collectionType_ == SingleSelectKeyResult::Collection::BitmapIdSet) {
+			auto& cursor = it->bitmapIds_.cursor;
+			lastVal_ = cursor.SeekRev(*it->bitmapIds_.ptr, lastVal) ? cursor.Value() : IdType::Min();
 		} else {
 			assertrx_dbg(it->collectionType_ == SingleSelectKeyResult::Collection::FlatIdSet);
 			it->flatIds_.u.rev.it = GallopLowerBound(it->flatIds_.u.rev.it, it->flatIds_.u.rev.end, lastVal);
@@ -615,6 +693,7 @@ private:
 	size_t lastPos_ = 0;
 	int matchedCount_ = 0;
 	int indexNo_ = IndexValueType::NotSet;
+	unsigned intersectedCount_ = 0;
 	HeapT heap_;
 };
 
@@ -1,10 +1,13 @@
 #include "selectiteratorcontainer.h"
 
+#include <array>
+#include <bit>
 #include <numeric>
 #include <optional>
 #include <span>
 #include <sstream>
 #include "core/id_type.h"
+#include "core/idset/idsetintersection.h"
 #include "core/index/float_vector/float_vector_index.h"
 #include "core/index/float_vector/knn_ctx.h"
 #include "core/keyvalue/float_vector.h"
@@ -20,8 +23,10 @@
 #include "knn_streaming_index_iterator.h"
 #include "nsselecter.h"
 #include "querypreprocessor.h"
+#include "selectworkerspool.h"
 #include "sorting_heuristics.h"
 #include "tools/logger.h"
+#include "tools/thread_exception_wrapper.h"
 #include "tools/use_pmr.h"
 
 #ifdef USE_PMR
@@ -215,6 +220,279 @@ void SelectIteratorContainer::CheckFirstQuery() {
 	throw_as_assert;
 }
 
+void SelectIteratorContainer::IntersectIdsets(bool reverse, int maxIterations, size_t requiredMatches) {
+	// Per-item probing is cheap enough for the small driving idsets
+	constexpr size_t kMinIdsToIntersect = 512;
+	// Select loop over the driving idset stops after the required matches. Unless the conditions are very selective it takes
+	// much less iterations, than the full intersection
+	constexpr size_t kLazyIterationsRatio = 16;
+
+	const auto plainIdsetIter = [](const_iterator it, const_iterator end) -> const SelectIterator* {
+		if (!isIdset(it, end)) {
+			return nullptr;
+		}
+		const auto& sit = it->Value<SelectIterator>();
+		return sit.IsDistinct() ? nullptr : &sit;
+	};
+
+	if (Size() < 2) {
+		return;
+	}
+	const auto first = plainIdsetIter(cbegin(), cend());
+	if (!first || (!first->SingleFlatIdsView() && !first->SingleBitmapIds())) {
+		return;
+	}
+	if (const auto firstSize = first->GetMaxIterations();
+		firstSize < kMinIdsToIntersect || requiredMatches < firstSize / kLazyIterationsRatio) {
+		return;
+	}
+	// Cached merged idsets may be compressed. Those are not materialized, but filter the intersection of the plain ones
+	h_vector<IdSetCRef, 8> idsets;
+	h_vector<const IdSetBitmap*, 4> bitmaps;
+	// Positions of the intersected iterators, except the first one
+	h_vector<size_t, 8> intersected;
+	const_iterator it = cbegin();
+	for (const const_iterator end = cend(); it != end; ++it) {
+		if (const auto sit = plainIdsetIter(it, end); sit) {
+			if (const auto ids = sit->SingleFlatIdsView(); ids) {
+				idsets.emplace_back(*ids);
+			} else if (const auto bitmap = sit->SingleBitmapIds(); bitmap) {
+				bitmaps.emplace_back(bitmap);
+			} else {
+				continue;
+			}
+			if (it != cbegin()) {
+				intersected.emplace_back(it.PlainIterator() - cbegin().PlainIterator());
+			}
+		}
+	}
+	if (idsets.empty() || idsets.size() + bitmaps.size() < 2) {
+		return;
+	}
+
+	base_idset intersection;
+	::reindexer::IntersectIdsets(idsets, intersection);
+	for (auto bitmap = bitmaps.begin(); bitmap != bitmaps.end() && !intersection.empty(); ++bitmap) {
+		intersection.resize((*bitmap)->IntersectSorted(intersection));
+	}
+	auto& firstIt = begin()->Value<SelectIterator>();
+	firstIt.SetIntersection(make_intrusive<intrusive_atomic_rc_wrapper<IdSetPlain>>(std::move(intersection)),
+							idsets.size() + bitmaps.size() - 1);
+	firstIt.Start(reverse, maxIterations);
+	// Intersected conditions are satisfied by each of the first iterator's ids, so the select loop does not have to check them again
+	for (auto pos = intersected.rbegin(); pos != intersected.rend(); ++pos) {
+		Erase(*pos, *pos + 1);
+	}
+}
+
+bool SelectIteratorContainer::isParallelScanAllowed(const_iterator begin, const_iterator end) {
+	// Only stateless conditions may be copied into the workers. Joins and distincts have to be evaluated in the select loop
+	for (const_iterator it = begin; it != end; ++it) {
+		const bool allowed = it->Visit(
+			[it](const SelectIteratorsBracket&) { return isParallelScanAllowed(it.cbegin(), it.cend()); },
+			[](const concepts::OneOf<SelectIterator, JoinSelectIterator, KnnRawSelectResult> auto&) noexcept { return false; },
+			[](const AlwaysTrue&) noexcept { return true; },
+			[](const concepts::OneOf<ComparatorsPackT> auto& comp) noexcept { return !*comp.IsDistinct(); });
+		if (!allowed) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool SelectIteratorContainer::ParallelScan(const NamespaceImpl& ns, const Index* sortIndex, unsigned threads, bool reverse,
+										   int maxIterations, const RdxContext& rdxCtx) {
+	constexpr size_t kMorselSize = 16 * 1024;
+
+	if (threads < 2 || Size() < 2 || maxIterations <= 0 || hasDistinctComparatorsFromPreviousStage() || !isIdset(cbegin(), cend()) ||
+		(sortIndex && sortIndex->SortOrders().size() < size_t(maxIterations))) {
+		return false;
+	}
+	auto it = cbegin();
+	if (!isParallelScanAllowed(++it, cend())) {
+		return false;
+	}
+	const size_t morselsCount = (size_t(maxIterations) + kMorselSize - 1) / kMorselSize;
+	threads = std::min<size_t>(threads, morselsCount);
+	if (threads < 2) {
+		return false;
+	}
+
+	// Morsels are claimed dynamically, so the fast workers take over the rest of the range from the slow ones.
+	// Each morsel has its own results, so the merged ids are sorted without any additional work
+	std::vector<base_idset> matched(morselsCount);
+	std::atomic<size_t> nextMorsel{0};
+	ExceptionPtrWrapper exWrp;
+	const auto& items = ns.items_;
+	const bool checkCancel = !ctx_ || !ctx_->inTransaction;
+	const auto worker = [&](SelectIteratorContainer& conditions, bool isMainThread) noexcept {
+		try {
+			for (auto morsel = nextMorsel.fetch_add(1, std::memory_order_relaxed); morsel < morselsCount;
+				 morsel = nextMorsel.fetch_add(1, std::memory_order_relaxed)) {
+				if (isMainThread && checkCancel) {
+					ThrowOnCancel(rdxCtx);
+				}
+				auto& ids = matched[morsel];
+				for (size_t i = morsel * kMorselSize, to = std::min(i + kMorselSize, size_t(maxIterations)); i < to; ++i) {
+					const auto rowId = IdType::FromNumber(i);
+					const IdType properRowId = sortIndex ? sortIndex->SortOrders()[i] : rowId;
+					const PayloadValue& pv = items[properRowId];
+					if (pv.IsFree()) {
+						continue;
+					}
+					bool finish = false;
+					auto begin = conditions.begin();
+					if (conditions.checkIfSatisfyAllConditions<false>(++begin, conditions.end(), pv, &finish, rowId, properRowId, false)) {
+						ids.emplace_back(rowId);
+					}
+				}
+			}
+		} catch (...) {
+			exWrp.SetException(std::current_exception());
+			nextMorsel.store(morselsCount, std::memory_order_relaxed);
+		}
+	};
+
+	// Workers run on the shared pool's threads, which are idle at the moment. If the pool is busy with the other selects,
+	// the conditions are evaluated by the select loop as usual. Workers' conditions must outlive the workers
+	std::vector<SelectIteratorContainer> workersConditions;
+	SelectWorkersPool::Workers workers(threads - 1);
+	if (!workers.Count()) {
+		return false;
+	}
+	workersConditions.assign(workers.Count(), *this);
+	for (auto& conditions : workersConditions) {
+		workers.Run([&worker, &conditions] { worker(conditions, false); });
+	}
+	worker(*this, true);
+	workers.Wait();
+	exWrp.RethrowException();
+
+	for (const auto& conditions : workersConditions) {
+		mergeMatchedCounts(conditions);
+	}
+	if (ctx_ && ctx_->query.NeedExplain()) {
+		// Conditions, evaluated by the workers, are not the part of the select loop anymore, but still have to be explained
+		parallelScanned_.Append(++cbegin(), cend());
+	}
+
+	size_t total = 0;
+	for (const auto& ids : matched) {
+		total += ids.size();
+	}
+	base_idset result;
+	result.reserve(total);
+	for (const auto& ids : matched) {
+		result.insert(result.end(), ids.begin(), ids.end());
+	}
+
+	Erase(1, Size());
+	auto& first = begin()->Value<SelectIterator>();
+	first.SetIntersection(make_intrusive<intrusive_atomic_rc_wrapper<IdSetPlain>>(std::move(result)), 0);
+	first.name = "-parallel-scan";
+	first.Start(reverse, maxIterations);
+	return true;
+}
+
+void SelectIteratorContainer::mergeMatchedCounts(const SelectIteratorContainer& other) noexcept {
+	assertrx_dbg(Size() == other.Size());
+	for (size_t i = 0, sz = Size(); i < sz; ++i) {
+		Visit(i, Skip<SelectIteratorsBracket, SelectIterator, JoinSelectIterator, AlwaysFalse, AlwaysTrue, KnnRawSelectResult>{},
+			  [&other, i]<concepts::OneOf<ComparatorsPackT> T>(T& comp) noexcept { comp.MergeMatchedCount(other.Get<T>(i)); });
+	}
+}
+
+template <typename T>
+concept ColumnComparator = concepts::OneOf<T, ComparatorIndexed<int>, ComparatorIndexed<int64_t>, ComparatorIndexed<double>>;
+
+bool SelectIteratorContainer::ColumnScan(const NamespaceImpl& ns, bool reverse, int maxIterations, const RdxContext& rdxCtx) {
+	using comparators::ZoneMatch;
+	constexpr size_t kChunkSize = ColumnZoneMap<int>::kChunkSize;
+	static_assert(kChunkSize == ColumnZoneMap<int64_t>::kChunkSize && kChunkSize == ColumnZoneMap<double>::kChunkSize);
+
+	if (maxIterations <= 0 || hasDistinctComparatorsFromPreviousStage() || !isIdset(cbegin(), cend())) {
+		return false;
+	}
+	// Only the conditions, which are not the parts of the OR-chains, may be evaluated separately from the rest of the query
+	h_vector<size_t, 8> columnFilters;
+	for (size_t i = 1, next = 1; i < Size(); i = next) {
+		next = Next(i);
+		if (GetOperation(i) == OpOr || (next < Size() && GetOperation(next) == OpOr)) {
+			continue;
+		}
+		if (Visit(
+				i, [maxIterations](const ColumnComparator auto& c) noexcept { return c.IsColumnScanAvailable(maxIterations); },
+				[](const auto&) noexcept { return false; })) {
+			columnFilters.emplace_back(i);
+		}
+	}
+	if (columnFilters.empty()) {
+		return false;
+	}
+
+	base_idset result;
+	std::array<uint64_t, comparators::ColumnBitmapWords(kChunkSize)> selection, matched;
+	const auto& items = ns.items_;
+	const bool checkCancel = !ctx_ || !ctx_->inTransaction;
+	for (size_t chunk = 0, from = 0; from < size_t(maxIterations); ++chunk, from += kChunkSize) {
+		if (checkCancel && (chunk % 64) == 0) {
+			ThrowOnCancel(rdxCtx);
+		}
+		const size_t count = std::min(kChunkSize, size_t(maxIterations) - from);
+		const size_t words = comparators::ColumnBitmapWords(count);
+		std::fill_n(selection.begin(), words, ~uint64_t(0));
+		if (count % 64) {
+			selection[words - 1] = (uint64_t(1) << (count % 64)) - 1;
+		}
+		bool empty = false;
+		for (size_t i : columnFilters) {
+			const bool isNot = GetOperation(i) == OpNot;
+			Visit(
+				i,
+				[&](const ColumnComparator auto& c) noexcept {
+					switch (c.MatchColumnZone(chunk)) {
+						case ZoneMatch::None:
+							empty = !isNot;
+							break;
+						case ZoneMatch::All:
+							empty = isNot;
+							break;
+						case ZoneMatch::Some:
+							c.CompareColumnChunk(chunk, count, matched.data());
+							for (size_t w = 0; w < words; ++w) {
+								selection[w] &= isNot ? ~matched[w] : matched[w];
+							}
+							break;
+					}
+				},
+				[](const auto&) noexcept { assertrx_dbg(false); });
+			if (empty) {
+				break;
+			}
+		}
+		if (empty) {
+			continue;
+		}
+		for (size_t w = 0; w < words; ++w) {
+			for (uint64_t bits = selection[w]; bits; bits &= bits - 1) {
+				const auto rowId = IdType::FromNumber(from + w * 64 + std::countr_zero(bits));
+				if (!items[rowId].IsFree()) {
+					result.emplace_back(rowId);
+				}
+			}
+		}
+	}
+
+	for (auto it = columnFilters.rbegin(); it != columnFilters.rend(); ++it) {
+		Erase(*it, *it + 1);
+	}
+	auto& first = begin()->Value<SelectIterator>();
+	first.SetIntersection(make_intrusive<intrusive_atomic_rc_wrapper<IdSetPlain>>(std::move(result)), 0);
+	first.name = "-column-scan";
+	first.Start(reverse, maxIterations);
+	return true;
+}
+
 SelectKeyResults SelectIteratorContainer::processQueryEntry(const QueryEntry& qe, const NamespaceImpl& ns, StrictMode strictMode) {
 	if (!qe.HaveEmptyField()) {
 		return ComparatorNotIndexed{qe.FieldName(), qe.Condition(), qe.Values(), ns.payloadType_, qe.Fields().getTagsPath(0),
@@ -716,6 +994,9 @@ SelectKeyResult SelectIteratorContainer::processKnnQueryEntry(const QueryPreproc
 	} else {
 		KnnCtx knnCtx{ranks};
 		knnCtx.NeedSort(NeedSort(ctx_->sortingContext.entries.empty()));
+		if (idx.IsQuantized()) {
+			knnCtx.SetOriginalVectorLoader([&ns, &idx](FloatVectorId id) { return ns.getFloatVector(id, idx); });
+		}
 		return idx.Select(qe.Value(), qe.Params(), knnCtx, rdxCtx);
 	}
 }
@@ -743,6 +1024,9 @@ void SelectIteratorContainer::ExplainJSON(int iters, JsonBuilder& builder, const
 	if (!preservedDistincts_.Empty()) [[unlikely]] {
 		std::ignore = explainJSON(preservedDistincts_.cbegin(), preservedDistincts_.cend(), iters, builder, nullptr);
 	}
+	if (!parallelScanned_.Empty()) {
+		explainParallelScanJSON(iters, builder, js);
+	}
 }
 
 void SelectIteratorContainer::Clear(bool preserveDistincts) {
@@ -777,6 +1061,7 @@ void SelectIteratorContainer::Clear(bool preserveDistincts) {
 		}
 	}
 	clear();
+	parallelScanned_.clear();
 
 	maxIterations_ = std::numeric_limits<int>::max();
 }
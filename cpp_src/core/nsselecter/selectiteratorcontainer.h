@@ -88,6 +88,20 @@ public:
 	bool HasIdsets() const;
 	// Check NOT or comparator must not be 1st
 	void CheckFirstQuery();
+	// Intersects plain idsets of the top level AND-chain in advance and replaces the 1st iterator's idset with the result.
+	// Must be called for the started iterators after CheckFirstQuery()
+	// @param requiredMatches - count of the matched items, after which the select loop stops (offset + limit)
+	void IntersectIdsets(bool reverse, int maxIterations, size_t requiredMatches);
+	// Evaluates the conditions of the full ids range scan by morsels in the parallel threads and replaces them with the single iterator
+	// over the matched ids. Workers are borrowed from the shared pool, their matched counters are summed up for the explain.
+	// Must be called for the started iterators after CheckFirstQuery()
+	// @return false, if the conditions can not be evaluated in parallel
+	bool ParallelScan(const NamespaceImpl&, const Index* sortIndex, unsigned threads, bool reverse, int maxIterations, const RdxContext&);
+	// Evaluates the numeric column conditions of the full ids range scan's top level AND-chain by the vectorized kernels chunk by chunk,
+	// skipping the chunks by the columns' zone maps, and replaces the 1st iterator with the matched ids. The rest of the conditions remain
+	// for the select loop. Must be called for the started iterators after CheckFirstQuery()
+	// @return false, if there are no conditions for the column scan
+	bool ColumnScan(const NamespaceImpl&, bool reverse, int maxIterations, const RdxContext&);
 	void PrepareIteratorsForSelectLoop(QueryPreprocessor&, unsigned sortId, QueryRankType, RankSortType, const NamespaceImpl&,
 									   FtFunction::Ptr&, RanksHolder::Ptr&, const RdxContext&);
 	template <bool reverse>
@@ -169,9 +183,12 @@ private:
 									 bool match);
 	static std::string explainJSON(const_iterator it, const_iterator to, int iters, JsonBuilder& builder,
 								   const std::vector<joins::ItemsProcessor>*);
+	void explainParallelScanJSON(int iters, JsonBuilder& builder, const std::vector<joins::ItemsProcessor>*) const;
 	template <bool reverse>
 	static IdType getNextItemId(const_iterator begin, const_iterator end, IdType from);
 	static bool isIdset(const_iterator it, const_iterator end);
+	static bool isParallelScanAllowed(const_iterator begin, const_iterator end);
+	void mergeMatchedCounts(const SelectIteratorContainer&) noexcept;
 	static bool markBracketsHavingJoins(iterator begin, iterator end) noexcept;
 	bool haveJoins(size_t i) const noexcept;
 
@@ -215,6 +232,10 @@ private:
 	bool streamingKnnMode_ = false;
 	struct : Base {
 	} preservedDistincts_;
+	// Conditions, which were evaluated by the parallel scan's workers. Kept for the explain only
+	struct : Base {
+		using Base::clear;
+	} parallelScanned_;
 };
 
 }  // namespace reindexer
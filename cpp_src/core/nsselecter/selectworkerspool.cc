@@ -0,0 +1,96 @@
+#include "selectworkerspool.h"
+
+#include "estl/lock.h"
+#include "tools/assertrx.h"
+#include "tools/hardware_concurrency.h"
+
+namespace reindexer {
+
+SelectWorkersPool::Workers::Workers(unsigned maxCount) noexcept : reserved_(maxCount ? instance().reserve(maxCount) : 0) {}
+
+SelectWorkersPool::Workers::~Workers() {
+	Wait();
+	if (reserved_ > started_) {
+		instance().release(reserved_ - started_);
+	}
+}
+
+void SelectWorkersPool::Workers::Run(std::function<void()>&& task) {
+	assertrx_throw(started_ < reserved_);
+	instance().push([this, task = std::move(task)] {
+		task();
+		lock_guard lck(mtx_);
+		++finished_;
+		// Notification under the lock, because the awaiting select destroys this object right after the wake up
+		cond_.notify_all();
+	});
+	++started_;
+}
+
+void SelectWorkersPool::Workers::Wait() noexcept {
+	unique_lock lck(mtx_);
+	cond_.wait(lck, [this]() RX_REQUIRES(mtx_) { return finished_ == started_; });
+}
+
+SelectWorkersPool::SelectWorkersPool(unsigned threads) : idle_(threads) {
+	threads_.reserve(threads);
+	for (unsigned i = 0; i < threads; ++i) {
+		threads_.emplace_back([this] { run(); });
+	}
+}
+
+SelectWorkersPool::~SelectWorkersPool() {
+	{
+		lock_guard lck(mtx_);
+		terminate_ = true;
+	}
+	cond_.notify_all();
+	for (auto& th : threads_) {
+		th.join();
+	}
+}
+
+SelectWorkersPool& SelectWorkersPool::instance() {
+	// The calling thread is the one of the workers too, so the pool does not need a thread for each core
+	static SelectWorkersPool pool(hardware_concurrency() - 1);
+	return pool;
+}
+
+unsigned SelectWorkersPool::reserve(unsigned count) noexcept {
+	unsigned idle = idle_.load(std::memory_order_acquire);
+	unsigned res = 0;
+	do {
+		res = std::min(idle, count);
+		if (!res) {
+			return 0;
+		}
+	} while (!idle_.compare_exchange_weak(idle, idle - res, std::memory_order_acq_rel, std::memory_order_acquire));
+	return res;
+}
+
+void SelectWorkersPool::push(std::function<void()>&& task) {
+	{
+		lock_guard lck(mtx_);
+		tasks_.emplace_back(std::move(task));
+	}
+	cond_.notify_one();
+}
+
+void SelectWorkersPool::run() noexcept {
+	for (;;) {
+		std::function<void()> task;
+		{
+			unique_lock lck(mtx_);
+			cond_.wait(lck, [this]() RX_REQUIRES(mtx_) { return terminate_ || !tasks_.empty(); });
+			if (tasks_.empty()) {
+				return;
+			}
+			task = std::move(tasks_.front());
+			tasks_.pop_front();
+		}
+		task();
+		release(1);
+	}
+}
+
+}  // namespace reindexer
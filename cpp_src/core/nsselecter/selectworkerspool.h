@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "estl/condition_variable.h"
+#include "estl/mutex.h"
+#include "estl/thread_annotation_attributes.h"
+
+namespace reindexer {
+
+// Process-wide bounded pool of the threads for the parallel selects' workers. The selects borrow the idle threads only,
+// so the concurrent parallel selects do not spawn any threads and never wait for each other
+class [[nodiscard]] SelectWorkersPool {
+public:
+	// Pool's threads, reserved by a single select. The unused threads are returned to the pool on destruction
+	class [[nodiscard]] Workers {
+	public:
+		// Reserves up to 'maxCount' idle threads. Less threads (or none) are reserved, if the pool is busy with the other selects
+		explicit Workers(unsigned maxCount) noexcept;
+		Workers(const Workers&) = delete;
+		Workers(Workers&&) = delete;
+		Workers& operator=(const Workers&) = delete;
+		Workers& operator=(Workers&&) = delete;
+		~Workers();
+
+		unsigned Count() const noexcept { return reserved_; }
+		// Runs the task on one of the reserved threads. Must be called Count() times at most. Task must not throw
+		void Run(std::function<void()>&& task);
+		// Awaits all the tasks, started via Run()
+		void Wait() noexcept;
+
+	private:
+		unsigned reserved_ = 0;
+		unsigned started_ = 0;
+		mutex mtx_;
+		condition_variable cond_;
+		unsigned finished_ RX_GUARDED_BY(mtx_) = 0;
+	};
+
+	~SelectWorkersPool();
+
+private:
+	explicit SelectWorkersPool(unsigned threads);
+	static SelectWorkersPool& instance();
+	unsigned reserve(unsigned count) noexcept;
+	void release(unsigned count) noexcept { idle_.fetch_add(count, std::memory_order_acq_rel); }
+	void push(std::function<void()>&& task);
+	void run() noexcept;
+
+	std::atomic<unsigned> idle_;
+	mutex mtx_;
+	condition_variable cond_;
+	std::deque<std::function<void()>> tasks_ RX_GUARDED_BY(mtx_);
+	bool terminate_ RX_GUARDED_BY(mtx_) = false;
+	std::vector<std::thread> threads_;
+};
+
+}  // namespace reindexer
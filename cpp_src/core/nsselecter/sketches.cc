@@ -0,0 +1,402 @@
+#include "sketches.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+#include "core/keyvalue/variant.h"
+#include "tools/assertrx.h"
+#include "tools/errors.h"
+#include "tools/serilize/serializer.h"
+#include "tools/serilize/wrserializer.h"
+#include "vendor/murmurhash/MurmurHash3.h"
+
+namespace reindexer {
+namespace sketch {
+
+namespace {
+
+// Seeds are fixed and differ for the different types of the values
+constexpr uint32_t kHashSeed = 0x5ce7c4e5;
+
+uint64_t hashBytes(const void* data, size_t size, uint32_t typeTag) noexcept {
+	uint64_t hash[2];
+	MurmurHash3_x64_128(data, int(size), kHashSeed + typeTag, hash);
+	return hash[0];
+}
+
+}  // namespace
+
+uint64_t HashValue(const Variant& v) noexcept {
+	// Hashes of the values bytes do not depend on the std::hash implementation. Int and int64 values have the same hashes
+	return v.Type().EvaluateOneOf(
+		[&](concepts::OneOf<KeyValueType::Int, KeyValueType::Int64> auto) noexcept {
+			const auto value = int64_t(v);
+			return hashBytes(&value, sizeof(value), 0);
+		},
+		[&](KeyValueType::Bool) noexcept {
+			const uint8_t value = bool(v);
+			return hashBytes(&value, sizeof(value), 1);
+		},
+		[&](KeyValueType::Double) noexcept {
+			// Adding of the positive zero turns the negative zero into the positive one, so the equal zeros have the same hashes
+			const double value = double(v) + 0.0;
+			return hashBytes(&value, sizeof(value), 2);
+		},
+		[&](KeyValueType::Float) noexcept {
+			const float value = float(v) + 0.0f;
+			return hashBytes(&value, sizeof(value), 3);
+		},
+		[&](KeyValueType::String) noexcept {
+			const auto value = std::string_view(v);
+			return hashBytes(value.data(), value.size(), 4);
+		},
+		[&](KeyValueType::Uuid) noexcept {
+			char value[Uuid::kStrFormLen];
+			try {
+				Uuid{v}.PutToStr(value);
+			} catch (...) {
+				// Supressing clang-tidy warning. Never expect this
+				std::terminate();
+			}
+			return hashBytes(value, sizeof(value), 5);
+		},
+		[](KeyValueType::Null) noexcept { return hashBytes(nullptr, 0, 6); },
+		[&](concepts::OneOf<KeyValueType::Tuple, KeyValueType::Composite, KeyValueType::Undefined, KeyValueType::FloatVector> auto) noexcept
+			-> uint64_t {
+#ifdef NDEBUG
+			abort();
+#else
+			assertf(false, "Unexpected variant type: {}", v.Type().Name());
+#endif
+		});
+}
+
+enum class [[nodiscard]] HLLMode : uint8_t { Sparse = 0, Dense = 1 };
+
+void HyperLogLog::Add(uint64_t hash) {
+	if (!IsSparse()) {
+		addDense(hash);
+		return;
+	}
+	sparse_.insert(hash);
+	if (sparse_.size() > kMaxSparseSize) {
+		toDense();
+	}
+}
+
+void HyperLogLog::addDense(uint64_t hash) noexcept {
+	const size_t idx = hash >> (64 - kPrecision);
+	// The marker bit limits the rank in case of the zero tail
+	const uint64_t tail = (hash << kPrecision) | (uint64_t(1) << (kPrecision - 1));
+	const uint8_t rank = std::countl_zero(tail) + 1;
+	registers_[idx] = std::max(registers_[idx], rank);
+}
+
+void HyperLogLog::toDense() {
+	registers_.assign(kRegistersCount, 0);
+	for (uint64_t h : sparse_) {
+		addDense(h);
+	}
+	std::unordered_set<uint64_t>{}.swap(sparse_);
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+	if (other.IsSparse()) {
+		for (uint64_t h : other.sparse_) {
+			Add(h);
+		}
+		return;
+	}
+	if (IsSparse()) {
+		toDense();
+	}
+	for (size_t i = 0; i < kRegistersCount; ++i) {
+		registers_[i] = std::max(registers_[i], other.registers_[i]);
+	}
+}
+
+double HyperLogLog::Estimate() const noexcept {
+	if (IsSparse()) {
+		return sparse_.size();
+	}
+	constexpr double m = kRegistersCount;
+	constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+	double sum = 0.0;
+	size_t zeros = 0;
+	for (uint8_t r : registers_) {
+		sum += std::ldexp(1.0, -int(r));
+		zeros += (r == 0);
+	}
+	const double estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && zeros) {
+		// Linear counting is more precise for the small cardinalities
+		return m * std::log(m / double(zeros));
+	}
+	return estimate;
+}
+
+void HyperLogLog::Serialize(WrSerializer& ser) const {
+	if (IsSparse()) {
+		ser.PutUInt8(uint8_t(HLLMode::Sparse));
+		ser.PutVarUint(sparse_.size());
+		for (uint64_t h : sparse_) {
+			ser.PutUInt64(h);
+		}
+	} else {
+		ser.PutUInt8(uint8_t(HLLMode::Dense));
+		ser.PutSlice(std::string_view(reinterpret_cast<const char*>(registers_.data()), registers_.size()));
+	}
+}
+
+HyperLogLog HyperLogLog::Deserialize(Serializer& ser) {
+	HyperLogLog ret;
+	switch (HLLMode(ser.GetUInt8())) {
+		case HLLMode::Sparse:
+			for (size_t i = 0, size = ser.GetVarUInt(); i < size; ++i) {
+				ret.Add(ser.GetUInt64());
+			}
+			break;
+		case HLLMode::Dense: {
+			const std::string_view regs = ser.GetSlice();
+			if (regs.size() != kRegistersCount) {
+				throw Error(errParseBin, "Unexpected HyperLogLog registers count: {}", regs.size());
+			}
+			ret.registers_.assign(regs.begin(), regs.end());
+			break;
+		}
+		default:
+			throw Error(errParseBin, "Unexpected HyperLogLog sketch mode");
+	}
+	return ret;
+}
+
+void TDigest::Add(double value, double weight) {
+	if (TotalWeight() <= 0.0) {
+		min_ = max_ = value;
+	} else {
+		min_ = std::min(min_, value);
+		max_ = std::max(max_, value);
+	}
+	buffer_.push_back({value, weight});
+	bufferedWeight_ += weight;
+	if (buffer_.size() >= bufferLimit()) {
+		compress();
+	}
+}
+
+void TDigest::Merge(const TDigest& other) {
+	if (other.TotalWeight() <= 0.0) {
+		return;
+	}
+	if (TotalWeight() <= 0.0) {
+		min_ = other.min_;
+		max_ = other.max_;
+	} else {
+		min_ = std::min(min_, other.min_);
+		max_ = std::max(max_, other.max_);
+	}
+	buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+	buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+	bufferedWeight_ += other.TotalWeight();
+	compress();
+}
+
+void TDigest::compress() {
+	if (buffer_.empty()) {
+		return;
+	}
+	buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+	std::sort(buffer_.begin(), buffer_.end(), [](const Centroid& lhs, const Centroid& rhs) noexcept { return lhs.mean < rhs.mean; });
+	const double total = totalWeight_ + bufferedWeight_;
+	// k1 scale function: k(q) = delta / (2 * pi) * asin(2 * q - 1). Each centroid may span at most one unit of k
+	const double kScale = compression_ / (2.0 * std::numbers::pi);
+	const auto weightLimit = [&](double weightSoFar) noexcept {
+		const double k = kScale * std::asin(2.0 * std::min(weightSoFar / total, 1.0) - 1.0) + 1.0;
+		if (k >= compression_ / 4.0) {
+			return total;
+		}
+		return total * (std::sin(k / kScale) + 1.0) / 2.0;
+	};
+
+	centroids_.clear();
+	Centroid cur = buffer_.front();
+	double weightSoFar = 0.0;
+	double limit = weightLimit(weightSoFar);
+	for (size_t i = 1; i < buffer_.size(); ++i) {
+		const Centroid& next = buffer_[i];
+		if (weightSoFar + cur.weight + next.weight <= limit) {
+			cur.weight += next.weight;
+			cur.mean += (next.mean - cur.mean) * next.weight / cur.weight;
+		} else {
+			weightSoFar += cur.weight;
+			centroids_.push_back(cur);
+			limit = weightLimit(weightSoFar);
+			cur = next;
+		}
+	}
+	centroids_.push_back(cur);
+	totalWeight_ = total;
+	buffer_.clear();
+	bufferedWeight_ = 0.0;
+}
+
+double TDigest::Quantile(double q) {
+	compress();
+	if (centroids_.empty()) {
+		return 0.0;
+	}
+	q = std::clamp(q, 0.0, 1.0);
+	const double target = q * totalWeight_;
+	double cumulative = 0.0;
+	for (size_t i = 0; i < centroids_.size(); ++i) {
+		const Centroid& c = centroids_[i];
+		const double center = cumulative + c.weight / 2.0;
+		if (target < center) {
+			// Interpolate between the previous centroid's center (or the minimum) and the current one
+			const double leftValue = (i == 0) ? min_ : centroids_[i - 1].mean;
+			const double leftPos = (i == 0) ? 0.0 : cumulative - centroids_[i - 1].weight / 2.0;
+			if (center <= leftPos) {
+				return c.mean;
+			}
+			return leftValue + (c.mean - leftValue) * (target - leftPos) / (center - leftPos);
+		}
+		cumulative += c.weight;
+	}
+	const Centroid& last = centroids_.back();
+	const double lastCenter = totalWeight_ - last.weight / 2.0;
+	if (totalWeight_ <= lastCenter) {
+		return max_;
+	}
+	return last.mean + (max_ - last.mean) * (target - lastCenter) / (totalWeight_ - lastCenter);
+}
+
+void TDigest::Serialize(WrSerializer& ser) {
+	compress();
+	ser.PutDouble(compression_);
+	ser.PutDouble(min_);
+	ser.PutDouble(max_);
+	ser.PutVarUint(centroids_.size());
+	for (const Centroid& c : centroids_) {
+		ser.PutDouble(c.mean);
+		ser.PutDouble(c.weight);
+	}
+}
+
+TDigest TDigest::Deserialize(Serializer& ser) {
+	TDigest ret(ser.GetDouble());
+	if (!(ret.compression_ >= 1.0)) {
+		throw Error(errParseBin, "Unexpected t-digest compression: {}", ret.compression_);
+	}
+	ret.min_ = ser.GetDouble();
+	ret.max_ = ser.GetDouble();
+	const size_t size = ser.GetVarUInt();
+	ret.centroids_.reserve(std::min(size, ret.bufferLimit()));
+	for (size_t i = 0; i < size; ++i) {
+		const double mean = ser.GetDouble();
+		const double weight = ser.GetDouble();
+		ret.centroids_.push_back({mean, weight});
+		ret.totalWeight_ += weight;
+	}
+	return ret;
+}
+
+void SpaceSaving::insert(std::string&& value, Counter counter) {
+	const auto [it, inserted] = counters_.emplace(std::move(value), counter);
+	assertrx_dbg(inserted);
+	(void)inserted;
+	byCount_.insert(&*it);
+}
+
+void SpaceSaving::rebuildOrder() {
+	byCount_.clear();
+	for (const auto& c : counters_) {
+		byCount_.insert(&c);
+	}
+}
+
+void SpaceSaving::Add(std::string&& value, int64_t count) {
+	if (const auto it = counters_.find(value); it != counters_.end()) {
+		byCount_.erase(&*it);
+		it->second.count += count;
+		byCount_.insert(&*it);
+		return;
+	}
+	if (counters_.size() < capacity_) {
+		insert(std::move(value), {count, 0});
+		return;
+	}
+	// Replace the least frequent item. Its count is the upper bound of the new item's missed occurrences
+	const auto minIt = byCount_.begin();
+	const CounterPtr minPtr = *minIt;
+	const int64_t minCnt = minPtr->second.count;
+	byCount_.erase(minIt);
+	counters_.erase(counters_.find(minPtr->first));
+	insert(std::move(value), {minCnt + count, minCnt});
+}
+
+void SpaceSaving::Merge(const SpaceSaving& other) {
+	// Mergeable summaries: the item, missing in one of the summaries, may have up to its minimal count there
+	const int64_t thisMin = minCount();
+	const int64_t otherMin = other.minCount();
+	std::vector<Item> items;
+	items.reserve(counters_.size() + other.counters_.size());
+	for (const auto& [value, c] : counters_) {
+		if (const auto it = other.counters_.find(value); it != other.counters_.end()) {
+			items.push_back({value, c.count + it->second.count, c.error + it->second.error});
+		} else {
+			items.push_back({value, c.count + otherMin, c.error + otherMin});
+		}
+	}
+	for (const auto& [value, c] : other.counters_) {
+		if (counters_.find(value) == counters_.end()) {
+			items.push_back({value, c.count + thisMin, c.error + thisMin});
+		}
+	}
+	const auto byCountDesc = [](const Item& lhs, const Item& rhs) noexcept {
+		return lhs.count == rhs.count ? lhs.value < rhs.value : lhs.count > rhs.count;
+	};
+	if (items.size() > capacity_) {
+		std::nth_element(items.begin(), items.begin() + capacity_, items.end(), byCountDesc);
+		items.resize(capacity_);
+	}
+	byCount_.clear();
+	counters_.clear();
+	for (auto& item : items) {
+		insert(std::move(item.value), {item.count, item.error});
+	}
+}
+
+std::vector<SpaceSaving::Item> SpaceSaving::Top(size_t k) const {
+	std::vector<Item> items;
+	items.reserve(std::min(k, counters_.size()));
+	for (auto it = byCount_.rbegin(); it != byCount_.rend() && items.size() < k; ++it) {
+		items.push_back({(*it)->first, (*it)->second.count, (*it)->second.error});
+	}
+	return items;
+}
+
+void SpaceSaving::Serialize(WrSerializer& ser) const {
+	ser.PutVarUint(capacity_);
+	ser.PutVarUint(counters_.size());
+	for (const auto& [value, c] : counters_) {
+		ser.PutVString(value);
+		ser.PutVarUint(c.count);
+		ser.PutVarUint(c.error);
+	}
+}
+
+SpaceSaving SpaceSaving::Deserialize(Serializer& ser) {
+	SpaceSaving ret(ser.GetVarUInt());
+	for (size_t i = 0, size = ser.GetVarUInt(); i < size; ++i) {
+		std::string value(ser.GetVString());
+		const int64_t count = ser.GetVarUInt();
+		const int64_t error = ser.GetVarUInt();
+		if (ret.counters_.size() < ret.capacity_ && ret.counters_.find(value) == ret.counters_.end()) {
+			ret.insert(std::move(value), {count, error});
+		}
+	}
+	return ret;
+}
+
+}  // namespace sketch
+}  // namespace reindexer
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace reindexer {
+
+class WrSerializer;
+class Serializer;
+class Variant;
+
+namespace sketch {
+
+// Seeded MurmurHash3 of the value's bytes, which is stable between the processes. It is used to merge sketches, built on different shards
+uint64_t HashValue(const Variant&) noexcept;
+
+// HyperLogLog cardinality estimator. Small sets are stored as the exact set of the hashes (sparse mode), so the estimation is exact
+// until the set grows over kMaxSparseSize, after that it switches to the dense registers with the ~0.8% standard error
+class [[nodiscard]] HyperLogLog {
+public:
+	static constexpr unsigned kPrecision = 14;
+	static constexpr size_t kRegistersCount = size_t(1) << kPrecision;
+	static constexpr size_t kMaxSparseSize = 2048;
+
+	void Add(uint64_t hash);
+	void Merge(const HyperLogLog&);
+	double Estimate() const noexcept;
+	bool IsSparse() const noexcept { return registers_.empty(); }
+
+	void Serialize(WrSerializer&) const;
+	static HyperLogLog Deserialize(Serializer&);
+
+private:
+	void toDense();
+	void addDense(uint64_t hash) noexcept;
+
+	std::unordered_set<uint64_t> sparse_;
+	std::vector<uint8_t> registers_;
+};
+
+// Merging t-digest quantiles estimator with the k1 (arcsine) scale function. The memory is bounded by the compression factor,
+// the error is the smallest near the tails of the distribution
+class [[nodiscard]] TDigest {
+public:
+	static constexpr double kDefaultCompression = 100.0;
+
+	explicit TDigest(double compression = kDefaultCompression) noexcept : compression_(compression) {}
+
+	void Add(double value, double weight = 1.0);
+	void Merge(const TDigest&);
+	// 'q' is in the range [0, 1]
+	double Quantile(double q);
+	double TotalWeight() const noexcept { return totalWeight_ + bufferedWeight_; }
+
+	void Serialize(WrSerializer&);
+	static TDigest Deserialize(Serializer&);
+
+private:
+	struct [[nodiscard]] Centroid {
+		double mean;
+		double weight;
+	};
+
+	void compress();
+	size_t bufferLimit() const noexcept { return size_t(compression_) * 5; }
+
+	double compression_;
+	std::vector<Centroid> centroids_;
+	std::vector<Centroid> buffer_;
+	double totalWeight_ = 0.0;
+	double bufferedWeight_ = 0.0;
+	double min_ = 0.0;
+	double max_ = 0.0;
+};
+
+// Space-Saving heavy hitters summary. Keeps at most 'capacity' counters; the estimated count of each reported item overestimates
+// the real count by no more than the item's error
+class [[nodiscard]] SpaceSaving {
+public:
+	struct [[nodiscard]] Item {
+		std::string value;
+		int64_t count;
+		int64_t error;
+	};
+
+	explicit SpaceSaving(size_t capacity) : capacity_(capacity) {}
+	SpaceSaving(const SpaceSaving& other) : capacity_(other.capacity_), counters_(other.counters_) { rebuildOrder(); }
+	SpaceSaving(SpaceSaving&&) noexcept = default;
+	SpaceSaving& operator=(const SpaceSaving& other) {
+		if (this != &other) {
+			*this = SpaceSaving(other);
+		}
+		return *this;
+	}
+	SpaceSaving& operator=(SpaceSaving&&) noexcept = default;
+
+	void Add(std::string&& value, int64_t count = 1);
+	void Merge(const SpaceSaving&);
+	// Returns up to 'k' items with the highest estimated counts
+	std::vector<Item> Top(size_t k) const;
+	size_t Capacity() const noexcept { return capacity_; }
+
+	void Serialize(WrSerializer&) const;
+	static SpaceSaving Deserialize(Serializer&);
+
+private:
+	struct [[nodiscard]] Counter {
+		int64_t count;
+		int64_t error;
+	};
+	using CountersMap = std::unordered_map<std::string, Counter>;
+	// The map's nodes are stable, so the order index may keep the pointers to them
+	using CounterPtr = const CountersMap::value_type*;
+	struct [[nodiscard]] MinOrder {
+		bool operator()(CounterPtr lhs, CounterPtr rhs) const noexcept {
+			return lhs->second.count == rhs->second.count ? lhs->first < rhs->first : lhs->second.count < rhs->second.count;
+		}
+	};
+
+	void insert(std::string&& value, Counter);
+	void rebuildOrder();
+	int64_t minCount() const noexcept { return (counters_.size() < capacity_ || byCount_.empty()) ? 0 : (*byCount_.begin())->second.count; }
+
+	size_t capacity_;
+	CountersMap counters_;
+	std::set<CounterPtr, MinOrder> byCount_;
+};
+
+}  // namespace sketch
+}  // namespace reindexer
@@ -0,0 +1,99 @@
+#include "topksortbuffer.h"
+#include <algorithm>
+#include "core/queryresults/localqueryresults.h"
+#include "selectctx.h"
+
+namespace reindexer {
+
+// Minimal count of the items, which are added between the buffer's shrinks
+constexpr static size_t kMinTopKBufferIncrement = 1024;
+
+static const ItemRef& asItemRef(const ItemRef& item) noexcept { return item; }
+static const ItemRef& asItemRef(const ItemRefRanked& item) noexcept { return item.NotRanked(); }
+
+static void setSortExprResultsIdx(ItemRef& item, unsigned idx) noexcept { item = ItemRef{item.Id(), idx, item.Nsid()}; }
+static void setSortExprResultsIdx(ItemRefRanked& item, unsigned idx) noexcept {
+	item = ItemRefRanked{item.Rank(), item.NotRanked().Id(), idx, item.NotRanked().Nsid()};
+}
+
+size_t SortBufferMemory(const LocalQueryResults& result, const SortingContext& sortingCtx, size_t initCount) noexcept {
+	const size_t count = result.Count() > initCount ? result.Count() - initCount : 0;
+	size_t memory = count * (result.haveRank ? sizeof(ItemRefRanked) : sizeof(ItemRef));
+	for (const auto& exprResults : sortingCtx.exprResults) {
+		memory += exprResults.size() * sizeof(double);
+	}
+	return memory;
+}
+
+TopKSortBuffer::TopKSortBuffer(const NamespaceImpl& ns, SelectCtx& ctx, const joins::NamespaceResults* jr, size_t initCount, size_t k)
+	: ctx_{ctx}, comparator_{ns, ctx, jr}, initCount_{initCount}, k_{k}, maxSize_{k + std::max(k, kMinTopKBufferIncrement)} {
+	assertrx_throw(k_ > 0);
+	comparator_.BindForGeneralSort();
+}
+
+void TopKSortBuffer::Push(LocalQueryResults& result) {
+	auto& items = result.Items();
+	assertrx_dbg(items.Size() > initCount_);
+	if (shrunk_) {
+		const bool worse = result.haveRank ? isWorseThanBoundary(items.begin().Ranked() + initCount_, items.end().Ranked() - 1)
+										   : isWorseThanBoundary(items.begin().NotRanked() + initCount_, items.end().NotRanked() - 1);
+		if (worse) {
+			dropLast(result);
+			return;
+		}
+	}
+	if (items.Size() - initCount_ < maxSize_) {
+		return;
+	}
+	peakMemory_ = std::max(peakMemory_, SortBufferMemory(result, ctx_.sortingContext, initCount_));
+	if (result.haveRank) {
+		shrink(items.begin().Ranked() + initCount_, items.end().Ranked());
+	} else {
+		shrink(items.begin().NotRanked() + initCount_, items.end().NotRanked());
+	}
+	items.Erase(items.begin() + (initCount_ + k_), items.end());
+	shrunk_ = true;
+}
+
+template <typename It>
+bool TopKSortBuffer::isWorseThanBoundary(It begin, It last) const {
+	// The k-th item is the worst of the kept items after the shrink
+	return !comparator_(asItemRef(*last), asItemRef(*(begin + (k_ - 1))));
+}
+
+template <typename It>
+void TopKSortBuffer::shrink(It begin, It end) {
+	std::nth_element(begin, begin + (k_ - 1), end,
+					 [this](const auto& lhs, const auto& rhs) { return comparator_(asItemRef(lhs), asItemRef(rhs)); });
+	if (ctx_.sortingContext.expressions.empty()) {
+		return;
+	}
+	// Results of the sort expressions of the kept items are moved into the beginning of the arrays
+	const It kept = begin + k_;
+	for (auto& exprResults : ctx_.sortingContext.exprResults) {
+		h_vector<double, 32> keptResults;
+		keptResults.reserve(maxSize_);
+		for (It it = begin; it != kept; ++it) {
+			keptResults.push_back(exprResults[asItemRef(*it).SortExprResultsIdx()]);
+		}
+		exprResults = std::move(keptResults);
+	}
+	unsigned idx = 0;
+	for (It it = begin; it != kept; ++it) {
+		setSortExprResultsIdx(*it, idx++);
+	}
+}
+
+void TopKSortBuffer::dropLast(LocalQueryResults& result) {
+	auto& items = result.Items();
+	if (!ctx_.sortingContext.expressions.empty()) {
+		assertrx_dbg(!items.Back().ValueInitialized());
+		for (auto& exprResults : ctx_.sortingContext.exprResults) {
+			assertrx_dbg(items.Back().SortExprResultsIdx() + 1 == exprResults.size());
+			exprResults.pop_back();
+		}
+	}
+	items.Erase(items.end() - 1, items.end());
+}
+
+}  // namespace reindexer
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "itemcomparator.h"
+
+namespace reindexer {
+
+class LocalQueryResults;
+struct SelectCtx;
+
+// Memory size of the results, which are held for the post-loop sorting: the item refs (starting from 'initCount') and the results of the
+// sort expressions
+size_t SortBufferMemory(const LocalQueryResults&, const SortingContext&, size_t initCount) noexcept;
+
+// Bounded buffer of the select loop's results for the general sort with limit (and offset).
+// Only 'offset + limit' of the best items are required for the result, so the worst of the items (and their sort expressions' results) are
+// dropped each time the buffer contains 'k' more items. After the first drop, the new items, which are not better than the current k-th
+// one, are dropped immediately. The order of the items is strict (the row id is compared for the equal items), so the result is the same
+// as for the sort of all of the matched items
+class [[nodiscard]] TopKSortBuffer {
+public:
+	TopKSortBuffer(const NamespaceImpl& ns, SelectCtx& ctx, const joins::NamespaceResults* jr, size_t initCount, size_t k);
+
+	// Must be called right after the item was added into the results
+	void Push(LocalQueryResults&);
+	size_t PeakMemory() const noexcept { return peakMemory_; }
+
+private:
+	template <typename It>
+	bool isWorseThanBoundary(It begin, It last) const;
+	template <typename It>
+	void shrink(It begin, It end);
+	void dropLast(LocalQueryResults&);
+
+	SelectCtx& ctx_;
+	ItemComparator comparator_;
+	const size_t initCount_;
+	const size_t k_;
+	const size_t maxSize_;
+	bool shrunk_ = false;
+	size_t peakMemory_ = 0;
+};
+
+}  // namespace reindexer
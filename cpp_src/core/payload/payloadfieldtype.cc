@@ -31,7 +31,8 @@ std::shared_ptr<T> createEmbedder(std::string_view nsName, std::string_view idxN
 	}
 
 	const auto& opts = cfg.value();
-	EmbedderConfig embedderCfg{CacheTag{opts.cacheTag}, opts.fields, convert(opts.strategy)};
+	EmbedderConfig embedderCfg{CacheTag{opts.cacheTag}, opts.fields, convert(opts.strategy),
+							   BatchingConfig{opts.batching.max_items, opts.batching.max_delay_ms}};
 	PoolConfig poolCfg{opts.pool.connections, opts.endpointUrl, opts.pool.connect_timeout_ms, opts.pool.read_timeout_ms,
 					   opts.pool.write_timeout_ms};
 	const auto embedderName = opts.name.empty() ? std::string{nsName} + "_" + toLower(idxName) : toLower(opts.name);
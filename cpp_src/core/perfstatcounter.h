@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cstdlib>
+#include <limits>
 #include <vector>
 #include "estl/dummy_mutex.h"
 #include "estl/lock.h"
@@ -164,4 +168,35 @@ using QuantityCounterMT = QuantityCounter<IntT, mutex>;
 template <typename IntT>
 using QuantityCounterST = QuantityCounter<IntT, DummyMutex>;
 
+/// Lock-free histogram with the exponential buckets: [0, 1], (1, 2], (2, 4], ..., (2^(N-2), +inf)
+template <size_t N>
+class [[nodiscard]] PerfStatHistogram {
+	static_assert(N > 1 && N < 64);
+
+public:
+	void Hit(uint64_t value) noexcept {
+		const size_t idx = (value <= 1) ? 0 : std::min<size_t>(std::bit_width(value - 1), N - 1);
+		buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+	}
+	void Reset() noexcept {
+		for (auto& b : buckets_) {
+			b.store(0, std::memory_order_relaxed);
+		}
+	}
+	// Upper bound of the last bucket is std::numeric_limits<uint64_t>::max()
+	template <typename T>
+	T Get() const {
+		T result;
+		result.reserve(N);
+		for (size_t i = 0; i < N; ++i) {
+			result.emplace_back(typename T::value_type{.upperBound = (i == N - 1) ? std::numeric_limits<uint64_t>::max() : (uint64_t(1) << i),
+													   .count = buckets_[i].load(std::memory_order_relaxed)});
+		}
+		return result;
+	}
+
+private:
+	std::array<std::atomic<uint64_t>, N> buckets_{};
+};
+
 }  // namespace reindexer
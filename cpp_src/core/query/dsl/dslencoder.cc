@@ -153,6 +153,9 @@ static void encodeAggregationFunctions(const Query& query, JsonBuilder& builder)
 			case AggMax:
 			case AggCount:
 			case AggCountCached:
+			case AggApproxCountDistinct:
+			case AggPercentile:
+			case AggTopKApprox:
 			case AggUnknown:
 			default:
 				break;
@@ -164,6 +167,12 @@ static void encodeAggregationFunctions(const Query& query, JsonBuilder& builder)
 		if (entry.Offset() != QueryEntry::kDefaultOffset) {
 			aggNode.Put("offset"sv, entry.Offset());
 		}
+		if (!entry.Percentiles().empty()) {
+			auto percentilesNode = aggNode.Array("percentiles"sv);
+			for (double rank : entry.Percentiles()) {
+				percentilesNode.Put(TagName::Empty(), rank);
+			}
+		}
 		auto fldNode = aggNode.Array("fields"sv);
 		for (const auto& field : entry.Fields()) {
 			fldNode.Put(TagName::Empty(), field);
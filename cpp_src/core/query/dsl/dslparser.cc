@@ -42,7 +42,7 @@ enum class [[nodiscard]] Root {
 enum class [[nodiscard]] Sort { Desc, Field, Values };
 enum class [[nodiscard]] JoinRoot { Type, On, Namespace, Filters, Sort, Limit, Offset, SelectFilter };
 enum class [[nodiscard]] JoinEntry { LeftField, RightField, Cond, Op };
-enum class [[nodiscard]] Aggregation { Fields, Type, Sort, Limit, Offset };
+enum class [[nodiscard]] Aggregation { Fields, Type, Sort, Limit, Offset, Percentiles };
 enum class [[nodiscard]] EqualPosition { Positions };
 enum class [[nodiscard]] UpdateField { Name, Type, Values, IsArray };
 enum class [[nodiscard]] UpdateFieldType { Object, Expression, Value };
@@ -122,7 +122,8 @@ constexpr static auto kAggregationMap = MakeFastStrMap<Aggregation>({{"fields",
 																	 {"type", Aggregation::Type},
 																	 {"sort", Aggregation::Sort},
 																	 {"limit", Aggregation::Limit},
-																	 {"offset", Aggregation::Offset}});
+																	 {"offset", Aggregation::Offset},
+																	 {"percentiles", Aggregation::Percentiles}});
 constexpr static auto kAggregationTypes = MakeFastStrMap<AggType>({
 	{"sum", AggSum},
 	{"avg", AggAvg},
@@ -132,6 +133,9 @@ constexpr static auto kAggregationTypes = MakeFastStrMap<AggType>({
 	{"distinct", AggDistinct},
 	{"count", AggCount},
 	{"count_cached", AggCountCached},
+	{"approx_count_distinct", AggApproxCountDistinct},
+	{"percentile", AggPercentile},
+	{"top_k_approx", AggTopKApprox},
 });
 
 // additional for parse field 'equation_positions'
@@ -648,6 +652,7 @@ static void parseAggregation(const JsonValue& aggregation, Query& query) {
 	SortingEntries sortingEntries;
 	unsigned limit{QueryEntry::kDefaultLimit};
 	unsigned offset{QueryEntry::kDefaultOffset};
+	h_vector<double, 1> percentiles;
 	for (const auto& element : aggregation) {
 		auto& value = element.value;
 		std::string_view name = element.key;
@@ -683,9 +688,19 @@ static void parseAggregation(const JsonValue& aggregation, Query& query) {
 				checkJsonValueType(value, name, JsonTag::NUMBER, JsonTag::DOUBLE);
 				offset = value.toNumber();
 				break;
+			case Aggregation::Percentiles:
+				checkJsonValueType(value, name, JsonTag::ARRAY);
+				for (const auto& subElem : value) {
+					checkJsonValueType(subElem.value, name, JsonTag::NUMBER, JsonTag::DOUBLE);
+					percentiles.emplace_back(subElem.value.toDouble());
+				}
+				break;
 		}
 	}
-	query.aggregations_.emplace_back(type, std::move(fields), std::move(sortingEntries), limit, offset);
+	auto& entry = query.aggregations_.emplace_back(type, std::move(fields), std::move(sortingEntries), limit, offset);
+	for (double rank : percentiles) {
+		entry.AddPercentile(rank);
+	}
 }
 
 static void parseEqualPositions(const JsonValue& dsl, Query& query) {
@@ -78,6 +78,9 @@ void Query::checkSubQueryWithData() const {
 			case AggDistinct:
 			case AggUnknown:
 			case AggFacet:
+			case AggApproxCountDistinct:
+			case AggPercentile:
+			case AggTopKApprox:
 				throw Error{errQueryExec, "Aggregation {} cannot be in subquery", AggTypeToStr(aggregations_[0].Type())};
 			case AggMin:
 			case AggMax:
@@ -138,7 +141,8 @@ bool Query::operator==(const Query& obj) const {
 	if (entries_ != obj.entries_ || aggregations_ != obj.aggregations_ ||
 
 		NsName() != obj.NsName() || sortingEntries_ != obj.sortingEntries_ || CalcTotal() != obj.CalcTotal() || Offset() != obj.Offset() ||
-		Limit() != obj.Limit() || debugLevel_ != obj.debugLevel_ || strictMode_ != obj.strictMode_ || selectFilter_ != obj.selectFilter_ ||
+		Limit() != obj.Limit() || debugLevel_ != obj.debugLevel_ || strictMode_ != obj.strictMode_ ||
+		parallelism_ != obj.parallelism_ || selectFilter_ != obj.selectFilter_ ||
 		selectFunctions_ != obj.selectFunctions_ || joinQueries_ != obj.joinQueries_ || mergeQueries_ != obj.mergeQueries_ ||
 		updateFields_ != obj.updateFields_ || subQueries_ != obj.subQueries_ || forcedSortOrder_.size() != obj.forcedSortOrder_.size()) {
 		return false;
@@ -374,6 +378,9 @@ void Query::deserialize(Serializer& ser) {
 						case QueryAggregationOffset:
 							ae.SetOffset(ser.GetVarUInt());
 							break;
+						case QueryAggregationPercentile:
+							ae.AddPercentile(ser.GetDouble());
+							break;
 						default:
 							ser.SetPos(pos);
 							aggEnd = true;
@@ -420,6 +427,9 @@ void Query::deserialize(Serializer& ser) {
 			case QueryStrictMode:
 				Strict(StrictMode(ser.GetVarUInt()));
 				break;
+			case QueryParallelism:
+				Parallel(ser.GetVarUInt());
+				break;
 			case QueryLimit:
 				count_ = ser.GetVarUInt();
 				break;
@@ -589,6 +599,7 @@ void Query::deserialize(Serializer& ser) {
 			case QueryAggregationSort:
 			case QueryAggregationOffset:
 			case QueryAggregationLimit:
+			case QueryAggregationPercentile:
 			default:
 				throw Error(errParseBin, "Unknown type {} while parsing binary buffer", int(qtype));
 		}
@@ -633,6 +644,10 @@ void Query::Serialize(WrSerializer& ser, uint8_t mode) const {
 				ser.PutVarUint(QueryAggregationOffset);
 				ser.PutVarUint(agg.Offset());
 			}
+			for (double rank : agg.Percentiles()) {
+				ser.PutVarUint(QueryAggregationPercentile);
+				ser.PutDouble(rank);
+			}
 		}
 	}
 
@@ -688,6 +703,10 @@ void Query::Serialize(WrSerializer& ser, uint8_t mode) const {
 			ser.PutVarUint(QueryStrictMode);
 			ser.PutVarUint(int(strictMode_));
 		}
+		if (parallelism_) {
+			ser.PutVarUint(QueryParallelism);
+			ser.PutVarUint(parallelism_);
+		}
 	}
 
 	for (const auto& funcText : selectFunctions_) {
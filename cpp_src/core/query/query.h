@@ -671,6 +671,16 @@ public:
 	[[nodiscard]] Query&& Strict(StrictMode mode) && noexcept { return std::move(Strict(mode)); }
 	[[nodiscard]] StrictMode GetStrictMode() const noexcept { return strictMode_; }
 
+	/// Sets max number of threads for the full scan evaluation. Actual number is also limited by the namespace config.
+	/// @param threads - threads count. 0 - use namespace config, 1 - disables parallel evaluation.
+	/// @return Query object.
+	Query& Parallel(unsigned threads) & noexcept {
+		walkNested(true, true, true, [threads](Query& q) noexcept { q.parallelism_ = threads; });
+		return *this;
+	}
+	[[nodiscard]] Query&& Parallel(unsigned threads) && noexcept { return std::move(Parallel(threads)); }
+	[[nodiscard]] unsigned GetParallelism() const noexcept { return parallelism_; }
+
 	/// Performs sorting by certain column. Same as sql 'ORDER BY'.
 	/// @param sort - sorting column name.
 	/// @param desc - is sorting direction descending or ascending.
@@ -825,6 +835,24 @@ public:
 									unsigned offset = QueryEntry::kDefaultOffset) && {
 		return std::move(Aggregate(type, std::move(fields), sort, limit, offset));
 	}
+	/// Adds an approximate percentile aggregation for the field.
+	/// @param field - name of the field to be aggregated.
+	/// @param ranks - percentile ranks in the range [0, 100]. The value of the aggregation result is set for the first rank.
+	/// @return Query object ready to be executed.
+	Query& AggregatePercentile(std::string field, const h_vector<double, 1>& ranks) & {
+		if (!CanAddAggregation(AggPercentile)) {
+			throw Error(errConflict, kAggregationWithSelectFieldsMsgError);
+		}
+		AggregateEntry entry{AggPercentile, {std::move(field)}};
+		for (double r : ranks) {
+			entry.AddPercentile(r);
+		}
+		aggregations_.emplace_back(std::move(entry));
+		return *this;
+	}
+	[[nodiscard]] Query&& AggregatePercentile(std::string field, const h_vector<double, 1>& ranks) && {
+		return std::move(AggregatePercentile(std::move(field), ranks));
+	}
 
 	/// Sets next operation type to Or.
 	/// @return Query object.
@@ -1128,6 +1156,7 @@ private:
 	bool withRank_ = false;						   /// Output fulltext/vectors rank in the results
 	StrictMode strictMode_ = StrictModeNotSet;	   /// Strict mode.
 	int debugLevel_ = 0;						   /// Debug level.
+	unsigned parallelism_ = 0;					   /// Max threads count for the full scan evaluation.
 	bool explain_ = false;						   /// Explain query if true
 	OpType nextOp_ = OpAnd;						   /// Next operation constant.
 };
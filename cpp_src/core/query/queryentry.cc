@@ -380,6 +380,9 @@ AggregateEntry::AggregateEntry(AggType type, h_vector<std::string, 1>&& fields,
 		case AggMax:
 		case AggSum:
 		case AggAvg:
+		case AggApproxCountDistinct:
+		case AggPercentile:
+		case AggTopKApprox:
 			if (fields_.size() != 1) {
 				throw Error{errQueryExec, "For aggregation {} is available exactly one field", AggTypeToStr(type_)};
 			}
@@ -401,6 +404,8 @@ AggregateEntry::AggregateEntry(AggType type, h_vector<std::string, 1>&& fields,
 		case AggAvg:
 		case AggCount:
 		case AggCountCached:
+		case AggApproxCountDistinct:
+		case AggPercentile:
 			if (limit_ != QueryEntry::kDefaultLimit || offset_ != QueryEntry::kDefaultOffset) {
 				throw Error(errQueryExec, "Limit or offset are not available for aggregation {}", AggTypeToStr(type_));
 			}
@@ -410,6 +415,14 @@ AggregateEntry::AggregateEntry(AggType type, h_vector<std::string, 1>&& fields,
 			break;
 		case AggUnknown:
 			throw Error{errQueryExec, "Unknown aggregation type"};
+		case AggTopKApprox:
+			if (offset_ != QueryEntry::kDefaultOffset) {
+				throw Error(errQueryExec, "Offset is not available for aggregation {}", AggTypeToStr(type_));
+			}
+			if (!sortingEntries_.empty()) {
+				throw Error(errQueryExec, "Sort is not available for aggregation {}", AggTypeToStr(type_));
+			}
+			break;
 		case AggFacet:
 			break;
 	}
@@ -423,7 +436,7 @@ void AggregateEntry::AddSortingEntry(SortingEntry&& sorting) {
 }
 
 void AggregateEntry::SetLimit(unsigned l) {
-	if (type_ != AggFacet) {
+	if (type_ != AggFacet && type_ != AggTopKApprox) {
 		throw Error(errQueryExec, "Limit or offset are not available for aggregation {}", AggTypeToStr(type_));
 	}
 	limit_ = l;
@@ -436,6 +449,23 @@ void AggregateEntry::SetOffset(unsigned o) {
 	offset_ = o;
 }
 
+bool AggregateEntry::operator==(const AggregateEntry& other) const noexcept {
+	return type_ == other.type_ && fields_ == other.fields_ && sortingEntries_ == other.sortingEntries_ && limit_ == other.limit_ &&
+		   offset_ == other.offset_ &&
+		   std::equal(percentiles_.begin(), percentiles_.end(), other.percentiles_.begin(), other.percentiles_.end(),
+					  [](double lhs, double rhs) noexcept { return fp::ExactlyEqual(lhs, rhs); });
+}
+
+void AggregateEntry::AddPercentile(double rank) {
+	if (type_ != AggPercentile) {
+		throw Error(errQueryExec, "Percentile ranks are not available for aggregation {}", AggTypeToStr(type_));
+	}
+	if (!(rank >= 0.0 && rank <= 100.0)) {
+		throw Error(errQueryExec, "Percentile rank has to be in the range [0, 100], got {}", rank);
+	}
+	percentiles_.emplace_back(rank);
+}
+
 std::string BetweenFieldsQueryEntry::Dump() const {
 	WrSerializer ser;
 	ser << LeftFieldName() << ' ' << Condition() << ' ' << RightFieldName();
@@ -727,8 +727,8 @@ class [[nodiscard]] AggregateEntry {
 public:
 	AggregateEntry(AggType type, h_vector<std::string, 1>&& fields, SortingEntries&& sort = {}, unsigned limit = QueryEntry::kDefaultLimit,
 				   unsigned offset = QueryEntry::kDefaultOffset);
-	bool operator==(const AggregateEntry&) const noexcept = default;
-	bool operator!=(const AggregateEntry& ae) const noexcept = default;
+	bool operator==(const AggregateEntry&) const noexcept;
+	bool operator!=(const AggregateEntry& ae) const noexcept { return !operator==(ae); }
 	AggType Type() const noexcept { return type_; }
 	const h_vector<std::string, 1>& Fields() const noexcept { return fields_; }
 	const SortingEntries& Sorting() const noexcept { return sortingEntries_; }
@@ -741,11 +741,15 @@ public:
 	}
 	void SetLimit(unsigned l);
 	void SetOffset(unsigned o);
+	// Percentile ranks in the range [0, 100]. Available for the 'percentile' aggregation only
+	const h_vector<double, 1>& Percentiles() const noexcept { return percentiles_; }
+	void AddPercentile(double rank);
 
 private:
 	AggType type_{AggUnknown};
 	h_vector<std::string, 1> fields_;
 	SortingEntries sortingEntries_;
+	h_vector<double, 1> percentiles_;
 	unsigned limit_{QueryEntry::kDefaultLimit};
 	unsigned offset_{QueryEntry::kDefaultOffset};
 };
@@ -229,6 +229,10 @@ void SQLEncoder<Formatter>::DumpSQL(bool stripArgs) const {
 							}
 							ser << f;
 						}
+						for (double rank : a.Percentiles()) {
+							formatter_.Comma();
+							ser << rank;
+						}
 						for (const auto& se : a.Sorting()) {
 							formatter_.Next();
 							ser << "ORDER BY " << '\'' << escapeQuotes(se.expression) << '\'' << (se.desc ? " DESC" : " ASC");
@@ -171,10 +171,21 @@ void SQLParser::selectParse(Tokenizer& parser) {
 						throw SqlParserError(range, "Expected field name, but found '{}' in query, {}", tok.Text(), range);
 					}
 					h_vector<std::string, 1> fields{{std::string(tok.Text())}};
+					h_vector<double, 1> percentiles;
 					tok = parser.NextToken();
 					for (tok = parser.PeekToken(); tok.Type() == TokenSymbol && tok.Text() == ","sv; tok = parser.PeekToken()) {
 						parser.SkipToken();
 						tok = peekSqlToken(parser, SingleSelectFieldSqlToken);
+						if (agg == AggPercentile && tok.Type() == TokenNumber) {
+							// percentile(field, rank1, rank2, ...)
+							using namespace double_conversion;
+							static const StringToDoubleConverter converter{StringToDoubleConverter::NO_FLAGS, NAN, NAN, nullptr, nullptr};
+							int countOfCharsParsedAsDoubleDummy = 0;
+							percentiles.emplace_back(
+								converter.StringToDouble(tok.Text().data(), tok.Text().size(), &countOfCharsParsedAsDoubleDummy));
+							tok = parser.NextToken();
+							continue;
+						}
 						if (tok.Type() != TokenName) {
 							const auto range = parser.Where(tok);
 							throw SqlParserError(range, "Expected field name, but found '{}' in query, {}", tok.Text(), range);
@@ -183,6 +194,9 @@ void SQLParser::selectParse(Tokenizer& parser) {
 						tok = parser.NextToken();
 					}
 					AggregateEntry entry{agg, std::move(fields)};
+					for (double rank : percentiles) {
+						entry.AddPercentile(rank);
+					}
 					for (tok = parser.PeekToken(); tok.Text() != ")"sv; tok = parser.PeekToken()) {
 						if (tok.Text() == "order"sv) {
 							parser.SkipToken();
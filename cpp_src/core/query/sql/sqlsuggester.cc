@@ -51,7 +51,9 @@ static const std::unordered_map<SqlTokenType, std::unordered_set<std::string>> s
 	{StartAfterLocal, {"explain", "select"}},
 	{StartAfterExplain, {"select", "delete", "update", "local"}},
 	{StartAfterLocalExplain, {"select"}},
-	{AggregationSqlToken, {"sum", "avg", "max", "min", "facet", "count", "distinct", "rank()", "count_cached", "vectors()"}},
+	{AggregationSqlToken,
+	 {"sum", "avg", "max", "min", "facet", "count", "distinct", "rank()", "count_cached", "vectors()", "approx_count_distinct",
+	  "percentile", "top_k_approx"}},
 	{SelectConditionsStart, {"where", "limit", "offset", "order", "join", "left", "inner", "equal_position", "merge", "or", ";"}},
 	{NestedSelectConditionsStart, {"where", "limit", "offset", "order", "equal_position"}},
 	{ConditionSqlToken, {">", ">=", "<", "<=", "<>", "in", "allset", "range", "is", "==", "="}},
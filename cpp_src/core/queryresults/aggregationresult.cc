@@ -3,12 +3,15 @@
 #include "core/cjson/msgpackbuilder.h"
 #include "core/cjson/protobufbuilder.h"
 #include "core/cjson/protobufschemabuilder.h"
+#include "core/nsselecter/sketches.h"
 #include "core/schema.h"
 #include "gason/gason.h"
 #include "tools/jsontools.h"
+#include "tools/serilize/serializer.h"
 #include "tools/serilize/wrserializer.h"
 #include "vendor/frozen/string.h"
 #include "vendor/frozen/unordered_map.h"
+#include "vendor/base64/base64.h"
 #include "vendor/msgpack/msgpackparser.h"
 
 namespace reindexer {
@@ -22,13 +25,17 @@ constexpr std::string_view Parameters::Count() noexcept { return "count"sv; }
 constexpr std::string_view Parameters::Values() noexcept { return "values"sv; }
 constexpr std::string_view Parameters::Distincts() noexcept { return "distincts"sv; }
 constexpr std::string_view Parameters::Fields() noexcept { return "fields"sv; }
+constexpr std::string_view Parameters::Percentiles() noexcept { return "percentiles"sv; }
+constexpr std::string_view Parameters::Rank() noexcept { return "rank"sv; }
+constexpr std::string_view Parameters::Sketch() noexcept { return "sketch"sv; }
 
 // clang-format off
 constexpr auto kParametersFieldNumbers = frozen::make_unordered_map<frozen::string, TagName>(
 															{{Parameters::Value(),  1_Tag}, {Parameters::Type(),      2_Tag},
 															 {Parameters::Count(),  1_Tag}, {Parameters::Values(),    2_Tag},
 															 {Parameters::Facets(), 3_Tag}, {Parameters::Distincts(), 4_Tag},
-															 {Parameters::Fields(), 5_Tag}});
+															 {Parameters::Fields(), 5_Tag}, {Parameters::Rank(),      2_Tag},
+															 {Parameters::Percentiles(), 6_Tag}, {Parameters::Sketch(), 7_Tag}});
 // clang-format on
 using ParametersFieldsNumbers = decltype(kParametersFieldNumbers);
 
@@ -53,6 +60,12 @@ AggType AggregationResult::StrToAggType(std::string_view type) {
 		return AggCount;
 	} else if (type == "count_cached"sv) {
 		return AggCountCached;
+	} else if (type == "approx_count_distinct"sv) {
+		return AggApproxCountDistinct;
+	} else if (type == "percentile"sv) {
+		return AggPercentile;
+	} else if (type == "top_k_approx"sv) {
+		return AggTopKApprox;
 	}
 	return AggUnknown;
 }
@@ -75,8 +88,100 @@ AggregationResult::AggregationResult(AggType tp, h_vector<std::string, 1>&& name
 AggregationResult::AggregationResult(AggType tp, h_vector<std::string, 1>&& names, std::vector<FacetResult>&& facets) noexcept
 	: type_(tp), fields_(std::move(names)), facets_(std::move(facets)) {}
 
+AggregationResult::AggregationResult(AggType tp, h_vector<std::string, 1>&& names, std::string&& sketch,
+									 std::vector<PercentileResult>&& percentiles) noexcept
+	: type_(tp), fields_(std::move(names)), percentiles_(std::move(percentiles)), sketch_(std::move(sketch)) {}
+
 AggregationResult::~AggregationResult() = default;
 
+void AggregationResult::MergeSketch(const AggregationResult& other) {
+	if (type_ != other.type_ || !HasSketch() || !other.HasSketch()) {
+		throw Error(errLogic, "Unable to merge sketches of the aggregations '{}' and '{}'", AggTypeToStr(type_), AggTypeToStr(other.type_));
+	}
+	Serializer lhs(sketch_), rhs(other.sketch_);
+	WrSerializer ser;
+	switch (type_) {
+		case AggApproxCountDistinct: {
+			auto hll = sketch::HyperLogLog::Deserialize(lhs);
+			hll.Merge(sketch::HyperLogLog::Deserialize(rhs));
+			hll.Serialize(ser);
+			break;
+		}
+		case AggPercentile: {
+			auto digest = sketch::TDigest::Deserialize(lhs);
+			digest.Merge(sketch::TDigest::Deserialize(rhs));
+			digest.Serialize(ser);
+			break;
+		}
+		case AggTopKApprox: {
+			const auto k = lhs.GetVarUInt();
+			std::ignore = rhs.GetVarUInt();
+			auto summary = sketch::SpaceSaving::Deserialize(lhs);
+			summary.Merge(sketch::SpaceSaving::Deserialize(rhs));
+			ser.PutVarUint(k);
+			summary.Serialize(ser);
+			break;
+		}
+		case AggSum:
+		case AggAvg:
+		case AggFacet:
+		case AggMin:
+		case AggMax:
+		case AggDistinct:
+		case AggCount:
+		case AggCountCached:
+		case AggUnknown:
+			throw Error(errLogic, "Aggregation '{}' does not have a sketch", AggTypeToStr(type_));
+	}
+	sketch_.assign(ser.Slice());
+}
+
+void AggregationResult::FinalizeSketch() {
+	if (!HasSketch()) {
+		return;
+	}
+	Serializer ser(sketch_);
+	switch (type_) {
+		case AggApproxCountDistinct:
+			value_ = std::round(sketch::HyperLogLog::Deserialize(ser).Estimate());
+			break;
+		case AggPercentile: {
+			auto digest = sketch::TDigest::Deserialize(ser);
+			if (digest.TotalWeight() <= 0.0) {
+				percentiles_.clear();
+				value_ = std::nullopt;
+				break;
+			}
+			for (auto& p : percentiles_) {
+				p.value = digest.Quantile(p.rank / 100.0);
+			}
+			value_ = percentiles_.empty() ? std::nullopt : std::optional<double>{percentiles_.front().value};
+			break;
+		}
+		case AggTopKApprox: {
+			const auto k = ser.GetVarUInt();
+			const auto top = sketch::SpaceSaving::Deserialize(ser).Top(k);
+			facets_.clear();
+			facets_.reserve(top.size());
+			for (const auto& item : top) {
+				facets_.push_back({{item.value}, int(item.count)});
+			}
+			break;
+		}
+		case AggSum:
+		case AggAvg:
+		case AggFacet:
+		case AggMin:
+		case AggMax:
+		case AggDistinct:
+		case AggCount:
+		case AggCountCached:
+		case AggUnknown:
+			throw Error(errLogic, "Aggregation '{}' does not have a sketch", AggTypeToStr(type_));
+	}
+	std::string().swap(sketch_);
+}
+
 void AggregationResult::GetJSON(WrSerializer& ser) const {
 	JsonBuilder builder(ser);
 	ParameterFieldGetter fieldsGetter;
@@ -94,6 +199,12 @@ void AggregationResult::GetMsgPack(WrSerializer& wrser) const {
 	if (!distincts_.empty()) {
 		++elements;
 	}
+	if (!percentiles_.empty()) {
+		++elements;
+	}
+	if (HasSketch()) {
+		++elements;
+	}
 	MsgPackBuilder msgpackBuilder(wrser, ObjType::TypeObject, elements);
 	ParameterFieldGetter fieldsGetter;
 	get(msgpackBuilder, ParametersFields<ParameterFieldGetter, std::string_view>(fieldsGetter));
@@ -134,6 +245,17 @@ AggregationResult AggregationResult::from(Node root) {
 		ret.facets_.emplace_back(std::move(facet));
 	}
 
+	for (const auto& percentileNode : root[Parameters::Percentiles()]) {
+		ret.percentiles_.push_back(
+			{percentileNode[Parameters::Rank()].template As<double>(), percentileNode[Parameters::Value()].template As<double>()});
+	}
+
+	const std::string sketch = root[Parameters::Sketch()].template As<std::string>();
+	if (!sketch.empty()) {
+		ret.sketch_.resize(Base64decode_len(sketch.c_str()));
+		ret.sketch_.resize(Base64decode(ret.sketch_.data(), sketch.c_str()));
+	}
+
 	for (const auto& distinctNode : root[Parameters::Distincts()]) {
 		bool isArray = false;
 		if constexpr (std::is_same_v<gason::JsonNode, Node>) {
@@ -207,6 +329,15 @@ void AggregationResult::GetProtobufSchema(ProtobufSchemaBuilder& builder) {
 				  FieldProps{KeyValueType::Tuple{}, IsArray_True, IsRequired_False, AllowAdditionalProps_False, "Distincts"});
 
 	results.Field(Parameters::Fields(), fields.Fields(), FieldProps{KeyValueType::String{}, IsArray_True});
+
+	{
+		ProtobufSchemaBuilder percentiles = results.Object(fields.Percentiles(), "Percentiles");
+		percentiles.Field(Parameters::Value(), fields.Value(), FieldProps{KeyValueType::Double{}});
+		percentiles.Field(Parameters::Rank(), fields.Rank(), FieldProps{KeyValueType::Double{}});
+	}
+	results.Field(Parameters::Percentiles(), fields.Percentiles(),
+				  FieldProps{KeyValueType::Tuple{}, IsArray_True, IsRequired_False, AllowAdditionalProps_False, "Percentiles"});
+	results.Field(Parameters::Sketch(), fields.Sketch(), FieldProps{KeyValueType::String{}});
 	results.End();
 }
 
@@ -232,6 +363,22 @@ void AggregationResult::get(Builder& builder, const Fields& parametersFields) co
 		serialiseDistinct(builder, parametersFields);
 	}
 
+	if (!percentiles_.empty()) {
+		auto percentilesArray = builder.Array(parametersFields.Percentiles(), percentiles_.size());
+		for (const auto& p : percentiles_) {
+			auto percentileObj = percentilesArray.Object(TagName::Empty(), 2);
+			percentileObj.Put(parametersFields.Rank(), p.rank);
+			percentileObj.Put(parametersFields.Value(), p.value);
+		}
+	}
+
+	if (HasSketch()) {
+		// Binary sketch is encoded to base64 to be valid for any of the output formats
+		std::string encoded(Base64encode_len(sketch_.size()), '\0');
+		encoded.resize(Base64encode(encoded.data(), sketch_.data(), sketch_.size()) - 1);
+		builder.Put(parametersFields.Sketch(), encoded);
+	}
+
 	auto fieldsArray = builder.Array(parametersFields.Fields(), fields_.size());
 	for (auto& v : fields_) {
 		fieldsArray.Put(TagName::Empty(), v);
@@ -36,6 +36,9 @@ struct [[nodiscard]] Parameters {
 	constexpr static std::string_view Values() noexcept;
 	constexpr static std::string_view Distincts() noexcept;
 	constexpr static std::string_view Fields() noexcept;
+	constexpr static std::string_view Percentiles() noexcept;
+	constexpr static std::string_view Rank() noexcept;
+	constexpr static std::string_view Sketch() noexcept;
 };
 
 template <typename T, typename K>
@@ -50,6 +53,9 @@ public:
 	K Values() const { return fieldsStorage_.at(Parameters::Values()); }
 	K Distincts() const { return fieldsStorage_.at(Parameters::Distincts()); }
 	K Fields() const { return fieldsStorage_.at(Parameters::Fields()); }
+	K Percentiles() const { return fieldsStorage_.at(Parameters::Percentiles()); }
+	K Rank() const { return fieldsStorage_.at(Parameters::Rank()); }
+	K Sketch() const { return fieldsStorage_.at(Parameters::Sketch()); }
 
 private:
 	const T& fieldsStorage_;
@@ -60,6 +66,11 @@ struct [[nodiscard]] FacetResult {
 	int count = 0;
 };
 
+struct [[nodiscard]] PercentileResult {
+	double rank = 0.0;
+	double value = 0.0;
+};
+
 class [[nodiscard]] AggregationResult {
 public:
 	AggregationResult() noexcept;
@@ -68,6 +79,9 @@ public:
 	explicit AggregationResult(AggType tp, h_vector<std::string, 1>&& names, PayloadType&& pt, FieldsSet&& fset,
 							   std::vector<Variant>&& _distincts) noexcept;
 	explicit AggregationResult(AggType tp, h_vector<std::string, 1>&& names, std::vector<FacetResult>&& facets) noexcept;
+	// Result of the approximate aggregation with the serialized sketch. Percentiles contain the requested ranks only
+	explicit AggregationResult(AggType tp, h_vector<std::string, 1>&& names, std::string&& sketch,
+							   std::vector<PercentileResult>&& percentiles) noexcept;
 	~AggregationResult();
 	void GetJSON(WrSerializer& ser) const;
 	void GetMsgPack(WrSerializer& wrser) const;
@@ -85,6 +99,17 @@ public:
 
 	const std::vector<FacetResult>& GetFacets() const& noexcept { return facets_; }
 	auto GetFacets() const&& = delete;
+	const std::vector<PercentileResult>& GetPercentiles() const& noexcept { return percentiles_; }
+	auto GetPercentiles() const&& = delete;
+
+	// Sketch is the mergeable state of the approximate aggregation. It is kept in the results of the distributed sub-queries only
+	bool HasSketch() const noexcept { return !sketch_.empty(); }
+	void MergeSketch(const AggregationResult& other);
+	// Calculates the results from the sketch and drops it
+	void FinalizeSketch();
+	static bool IsApproximate(AggType type) noexcept {
+		return type == AggApproxCountDistinct || type == AggPercentile || type == AggTopKApprox;
+	}
 
 	static AggType StrToAggType(std::string_view type);
 	static void GetProtobufSchema(ProtobufSchemaBuilder&);
@@ -132,6 +157,8 @@ private:
 	AggType type_ = AggSum;
 	h_vector<std::string, 1> fields_;
 	std::vector<FacetResult> facets_;
+	std::vector<PercentileResult> percentiles_;
+	std::string sketch_;
 	std::vector<Variant> distincts_;
 	FieldsSet distinctsFields_;
 	PayloadType payloadType_;
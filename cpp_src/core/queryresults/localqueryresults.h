@@ -159,6 +159,7 @@ public:
 	std::vector<joins::NamespaceResults> joined_;
 	std::vector<AggregationResult> aggregationResults;
 	int totalCount = 0;
+	size_t sortPeakMemory = 0;	// Peak memory size of the items, held for the post-loop sorting
 	bool haveRank = false;
 	bool nonCacheableData = false;
 	bool needOutputRank = false;
@@ -210,6 +211,8 @@ public:
 		return std::ranges::any_of(nsData_, [ns](const NsDataHolder& nsData) { return nsData.HoldsPointerTo(ns); });
 	}
 	FloatVectorsHolderMap& GetFloatVectorsHolder() & noexcept { return floatVectorsHolder_; }
+	// Keeps the string alive for the lifetime of the results (e.g. tuples of the cold items, loaded from the storage)
+	void HoldString(key_string&& str) { stringsHolder_.emplace_back(std::move(str)); }
 
 	std::string explainResults;
 
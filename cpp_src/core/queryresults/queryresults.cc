@@ -193,6 +193,10 @@ void QueryResults::RebuildMergedData() {
 					if (newAgg.GetType() != mergedAgg.GetType()) {
 						throw Error(errLogic, "Aggregations are incompatible between query results inside distributed query results");
 					}
+					if (AggregationResult::IsApproximate(newAgg.GetType())) {
+						mergedAgg.MergeSketch(newAgg);
+						continue;
+					}
 
 					auto newValue = newAgg.GetValue();
 					if (!newValue) {
@@ -221,6 +225,9 @@ void QueryResults::RebuildMergedData() {
 						case AggAvg:
 						case AggFacet:
 						case AggDistinct:
+						case AggApproxCountDistinct:
+						case AggPercentile:
+						case AggTopKApprox:
 							throw Error(errLogic, "Remote query result (within distributed results) has unsupported aggregations");
 					}
 				}
@@ -236,6 +243,9 @@ void QueryResults::RebuildMergedData() {
 		}
 
 		assertrx(mergedData_);
+		for (auto& agg : mergedData_->aggregationResults) {
+			agg.FinalizeSketch();
+		}
 		std::vector<TagsMatcher> tmList;
 		tmList.reserve(remote_.size() + (local_ ? 1 : 0));
 		if (local_) {
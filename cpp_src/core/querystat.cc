@@ -7,21 +7,24 @@
 namespace reindexer {
 
 template <void (PerfStatCounterST::*hitFunc)(std::chrono::microseconds)>
-void QueriesStatTracer::hit(const QuerySQL& sql, std::chrono::microseconds time) {
+void QueriesStatTracer::hit(const QuerySQL& sql, std::chrono::microseconds time, size_t sortMemory) {
 	unique_lock lck(mtx_);
 	const auto it = stat_.find(sql.normalized);
 	if (it == stat_.end()) {
-		(stat_.emplace(std::string(sql.normalized), Stat(sql.nonNormalized)).first->second.*hitFunc)(time);
+		const auto newIt = stat_.emplace(std::string(sql.normalized), Stat(sql.nonNormalized)).first;
+		(newIt->second.*hitFunc)(time);
+		newIt->second.maxSortMemory = sortMemory;
 	} else {
 		const auto maxTime = it->second.MaxTime();
 		(it->second.*hitFunc)(time);
 		if (it->second.MaxTime() > maxTime) {
 			it->second.longestQuery = std::string(sql.nonNormalized);
 		}
+		it->second.maxSortMemory = std::max(it->second.maxSortMemory, sortMemory);
 	}
 }
-template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds);
-template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds);
+template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds, size_t);
+template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds, size_t);
 
 std::vector<QueryPerfStat> QueriesStatTracer::Data() {
 	unique_lock lck(mtx_);
@@ -29,7 +32,7 @@ std::vector<QueryPerfStat> QueriesStatTracer::Data() {
 	std::vector<QueryPerfStat> ret;
 	ret.reserve(stat_.size());
 	for (auto& stat : stat_) {
-		ret.push_back({stat.first, stat.second.Get<PerfStat>(), stat.second.longestQuery});
+		ret.push_back({stat.first, stat.second.Get<PerfStat>(), stat.second.longestQuery, stat.second.maxSortMemory});
 	}
 	return ret;
 }
@@ -48,6 +51,7 @@ void QueryPerfStat::GetJSON(WrSerializer& ser) const {
 	builder.Put("min_latency_us", perf.minTimeUs);
 	builder.Put("max_latency_us", perf.maxTimeUs);
 	builder.Put("longest_query", longestQuery);
+	builder.Put("max_sort_memory", maxSortMemory);
 }
 
 }  // namespace reindexer
@@ -19,6 +19,7 @@ struct [[nodiscard]] QueryPerfStat {
 	std::string query;
 	PerfStat perf;
 	std::string longestQuery;
+	size_t maxSortMemory = 0;
 };
 
 class [[nodiscard]] QueriesStatTracer {
@@ -28,8 +29,11 @@ public:
 		std::string_view nonNormalized;
 	};
 
-	void Hit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::Hit>(sql, time); }
-	void LockHit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::LockHit>(sql, time); }
+	// 'sortMemory' is the peak memory size of the items, held for the sorting of the query results
+	void Hit(const QuerySQL& sql, std::chrono::microseconds time, size_t sortMemory = 0) {
+		hit<&PerfStatCounterST::Hit>(sql, time, sortMemory);
+	}
+	void LockHit(const QuerySQL& sql, std::chrono::microseconds time) { hit<&PerfStatCounterST::LockHit>(sql, time, 0); }
 	std::vector<QueryPerfStat> Data();
 	void Reset() {
 		unique_lock lck(mtx_);
@@ -40,16 +44,17 @@ private:
 	struct [[nodiscard]] Stat : public PerfStatCounterST {
 		Stat(std::string_view q) : longestQuery(q) {}
 		std::string longestQuery;
+		size_t maxSortMemory = 0;
 	};
 
 	template <void (PerfStatCounterST::*hitFunc)(std::chrono::microseconds)>
-	void hit(const QuerySQL&, std::chrono::microseconds);
+	void hit(const QuerySQL&, std::chrono::microseconds, size_t sortMemory);
 
 	mutable mutex mtx_;
 	fast_hash_map<std::string, Stat, hash_str, equal_str, less_str> stat_;
 };
-extern template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds);
-extern template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds);
+extern template void QueriesStatTracer::hit<&PerfStatCounterST::Hit>(const QuerySQL&, std::chrono::microseconds, size_t);
+extern template void QueriesStatTracer::hit<&PerfStatCounterST::LockHit>(const QuerySQL&, std::chrono::microseconds, size_t);
 
 template <typename T = void, template <typename> class Logger = long_actions::Logger>
 class [[nodiscard]] QueryStatCalculator {
@@ -322,6 +322,13 @@ Error Reindexer::ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk
 		return impl_->ApplySnapshotChunk(nsName, ch, rdxCtx);
 	});
 }
+Error Reindexer::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+									  std::vector<uint64_t>& hashes) noexcept {
+	return callWithConnectCheck([&] {
+		const auto rdxCtx = impl_->CreateRdxContext(ctx_, [&](WrSerializer& s) { s << "GET DATA HASH TREE OF " << nsName; });
+		return impl_->GetDataHashTreeNodes(nsName, leavesCount, nodes, hashes, rdxCtx);
+	});
+}
 Error Reindexer::SuggestLeader(const cluster::NodeData& suggestion, cluster::NodeData& response) noexcept {
 	return callWithConnectCheck([&] { return impl_->SuggestLeader(suggestion, response); });
 }
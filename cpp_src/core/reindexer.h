@@ -273,6 +273,13 @@ public:
 	/// @param nsName - Name of namespace
 	/// @param ch - Snapshot chunk to apply
 	Error ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch) noexcept;
+	/// Get hashes of the namespace's data hash tree nodes (used by replication to find the diverged items)
+	/// @param nsName - Name of namespace
+	/// @param leavesCount - Leaves count of the tree. The tree is rebuilt, if it has another leaves count
+	/// @param nodes - Tree nodes in the heap layout (root is 1)
+	/// @param hashes - Result hashes of the nodes
+	Error GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+							   std::vector<uint64_t>& hashes) noexcept;
 
 	/// Suggest new leader info to cluster node
 	/// @param suggestion - suggested elections data
@@ -20,6 +20,7 @@
 #include "core/query/functions_optimizations.h"
 #include "core/query/sql/sql_suggestions.h"
 #include "core/query/sql/sqlsuggester.h"
+#include "core/storage/storagefactory.h"
 #include "debug/crashqueryreporter.h"
 #include "rx_selector.h"
 #include "server/outputparameters.h"
@@ -235,6 +236,14 @@ Error ReindexerImpl::enableStorage(const std::string& storagePath) {
 		}
 	}
 
+	try {
+		sharedStorage_ = datastorage::StorageFactory::createShared(storageType_, storagePath,
+																	datastorage::SharedStorageOpts{config_.storageSyncInterval});
+	} catch (const Error& err) {
+		return Error(err.code(), "Failed to open shared storage engine: '{}'", err.what());
+	} catch (const std::exception& e) {
+		return Error(errParams, "Failed to open shared storage engine: '{}'", e.what());
+	}
 	storagePath_ = storagePath;
 
 	auto err = embeddersCache_->EnableStorage(storagePath_, storageType_);
@@ -287,6 +296,9 @@ Error ReindexerImpl::Connect(const std::string& dsn, ConnectOpts opts) {
 		case kStorageTypeOptRocksDB:
 			storageType_ = StorageType::RocksDB;
 			break;
+		case kStorageTypeOptRocksDBShared:
+			storageType_ = StorageType::RocksDBShared;
+			break;
 	}
 
 	replicationEnabled_ = !opts.IsReplicationDisabled();
@@ -1061,20 +1073,34 @@ Error ReindexerImpl::modifyQ(const Query& query, LocalQueryResults& result, cons
 			QueryStatCalculator statCalculator = QueryStatCalculator(long_actions::MakeLogger<TP>(query, std::move(params)), isEnabled);
 			std::pair<NamespaceImpl::Locker::WLockT, NamespaceImpl::Ptr> unlockData;
 
-			{
+			for (;;) {
 				const Query& q = queryCopy ? *queryCopy : query;
 				RxSelector::NsLockerW locks(rdxCtx);
-				locks.Add(nsName, std::move(mainNs), true);
+				locks.Add(nsName, Namespace::Ptr{mainNs}, true);
+				// Main namespace's payloads are restored under its exclusive lock. Nested namespaces have to be prepared before locking
+				h_vector<NamespaceImpl::ColdPayloadsPin, 2> coldPayloadsPins;
+				h_vector<std::pair<std::string_view, NamespaceImpl::Ptr>, 2> preparedNs;
 				// NOLINTNEXTLINE(rx-perf-lambda-to-std-function-allocation)
-				query.WalkNested(false, false, true, [this, &locks, &rdxCtx](const Query& q) {
+				query.WalkNested(false, false, true, [this, &locks, &coldPayloadsPins, &preparedNs, &rdxCtx](const Query& q) {
 					auto nsWrp = getNamespace(q.NsName(), rdxCtx);
+					auto ns = nsWrp->getMainNs();
+					coldPayloadsPins.emplace_back(ns->PrepareColdPayloads(q, rdxCtx));
+					preparedNs.emplace_back(q.NsName(), std::move(ns));
 					locks.Add(q.NsName(), std::move(nsWrp), false);
 				});
 				locks.Lock(statCalculator);
+				// Locker takes the actual implementation of the namespace, which may be replaced by the copy-policy transaction
+				// after the preparation. Such implementation is not pinned, so the preparation has to be repeated
+				const bool replaced =
+					std::ranges::any_of(preparedNs, [&locks](const auto& ns) { return locks.Get(ns.first).get() != ns.second.get(); });
+				if (replaced) [[unlikely]] {
+					continue;
+				}
 				FloatVectorsHolderMap* fvHolder = (TP == QueryType::QueryDelete) ? &result.GetFloatVectorsHolder() : nullptr;
 				RxSelector::DoPreSelectForUpdateDelete(q, queryCopy, result, locks, fvHolder, rdxCtx);
 
 				unlockData = locks.ExtractWLock();
+				break;
 			}
 
 			UpdatesContainer pendedRepl;
@@ -1192,11 +1218,11 @@ Error ReindexerImpl::Select(const Query& q, LocalQueryResults& result, const Rdx
 		const QueriesStatTracer::QuerySQL sql{normalizedSQL.Slice(), nonNormalizedSQL.Slice()};
 
 		auto hitter = queriesPerfStatsEnabled
-			? [&sql, &tracker](bool lockHit, std::chrono::microseconds time) {
+			? [&sql, &tracker, &result](bool lockHit, std::chrono::microseconds time) {
 				if (lockHit) {
 					tracker.LockHit(sql, time);
 				} else {
-					tracker.Hit(sql, time);
+					tracker.Hit(sql, time, result.sortPeakMemory);
 				}
 			} : std::function<void(bool, std::chrono::microseconds)>{};
 
@@ -1213,16 +1239,22 @@ Error ReindexerImpl::Select(const Query& q, LocalQueryResults& result, const Rdx
 		}
 		// Lookup and lock namespaces_
 		mainNs->updateSelectTime();
+		// Cold payloads of the joined namespaces have to be restored before the shared locks are taken.
+		// Locker takes exactly the same implementations, which were prepared, so they stay pinned even after the copy-policy transaction
+		h_vector<NamespaceImpl::ColdPayloadsPin, 4> coldPayloadsPins;
+		coldPayloadsPins.emplace_back(mainNs->PrepareColdPayloads(q, rdxCtx));
 		locks.Add(q.NsName(), std::move(mainNs), std::move(mainNsWrp));
 		struct {
 			bool isWalQuery;
 			RxSelector::NsLocker<const RdxContext>& locks;
+			h_vector<NamespaceImpl::ColdPayloadsPin, 4>& pins;
 			const RdxContext& ctx;
-		} refs{isWalQuery, locks, rdxCtx};
+		} refs{isWalQuery, locks, coldPayloadsPins, rdxCtx};
 		q.WalkNested(false, true, true, [this, &refs](const Query& q) {
 			auto nsWrp = getNamespace(q.NsName(), refs.ctx);
 			auto ns = refs.isWalQuery ? nsWrp->awaitMainNs(refs.ctx) : nsWrp->getMainNs();
 			ns->updateSelectTime();
+			refs.pins.emplace_back(ns->PrepareColdPayloads(q, refs.ctx));
 			refs.locks.Add(q.NsName(), std::move(ns), std::move(nsWrp));
 		});
 
@@ -2699,6 +2731,24 @@ Error ReindexerImpl::ApplySnapshotChunk(std::string_view nsName, const SnapshotC
 	return {};
 }
 
+Error ReindexerImpl::GetDataHashTree(std::string_view nsName, uint32_t leavesCount, std::optional<DataHashTree>& tree,
+									 const RdxContext& rdxCtx) noexcept {
+	try {
+		tree.emplace(getNamespace(nsName, rdxCtx)->GetDataHashTree(leavesCount, rdxCtx));
+	}
+	CATCH_AND_RETURN;
+	return {};
+}
+
+Error ReindexerImpl::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+										  std::vector<uint64_t>& hashes, const RdxContext& rdxCtx) noexcept {
+	try {
+		hashes = getNamespace(nsName, rdxCtx)->GetDataHashTreeNodes(leavesCount, nodes, rdxCtx);
+	}
+	CATCH_AND_RETURN;
+	return {};
+}
+
 bool ReindexerImpl::isSystemNamespaceNameStrict(std::string_view name) noexcept {
 	return std::ranges::find_if(kSystemNsDefs, [name](const NamespaceDef& nsDef) { return iequals(nsDef.name, name); }) !=
 		   std::cend(kSystemNsDefs);
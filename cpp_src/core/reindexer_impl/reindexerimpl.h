@@ -130,6 +130,10 @@ public:
 	Error SetClusterOperationStatus(std::string_view nsName, const ClusterOperationStatus& status, const RdxContext& ctx) noexcept;
 	Error GetSnapshot(std::string_view nsName, const SnapshotOpts& opts, Snapshot& snapshot, const RdxContext& ctx) noexcept;
 	Error ApplySnapshotChunk(std::string_view nsName, const SnapshotChunk& ch, const RdxContext& ctx) noexcept;
+	Error GetDataHashTree(std::string_view nsName, uint32_t leavesCount, std::optional<DataHashTree>& tree,
+						  const RdxContext& ctx) noexcept;
+	Error GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes, std::vector<uint64_t>& hashes,
+							   const RdxContext& ctx) noexcept;
 	Error Status() noexcept {
 		if (connected_.load(std::memory_order_acquire)) [[likely]] {
 			return {};
@@ -420,6 +424,8 @@ private:
 	ActivityContainer& activities_;
 
 	StorageType storageType_;
+	// Engine, shared by all of the namespaces' storages. nullptr for the storage types with the engine per namespace
+	datastorage::ISharedStorage::Ptr sharedStorage_;
 	std::atomic<bool> replicationEnabled_ = {true};
 	std::atomic<bool> connected_ = {false};
 
@@ -125,6 +125,9 @@ void RxSelector::DoSelect(const Query& q, std::optional<Query>& queryCopy, Local
 					case AggAvg:
 					case AggFacet:
 					case AggDistinct:
+					case AggApproxCountDistinct:
+					case AggPercentile:
+					case AggTopKApprox:
 					case AggUnknown:
 						throw Error{errNotValid, "Aggregation '{}' in merge query is not implemented yet",
 									AggTypeToStr(a.Type())};  // TODO #1506
@@ -261,6 +264,10 @@ void RxSelector::DoPreSelectForUpdateDelete(const Query& q, std::optional<Query>
 											FloatVectorsHolderMap* fvHolder, const RdxContext& rdxCtx) {
 	FtFunctionsHolder func;
 	auto ns = locks.Get(q.NsName());
+	if (ns->payloadsTier_.HasColdItems() && ns->queryNeedsColdPayloads(q)) {
+		// Main namespace is locked exclusively, so its payloads may be restored right here
+		ns->restoreColdPayloads();
+	}
 
 	std::vector<LocalQueryResults> queryResultsHolder;
 	Explain::Duration preselectTimeTotal{0};
@@ -407,8 +414,13 @@ VariantArray RxSelector::selectSubQuery(const Query& subQuery, const Query& main
 				if (!it.Status().ok()) {
 					throw it.Status();
 				}
-				ConstPayload{ns->payloadType_, ns->items_[it.GetItemRef().Id()]}.GetByJsonPath(field, ns->tagsMatcher_, buf,
-																							   KeyValueType::Undefined{});
+				// Payloads of the cold items are held by the results only
+				const auto& itemRef = it.GetItemRef();
+				ConstPayload{ns->payloadType_, itemRef.ValueInitialized() ? itemRef.Value() : ns->items_[itemRef.Id()]}.GetByJsonPath(
+					field, ns->tagsMatcher_, buf, KeyValueType::Undefined{});
+				if (ns->payloadsTier_.IsCold(itemRef.Id())) {
+					buf.EnsureHold();
+				}
 				for (Variant& v : buf) {
 					result.emplace_back(std::move(v));
 				}
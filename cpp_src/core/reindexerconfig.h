@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -32,6 +33,10 @@ struct [[nodiscard]] ReindexerConfig {
 		allocatorCachePart = maxCachePart;
 		return *this;
 	}
+	ReindexerConfig& WithStorageSyncInterval(std::chrono::milliseconds interval) noexcept {
+		storageSyncInterval = interval;
+		return *this;
+	}
 
 	/// Object for receiving clients statistics
 	IClientsStats* clientsStats = nullptr;
@@ -43,6 +48,9 @@ struct [[nodiscard]] ReindexerConfig {
 	int64_t allocatorCacheLimit = -1;
 	/// Recommended maximum free cache size of tcmalloc memory allocator in relation to total reindexer allocated memory size, in units
 	float allocatorCachePart = -1.0;
+	/// Interval of the background WAL sync for the storage engines, shared by all of the namespaces (rocksdb_shared). 0 - WAL is synced
+	/// only by the sync writes and flushes
+	std::chrono::milliseconds storageSyncInterval{100};
 };
 
 // NOLINTEND(performance-unnecessary-value-param) // Temprorary comment to avoid false-positive on warning on moved params
@@ -4,6 +4,7 @@
 
 #include "core/id_type.h"
 #include "core/idset/idset.h"
+#include "core/idset/idsetbitmap.h"
 #include "core/index/indexiterator.h"
 #include "core/index/keyentry.h"
 #include "core/nsselecter/comparator/comparator_indexed.h"
@@ -61,6 +62,10 @@ public:
 	}
 	explicit SingleSelectKeyResult(const IdSetPlain& ids) noexcept
 		: flatIds_{FlatIdSet{.storage{}, .view = ids, .u{}}}, collectionType_{Collection::FlatIdSet} {}
+	explicit SingleSelectKeyResult(IdSetBitmap::Ptr&& ids) noexcept
+		: bitmapIds_{BitmapIdSet{.ptr = std::move(ids), .cursor{}}}, collectionType_{Collection::BitmapIdSet} {
+		assertrx_dbg(bitmapIds_.ptr);
+	}
 	explicit SingleSelectKeyResult(IdType rBegin, IdType rEnd) noexcept
 		: range_{Range{.values = std::make_pair(rBegin, rEnd), .u{}}}, collectionType_{Collection::Range} {
 		assertrx_dbg(rBegin <= rEnd);
@@ -88,6 +93,8 @@ public:
 				return flatIds_.view.size();
 			case Collection::TreeIdSet:
 				return treeIds_.ptr->size();
+			case Collection::BitmapIdSet:
+				return bitmapIds_.ptr->Size();
 			case Collection::Range:
 				assertrx_dbg(range_.values.second.ToNumber() >= range_.values.first.ToNumber());
 				return range_.values.second.ToNumber() - range_.values.first.ToNumber();
@@ -130,6 +137,13 @@ public:
 					std::construct_at(&treeIds_.u.fwd, begin, end, begin);
 				}
 				break;
+			case Collection::BitmapIdSet:
+				if (reverse) {
+					bitmapIds_.cursor.StartRev(*bitmapIds_.ptr);
+				} else {
+					bitmapIds_.cursor.StartFwd();
+				}
+				break;
 			case Collection::Range:
 				resetUnionDirection(direction_, range_);
 				if (reverse) {
@@ -154,7 +168,7 @@ public:
 	IdSetCRef TryGetFlatIDSet() const noexcept { return collectionType_ == Collection::FlatIdSet ? flatIds_.view : IdSetCRef(); }
 
 protected:
-	enum class [[nodiscard]] Collection : uint8_t { NotSet, FlatIdSet, TreeIdSet, Range, SingleIterator };
+	enum class [[nodiscard]] Collection : uint8_t { NotSet, FlatIdSet, TreeIdSet, BitmapIdSet, Range, SingleIterator };
 	enum class [[nodiscard]] Direction : uint8_t { NotSet, Forward, Reverse };
 
 	template <typename IterT>
@@ -243,6 +257,12 @@ protected:
 		UnionT u;
 	};
 
+	// Cursor is direction agnostic, so there is no need in the iterators union
+	struct [[nodiscard]] BitmapIdSet {
+		IdSetBitmap::Ptr ptr;
+		IdSetBitmap::Cursor cursor;
+	};
+
 	struct [[nodiscard]] Range {
 		using UnionT = ItersUnion<IdType, IdType>;
 
@@ -286,6 +306,9 @@ protected:
 			case Collection::TreeIdSet:
 				new (&treeIds_) TreeIdSet(other.treeIds_.Clone(direction_));
 				break;
+			case Collection::BitmapIdSet:
+				new (&bitmapIds_) BitmapIdSet(other.bitmapIds_);
+				break;
 			case Collection::Range:
 				new (&range_) Range(other.range_.Clone(direction_));
 				break;
@@ -307,6 +330,9 @@ protected:
 			case Collection::TreeIdSet:
 				new (&treeIds_) TreeIdSet(std::move(other.treeIds_).Extract(direction_));
 				break;
+			case Collection::BitmapIdSet:
+				new (&bitmapIds_) BitmapIdSet(std::move(other.bitmapIds_));
+				break;
 			case Collection::Range:
 				new (&range_) Range(std::move(other.range_).Extract(direction_));
 				break;
@@ -345,6 +371,9 @@ protected:
 				resetUnionDirection(direction_, treeIds_);
 				std::destroy_at(&treeIds_);
 				break;
+			case Collection::BitmapIdSet:
+				std::destroy_at(&bitmapIds_);
+				break;
 			case Collection::Range:
 				resetUnionDirection(direction_, range_);
 				std::destroy_at(&range_);
@@ -360,6 +389,7 @@ protected:
 	union {
 		FlatIdSet flatIds_;
 		TreeIdSet treeIds_;
+		BitmapIdSet bitmapIds_;
 		Range range_;
 		IndexIterator::Ptr idxFwdIter_;
 	};
@@ -425,7 +455,7 @@ public:
 	/// from all the SingleSelectKeyResult inner objects.
 	IdSetPlain::Ptr MergeIdsets(MergeOptions&& opts, size_t idsCount) {
 		IdSetPlain::Ptr mergedIds;
-		if (opts.genericSort) {
+		if (opts.genericSort || hasBitmaps()) {
 			mergedIds = mergeGenericSort(idsCount);
 		} else if (idsCount < kSelectionSortIdsCount || size() < kMinSetsForHeapSort) {
 			mergedIds = mergeSelectionSort(idsCount);
@@ -445,6 +475,12 @@ public:
 	bool IsCached() const noexcept { return cached; }
 
 private:
+	bool hasBitmaps() const noexcept {
+		return std::ranges::any_of(*this, [](const SingleSelectKeyResult& r) noexcept {
+			return r.collectionType_ == SingleSelectKeyResult::Collection::BitmapIdSet;
+		});
+	}
+
 	IdSetPlain::Ptr mergeGenericSort(size_t idsCount) {
 		base_idset ids;
 		size_t actualSize = 0;
@@ -470,6 +506,11 @@ private:
 					rit += sz;
 					break;
 				}
+				case SingleSelectKeyResult::Collection::BitmapIdSet: {
+					actualSize += it->bitmapIds_.ptr->Size();
+					it->bitmapIds_.ptr->ForEach([&rit](IdType id) noexcept { *(rit++) = id; });
+					break;
+				}
 			}
 		}
 		assertrx(idsCount == actualSize);
@@ -493,6 +534,7 @@ private:
 				case SingleSelectKeyResult::Collection::NotSet:
 				case SingleSelectKeyResult::Collection::Range:
 				case SingleSelectKeyResult::Collection::SingleIterator:
+				case SingleSelectKeyResult::Collection::BitmapIdSet:
 					throw Error(errLogic, "Select key result must be flat IdSet or tree IdSet for 'merge selection sort mode'");
 				case SingleSelectKeyResult::Collection::FlatIdSet:
 				case SingleSelectKeyResult::Collection::TreeIdSet: {
@@ -579,6 +621,7 @@ private:
 				case SingleSelectKeyResult::Collection::NotSet:
 				case SingleSelectKeyResult::Collection::Range:
 				case SingleSelectKeyResult::Collection::SingleIterator:
+				case SingleSelectKeyResult::Collection::BitmapIdSet:
 					throw Error(errLogic, "Select key result must be flat IdSet or tree IdSet for 'merge heap sort mode'");
 				case SingleSelectKeyResult::Collection::FlatIdSet:
 				case SingleSelectKeyResult::Collection::TreeIdSet: {
@@ -1307,6 +1307,11 @@ Error ShardingProxy::ApplySnapshotChunk(std::string_view nsName, const SnapshotC
 	return impl_.ApplySnapshotChunk(nsName, ch, ctx);
 }
 
+Error ShardingProxy::GetDataHashTreeNodes(std::string_view nsName, uint32_t leavesCount, std::span<const uint32_t> nodes,
+										  std::vector<uint64_t>& hashes, const RdxContext& ctx) {
+	return impl_.GetDataHashTreeNodes(nsName, leavesCount, nodes, hashes, ctx);
+}
+
 Error ShardingProxy::CreateTemporaryNamespace(std::string_view baseName, std::string& resultName, const StorageOpts& opts, lsn_t nsVersion,
 											  const RdxContext& ctx) {
 	return impl_.CreateTemporaryNamespace(baseName, resultName, opts, nsVersion, ctx);
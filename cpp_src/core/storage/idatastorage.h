@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include "storagetype.h"
 #include "tools/errors.h"
@@ -25,6 +26,25 @@ public:
 	using Ptr = shared_ptr<const Snapshot>;
 };
 
+/// Options of the storage engine, shared by all of the namespaces of the database.
+struct [[nodiscard]] SharedStorageOpts {
+	/// Interval of the background WAL sync. 0 - WAL is synced only by the sync writes and flushes.
+	std::chrono::milliseconds syncInterval{100};
+};
+
+/// Storage engine, shared by all of the namespaces of the database.
+/// Engine is kept open while there is at least one owner of it (database itself or any of the namespaces' storages).
+class [[nodiscard]] ISharedStorage {
+public:
+	virtual ~ISharedStorage() = default;
+
+	/// Makes all of the written data durable.
+	/// @return Error code or ok.
+	virtual Error Sync() = 0;
+
+	using Ptr = shared_ptr<ISharedStorage>;
+};
+
 /// Low-level data storage abstraction.
 class [[nodiscard]] IDataStorage {
 public:
@@ -91,6 +91,7 @@ public:
 private:
 	const rocksdb::Snapshot* snapshot_;
 	friend class RocksDbStorage;
+	friend class SharedRocksDbStorage;
 };
 }  // namespace datastorage
 }  // namespace reindexer
@@ -0,0 +1,469 @@
+#ifdef REINDEX_WITH_ROCKSDB
+
+#include "sharedrocksdbstorage.h"
+
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/slice.h>
+#include <unordered_set>
+#include "rocksdbstorage.h"
+#include "tools/fsops.h"
+#include "tools/logger.h"
+
+namespace reindexer {
+namespace datastorage {
+
+using namespace std::string_view_literals;
+
+constexpr auto kStorageNotInitialized = "Storage is not initialized"sv;
+constexpr auto kEngineDirName = ".shared_rocksdb"sv;
+// File inside of the namespace's directory, which holds the name of the namespace's column family
+constexpr auto kColumnFamilyFileName = ".column_family"sv;
+// Common budget of the memtables of the all column families
+constexpr size_t kWriteBufferSize = 256 * 1024 * 1024;
+constexpr int kMaxOpenFiles = 512;
+// Group batch is reallocated after the huge commits to release the memory
+constexpr size_t kMaxCachedGroupBatchSize = 16 * 1024 * 1024;
+
+static std::string withoutTrailingSlash(std::string path) {
+	while (path.size() > 1 && path.back() == '/') {
+		path.pop_back();
+	}
+	return path;
+}
+
+static void toReadOptions(const StorageOpts& opts, rocksdb::ReadOptions& ropts) noexcept {
+	ropts.fill_cache = opts.IsFillCache();
+	ropts.verify_checksums = opts.IsVerifyChecksums();
+}
+
+static rocksdb::Options engineOptions(bool createIfMissing) {
+	rocksdb::Options options;
+	options.create_if_missing = createIfMissing;
+	options.create_missing_column_families = true;
+	options.max_open_files = kMaxOpenFiles;
+	options.db_write_buffer_size = kWriteBufferSize;
+	return options;
+}
+
+// Registry of the open engines. Engine is removed from the registry after its destruction, so the engine of the same directory
+// is never opened twice
+static mutex registryMtx;
+static condition_variable registryCond;
+static std::unordered_map<std::string, std::weak_ptr<SharedRocksDbEngine>> registry;
+
+std::shared_ptr<SharedRocksDbEngine> SharedRocksDbEngine::Acquire(const std::string& dbPath, const SharedStorageOpts& opts,
+																  bool createIfMissing) {
+	auto path = withoutTrailingSlash(dbPath);
+	unique_lock lck(registryMtx);
+	for (;;) {
+		auto it = registry.find(path);
+		if (it == registry.end()) {
+			break;
+		}
+		if (auto engine = it->second.lock()) {
+			return engine;
+		}
+		// The last owner is closing the engine right now
+		registryCond.wait(lck);
+	}
+	auto engine = std::shared_ptr<SharedRocksDbEngine>(new SharedRocksDbEngine(path, opts, createIfMissing), [](SharedRocksDbEngine* e) {
+		const std::string path = e->dbPath_;
+		delete e;
+		lock_guard lck(registryMtx);
+		registry.erase(path);
+		registryCond.notify_all();
+	});
+	registry.emplace(path, engine);
+	return engine;
+}
+
+bool SharedRocksDbEngine::IsOpen(const std::string& dbPath) {
+	lock_guard lck(registryMtx);
+	return registry.find(withoutTrailingSlash(dbPath)) != registry.end();
+}
+
+std::string SharedRocksDbEngine::EnginePath(const std::string& dbPath) { return fs::JoinPath(dbPath, kEngineDirName); }
+
+SharedRocksDbEngine::SharedRocksDbEngine(std::string dbPath, const SharedStorageOpts& opts, bool createIfMissing)
+	: dbPath_(std::move(dbPath)), opts_(opts) {
+	if (dbPath_.empty()) {
+		throw Error(errParams, "Cannot enable storage: the path is empty");
+	}
+	if (createIfMissing && fs::MkDirAll(dbPath_) < 0) {
+		throw Error(errLogic, "Unable to create directory '{}': {}", dbPath_, strerror(errno));
+	}
+
+	const auto enginePath = EnginePath(dbPath_);
+	const auto options = engineOptions(createIfMissing);
+	std::vector<std::string> names;
+	if (!rocksdb::DB::ListColumnFamilies(options, enginePath, &names).ok() || names.empty()) {
+		// New database
+		names = {rocksdb::kDefaultColumnFamilyName};
+	}
+	std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+	descriptors.reserve(names.size());
+	for (auto& name : names) {
+		descriptors.emplace_back(name, rocksdb::ColumnFamilyOptions(options));
+	}
+	std::vector<rocksdb::ColumnFamilyHandle*> handles;
+	rocksdb::DB* db;
+	rocksdb::Status status = rocksdb::DB::Open(options, enginePath, descriptors, &handles, &db);
+	if (!status.ok()) {
+		throw Error(errLogic, "Unable to open shared RocksDB storage '{}': {}", enginePath, status.ToString());
+	}
+	db_.reset(db);
+	{
+		lock_guard lck(familiesMtx_);
+		for (auto handle : handles) {
+			if (handle->GetName() == rocksdb::kDefaultColumnFamilyName) {
+				defaultFamily_ = handle;
+			} else {
+				families_.emplace(handle->GetName(), handle);
+			}
+		}
+	}
+	dropUnusedFamilies(names);
+
+	if (opts_.syncInterval.count() > 0) {
+		syncThread_ = std::thread([this] { syncRoutine(); });
+	}
+}
+
+SharedRocksDbEngine::~SharedRocksDbEngine() {
+	if (syncThread_.joinable()) {
+		{
+			lock_guard lck(syncMtx_);
+			terminate_ = true;
+		}
+		syncCond_.notify_all();
+		syncThread_.join();
+	}
+	if (!db_) {
+		return;
+	}
+	if (auto err = Sync(); !err.ok()) {
+		logFmt(LogError, "Unable to sync shared RocksDB storage '{}' on close: {}", dbPath_, err.what());
+	}
+	lock_guard lck(familiesMtx_);
+	for (auto& family : families_) {
+		std::ignore = db_->DestroyColumnFamilyHandle(family.second);
+	}
+	families_.clear();
+	if (defaultFamily_) {
+		std::ignore = db_->DestroyColumnFamilyHandle(defaultFamily_);
+	}
+	db_.reset();
+}
+
+void SharedRocksDbEngine::dropUnusedFamilies(const std::vector<std::string>& names) {
+	// Column families of the removed namespaces' directories (for example, of the temporary namespaces, which are removed on startup)
+	std::vector<fs::DirEntry> dirs;
+	if (fs::ReadDir(dbPath_, dirs) < 0) {
+		return;
+	}
+	std::unordered_set<std::string> used;
+	for (auto& dir : dirs) {
+		std::string name;
+		if (dir.isDir && fs::ReadFile(fs::JoinPath(dbPath_, dir.name, kColumnFamilyFileName), name) > 0) {
+			used.emplace(std::move(name));
+		}
+	}
+	lock_guard lck(familiesMtx_);
+	for (auto& name : names) {
+		auto it = families_.find(name);
+		if (it == families_.end() || used.count(name)) {
+			continue;
+		}
+		logFmt(LogWarning, "Dropping unused column family '{}' of the shared RocksDB storage '{}'", name, dbPath_);
+		auto status = db_->DropColumnFamily(it->second);
+		if (!status.ok()) {
+			logFmt(LogError, "Unable to drop column family '{}': {}", name, status.ToString());
+			continue;
+		}
+		std::ignore = db_->DestroyColumnFamilyHandle(it->second);
+		families_.erase(it);
+	}
+}
+
+rocksdb::ColumnFamilyHandle* SharedRocksDbEngine::OpenColumnFamily(const std::string& nsPath, bool createIfMissing) {
+	const auto markerPath = fs::JoinPath(nsPath, kColumnFamilyFileName);
+	lock_guard lck(familiesMtx_);
+	std::string name;
+	if (fs::ReadFile(markerPath, name) > 0) {
+		auto it = families_.find(name);
+		if (it == families_.end()) {
+			throw Error(errNotFound, "Column family '{}' of the storage '{}' does not exist in the shared RocksDB storage", name, nsPath);
+		}
+		return it->second;
+	}
+	if (!createIfMissing) {
+		throw Error(errNotFound, "Storage '{}' does not exist in the shared RocksDB storage", nsPath);
+	}
+	if (fs::MkDirAll(nsPath) < 0) {
+		throw Error(errLogic, "Unable to create directory '{}': {}", nsPath, strerror(errno));
+	}
+
+	// Names are unique, so the column family of the removed namespace is never reused by the new namespace with the same name
+	auto dirName = withoutTrailingSlash(nsPath);
+	dirName = dirName.substr(dirName.find_last_of('/') + 1);
+	auto stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	do {
+		name = fmt::format("{}.{}", dirName, stamp++);
+	} while (families_.count(name));
+
+	rocksdb::ColumnFamilyHandle* cf;
+	auto status = db_->CreateColumnFamily(rocksdb::ColumnFamilyOptions(engineOptions(true)), name, &cf);
+	if (!status.ok()) {
+		throw Error(errLogic, "Unable to create column family for the storage '{}': {}", nsPath, status.ToString());
+	}
+	// Column family is created before the marker, so the crash between them leaves only the unused column family, which is dropped
+	// on the next startup
+	if (fs::WriteFile(markerPath, name) != int64_t(name.size())) {
+		std::ignore = db_->DropColumnFamily(cf);
+		std::ignore = db_->DestroyColumnFamilyHandle(cf);
+		throw Error(errLogic, "Unable to write '{}': {}", markerPath, strerror(errno));
+	}
+	families_.emplace(std::move(name), cf);
+	return cf;
+}
+
+Error SharedRocksDbEngine::DropColumnFamily(rocksdb::ColumnFamilyHandle* cf) {
+	lock_guard lck(familiesMtx_);
+	auto it = families_.find(cf->GetName());
+	if (it == families_.end() || it->second != cf) {
+		return Error(errNotFound, "Unknown column family of the shared RocksDB storage '{}'", dbPath_);
+	}
+	families_.erase(it);
+	auto status = db_->DropColumnFamily(cf);
+	std::ignore = db_->DestroyColumnFamilyHandle(cf);
+	if (!status.ok()) {
+		return Error(errLogic, status.ToString());
+	}
+	return Error();
+}
+
+Error SharedRocksDbEngine::Write(rocksdb::ColumnFamilyHandle* cf, const SharedRocksDbBatchBuffer& buffer, bool sync) {
+	if (buffer.Empty()) {
+		return Error();
+	}
+	CommitRequest request{cf, buffer, sync, false, Error()};
+	unique_lock lck(commitMtx_);
+	pending_.emplace_back(&request);
+	commitCond_.wait(lck, [&]() RX_REQUIRES(commitMtx_) { return request.done || !committing_; });
+	if (request.done) {
+		return request.err;
+	}
+
+	// This writer is the leader of the group now: all of the pending requests are written by the single WriteBatch
+	committing_ = true;
+	group_.swap(pending_);
+	lck.unlock();
+	Error err = writeGroup(group_);
+	lck.lock();
+	for (auto r : group_) {
+		r->err = err;
+		r->done = true;
+	}
+	group_.clear();
+	committing_ = false;
+	lck.unlock();
+	commitCond_.notify_all();
+	return err;
+}
+
+Error SharedRocksDbEngine::writeGroup(std::vector<CommitRequest*>& group) {
+	rocksdb::WriteOptions options;
+	rocksdb::Status status;
+	try {
+		for (auto r : group) {
+			r->buffer.AppendTo(groupBatch_, r->cf);
+			options.sync = options.sync || r->sync;
+		}
+		status = db_->Write(options, &groupBatch_);
+	} catch (std::exception& e) {
+		status = rocksdb::Status::Aborted(e.what());
+	}
+	if (groupBatch_.GetDataSize() > kMaxCachedGroupBatchSize) {
+		groupBatch_ = rocksdb::WriteBatch();
+	} else {
+		groupBatch_.Clear();
+	}
+	if (!status.ok()) {
+		return Error(errLogic, status.ToString());
+	}
+	if (!options.sync) {
+		unsynced_.store(true, std::memory_order_release);
+	}
+	return Error();
+}
+
+Error SharedRocksDbEngine::Sync() {
+	if (!unsynced_.exchange(false, std::memory_order_acq_rel)) {
+		return Error();
+	}
+	auto status = db_->SyncWAL();
+	if (!status.ok()) {
+		unsynced_.store(true, std::memory_order_release);
+		return Error(errLogic, status.ToString());
+	}
+	return Error();
+}
+
+void SharedRocksDbEngine::syncRoutine() {
+	unique_lock lck(syncMtx_);
+	while (!terminate_) {
+		if (syncCond_.wait_for(lck, opts_.syncInterval, [this]() RX_REQUIRES(syncMtx_) { return terminate_; })) {
+			break;
+		}
+		lck.unlock();
+		if (auto err = Sync(); !err.ok()) {
+			logFmt(LogError, "Unable to sync shared RocksDB storage '{}': {}", dbPath_, err.what());
+		}
+		lck.lock();
+	}
+}
+
+SharedRocksDbStorage::SharedRocksDbStorage() = default;
+SharedRocksDbStorage::~SharedRocksDbStorage() = default;
+
+Error SharedRocksDbStorage::Open(const std::string& path, const StorageOpts& opts) {
+	if (path.empty()) {
+		return Error(errParams, "Cannot enable storage: the path is empty");
+	}
+	try {
+		const auto nsPath = withoutTrailingSlash(path);
+		auto engine = SharedRocksDbEngine::Acquire(fs::GetDirPath(nsPath), SharedStorageOpts(), opts.IsCreateIfMissing());
+		cf_ = engine->OpenColumnFamily(nsPath, opts.IsCreateIfMissing());
+		engine_ = std::move(engine);
+	} catch (Error& err) {
+		return err;
+	}
+	return Error();
+}
+
+void SharedRocksDbStorage::Destroy(const std::string& path) {
+	if (engine_ && cf_) {
+		if (auto err = engine_->DropColumnFamily(cf_); !err.ok()) {
+			fprintf(stderr, "reindexer error: unable to drop column family of the storage: %s, %s\n", path.c_str(), err.what());
+		}
+	}
+	cf_ = nullptr;
+	engine_.reset();
+	if (fs::RmDirAll(path) != 0) {
+		fprintf(stderr, "reindexer error: unable to remove storage's directory: %s, %s\n", path.c_str(), strerror(errno));
+	}
+}
+
+Error SharedRocksDbStorage::Read(const StorageOpts& opts, std::string_view key, std::string& value) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+
+	rocksdb::ReadOptions options;
+	toReadOptions(opts, options);
+	rocksdb::Status status = engine_->DB().Get(options, cf_, rocksdb::Slice(key.data(), key.size()), &value);
+	if (status.ok()) {
+		return Error();
+	}
+	return Error(status.IsNotFound() ? errNotFound : errLogic, status.ToString());
+}
+
+Error SharedRocksDbStorage::Write(const StorageOpts& opts, std::string_view key, std::string_view value) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	SharedRocksDbBatchBuffer buffer;
+	buffer.Put(key, value);
+	return engine_->Write(cf_, buffer, opts.IsSync());
+}
+
+Error SharedRocksDbStorage::Write(const StorageOpts& opts, UpdatesCollection& buffer) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	return engine_->Write(cf_, static_cast<const SharedRocksDbBatchBuffer&>(buffer), opts.IsSync());
+}
+
+Error SharedRocksDbStorage::Delete(const StorageOpts& opts, std::string_view key) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	SharedRocksDbBatchBuffer buffer;
+	buffer.Remove(key);
+	return engine_->Write(cf_, buffer, opts.IsSync());
+}
+
+Error SharedRocksDbStorage::Repair(const std::string& path) {
+	const auto dbPath = fs::GetDirPath(withoutTrailingSlash(path));
+	if (SharedRocksDbEngine::IsOpen(dbPath)) {
+		return Error(errLogic, "Unable to repair shared RocksDB storage '{}': it is in use", dbPath);
+	}
+	auto status = rocksdb::RepairDB(SharedRocksDbEngine::EnginePath(dbPath), engineOptions(false));
+	if (status.ok()) {
+		return Error();
+	}
+	return Error(errLogic, status.ToString());
+}
+
+Snapshot::Ptr SharedRocksDbStorage::MakeSnapshot() {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	const rocksdb::Snapshot* snapshot = engine_->DB().GetSnapshot();
+	assertrx(snapshot);
+	return std::make_shared<RocksDbSnapshot>(snapshot);
+}
+
+void SharedRocksDbStorage::ReleaseSnapshot(Snapshot::Ptr snapshot) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	if (!snapshot) {
+		throw Error(errParams, "Storage pointer is null");
+	}
+	const RocksDbSnapshot* rocksDbSnapshot = static_cast<const RocksDbSnapshot*>(snapshot.get());
+	engine_->DB().ReleaseSnapshot(rocksDbSnapshot->snapshot_);
+	snapshot.reset();
+}
+
+Error SharedRocksDbStorage::Flush() {
+	// Unlike the standalone RocksDB storage, the shared instance is never reopened: syncing of the common WAL is enough
+	if (engine_) {
+		return engine_->Sync();
+	}
+	return Error();
+}
+
+Error SharedRocksDbStorage::Reopen() { return Error(); }
+
+Cursor* SharedRocksDbStorage::GetCursor(StorageOpts& opts) {
+	if (!engine_) {
+		throw Error(errParams, kStorageNotInitialized);
+	}
+	rocksdb::ReadOptions options;
+	toReadOptions(opts, options);
+	options.fill_cache = false;
+	return new RocksDbIterator(engine_->DB().NewIterator(options, cf_));
+}
+
+UpdatesCollection* SharedRocksDbStorage::GetUpdatesCollection() { return new SharedRocksDbBatchBuffer(); }
+
+void SharedRocksDbBatchBuffer::AppendTo(rocksdb::WriteBatch& batch, rocksdb::ColumnFamilyHandle* cf) const {
+	for (const auto& r : records_) {
+		const rocksdb::Slice key(data_.data() + r.keyOffset, r.keySize);
+		if (r.remove) {
+			std::ignore = batch.Delete(cf, key);
+		} else {
+			std::ignore = batch.Put(cf, key, rocksdb::Slice(data_.data() + r.keyOffset + r.keySize, r.valueSize));
+		}
+	}
+}
+
+}  // namespace datastorage
+}  // namespace reindexer
+#else
+// suppress clang warning
+int ___sharedrocksdbsrorage_dummy_suppress_warning;
+
+#endif	// REINDEX_WITH_ROCKSDB
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifdef REINDEX_WITH_ROCKSDB
+
+#include <rocksdb/write_batch.h>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "estl/condition_variable.h"
+#include "estl/lock.h"
+#include "estl/mutex.h"
+#include "idatastorage.h"
+
+struct StorageOpts;
+
+namespace rocksdb {
+class DB;
+class ColumnFamilyHandle;
+}  // namespace rocksdb
+
+namespace reindexer {
+namespace datastorage {
+
+class SharedRocksDbBatchBuffer;
+
+/// RocksDB instance, shared by all of the namespaces of the database directory. Each namespace's storage is the column family of this
+/// instance, so the database has the single set of the open files, the single WAL and the common memtables' memory budget.
+/// Writes of the concurrent namespaces are group-committed: the first of the waiting writers becomes the leader and writes the batches
+/// of the all others as the single WriteBatch. WAL is synced by the background routine once per sync interval.
+class [[nodiscard]] SharedRocksDbEngine final : public ISharedStorage {
+public:
+	/// Returns the engine of the database directory, opening it if required. Options are applied only by the call, which opens the
+	/// engine. Throws on errors
+	static std::shared_ptr<SharedRocksDbEngine> Acquire(const std::string& dbPath, const SharedStorageOpts& opts, bool createIfMissing);
+	/// Returns true, if the engine of the database directory is open now
+	static bool IsOpen(const std::string& dbPath);
+	/// Path of the RocksDB instance inside of the database directory
+	static std::string EnginePath(const std::string& dbPath);
+
+	SharedRocksDbEngine(std::string dbPath, const SharedStorageOpts& opts, bool createIfMissing);
+	SharedRocksDbEngine(const SharedRocksDbEngine&) = delete;
+	SharedRocksDbEngine& operator=(const SharedRocksDbEngine&) = delete;
+	~SharedRocksDbEngine() override;
+
+	Error Sync() override;
+
+	/// Column family of the namespace's storage directory. Column family's name is kept in the file inside of the directory, so the
+	/// directory may be renamed or moved inside of the database directory. Throws on errors
+	rocksdb::ColumnFamilyHandle* OpenColumnFamily(const std::string& nsPath, bool createIfMissing) RX_REQUIRES(!familiesMtx_);
+	Error DropColumnFamily(rocksdb::ColumnFamilyHandle* cf) RX_REQUIRES(!familiesMtx_);
+	/// Group-committed write. Returns, when the batch is written (and synced, if 'sync' is set)
+	Error Write(rocksdb::ColumnFamilyHandle* cf, const SharedRocksDbBatchBuffer& buffer, bool sync) RX_REQUIRES(!commitMtx_);
+	rocksdb::DB& DB() noexcept { return *db_; }
+
+private:
+	struct [[nodiscard]] CommitRequest {
+		rocksdb::ColumnFamilyHandle* cf;
+		const SharedRocksDbBatchBuffer& buffer;
+		bool sync;
+		bool done = false;
+		Error err;
+	};
+
+	void dropUnusedFamilies(const std::vector<std::string>& names);
+	Error writeGroup(std::vector<CommitRequest*>& group);
+	void syncRoutine() RX_REQUIRES(!syncMtx_);
+
+	const std::string dbPath_;
+	const SharedStorageOpts opts_;
+	std::unique_ptr<rocksdb::DB> db_;
+
+	mutex familiesMtx_;
+	std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*> families_ RX_GUARDED_BY(familiesMtx_);
+	rocksdb::ColumnFamilyHandle* defaultFamily_ = nullptr;
+
+	mutex commitMtx_;
+	condition_variable commitCond_;
+	std::vector<CommitRequest*> pending_ RX_GUARDED_BY(commitMtx_);
+	bool committing_ RX_GUARDED_BY(commitMtx_) = false;
+	// Accessed by the current leader only
+	std::vector<CommitRequest*> group_;
+	rocksdb::WriteBatch groupBatch_;
+
+	// Set, when there are the written, but not synced batches
+	std::atomic<bool> unsynced_ = {false};
+	mutex syncMtx_;
+	condition_variable syncCond_;
+	bool terminate_ RX_GUARDED_BY(syncMtx_) = false;
+	std::thread syncThread_;
+};
+
+/// Storage of the single namespace inside of the shared RocksDB instance
+class [[nodiscard]] SharedRocksDbStorage final : public IDataStorage {
+public:
+	SharedRocksDbStorage();
+	~SharedRocksDbStorage() override;
+
+	Error Open(const std::string& path, const StorageOpts& opts) override;
+	void Destroy(const std::string& path) override;
+	Error Read(const StorageOpts& opts, std::string_view key, std::string& value) override;
+	Error Write(const StorageOpts& opts, std::string_view key, std::string_view value) override;
+	Error Write(const StorageOpts& opts, UpdatesCollection& buffer) override;
+	Error Delete(const StorageOpts& opts, std::string_view key) override;
+	Error Repair(const std::string& path) override;
+
+	StorageType Type() const noexcept override { return StorageType::RocksDBShared; }
+
+	Snapshot::Ptr MakeSnapshot() override;
+	void ReleaseSnapshot(Snapshot::Ptr) override;
+
+	Error Flush() override;
+	Error Reopen() override;
+	Cursor* GetCursor(StorageOpts& opts) override;
+	UpdatesCollection* GetUpdatesCollection() override;
+
+private:
+	std::shared_ptr<SharedRocksDbEngine> engine_;
+	rocksdb::ColumnFamilyHandle* cf_ = nullptr;
+};
+
+/// Updates of the single namespace. Updates are kept in the own format until the group commit, which copies them into the common
+/// WriteBatch of the all namespaces
+class [[nodiscard]] SharedRocksDbBatchBuffer final : public UpdatesCollection {
+public:
+	void Put(std::string_view key, std::string_view value) override { add(false, key, value); }
+	void Remove(std::string_view key) override { add(true, key, {}); }
+	void Clear() override {
+		data_.clear();
+		records_.clear();
+	}
+	void Id(uint64_t id) noexcept override { batchId_ = id; }
+	uint64_t Id() const noexcept override { return batchId_; }
+
+	bool Empty() const noexcept { return records_.empty(); }
+	void AppendTo(rocksdb::WriteBatch& batch, rocksdb::ColumnFamilyHandle* cf) const;
+
+private:
+	struct [[nodiscard]] Record {
+		size_t keyOffset;
+		uint32_t keySize;
+		uint32_t valueSize;	 // Value follows the key
+		bool remove;
+	};
+
+	void add(bool remove, std::string_view key, std::string_view value) {
+		records_.emplace_back(Record{data_.size(), uint32_t(key.size()), uint32_t(value.size()), remove});
+		data_.append(key).append(value);
+	}
+
+	std::string data_;
+	std::vector<Record> records_;
+	uint64_t batchId_ = 0;
+};
+
+}  // namespace datastorage
+}  // namespace reindexer
+
+#endif	// REINDEX_WITH_ROCKSDB
@@ -1,6 +1,7 @@
 #include "storagefactory.h"
 #include "leveldbstorage.h"
 #include "rocksdbstorage.h"
+#include "sharedrocksdbstorage.h"
 
 namespace reindexer {
 namespace datastorage {
@@ -18,6 +19,12 @@ IDataStorage* StorageFactory::create(StorageType type) {
 			return new RocksDbStorage();
 #else	// REINDEX_WITH_ROCKSDB
 			throw std::runtime_error("No such storage type!");
+#endif	// REINDEX_WITH_ROCKSDB
+		case StorageType::RocksDBShared:
+#ifdef REINDEX_WITH_ROCKSDB
+			return new SharedRocksDbStorage();
+#else	// REINDEX_WITH_ROCKSDB
+			throw std::runtime_error("No such storage type!");
 #endif	// REINDEX_WITH_ROCKSDB
 		default:
 			throw std::runtime_error("No such storage type!");
@@ -33,9 +40,27 @@ std::vector<StorageType> StorageFactory::getAvailableTypes() {
 #endif	// REINDEX_WITH_LEVELDB
 #ifdef REINDEX_WITH_ROCKSDB
 	types.emplace_back(StorageType::RocksDB);
+	types.emplace_back(StorageType::RocksDBShared);
 #endif	// REINDEX_WITH_ROCKSDB
 	return types;
 }
 
+ISharedStorage::Ptr StorageFactory::createShared(StorageType type, [[maybe_unused]] const std::string& dbPath,
+												 [[maybe_unused]] const SharedStorageOpts& opts) {
+	switch (type) {
+		case StorageType::LevelDB:
+		case StorageType::RocksDB:
+			return nullptr;
+		case StorageType::RocksDBShared:
+#ifdef REINDEX_WITH_ROCKSDB
+			return SharedRocksDbEngine::Acquire(dbPath, opts, true);
+#else	// REINDEX_WITH_ROCKSDB
+			throw std::runtime_error("No such storage type!");
+#endif	// REINDEX_WITH_ROCKSDB
+		default:
+			throw std::runtime_error("No such storage type!");
+	}
+}
+
 }  // namespace datastorage
 }  // namespace reindexer
@@ -12,6 +12,9 @@ public:
 	static IDataStorage* create(StorageType);
 	static IDataStorage* create(std::string_view type);
 	static std::vector<StorageType> getAvailableTypes();
+	/// Opens the engine, shared by all of the namespaces of the database in 'dbPath'. Returns nullptr for the storage types,
+	/// which do not share the engine. Throws on errors
+	static ISharedStorage::Ptr createShared(StorageType, const std::string& dbPath, const SharedStorageOpts&);
 };
 }  // namespace datastorage
 }  // namespace reindexer
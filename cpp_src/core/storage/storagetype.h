@@ -6,15 +6,20 @@
 namespace reindexer {
 namespace datastorage {
 
-enum class [[nodiscard]] StorageType : uint8_t { LevelDB = 0, RocksDB = 1 };
+// RocksDBShared - single RocksDB instance for all of the namespaces of the database (each namespace is the column family)
+enum class [[nodiscard]] StorageType : uint8_t { LevelDB = 0, RocksDB = 1, RocksDBShared = 2 };
 
 const char kLevelDBName[] = "leveldb";
 const char kRocksDBName[] = "rocksdb";
+const char kRocksDBSharedName[] = "rocksdb_shared";
 
 inline std::string StorageTypeToString(StorageType type) {
 	if (StorageType::RocksDB == type) {
 		return kRocksDBName;
 	}
+	if (StorageType::RocksDBShared == type) {
+		return kRocksDBSharedName;
+	}
 	return kLevelDBName;
 }
 
@@ -35,6 +40,9 @@ inline StorageType StorageTypeFromString(std::string_view str) {
 		return StorageType::LevelDB;
 	} else if (str.substr(0, sizeof(kRocksDBName) - 1) == kRocksDBName && HasSpacesOnly(str.substr(sizeof(kRocksDBName) - 1))) {
 		return StorageType::RocksDB;
+	} else if (str.substr(0, sizeof(kRocksDBSharedName) - 1) == kRocksDBSharedName &&
+			   HasSpacesOnly(str.substr(sizeof(kRocksDBSharedName) - 1))) {
+		return StorageType::RocksDBShared;
 	} else {
 		throw Error(errParams, "Invalid storage type string: '{}'", str);
 	}
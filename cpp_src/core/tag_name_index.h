@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include "estl/concepts.h"
 #include "tools/errors.h"
 
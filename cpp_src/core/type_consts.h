@@ -90,6 +90,8 @@ typedef enum REINDEX_CPP_NODISCARD QueryItemType {
 	QueryFunction = 34,					  // Deprecated
 	QueryFunctionSubQueryCondition = 35,  // Deprecated
 	QueryExpressions = 36,
+	QueryParallelism = 37,
+	QueryAggregationPercentile = 38,
 } QueryItemType;
 
 typedef enum REINDEX_CPP_NODISCARD QuerySerializeMode {
@@ -188,7 +190,20 @@ enum REINDEX_CPP_NODISCARD OpType { OpOr = 1, OpAnd = 2, OpNot = 3 };
 
 enum REINDEX_CPP_NODISCARD ArithmeticOpType { OpPlus = 0, OpMinus = 1, OpMult = 2, OpDiv = 3 };
 
-enum REINDEX_CPP_NODISCARD AggType { AggSum, AggAvg, AggFacet, AggMin, AggMax, AggDistinct, AggCount, AggCountCached, AggUnknown = -1 };
+enum REINDEX_CPP_NODISCARD AggType {
+	AggSum,
+	AggAvg,
+	AggFacet,
+	AggMin,
+	AggMax,
+	AggDistinct,
+	AggCount,
+	AggCountCached,
+	AggApproxCountDistinct,
+	AggPercentile,
+	AggTopKApprox,
+	AggUnknown = -1
+};
 
 enum REINDEX_CPP_NODISCARD JoinType { LeftJoin, InnerJoin, OrInnerJoin, Merge };
 
@@ -328,6 +343,7 @@ typedef enum REINDEX_CPP_NODISCARD ConnectOpt {
 typedef enum REINDEX_CPP_NODISCARD StorageTypeOpt {
 	kStorageTypeOptLevelDB = 0,
 	kStorageTypeOptRocksDB = 1,
+	kStorageTypeOptRocksDBShared = 2,
 } StorageTypeOpt;
 
 typedef struct REINDEX_CPP_NODISCARD ConnectOpts {
@@ -340,6 +356,9 @@ typedef struct REINDEX_CPP_NODISCARD ConnectOpts {
 		if (storage == static_cast<uint16_t>(kStorageTypeOptRocksDB)) {
 			return kStorageTypeOptRocksDB;
 		}
+		if (storage == static_cast<uint16_t>(kStorageTypeOptRocksDBShared)) {
+			return kStorageTypeOptRocksDBShared;
+		}
 		return kStorageTypeOptLevelDB;
 	}
 	int ExpectedClusterID() const noexcept { return expectedClusterID; }
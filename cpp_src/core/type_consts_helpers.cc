@@ -140,6 +140,12 @@ std::string_view AggTypeToStr(AggType t) noexcept {
 			return "count"sv;
 		case AggCountCached:
 			return "count_cached"sv;
+		case AggApproxCountDistinct:
+			return "approx_count_distinct"sv;
+		case AggPercentile:
+			return "percentile"sv;
+		case AggTopKApprox:
+			return "top_k_approx"sv;
 		case AggUnknown:
 			break;
 	}
@@ -39,6 +39,8 @@ void ApiTvSimpleComparators::RegisterAllCases() {
 	Register("Query4CondRange", &ApiTvSimpleComparators::Query4CondRange<NoTotal, AscSort>, BasePtr());
 	Register("Query4CondRangeTotal", &ApiTvSimpleComparators::Query4CondRange<ReqTotal, AscSort>, BasePtr());
 	Register("Query4CondRangeCachedTotal", &ApiTvSimpleComparators::Query4CondRange<CachedTotal, AscSort>, BasePtr());
+	Register("QueryNumericColumns", &ApiTvSimpleComparators::QueryNumericColumns<NoTotal>, this);
+	Register("QueryNumericColumnsTotal", &ApiTvSimpleComparators::QueryNumericColumns<ReqTotal>, this);
 
 	Register("QueryDistinctOneField", &ApiTvSimpleComparators::QueryDistinctOneField, this);
 	Register("QueryDistinctTwoField", &ApiTvSimpleComparators::QueryDistinctTwoField, this);
@@ -122,6 +124,7 @@ reindexer::Item ApiTvSimpleComparators::MakeItem(benchmark::State&) {
 	item["start_time"] = start_times_.at(random<size_t>(0, start_times_.size() - 1));
 	item["end_time"] = startTime + random<int>(1, 5) * 1000;
 	item["uuid_str"] = uuids_[rand() % uuids_.size()];
+	item["rating"] = random<double>(0.0, 10.0);
 
 	return item;
 }
@@ -180,6 +183,26 @@ void ApiTvSimpleComparators::QueryFlatArrayLenIndexed(State& state) {
 template void ApiTvSimpleComparators::QueryFlatArrayLenIndexed<BaseFixture::NoTotal>(State&);
 template void ApiTvSimpleComparators::QueryFlatArrayLenIndexed<BaseFixture::ReqTotal>(State&);
 
+// With the total count all of the items have to be checked, so the conditions are evaluated by the vectorized column scan
+template <typename Total>
+void ApiTvSimpleComparators::QueryNumericColumns(State& state) {
+	const auto q = [&] {
+		const int startTime = random<int>(0, 30000);
+		auto q = Query(nsdef_.name)
+					 .Where("genre", CondSet, {5, 10, 15})
+					 .Where("year", CondRange, {2010, 2030})
+					 .Where("start_time", CondGt, startTime)
+					 .Where("rating", CondGe, random<double>(0.0, 5.0))
+					 .Limit(20);
+		Total::Apply(q);
+		return q;
+	};
+	benchQuery(q, state);
+}
+
+template void ApiTvSimpleComparators::QueryNumericColumns<BaseFixture::NoTotal>(State&);
+template void ApiTvSimpleComparators::QueryNumericColumns<BaseFixture::ReqTotal>(State&);
+
 void ApiTvSimpleComparators::QueryDistinctOneField(benchmark::State& state) {
 	AllocsTracker allocsTracker(state);
 	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
@@ -26,7 +26,8 @@ public:
 			.AddIndex("location", "-", "string", IndexOpts())
 			.AddIndex("end_time", "-", "int", IndexOpts())
 			.AddIndex("start_time", "-", "int", IndexOpts())
-			.AddIndex("uuid_str", "-", "string", IndexOpts());
+			.AddIndex("uuid_str", "-", "string", IndexOpts())
+			.AddIndex("rating", "-", "double", IndexOpts());
 	}
 
 	void RegisterAllCases();
@@ -41,6 +42,8 @@ private:
 	void GetByRangeIDAndSort(State& state);
 	template <typename Total>
 	void QueryFlatArrayLenIndexed(State& state);
+	template <typename Total>
+	void QueryNumericColumns(State& state);
 
 	void QueryDistinctOneField(State& state);
 	void QueryDistinctTwoField(State& state);
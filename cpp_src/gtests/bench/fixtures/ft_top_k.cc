@@ -0,0 +1,187 @@
+#include "ft_top_k.h"
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include "allocs_tracker.h"
+
+#include "core/ft/config/ftconfig.h"
+
+using reindexer::IndexOpts;
+
+namespace reindexer_benchmarks {
+
+static uint8_t printFlags = AllocsTracker::kPrintAllocs | AllocsTracker::kPrintHold;
+
+FullTextTopK::FullTextTopK(Reindexer* db, const std::string& name, size_t maxItems) : BaseFixture(db, name, maxItems, 1, false) {
+	reindexer::FTConfig ftCfg(1);
+	ftCfg.stopWords = {};
+	ftCfg.maxTypos = 0;
+	ftCfg.enableKbLayout = false;
+	ftCfg.enableTranslit = false;
+	ftCfg.mergeLimit = kMergeLimit;
+	nsdef_.AddIndex("id", "hash", "int", IndexOpts().PK())
+		.AddIndex(kBaselineIndex_, "text", "string", IndexOpts().SetConfig(IndexFastFT, ftCfg.GetJSON({})));
+	ftCfg.enableBlockMaxPruning = true;
+	nsdef_.AddIndex(kBlockMaxIndex_, "text", "string", IndexOpts().SetConfig(IndexFastFT, ftCfg.GetJSON({})));
+	ftCfg.enableBlockMaxPruning = false;
+	ftCfg.postingsFormat = reindexer::FTConfig::PostingsFormat::Blocks;
+	nsdef_.AddIndex(kBlocksIndex_, "text", "string", IndexOpts().SetConfig(IndexFastFT, ftCfg.GetJSON({})));
+	ftCfg.postingsFormat = reindexer::FTConfig::PostingsFormat::Varint;
+	ftCfg.mergeLimit = 0x1FFFFFF;
+	nsdef_.AddIndex(kExactIndex_, "text", "string", IndexOpts().SetConfig(IndexFastFT, ftCfg.GetJSON({})));
+
+	fillers_.reserve(2000);
+	for (size_t i = 0; i < 2000; ++i) {
+		fillers_.emplace_back("слово" + std::to_string(i));
+	}
+}
+
+void FullTextTopK::RegisterAllCases() {
+	// NOLINTBEGIN(*cplusplus.NewDeleteLeaks)
+	Register("Insert", &FullTextTopK::Insert, this)->Iterations(1)->Unit(benchmark::kMicrosecond);
+	// Indexes are built lazily by the first select, so each format is built by its own case
+	const std::pair<std::string, std::string> buildCases[] = {
+		{kBaselineIndex_, "Baseline"}, {kBlockMaxIndex_, "BlockMax"}, {kBlocksIndex_, "Blocks"}, {kExactIndex_, "Exact"}};
+	for (const auto& [index, caseName] : buildCases) {
+		const auto build = [this, index](State& state) { Build(state, index); };
+		RegisterF("Build" + caseName, build)->Iterations(1)->Unit(benchmark::kMicrosecond);
+	}
+	const std::pair<std::string, std::string> cases[] = {
+		{kBaselineIndex_, "Baseline"}, {kBlockMaxIndex_, "BlockMax"}, {kBlocksIndex_, "Blocks"}};
+	for (size_t words = 1; words <= kWords_.size(); ++words) {
+		for (const auto& [index, caseName] : cases) {
+			const auto select = [this, index, words](State& state) { Select(state, index, words); };
+			RegisterF(caseName + std::to_string(words) + "Words", select)
+				->Iterations(100)
+				->Unit(benchmark::kMicrosecond);
+		}
+	}
+	// NOLINTEND(*cplusplus.NewDeleteLeaks)
+}
+
+reindexer::Item FullTextTopK::MakeItem(benchmark::State&) {
+	auto item = db_->NewItem(nsdef_.name);
+	std::ignore = item.Unsafe(false);
+	return item;
+}
+
+void FullTextTopK::Insert(State& state) {
+	// Fixed seed allows to compare the results of the different runs
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> percent(0, 99), repeats(1, 4), fillersCount(2, 40);
+	std::uniform_int_distribution<size_t> filler(0, fillers_.size() - 1);
+	std::vector<std::string_view> words;
+	std::string text;
+
+	AllocsTracker allocsTracker(state, printFlags);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		for (int id = 0; id < id_seq_->Count(); ++id) {
+			words.clear();
+			for (size_t w = 0; w < kWords_.size(); ++w) {
+				if (percent(gen) < kWordsPercent_[w]) {
+					for (int r = repeats(gen); r > 0; --r) {
+						words.emplace_back(kWords_[w]);
+					}
+				}
+			}
+			for (int f = fillersCount(gen); f > 0; --f) {
+				words.emplace_back(fillers_[filler(gen)]);
+			}
+			std::shuffle(words.begin(), words.end(), gen);
+			text.clear();
+			for (auto w : words) {
+				text.append(w).append(" ");
+			}
+
+			auto item = MakeItem(state);
+			if (!item.Status().ok()) {
+				state.SkipWithError(item.Status().what());
+				continue;
+			}
+			item["id"] = id;
+			item[kBaselineIndex_] = text;
+			item[kBlockMaxIndex_] = text;
+			item[kBlocksIndex_] = text;
+			item[kExactIndex_] = text;
+			auto err = db_->Upsert(nsdef_.name, item);
+			if (!err.ok()) {
+				state.SkipWithError(err.what());
+			}
+		}
+	}
+	state.SetLabel("inserted " + std::to_string(id_seq_->Count()) + " documents");
+}
+
+void FullTextTopK::Build(State& state, const std::string& index) {
+	AllocsTracker allocsTracker(state, printFlags);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		reindexer::QueryResults qres;
+		auto err = db_->Select(reindexer::Query(nsdef_.name).Where(index, CondEq, kWords_[0]).Limit(20), qres);
+		if (!err.ok()) {
+			state.SkipWithError(err.what());
+		}
+	}
+}
+
+void FullTextTopK::Select(State& state, const std::string& index, size_t wordsCount) {
+	const std::string query = makeQuery(wordsCount);
+	AllocsTracker allocsTracker(state, printFlags);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		reindexer::QueryResults qres;
+		auto err = db_->Select(reindexer::Query(nsdef_.name).Where(index, CondEq, query).Limit(20), qres);
+		if (!err.ok()) {
+			state.SkipWithError(err.what());
+		}
+	}
+	try {
+		// Share of the returned documents, which belong to the exact top-K
+		state.counters["recall"] = recall(selectIds(index, query, nullptr), wordsCount);
+	} catch (const reindexer::Error& err) {
+		state.SkipWithError(err.what());
+	}
+}
+
+std::string FullTextTopK::makeQuery(size_t wordsCount) const {
+	std::string query;
+	for (size_t i = 0; i < wordsCount; ++i) {
+		query.append(i ? " " : "").append(kWords_[i]);
+	}
+	return query;
+}
+
+std::vector<int> FullTextTopK::selectIds(const std::string& index, const std::string& query, std::vector<float>* ranks) const {
+	reindexer::QueryResults qres;
+	auto err = db_->Select(reindexer::Query(nsdef_.name).Where(index, CondEq, query).WithRank(), qres);
+	if (!err.ok()) {
+		throw err;
+	}
+	std::vector<int> ids;
+	ids.reserve(qres.Count());
+	auto& lqr = qres.ToLocalQr();
+	for (auto it = lqr.begin(), end = lqr.end(); it != end; ++it) {
+		ids.emplace_back(it.GetItem(false)["id"].As<int>());
+		if (ranks) {
+			ranks->emplace_back(it.GetItemRefRanked().Rank().Value());
+		}
+	}
+	return ids;
+}
+
+double FullTextTopK::recall(const std::vector<int>& ids, size_t wordsCount) const {
+	std::vector<float> ranks;
+	const auto exactIds = selectIds(kExactIndex_, makeQuery(wordsCount), &ranks);
+	if (ids.empty() || exactIds.empty()) {
+		return 1.0;
+	}
+	// Documents with the same rank as the K-th one are equally good
+	const size_t k = std::min<size_t>(kMergeLimit, exactIds.size());
+	const float minRank = ranks[k - 1];
+	std::unordered_set<int> exactTop;
+	for (size_t i = 0; i < exactIds.size() && ranks[i] >= minRank; ++i) {
+		exactTop.insert(exactIds[i]);
+	}
+	const auto found = std::count_if(ids.begin(), ids.end(), [&exactTop](int id) { return exactTop.count(id) > 0; });
+	return double(found) / double(std::min(k, ids.size()));
+}
+
+}  // namespace reindexer_benchmarks
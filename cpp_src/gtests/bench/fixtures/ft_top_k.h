@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "base_fixture.h"
+
+namespace reindexer_benchmarks {
+
+// Compares the top-K selection with the block-max pruning against the default merge on the frequent words.
+// Each document has the same text in four fulltext indexes: default, with pruning, with the block postings format
+// and with the unlimited merge (exact results)
+class [[nodiscard]] FullTextTopK : private BaseFixture {
+public:
+	virtual ~FullTextTopK() {}
+	FullTextTopK(Reindexer* db, const std::string& name, size_t maxItems);
+
+	using BaseFixture::Initialize;
+	void RegisterAllCases();
+
+private:
+	virtual reindexer::Item MakeItem(benchmark::State&) override;
+
+	void Insert(State& state);
+	void Build(State& state, const std::string& index);
+	void Select(State& state, const std::string& index, size_t wordsCount);
+
+	std::string makeQuery(size_t wordsCount) const;
+	std::vector<int> selectIds(const std::string& index, const std::string& query, std::vector<float>* ranks) const;
+	double recall(const std::vector<int>& ids, size_t wordsCount) const;
+
+	const std::string kBaselineIndex_ = "text_baseline";
+	const std::string kBlockMaxIndex_ = "text_block_max";
+	const std::string kBlocksIndex_ = "text_blocks";
+	const std::string kExactIndex_ = "text_exact";
+	static constexpr int kMergeLimit = 1000;
+
+	// Frequent words with decreasing documents frequency
+	const std::vector<std::string> kWords_ = {"дорога", "гора", "машина", "ведро", "ключ"};
+	const std::vector<int> kWordsPercent_ = {80, 60, 45, 30, 20};
+	std::vector<std::string> fillers_;
+};
+
+}  // namespace reindexer_benchmarks
@@ -0,0 +1,92 @@
+#include "idset_cache_concurrency.h"
+
+#include <random>
+#include "core/dbconfig.h"
+#include "helpers.h"
+
+namespace reindexer_benchmarks {
+
+reindexer::Error IdSetCacheConcurrency::Initialize() {
+	assertrx(db_);
+	auto err = db_->AddNamespace(nsdef_);
+	if (!err.ok()) {
+		return err;
+	}
+
+	// Caches are shared between the benchmark threads, so they are filled in advance
+	keys_.reserve(kCachedKeys);
+	for (int i = 0; i < kCachedKeys; ++i) {
+		keys_.emplace_back(reindexer::VariantArray{reindexer::Variant(i)});
+	}
+	for (int shards : kShardsCounts) {
+		auto cache = std::make_unique<reindexer::IdSetCache>(reindexer::kDefaultCacheSizeLimit, 1, reindexer::CachePolicy::LRU, shards);
+		for (const auto& key : keys_) {
+			const reindexer::IdSetCacheKey ckey{key, CondEq, 0};
+			std::ignore = cache->Get(ckey);
+			auto ids = reindexer::make_intrusive<reindexer::intrusive_atomic_rc_wrapper<reindexer::IdSetPlain>>();
+			for (int id = 0; id < 100; ++id) {
+				ids->AddUnordered(reindexer::IdType::FromNumber(id));
+			}
+			cache->Put(ckey, reindexer::IdSetCacheVal{std::move(ids)});
+		}
+		caches_.emplace(shards, std::move(cache));
+	}
+	return {};
+}
+
+void IdSetCacheConcurrency::RegisterAllCases() {
+	// NOLINTBEGIN(*cplusplus.NewDeleteLeaks)
+	Register("Insert" + std::to_string(id_seq_->Count()), &IdSetCacheConcurrency::Insert, this)->Iterations(1);
+	for (int shards : kShardsCounts) {
+		Register("CacheGet", &IdSetCacheConcurrency::CacheGet, this)->Arg(shards)->ThreadRange(1, 64)->UseRealTime();
+	}
+	Register("SelectCachedRange", &IdSetCacheConcurrency::SelectCachedRange, this)->ThreadRange(1, 64)->UseRealTime();
+	// NOLINTEND(*cplusplus.NewDeleteLeaks)
+}
+
+reindexer::Item IdSetCacheConcurrency::MakeItem(benchmark::State&) {
+	reindexer::Item item = db_->NewItem(nsdef_.name);
+	if (item.Status().ok()) {
+		item["id"] = id_seq_->Next();
+		item["year"] = random<int>(kMinYear, kMaxYear);
+	}
+	return item;
+}
+
+void IdSetCacheConcurrency::Insert(State& state) {
+	BaseFixture::Insert(state);
+	WaitForOptimization();
+}
+
+void IdSetCacheConcurrency::CacheGet(State& state) {
+	const auto& cache = *caches_.at(state.range(0));
+	std::mt19937 rng(state.thread_index());
+	std::uniform_int_distribution<int> dist(0, kCachedKeys - 1);
+	benchmark::IterationCount hits = 0;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		auto cached = cache.Get(reindexer::IdSetCacheKey{keys_[dist(rng)], CondEq, 0});
+		hits += cached.val.IsInitialized() ? 1 : 0;
+	}
+	if (hits != state.iterations()) [[unlikely]] {
+		state.SkipWithError("Unexpected cache miss");
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+// Range conditions on the tree index are using its IdSets cache
+void IdSetCacheConcurrency::SelectCachedRange(State& state) {
+	std::mt19937 rng(state.thread_index());
+	std::uniform_int_distribution<int> dist(kMinYear, kMaxYear - 10);
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		// Ranges are aligned, so all of them are cached after the first few iterations
+		const int year = dist(rng) / 10 * 10;
+		reindexer::QueryResults qres;
+		auto err = db_->Select(reindexer::Query(nsdef_.name).Where("year", CondRange, {year, year + 10}).Limit(1), qres);
+		if (!err.ok()) [[unlikely]] {
+			state.SkipWithError(err.what());
+		}
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace reindexer_benchmarks
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <map>
+#include "base_fixture.h"
+#include "core/idset/idsetcache.h"
+
+namespace reindexer_benchmarks {
+
+// Concurrent lookups into the index IdSets cache from 1 to 64 threads.
+// Raw cache cases are running for the different shards count (Args: {shards count})
+class [[nodiscard]] IdSetCacheConcurrency : protected BaseFixture {
+public:
+	~IdSetCacheConcurrency() override = default;
+	IdSetCacheConcurrency(Reindexer* db, std::string_view name, size_t maxItems) : BaseFixture(db, name, maxItems) {
+		using reindexer::IndexOpts;
+
+		nsdef_.AddIndex("id", "hash", "int", IndexOpts().PK());
+		nsdef_.AddIndex("year", "tree", "int", IndexOpts());
+	}
+
+	void RegisterAllCases();
+	reindexer::Error Initialize() override;
+
+private:
+	reindexer::Item MakeItem(benchmark::State&) override;
+
+	void Insert(State&);
+	void CacheGet(State&);
+	void SelectCachedRange(State&);
+
+	static constexpr int kCachedKeys = 4096;
+	static constexpr int kMinYear = 1900;
+	static constexpr int kMaxYear = 2100;
+	static constexpr int kShardsCounts[] = {1, 8, 32};
+
+	std::vector<reindexer::VariantArray> keys_;
+	std::map<int, std::unique_ptr<reindexer::IdSetCache>> caches_;
+};
+
+}  // namespace reindexer_benchmarks
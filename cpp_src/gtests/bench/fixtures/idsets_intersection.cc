@@ -0,0 +1,134 @@
+#include "idsets_intersection.h"
+
+#include <random>
+#include "allocs_tracker.h"
+#include "core/idset/idsetbitmap.h"
+#include "core/idset/idsetintersection.h"
+#include "helpers.h"
+
+namespace reindexer_benchmarks {
+
+reindexer::Error IdsetsIntersection::Initialize() {
+	assertrx(db_);
+	return db_->AddNamespace(nsdef_);
+}
+
+void IdsetsIntersection::RegisterAllCases() {
+	// NOLINTBEGIN(*cplusplus.NewDeleteLeaks)
+	Register("Insert" + std::to_string(id_seq_->Count()), &IdsetsIntersection::Insert, this)->Iterations(1);
+	Register("AndChain", &IdsetsIntersection::AndChain, this)->ArgsProduct({{2, 4, 8}, {2, 8, 32}});
+	Register("IntersectIdsets", &IdsetsIntersection::IntersectIdsets, this)->ArgsProduct({{2, 4, 8}, {2, 8, 32}});
+	Register("CachedSetAndChain", &IdsetsIntersection::CachedSetAndChain, this);
+	Register("IntersectWithBitmap", &IdsetsIntersection::IntersectWithBitmap, this)->ArgsProduct({{2, 8, 32}, {0, 1}});
+	// NOLINTEND(*cplusplus.NewDeleteLeaks)
+}
+
+reindexer::Item IdsetsIntersection::MakeItem(benchmark::State&) {
+	reindexer::Item item = db_->NewItem(nsdef_.name);
+	if (item.Status().ok()) {
+		item["id"] = id_seq_->Next();
+		for (int card : kCardinalities) {
+			for (int i = 0; i < kMaxConditions; ++i) {
+				item[fieldName(card, i)] = random<int>(0, card - 1);
+			}
+		}
+	}
+	return item;
+}
+
+void IdsetsIntersection::Insert(State& state) {
+	BaseFixture::Insert(state);
+	WaitForOptimization();
+}
+
+void IdsetsIntersection::AndChain(State& state) {
+	const int conditions = state.range(0);
+	const int card = state.range(1);
+	benchQuery(
+		[&] {
+			reindexer::Query q(nsdef_.name);
+			for (int i = 0; i < conditions; ++i) {
+				q.Where(fieldName(card, i), CondEq, random<int>(0, card - 1));
+			}
+			return std::move(q.Limit(0).ReqTotal());
+		},
+		state, allowEmptyResult);
+}
+
+// Raw intersection engine on the synthetic idsets of the same sizes
+void IdsetsIntersection::IntersectIdsets(State& state) {
+	const size_t conditions = state.range(0);
+	const int card = state.range(1);
+	std::mt19937 rng(conditions * 100 + card);
+	std::uniform_int_distribution<int> dist(0, card - 1);
+	std::vector<reindexer::base_idset> idsets(conditions);
+	for (int id = 0, cnt = id_seq_->Count(); id < cnt; ++id) {
+		for (auto& ids : idsets) {
+			if (dist(rng) == 0) {
+				ids.emplace_back(reindexer::IdType::FromNumber(id));
+			}
+		}
+	}
+	std::vector<reindexer::IdSetCRef> views(idsets.begin(), idsets.end());
+
+	AllocsTracker allocsTracker(state);
+	size_t resultSize = 0;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		reindexer::base_idset result;
+		reindexer::IntersectIdsets(views, result);
+		resultSize = result.size();
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.counters["result_size"] = double(resultSize);
+}
+
+// Merged result of the large IN() condition is put into the idset cache in the compressed form
+void IdsetsIntersection::CachedSetAndChain(State& state) {
+	benchQuery(
+		[&] {
+			return std::move(reindexer::Query(nsdef_.name)
+								 .Where(fieldName(8, 0), CondSet, {0, 1, 2, 3})
+								 .Where(fieldName(32, 0), CondEq, random<int>(0, 31))
+								 .Limit(0)
+								 .ReqTotal());
+		},
+		state, allowEmptyResult);
+}
+
+// Intersection of the driving plain idset with the other one in the plain and in the compressed forms
+void IdsetsIntersection::IntersectWithBitmap(State& state) {
+	const int card = state.range(0);
+	const bool useBitmap = state.range(1) != 0;
+	std::mt19937 rng(card);
+	std::uniform_int_distribution<int> dist(0, card - 1);
+	reindexer::base_idset driving, other;
+	for (int id = 0, cnt = id_seq_->Count(); id < cnt; ++id) {
+		if (dist(rng) == 0) {
+			driving.emplace_back(reindexer::IdType::FromNumber(id));
+		}
+		// Half of the namespace, i.e. dense enough to be compressed
+		if (id % 2 == 0) {
+			other.emplace_back(reindexer::IdType::FromNumber(id));
+		}
+	}
+	const auto bitmap = reindexer::IdSetBitmap::Build(other);
+
+	AllocsTracker allocsTracker(state);
+	size_t resultSize = 0;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		reindexer::base_idset result;
+		if (useBitmap) {
+			result.assign(driving.begin(), driving.end());
+			result.resize(bitmap->IntersectSorted(result));
+		} else {
+			const reindexer::IdSetCRef views[] = {driving, other};
+			reindexer::IntersectIdsets(views, result);
+		}
+		resultSize = result.size();
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.counters["result_size"] = double(resultSize);
+	state.counters["heap_size"] = double(useBitmap ? bitmap->HeapSize() : other.size() * sizeof(reindexer::IdType));
+}
+
+}  // namespace reindexer_benchmarks
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "base_fixture.h"
+#include "core/idset/idset.h"
+
+namespace reindexer_benchmarks {
+
+// AND-chains of the 2/4/8 indexed conditions with different selectivities.
+// Each condition selects 1/2, 1/8 or 1/32 of the namespace (Args: {conditions count, cardinality}).
+// 'Bitmap' cases compare the intersection with the cached compressed idset against the plain one (Args: {cardinality, 0 - plain/1 - bitmap})
+class [[nodiscard]] IdsetsIntersection : protected BaseFixture {
+public:
+	~IdsetsIntersection() override = default;
+	IdsetsIntersection(Reindexer* db, std::string_view name, size_t maxItems) : BaseFixture(db, name, maxItems) {
+		using reindexer::IndexOpts;
+
+		nsdef_.AddIndex("id", "hash", "int", IndexOpts().PK());
+		for (int card : kCardinalities) {
+			for (int i = 0; i < kMaxConditions; ++i) {
+				nsdef_.AddIndex(fieldName(card, i), "hash", "int", IndexOpts());
+			}
+		}
+	}
+
+	void RegisterAllCases();
+	reindexer::Error Initialize() override;
+
+private:
+	reindexer::Item MakeItem(benchmark::State&) override;
+
+	void Insert(State&);
+	void AndChain(State&);
+	void IntersectIdsets(State&);
+	void CachedSetAndChain(State&);
+	void IntersectWithBitmap(State&);
+
+	static std::string fieldName(int cardinality, int i) { return "c" + std::to_string(cardinality) + "_" + std::to_string(i); }
+
+	static constexpr int kMaxConditions = 8;
+	static constexpr int kCardinalities[] = {2, 8, 32};
+};
+
+}  // namespace reindexer_benchmarks
@@ -1,5 +1,6 @@
 #include "knn_fixture.h"
 #include <thread>
+#include <unordered_set>
 #include "allocs_tracker.h"
 #include "core/ft/config/ftconfig.h"
 #include "gtests/tools.h"
@@ -156,9 +157,15 @@ KnnBench<indexType, metric>::KnnBench(Reindexer* db, std::string_view name, With
 			break;
 		}
 		case IndexType::Ivf: {
-			nsdef_.AddIndex("vec", "ivf", "float_vector",
-							IndexOpts().SetFloatVector(
-								IndexIvf, FloatVectorIndexOpts{}.SetDimension(kDimention).SetMetric(metric).SetNCentroids(kNsSize / 100)));
+			auto fvOpts = FloatVectorIndexOpts{}.SetDimension(kDimention).SetMetric(metric).SetNCentroids(kNsSize / 100);
+			if (withQuantization_ == WithQuantization::Yes) {
+				hnswlib::QuantizationConfig config;
+				config.quantizationType = hnswlib::QuantizationType::ProductQuantization;
+				config.sampleSize = kNsSize;
+				config.quantizationThreshold = kNsSize;
+				std::ignore = fvOpts.SetQuantizationConfig(std::move(config));
+			}
+			nsdef_.AddIndex("vec", "ivf", "float_vector", IndexOpts().SetFloatVector(IndexIvf, std::move(fvOpts)));
 			break;
 		}
 	}
@@ -187,6 +194,7 @@ Item KnnBench<indexType, metric>::MakeItem(State&, int id) {
 		static std::array<float, kDimention> vect;
 		reindexer_tests_tools::rndFloatVector(vect);
 		item["vec"sv] = ConstFloatVectorView{vect};
+		vectors_[id].assign(vect.begin(), vect.end());
 	}
 	return item;
 }
@@ -583,6 +591,87 @@ void KnnBench<indexType, metric>::StreamingKnnNoFilter(State& state) {
 	benchQuery(q, state, itemsCounter);
 }
 
+static size_t GetIndexMemory(Reindexer* db, std::string_view nsName, std::string_view indexName) {
+	QueryResults qr;
+	auto err = db->Select(reindexer::Query("#memstats").Where("name", CondEq, nsName), qr);
+	if (!err.ok()) {
+		throw err;
+	}
+	if (qr.Count() != 1) {
+		throw Error(errLogic, "Unexpected QueryResults size ({}) for #memstats query", qr.Count());
+	}
+
+	auto item = YAML::Load(std::string{(*qr.begin()).GetItem().GetJSON()});
+	for (const auto& index : item["indexes"]) {
+		if (index["name"].as<std::string>() == indexName) {
+			return index["data_size"].as<size_t>(0) + index["indexing_struct_size"].as<size_t>(0);
+		}
+	}
+	throw Error(errLogic, "Info about index {} not found in #memstats", indexName);
+}
+
+// Recall of the K-queries against the exact bruteforce results over the inserted vectors
+template <IndexType indexType, VectorMetric metric>
+void KnnBench<indexType, metric>::Recall(State& state) {
+	const auto distance = [](std::span<const float> l, std::span<const float> r) noexcept {
+		float dist = 0.0f, lNorm = 0.0f, rNorm = 0.0f;
+		for (size_t i = 0; i < l.size(); ++i) {
+			if constexpr (metric == VectorMetric::L2) {
+				dist += (l[i] - r[i]) * (l[i] - r[i]);
+			} else {
+				dist += l[i] * r[i];
+				lNorm += l[i] * l[i];
+				rNorm += r[i] * r[i];
+			}
+		}
+		if constexpr (metric == VectorMetric::Cosine) {
+			return (lNorm > 0.0f && rNorm > 0.0f) ? dist / std::sqrt(lNorm * rNorm) : 0.0f;
+		}
+		return dist;
+	};
+	const auto closer = [](const auto& l, const auto& r) noexcept {
+		return (metric == VectorMetric::L2) ? l.first < r.first : l.first > r.first;
+	};
+
+	double recall = 0.0;
+	size_t queriesCount = 0;
+	std::vector<std::pair<float, int>> dists;
+	std::unordered_set<int> expected;
+	for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+		std::array<float, kDimention> key;
+		reindexer_tests_tools::rndFloatVector(key);
+
+		state.PauseTiming();
+		dists.clear();
+		for (const auto& [id, vec] : vectors_) {
+			dists.emplace_back(distance(key, vec), id);
+		}
+		const size_t k = std::min(kK, dists.size());
+		std::partial_sort(dists.begin(), dists.begin() + k, dists.end(), closer);
+		expected.clear();
+		for (size_t i = 0; i < k; ++i) {
+			expected.insert(dists[i].second);
+		}
+		state.ResumeTiming();
+
+		QueryResults qr;
+		const auto params = KnnSearchParams<indexType, metric, KnnParams::K>{}();
+		auto err = db_->Select(Query(nsdef_.name).WhereKNN("vec"sv, ConstFloatVectorView{key}, params), qr);
+		if (!err.ok()) {
+			state.SkipWithError(err.what());
+			return;
+		}
+		size_t found = 0;
+		for (auto& it : qr) {
+			found += expected.contains(it.GetItem(false)["id"sv].As<int>());
+		}
+		recall += k ? double(found) / k : 1.0;
+		++queriesCount;
+	}
+	state.counters["Recall"] = queriesCount ? recall / queriesCount : 0.0;
+	state.counters["IndexMemory"] = GetIndexMemory(db_, nsdef_.name, "vec");
+}
+
 #if !defined(RX_WITH_STDLIB_DEBUG) && !defined(REINDEX_WITH_ASAN) && !defined(REINDEX_WITH_TSAN)
 
 static bool GetQuantizationStatus(Reindexer* db, std::string_view nsName, std::string_view indexName) {
@@ -641,6 +730,7 @@ void KnnBench<indexType, metric>::RegisterAllCases() {
 #if !defined(RX_WITH_STDLIB_DEBUG) && !defined(REINDEX_WITH_ASAN) && !defined(REINDEX_WITH_TSAN)
 	Register("Sleep"s, &KnnBench<indexType, metric>::Sleep, this)->Iterations(1);
 #endif	// !defined(RX_WITH_STDLIB_DEBUG) && !defined(REINDEX_WITH_ASAN) && !defined(REINDEX_WITH_TSAN)
+	Register("Recall"s, &KnnBench<indexType, metric>::Recall, this)->Iterations(50);
 
 	Register("Knn/K"s, &KnnBench<indexType, metric>::Knn<KnnParams::K>, this);
 	if constexpr (indexType == IndexType::Hnsw) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <random>
+#include <unordered_map>
 
 #include "base_fixture.h"
 #include "ft_base.h"
@@ -60,12 +61,14 @@ private:
 	void StreamingKnnNoFilter(State&);
 	void prepareStreamingParams(State& state);
 	void Sleep(State&);
+	void Recall(State&);
 
 	// NOLINTNEXTLINE(bugprone-random-generator-seed) Using the same seed here for more stable results
 	std::mt19937 randomEngine_{1};
 	std::uniform_int_distribution<int> randomGenerator_{};
 	const WithQuantization withQuantization_;
 	std::vector<float> streamingQuery_;
+	std::unordered_map<int, std::vector<float>> vectors_;  // Inserted vectors for the bruteforce ground truth
 	size_t streamingLimitTree50_{0};
 	size_t streamingLimit2Cond_{0};
 };
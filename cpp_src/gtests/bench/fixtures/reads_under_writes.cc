@@ -0,0 +1,156 @@
+#include "reads_under_writes.h"
+
+#include <thread>
+#include "allocs_tracker.h"
+#include "core/system_ns_names.h"
+#include "helpers.h"
+
+namespace reindexer_benchmarks {
+
+reindexer::Error ReadsUnderWrites::Initialize() {
+	assertrx(db_);
+	return db_->AddNamespace(nsdef_);
+}
+
+void ReadsUnderWrites::RegisterAllCases() {
+	// NOLINTBEGIN(*cplusplus.NewDeleteLeaks)
+	Register("Insert" + std::to_string(id_seq_->Count()), &ReadsUnderWrites::Insert, this)->Iterations(1);
+	Register("SelectUnderUpdateStream", &ReadsUnderWrites::SelectUnderUpdateStream, this)->UseRealTime();
+	Register("SelectByPKUnderUpdateStream", &ReadsUnderWrites::SelectByPKUnderUpdateStream, this)->UseRealTime();
+	Register("SelectUnderTxStream", &ReadsUnderWrites::SelectUnderTxStream, this)->Arg(0)->Arg(1)->UseRealTime();
+	Register("SelectByPKUnderTxStream", &ReadsUnderWrites::SelectByPKUnderTxStream, this)->Arg(0)->Arg(1)->UseRealTime();
+	// NOLINTEND(*cplusplus.NewDeleteLeaks)
+}
+
+void ReadsUnderWrites::Insert(State& state) { BaseFixture::Insert(state); }
+
+reindexer::Item ReadsUnderWrites::MakeItem(benchmark::State&) { return makeItem(id_seq_->Next()); }
+
+reindexer::Item ReadsUnderWrites::makeItem(int id) {
+	reindexer::Item item = db_->NewItem(nsdef_.name);
+	if (item.Status().ok()) {
+		item["id"] = id;
+		item["year"] = random<int>(kMinYear, kMaxYear);
+		item["genre"] = random<int>(0, 49);
+		item["name"] = randString(16);
+	}
+	return item;
+}
+
+reindexer::Query ReadsUnderWrites::rangeQuery() {
+	const int year = random<int>(kMinYear, kMaxYear - 10);
+	return reindexer::Query(nsdef_.name).Where("year", CondRange, {year, year + 10}).Where("genre", CondLt, 25).Limit(20);
+}
+
+reindexer::Query ReadsUnderWrites::pkQuery() {
+	return reindexer::Query(nsdef_.name).Where("id", CondEq, random<int>(id_seq_->Start(), id_seq_->End()));
+}
+
+void ReadsUnderWrites::SelectUnderUpdateStream(State& state) {
+	selectUnderWrites(state, [this] { return rangeQuery(); }, [this] { return upsertItem(); });
+}
+
+void ReadsUnderWrites::SelectByPKUnderUpdateStream(State& state) {
+	selectUnderWrites(state, [this] { return pkQuery(); }, [this] { return upsertItem(); });
+}
+
+void ReadsUnderWrites::SelectUnderTxStream(State& state) {
+	setTxCopyPolicy(state, state.range(0) != 0);
+	selectUnderWrites(state, [this] { return rangeQuery(); }, [this] { return commitTx(); });
+	setTxCopyPolicy(state, false);
+}
+
+void ReadsUnderWrites::SelectByPKUnderTxStream(State& state) {
+	setTxCopyPolicy(state, state.range(0) != 0);
+	selectUnderWrites(state, [this] { return pkQuery(); }, [this] { return commitTx(); });
+	setTxCopyPolicy(state, false);
+}
+
+template <typename QueryGenT, typename WriteT>
+void ReadsUnderWrites::selectUnderWrites(State& state, QueryGenT&& queryGen, WriteT&& write) {
+	std::atomic<bool> stop{false};
+	std::atomic<size_t> writesCount{0};
+	reindexer::Error writerErr;
+	std::thread writer([&] {
+		while (!stop.load(std::memory_order_relaxed)) {
+			auto err = write();
+			if (!err.ok()) {
+				writerErr = std::move(err);
+				return;
+			}
+			writesCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	});
+
+	std::vector<int64_t> latencies;
+	latencies.reserve(1 << 16);
+	{
+		AllocsTracker allocsTracker(state);
+		for (auto _ : state) {	// NOLINT(*deadcode.DeadStores)
+			const auto q = queryGen();
+			const auto start = std::chrono::steady_clock::now();
+			reindexer::QueryResults qres;
+			auto err = db_->Select(q, qres);
+			latencies.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+			if (!err.ok()) [[unlikely]] {
+				state.SkipWithError(err.what());
+			}
+		}
+	}
+	stop.store(true, std::memory_order_relaxed);
+	writer.join();
+	if (!writerErr.ok()) {
+		state.SkipWithError(writerErr.what());
+	}
+
+	if (!latencies.empty()) {
+		std::sort(latencies.begin(), latencies.end());
+		const auto percentile = [&latencies](double p) { return double(latencies[size_t(p * double(latencies.size() - 1))]); };
+		state.counters["p50_us"] = percentile(0.5);
+		state.counters["p99_us"] = percentile(0.99);
+		state.counters["max_us"] = double(latencies.back());
+	}
+	state.counters["writes"] = double(writesCount.load(std::memory_order_relaxed));
+}
+
+reindexer::Error ReadsUnderWrites::upsertItem() {
+	auto item = makeItem(random<int>(id_seq_->Start(), id_seq_->End()));
+	if (!item.Status().ok()) {
+		return item.Status();
+	}
+	return db_->Upsert(nsdef_.name, item);
+}
+
+reindexer::Error ReadsUnderWrites::commitTx() {
+	auto tx = db_->NewTransaction(nsdef_.name);
+	if (!tx.Status().ok()) {
+		return tx.Status();
+	}
+	for (int i = 0; i < kTxSize; ++i) {
+		auto item = makeItem(random<int>(id_seq_->Start(), id_seq_->End()));
+		if (!item.Status().ok()) {
+			return item.Status();
+		}
+		auto err = tx.Upsert(std::move(item));
+		if (!err.ok()) {
+			return err;
+		}
+	}
+	reindexer::QueryResults qr;
+	return db_->CommitTransaction(tx, qr);
+}
+
+void ReadsUnderWrites::setTxCopyPolicy(State& state, bool copyNamespace) {
+	// Default multiplier disables the copying of the namespace, which is much larger than the transaction
+	constexpr int kDefaultCopyPolicyMultiplier = 5, kUnlimitedCopyPolicyMultiplier = 10'000;
+	const auto q = reindexer::Query(reindexer::kConfigNamespace)
+					   .Set("namespaces.copy_policy_multiplier", copyNamespace ? kUnlimitedCopyPolicyMultiplier : kDefaultCopyPolicyMultiplier)
+					   .Where("type", CondEq, "namespaces");
+	reindexer::QueryResults qr;
+	auto err = db_->Update(q, qr);
+	if (!err.ok()) {
+		state.SkipWithError(err.what());
+	}
+}
+
+}  // namespace reindexer_benchmarks
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "base_fixture.h"
+
+namespace reindexer_benchmarks {
+
+// Measures selects latency distribution under the concurrent stream of the modifications.
+// 'UpdateStream' cases run the selects concurrently with the single item upserts.
+// 'TxStream' cases run the selects concurrently with the large transactions, which are committed in place (0) or into the namespace
+// copy (1), depending on the 'copy_policy_multiplier' namespace option
+class [[nodiscard]] ReadsUnderWrites : protected BaseFixture {
+public:
+	~ReadsUnderWrites() override = default;
+	ReadsUnderWrites(Reindexer* db, std::string_view name, size_t maxItems) : BaseFixture(db, name, maxItems) {
+		using reindexer::IndexOpts;
+
+		nsdef_.AddIndex("id", "hash", "int", IndexOpts().PK());
+		nsdef_.AddIndex("year", "tree", "int", IndexOpts());
+		nsdef_.AddIndex("genre", "hash", "int", IndexOpts());
+		nsdef_.AddIndex("name", "hash", "string", IndexOpts());
+	}
+
+	void RegisterAllCases();
+	reindexer::Error Initialize() override;
+
+private:
+	reindexer::Item MakeItem(benchmark::State&) override;
+	reindexer::Item makeItem(int id);
+
+	void Insert(State&);
+	void SelectUnderUpdateStream(State&);
+	void SelectByPKUnderUpdateStream(State&);
+	void SelectUnderTxStream(State&);
+	void SelectByPKUnderTxStream(State&);
+
+	reindexer::Query rangeQuery();
+	reindexer::Query pkQuery();
+	template <typename QueryGenT, typename WriteT>
+	void selectUnderWrites(State&, QueryGenT&&, WriteT&&);
+	reindexer::Error upsertItem();
+	reindexer::Error commitTx();
+	void setTxCopyPolicy(State&, bool copyNamespace);
+
+	static constexpr int kTxSize = 10'000;
+	static constexpr int kMinYear = 1900;
+	static constexpr int kMaxYear = 2025;
+};
+
+}  // namespace reindexer_benchmarks
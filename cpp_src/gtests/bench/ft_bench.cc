@@ -5,6 +5,7 @@
 
 #include "args/args.hpp"
 #include "ft_fixture.h"
+#include "ft_top_k.h"
 
 namespace reindexer_benchmarks {
 
@@ -62,6 +63,13 @@ int BenchMain(int argc, char** argv) {
 	}
 	ft.RegisterAllCases(fastIterationCount, slowIterationCount, verySlowIterationCount);
 
+	FullTextTopK ftTopK(DB.get(), "top_k", kItemsInBenchDataset);
+	err = ftTopK.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+	ftTopK.RegisterAllCases();
+
 	// Disabled bench for large merge limits
 	// FullTextMergeLimit ftMergeLimit(DB.get(), "merge_limit", 100000);
 	// err = ftMergeLimit.Initialize();
@@ -74,6 +74,27 @@ int BenchMain(int argc, char** argv) {
 		return err.code();
 	}
 
+	knn_bench::KnnBench<knn_bench::IndexType::Ivf, reindexer::VectorMetric::L2> ivfL2Q(DB.get(), "quantized_ivf_l2_bench"sv,
+																					   knn_bench::WithQuantization::Yes);
+	err = ivfL2Q.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
+	knn_bench::KnnBench<knn_bench::IndexType::Ivf, reindexer::VectorMetric::Cosine> ivfCosineQ(DB.get(), "quantized_ivf_cosine_bench"sv,
+																							   knn_bench::WithQuantization::Yes);
+	err = ivfCosineQ.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
+	knn_bench::KnnBench<knn_bench::IndexType::Ivf, reindexer::VectorMetric::InnerProduct> ivfInnerProductQ(
+		DB.get(), "quantized_ivf_inner_product_bench"sv, knn_bench::WithQuantization::Yes);
+	err = ivfInnerProductQ.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
 	::benchmark::Initialize(&argc, argv);
 	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
 		return 1;
@@ -88,6 +109,9 @@ int BenchMain(int argc, char** argv) {
 	ivfL2.RegisterAllCases();
 	ivfCosine.RegisterAllCases();
 	ivfInnerProduct.RegisterAllCases();
+	ivfL2Q.RegisterAllCases();
+	ivfCosineQ.RegisterAllCases();
+	ivfInnerProductQ.RegisterAllCases();
 
 	::benchmark::RunSpecifiedBenchmarks();
 	::benchmark::Shutdown();
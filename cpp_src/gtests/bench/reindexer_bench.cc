@@ -8,7 +8,10 @@
 #include "api_tv_simple_sparse.h"
 #include "equalpositions.h"
 #include "geometry.h"
+#include "idset_cache_concurrency.h"
+#include "idsets_intersection.h"
 #include "join_items.h"
+#include "reads_under_writes.h"
 #include "update_items.h"
 
 namespace reindexer_benchmarks {
@@ -43,6 +46,9 @@ int BenchMain(int argc, char** argv) {
 	ApiEncDec decoding(DB.get(), "EncDec");
 	EqualPositions equalPosition(DB.get(), "EqualPositions", kItemsInBenchDataset);
 	UpdateItems updateItems(DB.get(), "UpdateItems", 2000);
+	ReadsUnderWrites readsUnderWrites(DB.get(), "ReadsUnderWrites", kItemsInBenchDataset);
+	IdsetsIntersection idsetsIntersection(DB.get(), "IdsetsIntersection", kItemsInBenchDataset);
+	IdSetCacheConcurrency idSetCacheConcurrency(DB.get(), "IdSetCacheConcurrency", kItemsInBenchDataset);
 
 	auto err = apiTvSimple.Initialize();
 	if (!err.ok()) {
@@ -94,6 +100,21 @@ int BenchMain(int argc, char** argv) {
 		return err.code();
 	}
 
+	err = readsUnderWrites.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
+	err = idsetsIntersection.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
+	err = idSetCacheConcurrency.Initialize();
+	if (!err.ok()) {
+		return err.code();
+	}
+
 	::benchmark::Initialize(&argc, argv);
 	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
 		return 1;
@@ -109,6 +130,9 @@ int BenchMain(int argc, char** argv) {
 	decoding.RegisterAllCases();
 	equalPosition.RegisterAllCases();
 	updateItems.RegisterAllCases();
+	readsUnderWrites.RegisterAllCases();
+	idsetsIntersection.RegisterAllCases();
+	idSetCacheConcurrency.RegisterAllCases();
 
 	::benchmark::RunSpecifiedBenchmarks();
 	::benchmark::Shutdown();
@@ -68,7 +68,8 @@ bool AsyncReplicationConfigTest::operator==(const AsyncReplicationConfigTest& co
 	return role == config.role && mode == config.mode && nodes == config.nodes && forceSyncOnLogicError == config.forceSyncOnLogicError &&
 		   forceSyncOnWrongDataHash == config.forceSyncOnWrongDataHash && appName == config.appName && namespaces == config.namespaces &&
 		   serverId == config.serverId && syncThreads == config.syncThreads &&
-		   concurrentSyncsPerThread == config.concurrentSyncsPerThread && onlineUpdatesDelayMSec == config.onlineUpdatesDelayMSec;
+		   concurrentSyncsPerThread == config.concurrentSyncsPerThread && onlineUpdatesDelayMSec == config.onlineUpdatesDelayMSec &&
+		   applyLanesCount == config.applyLanesCount && compressionCodec == config.compressionCodec && zstdDictSize == config.zstdDictSize;
 }
 
 std::string AsyncReplicationConfigTest::GetJSON() const {
@@ -88,6 +89,9 @@ void AsyncReplicationConfigTest::GetJSON(JsonBuilder& jb) const {
 	jb.Put("sync_threads", syncThreads);
 	jb.Put("syncs_per_thread", concurrentSyncsPerThread);
 	jb.Put("online_updates_delay_msec", onlineUpdatesDelayMSec);
+	jb.Put("apply_lanes_count", applyLanesCount);
+	jb.Put("compression_codec", compressionCodec);
+	jb.Put("zstd_dict_size", zstdDictSize);
 	{
 		auto arrNode = jb.Array("namespaces");
 		for (const auto& ns : namespaces) {
@@ -234,10 +238,14 @@ AsyncReplicationConfigTest ServerControl::Interface::GetServerConfig(ConfigType
 			followers.back().nsList.emplace(std::move(nss));
 		}
 	}
-	return AsyncReplicationConfigTest(cluster::AsyncReplConfigData::Role2str(asyncReplConf.role), std::move(followers),
+	AsyncReplicationConfigTest config(cluster::AsyncReplConfigData::Role2str(asyncReplConf.role), std::move(followers),
 									  asyncReplConf.forceSyncOnLogicError, asyncReplConf.forceSyncOnWrongDataHash, replConf.serverID,
 									  std::move(asyncReplConf.appName), std::move(namespaces),
 									  cluster::AsyncReplConfigData::Mode2str(asyncReplConf.mode), asyncReplConf.onlineUpdatesDelayMSec);
+	config.applyLanesCount = asyncReplConf.applyLanesCount;
+	config.compressionCodec = reindexer::net::cproto::CompressionCodecToStr(asyncReplConf.compressionCodec);
+	config.zstdDictSize = asyncReplConf.zstdDictSize;
+	return config;
 }
 
 void ServerControl::Interface::WriteReplicationConfig(const std::string& configYaml) {
@@ -55,6 +55,9 @@ struct [[nodiscard]] AsyncReplicationConfigTest {
 	NsSet namespaces;
 	int serverId;
 	int onlineUpdatesDelayMSec = 100;
+	int applyLanesCount = 1;
+	std::string compressionCodec{"snappy"};
+	int zstdDictSize = int(reindexer::net::cproto::kDefaultZstdDictSize);
 	std::string selfReplicationToken;
 	reindexer::NsNamesHashMapT<std::string> admissibleTokens;
 };
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <set>
+
+#include "core/nsselecter/sketches.h"
+#include "core/payload/payloadtypeimpl.h"
+#include "core/queryresults/aggregationresult.h"
+#include "gtests/tests/fixtures/reindexer_api.h"
+#include "tools/serilize/serializer.h"
+#include "tools/serilize/wrserializer.h"
+
+namespace reindexer_tests {
+
+using reindexer::AggregationResult;
+using reindexer::IndexOpts;
+using reindexer::Variant;
+namespace sketch = reindexer::sketch;
+
+TEST_F(ReindexerApi, ApproxAggregations) {
+	constexpr int kItemsCount = 20'000;
+	constexpr int kUsersCount = 3'000;
+	rt.OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"value", "tree", "int", IndexOpts(), 0}});
+	std::vector<int> values;
+	values.reserve(kItemsCount);
+	for (int i = 0; i < kItemsCount; ++i) {
+		values.emplace_back((i * 7919) % 10'000);
+		// 5 heavy categories with 10% of the items each and 50 light ones with 1% each
+		const int category = (i % 100) < 50 ? (i % 100) % 5 : i % 100;
+		rt.UpsertJSON(default_namespace, fmt::format(R"json({{"id":{},"value":{},"user":"user_{}","category":"c{}"}})json", i,
+													 values.back(), i % kUsersCount, category));
+	}
+	std::sort(values.begin(), values.end());
+
+	const auto check = [&](const std::vector<AggregationResult>& aggs) {
+		ASSERT_EQ(aggs.size(), 3);
+
+		ASSERT_EQ(aggs[0].GetType(), AggPercentile);
+		const auto& percentiles = aggs[0].GetPercentiles();
+		ASSERT_EQ(percentiles.size(), 3);
+		for (const auto& p : percentiles) {
+			const double expected = values[size_t(p.rank / 100.0 * (values.size() - 1))];
+			EXPECT_NEAR(p.value, expected, 0.01 * 10'000) << p.rank;
+		}
+		ASSERT_TRUE(aggs[0].GetValue());
+		EXPECT_DOUBLE_EQ(*aggs[0].GetValue(), percentiles[0].value);
+
+		ASSERT_EQ(aggs[1].GetType(), AggApproxCountDistinct);
+		EXPECT_NEAR(aggs[1].GetValueOrZero(), kUsersCount, 0.03 * kUsersCount);
+
+		ASSERT_EQ(aggs[2].GetType(), AggTopKApprox);
+		const auto& facets = aggs[2].GetFacets();
+		ASSERT_EQ(facets.size(), 5);
+		std::set<std::string> top;
+		for (const auto& f : facets) {
+			ASSERT_EQ(f.values.size(), 1);
+			top.insert(f.values[0]);
+			EXPECT_EQ(f.count, kItemsCount / 10) << f.values[0];
+		}
+		EXPECT_EQ(top, (std::set<std::string>{"c0", "c1", "c2", "c3", "c4"}));
+	};
+
+	const std::string sql =
+		fmt::format("SELECT percentile(value, 50, 90, 99), approx_count_distinct(user), top_k_approx(category LIMIT 5) FROM {}",
+					default_namespace);
+	const Query q = Query::FromSQL(sql);
+	EXPECT_EQ(Query::FromSQL(q.GetSQL()), q) << q.GetSQL();
+	EXPECT_EQ(Query::FromJSON(q.GetJSON()), q);
+	{
+		reindexer::WrSerializer ser;
+		q.Serialize(ser);
+		reindexer::Serializer rser(ser.Slice());
+		EXPECT_EQ(Query::Deserialize(rser), q);
+	}
+	EXPECT_EQ(q, Query(default_namespace)
+					 .AggregatePercentile("value", {50, 90, 99})
+					 .Aggregate(AggApproxCountDistinct, {"user"})
+					 .Aggregate(AggTopKApprox, {"category"}, {}, 5));
+
+	{
+		auto qr = rt.Select(q);
+		check(qr.GetAggregationResults());
+	}
+	{
+		auto qr = rt.ExecSQL(sql);
+		check(qr.GetAggregationResults());
+	}
+
+	// Invalid arguments
+	for (std::string_view badSql : {"SELECT percentile(value) FROM ", "SELECT percentile(value, 101) FROM ",
+									"SELECT approx_count_distinct(value LIMIT 5) FROM ", "SELECT top_k_approx(value OFFSET 5) FROM "}) {
+		QueryResults qr;
+		const auto err = rt.reindexer->ExecSQL(std::string(badSql) + default_namespace, qr);
+		EXPECT_FALSE(err.ok()) << badSql;
+	}
+}
+
+TEST(ApproxAggregations, StableValuesHashes) {
+	// Sketches from the different processes are merged, so the hashes must not depend on the process or the platform's std::hash
+	EXPECT_EQ(sketch::HashValue(Variant{int64_t(42)}), 9445750402258972184ULL);
+	EXPECT_EQ(sketch::HashValue(Variant{std::string("reindexer")}), 7209816052766752467ULL);
+	EXPECT_EQ(sketch::HashValue(Variant{42}), sketch::HashValue(Variant{int64_t(42)}));
+	EXPECT_EQ(sketch::HashValue(Variant{-0.0}), sketch::HashValue(Variant{0.0}));
+	EXPECT_NE(sketch::HashValue(Variant{int64_t(42)}), sketch::HashValue(Variant{int64_t(43)}));
+	EXPECT_NE(sketch::HashValue(Variant{true}), sketch::HashValue(Variant{false}));
+}
+
+TEST(ApproxAggregations, MergeSketches) {
+	constexpr int kValuesCount = 100'000;
+	constexpr int kShards = 3;
+	const auto value = [](int i) { return Variant{int64_t(i % 40'000)}; };
+
+	// Merged per-shard sketches have to be equal to the single sketch over all of the values
+	sketch::HyperLogLog fullHll;
+	std::vector<sketch::HyperLogLog> hlls(kShards);
+	sketch::TDigest fullDigest;
+	std::vector<sketch::TDigest> digests(kShards);
+	sketch::SpaceSaving fullTop(100);
+	std::vector<sketch::SpaceSaving> tops(kShards, sketch::SpaceSaving(100));
+	for (int i = 0; i < kValuesCount; ++i) {
+		const auto hash = sketch::HashValue(value(i));
+		fullHll.Add(hash);
+		hlls[i % kShards].Add(hash);
+		fullDigest.Add(i);
+		digests[i % kShards].Add(i);
+		const std::string str = std::to_string(i % 20 == 0 ? 0 : i);
+		fullTop.Add(std::string(str));
+		tops[i % kShards].Add(std::string(str));
+	}
+	for (int i = 1; i < kShards; ++i) {
+		hlls[0].Merge(hlls[i]);
+		digests[0].Merge(digests[i]);
+		tops[0].Merge(tops[i]);
+	}
+	EXPECT_DOUBLE_EQ(hlls[0].Estimate(), fullHll.Estimate());
+	EXPECT_NEAR(fullHll.Estimate(), 40'000, 0.03 * 40'000);
+	for (double q : {0.01, 0.5, 0.9, 0.999}) {
+		EXPECT_NEAR(digests[0].Quantile(q), q * kValuesCount, 0.01 * kValuesCount) << q;
+		EXPECT_NEAR(fullDigest.Quantile(q), q * kValuesCount, 0.01 * kValuesCount) << q;
+	}
+	const auto top = tops[0].Top(1);
+	ASSERT_EQ(top.size(), 1);
+	EXPECT_EQ(top[0].value, "0");
+	EXPECT_GE(top[0].count, kValuesCount / 20);
+	EXPECT_LE(top[0].count - top[0].error, kValuesCount / 20);
+
+	// The sketches are passed through the serialized aggregation results
+	std::vector<AggregationResult> results;
+	for (int shard = 0; shard < kShards; ++shard) {
+		sketch::HyperLogLog hll;
+		for (int i = shard; i < kValuesCount; i += kShards) {
+			hll.Add(sketch::HashValue(value(i)));
+		}
+		reindexer::WrSerializer ser;
+		hll.Serialize(ser);
+		AggregationResult res{AggApproxCountDistinct, {"field"}, std::string(ser.Slice()), {}};
+		reindexer::WrSerializer json;
+		res.GetJSON(json);
+		auto parsed = AggregationResult::FromJSON(json.Slice());
+		ASSERT_TRUE(parsed) << parsed.error().what();
+		ASSERT_TRUE(parsed->HasSketch());
+		reindexer::WrSerializer msgpack;
+		parsed->GetMsgPack(msgpack);
+		auto unpacked = AggregationResult::FromMsgPack(msgpack.Slice());
+		ASSERT_TRUE(unpacked) << unpacked.error().what();
+		results.emplace_back(std::move(*unpacked));
+	}
+	for (int shard = 1; shard < kShards; ++shard) {
+		results[0].MergeSketch(results[shard]);
+	}
+	results[0].FinalizeSketch();
+	EXPECT_FALSE(results[0].HasSketch());
+	EXPECT_DOUBLE_EQ(results[0].GetValueOrZero(), std::round(fullHll.Estimate()));
+}
+
+}  // namespace reindexer_tests
@@ -197,4 +197,48 @@ TEST_F(ReindexerApi, BtreeUnbuiltIndexIteratorsTest) {
 	EXPECT_TRUE(pos == 0);
 }
 
+TEST(BtreeIdsets, SharedBtreeCopyOnWrite) {
+	using reindexer::IdType;
+	constexpr int kIdsCount = 5000;
+
+	reindexer::IdSet src;
+	for (int i = 0; i < kIdsCount; ++i) {
+		std::ignore = src.Add(IdType::FromNumber(i), 0);
+	}
+	ASSERT_NE(src.BTree(), nullptr);
+
+	// Btree has to be shared between the copies until the first modification
+	reindexer::IdSet copy{src};
+	ASSERT_EQ(copy.BTree(), src.BTree());
+	ASSERT_EQ(copy.Size(), kIdsCount);
+
+	const auto* srcBtree = src.BTree();
+	EXPECT_EQ(copy.Erase(IdType::FromNumber(0)), 1);
+	EXPECT_TRUE(copy.Add(IdType::FromNumber(kIdsCount), 0));
+	EXPECT_NE(copy.BTree(), srcBtree);
+	EXPECT_EQ(src.BTree(), srcBtree);
+
+	EXPECT_TRUE(src.Find(IdType::FromNumber(0)));
+	EXPECT_FALSE(src.Find(IdType::FromNumber(kIdsCount)));
+	EXPECT_EQ(src.Size(), kIdsCount);
+	EXPECT_FALSE(copy.Find(IdType::FromNumber(0)));
+	EXPECT_TRUE(copy.Find(IdType::FromNumber(kIdsCount)));
+	EXPECT_EQ(copy.Size(), kIdsCount);
+
+	// Unique btree has to be modified in place
+	const auto* copyBtree = copy.BTree();
+	EXPECT_EQ(copy.Erase(IdType::FromNumber(1)), 1);
+	EXPECT_EQ(copy.BTree(), copyBtree);
+
+	// Commited copies have to keep btrees independent
+	copy.Commit(0);
+	src.Commit(0);
+	reindexer::IdSet copy2{src};
+	EXPECT_EQ(copy2.Erase(IdType::FromNumber(2)), 1);
+	EXPECT_TRUE(src.Find(IdType::FromNumber(2)));
+	EXPECT_FALSE(copy2.Find(IdType::FromNumber(2)));
+	EXPECT_EQ(src.Size(), kIdsCount);
+	EXPECT_EQ(copy2.Size(), kIdsCount - 1);
+}
+
 }  // namespace reindexer_tests
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include "core/system_ns_names.h"
+#include "fmt/format.h"
+#include "gtests/tests/fixtures/reindexertestapi.h"
+#include "tools/fsops.h"
+
+namespace reindexer_tests {
+
+using reindexer::IndexOpts;
+using reindexer::Query;
+
+// Namespace with storage evicts the tuples into the storage, reference namespace without storage keeps all of them in memory
+class [[nodiscard]] ColdPayloadsApi : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::ignore = reindexer::fs::RmDirAll(kStoragePath);
+		rt.reindexer = std::make_shared<reindexer::Reindexer>();
+		rt.Connect("builtin://" + kStoragePath);
+
+		rt.OpenNamespace(kNsName);
+		rt.OpenNamespace(kRefNsName, StorageOpts().Enabled(false));
+		for (auto ns : {kNsName, kRefNsName}) {
+			rt.DefineNamespaceDataset(ns, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+										   IndexDeclaration{"name", "hash", "string", IndexOpts(), 0},
+										   IndexDeclaration{"price", "tree", "double", IndexOpts(), 0},
+										   IndexDeclaration{"nested.value", "hash", "int", IndexOpts().Sparse(), 0}});
+		}
+	}
+
+	void setPayloadsMemoryLimit(int64_t limit) {
+		ReindexerTestApi<reindexer::Reindexer>::QueryResultsType qr;
+		rt.Update(Query(reindexer::kConfigNamespace)
+					  .Set("namespaces[*].payloads_memory_limit", limit)
+					  .Where("type", CondEq, "namespaces"),
+				  qr);
+	}
+	void upsertItems(int from, int to, std::string_view suffix) {
+		for (auto ns : {kNsName, kRefNsName}) {
+			for (int i = from; i < to; ++i) {
+				rt.UpsertJSON(ns, fmt::format(R"json({{"id":{},"name":"name_{}","price":{}.5,"nested":{{"value":{}}},)json"
+											  R"json("non_indexed":"data_{}{}","text":"{}","arr":[{},{}]}})json",
+											  i, i % 100, i, i % 13, i, suffix, std::string(100, 'a' + i % 26), i, i + 1));
+			}
+		}
+	}
+	void awaitColdItems(size_t count) {
+		const auto q = count ? Query(reindexer::kMemStatsNamespace)
+								   .Where("name", CondEq, kNsName)
+								   .Where("cold_items_count", CondEq, int64_t(count))
+							 : Query(reindexer::kMemStatsNamespace)
+								   .Where("name", CondEq, kNsName)
+								   .Where("cold_items_count", CondEmpty, reindexer::VariantArray{});
+		for (int i = 0; i < 100; ++i) {
+			if (rt.Select(q).Count() == 1) {
+				return;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+		FAIL() << "Expecting " << count << " cold items in " << kNsName;
+	}
+	std::vector<std::string> select(Query q) {
+		auto qr = rt.Select(q);
+		auto items = rt.GetSerializedQrItems(qr);
+		for (auto& agg : qr.GetAggregationResults()) {
+			reindexer::WrSerializer ser;
+			agg.GetJSON(ser);
+			items.emplace_back(ser.Slice());
+		}
+		return items;
+	}
+	// Those queries do not require the tuples of the not selected items
+	std::vector<Query> indexedQueries() const {
+		return {Query(kNsName).Sort("id", false), Query(kNsName).Where("name", CondEq, "name_5").Sort("id", false),
+				Query(kNsName).Where("price", CondGe, 500).Sort("price", true).Limit(50),
+				Query(kNsName).Where("id", CondLt, 100).Select({"id", "non_indexed"}).Sort("id", false)};
+	}
+	std::vector<Query> nonIndexedQueries() const {
+		return {Query(kNsName).Where("non_indexed", CondEq, "data_5"), Query(kNsName).Sort("non_indexed", true).Limit(20),
+				Query(kNsName).Where("nested.value", CondEq, 5).Sort("id", false), Query(kNsName).Distinct("text").Limit(0),
+				Query(kNsName).Where("arr", CondSet, {10, 20, 30}).Sort("id", false)};
+	}
+	void checkQueries(const std::vector<Query>& queries) {
+		for (const auto& q : queries) {
+			Query refQ = q;
+			refQ.SetNsName(kRefNsName);
+			ASSERT_EQ(select(refQ), select(q)) << q.GetSQL();
+		}
+	}
+
+	const std::string kStoragePath = reindexer::fs::JoinPath(reindexer::fs::GetTempDir(), "ColdPayloadsTest");
+	constexpr static std::string_view kNsName = "cold_payloads_ns";
+	constexpr static std::string_view kRefNsName = "cold_payloads_ref_ns";
+	constexpr static int kItemsCount = 3000;
+	ReindexerTestApi<reindexer::Reindexer> rt;
+};
+
+TEST_F(ColdPayloadsApi, SelectColdItems) {
+	upsertItems(0, kItemsCount, "");
+	setPayloadsMemoryLimit(1);
+	awaitColdItems(kItemsCount);
+
+	// Selected tuples are loaded from the storage without the restoration of the items
+	checkQueries(indexedQueries());
+	awaitColdItems(kItemsCount);
+
+	// Filtering and sorting by the non-indexed fields load the tuples of the checked items without their restoration
+	checkQueries(nonIndexedQueries());
+	awaitColdItems(kItemsCount);
+	checkQueries(indexedQueries());
+}
+
+TEST_F(ColdPayloadsApi, ModifyColdItems) {
+	upsertItems(0, kItemsCount, "");
+	setPayloadsMemoryLimit(1);
+	awaitColdItems(kItemsCount);
+
+	upsertItems(500, 1000, "_updated");
+	for (auto ns : {kNsName, kRefNsName}) {
+		ASSERT_EQ(rt.Delete(Query(ns).Where("id", CondRange, {1500, 1999})), 500u);
+		ReindexerTestApi<reindexer::Reindexer>::QueryResultsType qr;
+		rt.Update(Query(ns).Set("non_indexed", "updated").Where("id", CondLt, 100), qr);
+		ASSERT_EQ(qr.Count(), 100u);
+	}
+	checkQueries(indexedQueries());
+	checkQueries(nonIndexedQueries());
+
+	// Indexes are rebuilt from the restored tuples
+	awaitColdItems(kItemsCount - 500);
+	for (auto ns : {kNsName, kRefNsName}) {
+		rt.AddIndex(ns, reindexer::IndexDef{"non_indexed", "hash", "string", IndexOpts()});
+	}
+	checkQueries(nonIndexedQueries());
+
+	// All of the tuples are restored, when eviction is disabled
+	awaitColdItems(kItemsCount - 500);
+	setPayloadsMemoryLimit(0);
+	awaitColdItems(0);
+	checkQueries(indexedQueries());
+
+	rt.CloseNamespace(kNsName);
+	rt.OpenNamespace(kNsName);
+	checkQueries(indexedQueries());
+}
+
+TEST_F(ColdPayloadsApi, EvictModifiedItems) {
+	upsertItems(0, kItemsCount, "");
+	setPayloadsMemoryLimit(1);
+	awaitColdItems(kItemsCount);
+
+	// Modified and reinserted items are evicted again without the explicit storage flush.
+	// Reinserted items reuse the row slots of the deleted ones
+	for (int i = 0; i < 5; ++i) {
+		for (auto ns : {kNsName, kRefNsName}) {
+			ASSERT_EQ(rt.Delete(Query(ns).Where("id", CondLt, 100)), 100u);
+		}
+		upsertItems(0, 200, fmt::format("_modified_{}", i));
+		awaitColdItems(kItemsCount);
+		checkQueries(indexedQueries());
+		checkQueries(nonIndexedQueries());
+	}
+
+	// Restored tuples contain the actual versions of the items
+	awaitColdItems(kItemsCount);
+	setPayloadsMemoryLimit(0);
+	awaitColdItems(0);
+	checkQueries(indexedQueries());
+	checkQueries(nonIndexedQueries());
+}
+
+}  // namespace reindexer_tests
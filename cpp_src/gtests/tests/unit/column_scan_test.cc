@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include "gtests/tests/fixtures/reindexer_api.h"
+
+namespace reindexer_tests {
+
+using reindexer::IndexOpts;
+
+TEST_F(ReindexerApi, VectorizedColumnScan) {
+	constexpr int kItemsCount = 50'000;
+	struct [[nodiscard]] Row {
+		int id;
+		int year;
+		int64_t genre;
+		double rating;
+		int ts;
+	};
+	rt.OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"year", "-", "int", IndexOpts(), 0},
+											   IndexDeclaration{"genre", "-", "int64", IndexOpts(), 0},
+											   IndexDeclaration{"rating", "-", "double", IndexOpts(), 0},
+											   IndexDeclaration{"ts", "-", "int", IndexOpts(), 0}});
+	std::vector<Row> rows;
+	rows.reserve(kItemsCount);
+	for (int i = 0; i < kItemsCount; ++i) {
+		// 'ts' grows monotonically, so most of the chunks are skipped by the zone maps for the narrow ranges
+		const Row& row = rows.emplace_back(Row{i, 2000 + (i * 7) % 25, (i * 31) % 50, ((i * 37) % 100) / 10.0, i});
+		rt.UpsertJSON(default_namespace, fmt::format(R"json({{"id":{},"year":{},"genre":{},"rating":{},"ts":{}}})json", row.id, row.year,
+													 row.genre, row.rating, row.ts));
+	}
+	// Free items must be skipped
+	ASSERT_EQ(rt.Delete(Query(default_namespace).Where("id", CondRange, {10'000, 14'999})), 5'000u);
+	std::erase_if(rows, [](const Row& r) { return r.id >= 10'000 && r.id <= 14'999; });
+	rt.AwaitIndexOptimization(default_namespace);
+
+	const auto check = [&](const Query& q, const std::function<bool(const Row&)>& filter, bool columnScanExpected) {
+		auto qr = rt.Select(Query(q).Explain().ReqTotal());
+		std::vector<int> expected, result;
+		for (const auto& r : rows) {
+			if (filter(r)) {
+				expected.emplace_back(r.id);
+			}
+		}
+		for (auto& it : qr) {
+			result.emplace_back(it.GetItem(false)["id"].As<int>());
+		}
+		std::sort(result.begin(), result.end());
+		EXPECT_EQ(result, expected) << q.GetSQL();
+		EXPECT_EQ(qr.TotalCount(), expected.size()) << q.GetSQL();
+		EXPECT_EQ(qr.GetExplainResults().find("-column-scan") != std::string::npos, columnScanExpected)
+			<< q.GetSQL() << "\n"
+			<< qr.GetExplainResults();
+	};
+
+	check(Query(default_namespace).Where("year", CondRange, {2005, 2010}), [](const Row& r) { return r.year >= 2005 && r.year <= 2010; },
+		  true);
+	check(Query(default_namespace).Where("genre", CondSet, {1, 5, 7}).Where("rating", CondGe, 5.5).Not().Where("year", CondEq, 2003),
+		  [](const Row& r) { return (r.genre == 1 || r.genre == 5 || r.genre == 7) && r.rating >= 5.5 && r.year != 2003; }, true);
+	check(Query(default_namespace).Where("genre", CondSet, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}).Where("rating", CondLt, 1.0),
+		  [](const Row& r) { return r.genre >= 1 && r.genre <= 12 && r.rating < 1.0; }, true);
+	check(Query(default_namespace).Where("ts", CondRange, {30'000, 30'100}).Where("rating", CondLe, 3.0),
+		  [](const Row& r) { return r.ts >= 30'000 && r.ts <= 30'100 && r.rating <= 3.0; }, true);
+	check(Query(default_namespace).Not().Where("ts", CondLt, 48'000), [](const Row& r) { return r.ts >= 48'000; }, true);
+	check(Query(default_namespace).Where("ts", CondGt, kItemsCount), [](const Row&) { return false; }, true);
+	// Conditions from the OR-chains are evaluated by the select loop only
+	check(Query(default_namespace).Where("year", CondLt, 2003).Or().Where("rating", CondGt, 9.0),
+		  [](const Row& r) { return r.year < 2003 || r.rating > 9.0; }, false);
+	check(Query(default_namespace)
+			  .Where("ts", CondGe, 40'000)
+			  .OpenBracket()
+			  .Where("year", CondEq, 2001)
+			  .Or()
+			  .Where("genre", CondEq, 3)
+			  .CloseBracket(),
+		  [](const Row& r) { return r.ts >= 40'000 && (r.year == 2001 || r.genre == 3); }, true);
+
+	// Queries with limit and without total count are stopped early by the select loop
+	auto qr = rt.Select(Query(default_namespace).Where("year", CondGe, 2010).Limit(10).Explain());
+	EXPECT_EQ(qr.Count(), 10);
+	EXPECT_EQ(qr.GetExplainResults().find("-column-scan"), std::string::npos) << qr.GetExplainResults();
+}
+
+}  // namespace reindexer_tests
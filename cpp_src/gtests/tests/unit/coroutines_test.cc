@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include <chrono>
 #include <stdexcept>
+#include <thread>
+#ifdef __linux__
+#include <sys/socket.h>
+#include <unistd.h>
+#endif	// __linux__
 
 #include <coroutine/channel.h>
 #include <coroutine/coroutine.h>
@@ -128,6 +133,75 @@ TEST(Coroutines, StressTest) {
 	ASSERT_NE(res, 0);
 }
 
+#ifdef __linux__
+TEST(Coroutines, UringLoopBackend) {
+	// io_uring backend has to provide the same level-triggered semantic, timers and asyncs, as the native one
+	using namespace reindexer::net;
+	if (!ev::uring_supported()) {
+		GTEST_SKIP() << "io_uring is not supported by the system";
+	}
+	dynamic_loop loop(ev::loop_backend::uring);
+	ASSERT_EQ(loop.backend(), ev::loop_backend::uring);
+	int fds[2];
+	ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+	// Each timer tick writes single byte, which is read by the watcher
+	constexpr int kTicks = 5;
+	int reads = 0, ticks = 0, asyncs = 0;
+	ev::io reader;
+	reader.set(loop);
+	reader.set([&](ev::io& w, int events) {
+		ASSERT_TRUE(events & ev::READ);
+		char buf[16];
+		ASSERT_EQ(read(w.fd, buf, sizeof(buf)), 1);
+		if (++reads == kTicks) {
+			w.stop();
+			loop.break_loop();
+		}
+	});
+	reader.start(fds[0], ev::READ);
+	ev::timer tm;
+	tm.set(loop);
+	tm.set([&](ev::timer&, int) {
+		++ticks;
+		ASSERT_EQ(write(fds[1], "x", 1), 1);
+	});
+	tm.start(0.01, 0.01);
+	ev::async async;
+	async.set(loop);
+	async.set([&](ev::async&) { ++asyncs; });
+	async.start();
+	std::thread th([&async] { async.send(); });
+	loop.run();
+	th.join();
+	tm.stop();
+	async.stop();
+	EXPECT_EQ(reads, kTicks);
+	EXPECT_EQ(ticks, kTicks);
+	EXPECT_EQ(asyncs, 1);
+
+	// Unread data has to be reported on each iteration
+	constexpr int kExpectedCallbacks = 5;
+	int callbacks = 0;
+	ev::io watcher;
+	watcher.set(loop);
+	watcher.set([&](ev::io& w, int) {
+		if (++callbacks == kExpectedCallbacks) {
+			char buf[16];
+			ASSERT_EQ(read(w.fd, buf, sizeof(buf)), 2);
+			w.stop();
+			loop.break_loop();
+		}
+	});
+	ASSERT_EQ(write(fds[1], "yy", 2), 2);
+	watcher.start(fds[0], ev::READ);
+	loop.run();
+	EXPECT_EQ(callbacks, kExpectedCallbacks);
+	close(fds[0]);
+	close(fds[1]);
+}
+#endif	// __linux__
+
 TEST(Coroutines, ClosedChannelWriting) {
 	// Closed channel should throw exception on write
 	dynamic_loop loop;
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include "core/namespace/datahashtree.h"
+
+using reindexer::DataHashTree;
+
+static uint64_t itemChecksum(uint64_t pk) noexcept { return (pk + 1) * 0x9e3779b97f4a7c15ull; }
+
+TEST(DataHashTreeTest, LeavesCount) {
+	EXPECT_EQ(DataHashTree::LeavesCountFor(0), DataHashTree::kMinLeavesCount);
+	EXPECT_EQ(DataHashTree::LeavesCountFor(100'000), DataHashTree::kMinLeavesCount * 2);
+	EXPECT_EQ(DataHashTree::LeavesCountFor(size_t(1) << 40), DataHashTree::kMaxLeavesCount);
+
+	EXPECT_THROW(std::ignore = DataHashTree{DataHashTree::kMinLeavesCount / 2}, reindexer::Error);
+	EXPECT_THROW(std::ignore = DataHashTree{DataHashTree::kMinLeavesCount + 1}, reindexer::Error);
+	EXPECT_THROW(std::ignore = DataHashTree{DataHashTree::kMaxLeavesCount * 2}, reindexer::Error);
+
+	DataHashTree tree(DataHashTree::kMinLeavesCount);
+	std::vector<uint64_t> hashes;
+	EXPECT_THROW(tree.GetNodes(std::vector<uint32_t>{0}, hashes), reindexer::Error);
+	EXPECT_THROW(tree.GetNodes(std::vector<uint32_t>{2 * DataHashTree::kMinLeavesCount}, hashes), reindexer::Error);
+}
+
+TEST(DataHashTreeTest, DivergedBuckets) {
+	constexpr uint64_t kItemsCount = 50'000;
+	const auto leavesCount = DataHashTree::LeavesCountFor(kItemsCount);
+	DataHashTree leader(leavesCount), follower(leavesCount);
+	uint64_t datahash = 0;
+	for (uint64_t pk = 0; pk < kItemsCount; ++pk) {
+		leader.Xor(leader.Bucket(pk), itemChecksum(pk));
+		follower.Xor(follower.Bucket(pk), itemChecksum(pk));
+		datahash ^= itemChecksum(pk);
+	}
+	ASSERT_EQ(leader.Root(), datahash);
+	ASSERT_EQ(follower.Root(), datahash);
+
+	size_t requests = 0;
+	auto getFollowerNodes = [&](std::span<const uint32_t> nodes, std::vector<uint64_t>& hashes) {
+		++requests;
+		follower.GetNodes(nodes, hashes);
+	};
+	auto diverged = leader.DivergedBuckets(getFollowerNodes, DataHashTree::MaxDivergedBuckets(leavesCount));
+	ASSERT_TRUE(diverged.has_value());
+	EXPECT_TRUE(diverged->empty());
+	EXPECT_EQ(requests, 1u);
+
+	// Follower has missed the update of one item, the deletion of another one and has the extra item
+	std::vector<uint32_t> expected{follower.Bucket(10), follower.Bucket(20'000), follower.Bucket(kItemsCount + 5)};
+	follower.Xor(follower.Bucket(10), itemChecksum(10) ^ itemChecksum(kItemsCount * 2));
+	leader.Xor(leader.Bucket(20'000), itemChecksum(20'000));
+	follower.Xor(follower.Bucket(kItemsCount + 5), itemChecksum(kItemsCount + 5));
+	std::sort(expected.begin(), expected.end());
+	expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+	ASSERT_GT(expected.size(), 1u);
+
+	requests = 0;
+	diverged = leader.DivergedBuckets(getFollowerNodes, DataHashTree::MaxDivergedBuckets(leavesCount));
+	ASSERT_TRUE(diverged.has_value());
+	std::sort(diverged->begin(), diverged->end());
+	EXPECT_EQ(*diverged, expected);
+	// Root and a single request per each kLevelsPerRequest levels
+	EXPECT_EQ(requests, 1u + (std::countr_zero(leavesCount) + DataHashTree::kLevelsPerRequest - 1) / DataHashTree::kLevelsPerRequest);
+
+	// Too many of the diverged buckets
+	EXPECT_FALSE(leader.DivergedBuckets(getFollowerNodes, 1).has_value());
+}
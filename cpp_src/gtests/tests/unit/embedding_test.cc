@@ -1,8 +1,13 @@
 #include "gtests/tests/fixtures/embedding_test.h"
 #include <gmock/gmock.h>
+#include <numeric>
+#include <thread>
 #include "core/system_ns_names.h"
+#include "fmt/ranges.h"
+#include "gason/gason.h"
 #include "gtests/tools.h"
 #include "tools/errors.h"
+#include "vendor/cpp-httplib/httplib.h"
 
 namespace reindexer_tests {
 
@@ -246,6 +251,91 @@ TEST_F(EmbeddingTest, ParseDslIndexDefWithEmbedderPoolFull) try {
 }
 CATCH_AND_ASSERT
 
+TEST_F(EmbeddingTest, ParseDslIndexDefWithEmbedderBatching) try {
+	const auto indexDef = reindexer::IndexDef::FromJSON(R"json(
+{
+	"name":"hnsw",
+	"json_paths":["hnsw"]
+	"field_type":"float_vector",
+	"index_type":"hnsw",
+	"is_pk":false,
+	"is_array":false,
+	"is_dense":false,
+	"is_sparse":false,
+	"collate_mode":"none",
+	"sort_order_letters":"",
+	"expire_after":0,
+	"config":{
+		"dimension":2048,
+		"metric":"l2",
+		"start_size":100,
+		"ef_construction":200,
+		"m":16,
+		"embedding": {
+			"upsert_embedder": {
+				"URL": "http://127.0.0.1:7777/embedder",
+				"fields": [ "idx1", "idx2" ],
+				"batching": {
+					"max_items": 64,
+					"max_delay_ms": 10
+				}
+			}
+		}
+	}
+}
+)json"sv);
+	ASSERT_TRUE(indexDef) << indexDef.error().what();
+	// NOLINTBEGIN(bugprone-unchecked-optional-access)
+	const auto& embedder = indexDef->Opts().FloatVector().Embedding().value().upsertEmbedder.value();
+	// NOLINTEND(bugprone-unchecked-optional-access)
+	ASSERT_EQ(embedder.batching.max_items, 64u);
+	ASSERT_EQ(embedder.batching.max_delay_ms, 10u);
+
+	reindexer::WrSerializer ser;
+	indexDef->GetJSON(ser);
+	const auto parsedDef = reindexer::IndexDef::FromJSON(ser.Slice());
+	ASSERT_TRUE(parsedDef) << parsedDef.error().what();
+	ASSERT_TRUE(parsedDef->Compare(*indexDef).Equal());
+}
+CATCH_AND_ASSERT
+
+TEST_F(EmbeddingTest, NegativeParseDslIndexDefWithEmbedderBatchingMaxItems) try {
+	const auto indexDef = reindexer::IndexDef::FromJSON(R"json(
+{
+	"name":"hnsw",
+	"json_paths":["hnsw"]
+	"field_type":"float_vector",
+	"index_type":"hnsw",
+	"is_pk":false,
+	"is_array":false,
+	"is_dense":false,
+	"is_sparse":false,
+	"collate_mode":"none",
+	"sort_order_letters":"",
+	"expire_after":0,
+	"config":{
+		"dimension":2048,
+		"metric":"l2",
+		"start_size":100,
+		"ef_construction":200,
+		"m":16,
+		"embedding": {
+			"upsert_embedder": {
+				"URL": "http://127.0.0.1:7777/embedder",
+				"fields": [ "idx1", "idx2" ],
+				"batching": {
+					"max_items": 2048
+				}
+			}
+		}
+	}
+}
+)json"sv);
+	ASSERT_STREQ(indexDef.error().what(),
+				 "Configuration 'embedding:upsert_embedder:batching:max_items' should be in range [1, 1024], in config '2048'");
+}
+CATCH_AND_ASSERT
+
 TEST_F(EmbeddingTest, NegativeParseDslIndexDefWithEmbedderUrl) try {
 	const auto indexDef = reindexer::IndexDef::FromJSON(R"json(
 {
@@ -1157,4 +1247,156 @@ TEST_F(EmbeddingTest, SkipEmbeddingStrategy) {
 	changeIndexAndCheck(FloatVectorIndexOpts::EmbedderOpts::Strategy::Strict);
 }
 
+namespace {
+
+// Stand-in embedding service: the vector of the document is built from the number at the end of its text field
+class [[nodiscard]] EmbedderStub {
+public:
+	EmbedderStub(std::string field, size_t dimension) : field_{std::move(field)}, dimension_{dimension} {
+		server_.Post(R"(/api/v1/embedder/(.+)/produce)", [this](const httplib::Request& req, httplib::Response& res) {
+			gason::JsonParser parser;
+			const auto root = parser.Parse(std::string_view(req.body));
+			std::string body{R"json({"products":[)json"};
+			size_t docs = 0;
+			for (const auto& doc : root["data"]) {
+				const auto text = doc[field_].As<std::string>();
+				const int value = std::stoi(text.substr(text.rfind('_') + 1));
+				std::vector<int> embedding(dimension_);
+				std::iota(embedding.begin(), embedding.end(), value);
+				body += fmt::format(R"json({}[{{"chunk":"{}","embedding":[{}]}}])json", docs++ ? "," : "", text, fmt::join(embedding, ","));
+			}
+			body += "]}";
+			requests_.fetch_add(1, std::memory_order_relaxed);
+			documents_.fetch_add(docs, std::memory_order_relaxed);
+			for (size_t maxBatch = maxBatch_.load(); maxBatch < docs && !maxBatch_.compare_exchange_weak(maxBatch, docs);) {
+			}
+			res.set_content(body, "application/json");
+		});
+		port_ = server_.bind_to_any_port("127.0.0.1");
+		thread_ = std::thread([this] { server_.listen_after_bind(); });
+		server_.wait_until_ready();
+	}
+	~EmbedderStub() {
+		server_.stop();
+		thread_.join();
+	}
+
+	std::string Url() const { return fmt::format("http://127.0.0.1:{}", port_); }
+	size_t RequestsCount() const noexcept { return requests_.load(std::memory_order_relaxed); }
+	size_t DocumentsCount() const noexcept { return documents_.load(std::memory_order_relaxed); }
+	size_t MaxBatchSize() const noexcept { return maxBatch_.load(std::memory_order_relaxed); }
+
+private:
+	const std::string field_;
+	const size_t dimension_;
+	httplib::Server server_;
+	std::thread thread_;
+	int port_ = 0;
+	std::atomic<size_t> requests_{0};
+	std::atomic<size_t> documents_{0};
+	std::atomic<size_t> maxBatch_{0};
+};
+
+}  // namespace
+
+TEST_F(EmbeddingTest, BatchedUpsertEmbedding) try {
+	constexpr static auto kNsName = "ns_batched_embedding"sv;
+	const static std::string kFieldNameHnsw{"hnsw"};
+	const static std::string kFieldNameText{"text"};
+	constexpr static size_t kDimension = 3;
+	constexpr static size_t kMaxBatchItems = 16;
+	constexpr static int kWritersCount = 8;
+	constexpr static int kItemsPerWriter = 50;
+	constexpr static int kUniqueTexts = 20;
+
+	EmbedderStub stub(kFieldNameText, kDimension);
+
+	FloatVectorIndexOpts::EmbedderOpts embedder;
+	embedder.endpointUrl = stub.Url();
+	embedder.fields = {kFieldNameText};
+	embedder.pool.connections = 2;
+	embedder.batching.max_items = kMaxBatchItems;
+	embedder.batching.max_delay_ms = 20;
+	FloatVectorIndexOpts::EmbeddingOpts embedding;
+	embedding.upsertEmbedder = embedder;
+
+	rt.EnablePerfStats(*rt.reindexer);
+	rt.OpenNamespace(kNsName);
+	rt.DefineNamespaceDataset(
+		kNsName, {IndexDeclaration{kFieldNameId, "hash", "int", IndexOpts{}.PK(), 0},
+				  IndexDeclaration{kFieldNameText, "hash", "string", IndexOpts(), 0},
+				  IndexDeclaration{kFieldNameHnsw, "hnsw", "float_vector",
+								   IndexOpts{}.SetFloatVector(IndexHnsw, FloatVectorIndexOpts{}
+																			 .SetDimension(kDimension)
+																			 .SetStartSize(100)
+																			 .SetM(16)
+																			 .SetEfConstruction(200)
+																			 .SetMetric(reindexer::VectorMetric::L2)
+																			 .SetEmbedding(embedding)),
+								   0}});
+
+	// Concurrent writers share the batches
+	std::vector<std::thread> writers;
+	writers.reserve(kWritersCount);
+	for (int w = 0; w < kWritersCount; ++w) {
+		writers.emplace_back([&, w] {
+			for (int i = w * kItemsPerWriter; i < (w + 1) * kItemsPerWriter; ++i) {
+				auto item = rt.reindexer->NewItem(kNsName);
+				ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+				auto err = item.FromJSON(fmt::format(R"json({{"{}":{},"{}":"text_{}"}})json", kFieldNameId, i, kFieldNameText, i % kUniqueTexts));
+				ASSERT_TRUE(err.ok()) << err.what();
+				err = rt.reindexer->Upsert(kNsName, item);
+				ASSERT_TRUE(err.ok()) << err.what();
+			}
+		});
+	}
+	for (auto& th : writers) {
+		th.join();
+	}
+
+	constexpr size_t kItemsCount = kWritersCount * kItemsPerWriter;
+	auto qr = rt.Select(Query(kNsName).SelectAllFields().Sort(kFieldNameId, false));
+	ASSERT_EQ(qr.Count(), kItemsCount);
+	for (int id = 0; auto& it : qr) {
+		const int value = id % kUniqueTexts;
+		ASSERT_EQ(it.GetJSON(), fmt::format(R"json({{"{}":{},"{}":"text_{}","{}":[{}.0,{}.0,{}.0]}})json", kFieldNameId, id, kFieldNameText,
+											value, kFieldNameHnsw, value, value + 1, value + 2));
+		++id;
+	}
+
+	// Each document is sent at most once and the requests contain several documents
+	ASSERT_LE(stub.DocumentsCount(), kItemsCount);
+	ASSERT_LT(stub.RequestsCount(), kItemsCount);
+	ASSERT_GT(stub.MaxBatchSize(), 1u);
+	ASSERT_LE(stub.MaxBatchSize(), kMaxBatchItems);
+
+	auto perfQr = rt.Select(Query(reindexer::kPerfStatsNamespace).Where("name", CondEq, kNsName));
+	ASSERT_EQ(perfQr.Count(), 1);
+	gason::JsonParser parser;
+	const auto perfJson = perfQr.begin().GetJSON();
+	ASSERT_TRUE(perfJson) << perfJson.error().what();
+	const auto& json = *perfJson;
+	const auto root = parser.Parse(std::string_view(json));
+	bool found = false;
+	for (const auto& index : root["indexes"]) {
+		if (index["name"].As<std::string>() != kFieldNameHnsw) {
+			continue;
+		}
+		found = true;
+		const auto& batching = index["upsert_embedder"]["batching"];
+		ASSERT_EQ(batching["total_batches_count"].As<size_t>(), stub.RequestsCount()) << json;
+		ASSERT_EQ(batching["total_batched_documents_count"].As<size_t>(), stub.DocumentsCount()) << json;
+		ASSERT_EQ(batching["total_batched_documents_count"].As<size_t>() + batching["total_deduplicated_documents_count"].As<size_t>(),
+				  kItemsCount)
+			<< json;
+		size_t histogramBatches = 0;
+		for (const auto& bucket : batching["batch_size_histogram"]) {
+			histogramBatches += bucket["count"].As<size_t>();
+		}
+		ASSERT_EQ(histogramBatches, stub.RequestsCount()) << json;
+	}
+	ASSERT_TRUE(found) << json;
+}
+CATCH_AND_ASSERT
+
 }  // namespace reindexer_tests
@@ -7,6 +7,7 @@
 #include "core/ft/ft_fast/frisosplitter.h"
 #include "core/ft/ft_fast/typosmap.h"
 #include "core/ft/limits.h"
+#include "core/system_ns_names.h"
 #include "estl/gift_str.h"
 #include "estl/suffix_map.h"
 #include "ft_api.h"
@@ -2577,6 +2578,231 @@ TEST_P(FTGenericApi, OperatorsInExtraWordSymbols) {
 	CheckResults("\\=слово\\*", {{"!=слово*!", ""}}, true);
 }
 
+TEST_P(FTGenericApi, BlockMaxPruning) {
+	constexpr int kDocsCount = 3000;
+	constexpr uint32_t kMergeLimit = 100;
+	auto ftCfg = GetDefaultConfig();
+	ftCfg.enableBlockMaxPruning = true;
+	ftCfg.mergeLimit = kMergeLimit;
+	Init(ftCfg);
+
+	const auto addDocs = [&](int from, int to) {
+		for (int i = from; i < to; ++i) {
+			std::string ft1;
+			// There are no single word fields, which would be boosted by the full match
+			for (int j = 0; j <= i % 9; ++j) {
+				ft1 += fmt::format("fil{} ", (i + j) % 50);
+			}
+			for (int j = 0; j <= i % 5; ++j) {
+				ft1 += "common ";
+			}
+			Add(ft1, (i % 3) ? fmt::format("other{}", i % 7) : std::string("second"));
+		}
+	};
+	const auto selectRanks = [&](std::string_view dsl) {
+		std::vector<float> ranks;
+		for (const auto& it : SimpleSelect(dsl, false).ToLocalQr()) {
+			ranks.emplace_back(it.GetItemRefRanked().Rank().Value());
+		}
+		std::sort(ranks.begin(), ranks.end(), std::greater<>());
+		return ranks;
+	};
+
+	// Bounds of the last commit step's blocks must be rebuilt with the step
+	addDocs(0, kDocsCount / 2);
+	std::ignore = selectRanks("common");
+	addDocs(kDocsCount / 2, kDocsCount);
+
+	const std::vector<std::string_view> queries{"common", "common second", "common -second", "+common +second"};
+	std::vector<std::vector<float>> prunedRanks;
+	for (auto q : queries) {
+		prunedRanks.emplace_back(selectRanks(q));
+		EXPECT_EQ(prunedRanks.back().size(), kMergeLimit) << q;
+	}
+
+	// Single term's results must be the same as the top of the results without merge limit
+	ftCfg.enableBlockMaxPruning = false;
+	ftCfg.mergeLimit = kDocsCount;
+	SetFTConfig(ftCfg);
+	const auto fullRanks = selectRanks(queries[0]);
+	ASSERT_GE(fullRanks.size(), kMergeLimit);
+	EXPECT_EQ(prunedRanks[0], std::vector<float>(fullRanks.begin(), fullRanks.begin() + kMergeLimit));
+}
+
+TEST_P(FTGenericApi, BlocksPostingsFormat) {
+	constexpr int kDocsCount = 1000;
+	auto ftCfg = GetDefaultConfig();
+	Init(ftCfg);
+
+	// Frequent words have multiple blocks in each commit step
+	for (int step = 0; step < 3; ++step) {
+		for (int i = step * kDocsCount / 3; i < (step + 1) * kDocsCount / 3; ++i) {
+			std::string ft1 = fmt::format("word{} ", i % 17);
+			for (int j = 0; j <= i % 4; ++j) {
+				ft1 += (i % 3) ? "common stone " : "common ";
+			}
+			Add(ft1, fmt::format("other{} {}", i % 11, (i % 5) ? "common" : "stone"));
+		}
+		std::ignore = SimpleSelect("common", false);
+	}
+
+	const std::vector<std::string_view> queries{
+		"common", "word1*", "stone~", "\"common stone\"", "+common +stone", "common -stone", "@ft1 stone", "=other3", "word5 other5"};
+	const auto selectAll = [&] {
+		std::vector<std::vector<std::pair<std::string, float>>> results;
+		for (auto q : queries) {
+			auto qr = SimpleSelect(q, true);
+			const auto items = rt.GetSerializedQrItems(qr);
+			auto& res = results.emplace_back();
+			size_t i = 0;
+			for (const auto& it : qr.ToLocalQr()) {
+				res.emplace_back(items[i++], it.GetItemRefRanked().Rank().Value());
+			}
+			EXPECT_GT(res.size(), 0) << q;
+		}
+		return results;
+	};
+	const auto varintResults = selectAll();
+
+	ftCfg.postingsFormat = reindexer::FTConfig::PostingsFormat::Blocks;
+	SetFTConfig(ftCfg);
+	const auto blocksResults = selectAll();
+	ASSERT_EQ(varintResults.size(), blocksResults.size());
+	for (size_t i = 0; i < queries.size(); ++i) {
+		EXPECT_EQ(varintResults[i], blocksResults[i]) << queries[i];
+	}
+
+	if (GetParam() == reindexer::FTConfig::Optimization::Memory) {
+		auto qr = rt.Select(Query(reindexer::kMemStatsNamespace).Where("name", CondEq, "nm1"));
+		ASSERT_EQ(qr.Count(), 1);
+		const auto json = qr.begin().GetItem(false).GetJSON();
+		EXPECT_NE(json.find("\"ft_postings_size\""), std::string_view::npos) << json;
+		EXPECT_NE(json.find("\"ft_postings_varint_size\""), std::string_view::npos) << json;
+	}
+}
+
+TEST_P(FTGenericApi, BackgroundMerge) {
+	constexpr int kBatches = 5, kBatchSize = 10;
+	auto ftCfg = GetDefaultConfig();
+	ftCfg.enableBackgroundMerge = true;
+	ftCfg.maxStepSize = 5;
+	ftCfg.maxRebuildSteps = 3;
+	Init(ftCfg);
+	rt.EnablePerfStats(*rt.reindexer);
+
+	const auto selectIds = [&](std::string_view dsl) {
+		std::vector<int> ids;
+		for (auto& it : SimpleSelect(dsl, false)) {
+			ids.emplace_back(it.GetItem(false)["id"].As<int>());
+		}
+		std::sort(ids.begin(), ids.end());
+		return ids;
+	};
+	const auto indexStat = [&](std::string_view statsNs, std::string_view section, std::string_view field) {
+		auto qr = rt.Select(Query(statsNs).Where("name", CondEq, "nm1"));
+		EXPECT_EQ(qr.Count(), 1);
+		const std::string json(qr.begin().GetItem(false).GetJSON());
+		gason::JsonParser parser;
+		for (const auto& idx : parser.Parse(std::string_view(json))["indexes"]) {
+			if (idx["name"].As<std::string_view>() == "ft3") {
+				return section.empty() ? idx[field].As<int64_t>(-1) : idx[section][field].As<int64_t>(-1);
+			}
+		}
+		return int64_t(-1);
+	};
+
+	// Each batch has the new unique words, so the queries create the new commit steps. The steps are not rebuilt by the queries
+	for (int batch = 0; batch < kBatches; ++batch) {
+		for (int i = 0; i < kBatchSize; ++i) {
+			Add(fmt::format("common uniq{}x{}", batch, i), fmt::format("batch{}", batch));
+		}
+		EXPECT_EQ(selectIds("common").size(), (batch + 1) * kBatchSize);
+	}
+	EXPECT_LE(indexStat(reindexer::kPerfStatsNamespace, "ft_rebuilds", "total_queries_count"), 1);
+
+	// Removed documents are filtered out by the queries until the merge
+	for (int id = 0; id < kBatches * kBatchSize; id += 2) {
+		Delete(id);
+	}
+	const std::vector<std::string_view> queries{"common", "batch1", "uniq2x*", "common -batch3"};
+	std::vector<std::vector<int>> beforeMerge;
+	for (auto q : queries) {
+		beforeMerge.emplace_back(selectIds(q));
+		for (int id : beforeMerge.back()) {
+			EXPECT_EQ(id % 2, 1) << q;
+		}
+	}
+
+	rt.AwaitIndexOptimization("nm1");
+	EXPECT_EQ(indexStat(reindexer::kMemStatsNamespace, "", "ft_segments_count"), 1);
+	EXPECT_EQ(indexStat(reindexer::kMemStatsNamespace, "", "ft_tombstones_count"), kBatches * kBatchSize / 2);
+	EXPECT_GE(indexStat(reindexer::kPerfStatsNamespace, "ft_merges", "total_queries_count"), 1);
+	for (size_t i = 0; i < queries.size(); ++i) {
+		EXPECT_EQ(selectIds(queries[i]), beforeMerge[i]) << queries[i];
+	}
+
+	// Merged index keeps the removed documents, until their count exceeds the half of the documents
+	for (int id = 1; id < kBatches * kBatchSize; id += 4) {
+		Delete(id);
+	}
+	for (size_t i = 0; i < queries.size(); ++i) {
+		std::erase_if(beforeMerge[i], [](int id) { return id % 4 == 1; });
+		EXPECT_EQ(selectIds(queries[i]), beforeMerge[i]) << queries[i];
+	}
+	rt.AwaitIndexOptimization("nm1");
+	EXPECT_EQ(indexStat(reindexer::kMemStatsNamespace, "", "ft_segments_count"), 1);
+	EXPECT_EQ(indexStat(reindexer::kMemStatsNamespace, "", "ft_tombstones_count"), 0);
+	for (size_t i = 0; i < queries.size(); ++i) {
+		EXPECT_EQ(selectIds(queries[i]), beforeMerge[i]) << queries[i];
+	}
+}
+
+TEST_P(FTGenericApi, ParallelSelect) {
+	auto ftCfg = GetDefaultConfig();
+	ftCfg.maxTypos = 2;
+	Init(ftCfg);
+
+	// Words with a single replaced letter are the typo variants of each other
+	const std::string_view base = "machine";
+	for (size_t pos = 0; pos < base.size(); ++pos) {
+		for (char c = 'a'; c <= 'z'; c += 3) {
+			std::string word(base);
+			word[pos] = c;
+			Add(fmt::format("{} learning model{}", word, c), fmt::format("{}s {}ing", word, word));
+		}
+	}
+
+	const std::vector<std::string_view> queries{"machine~",
+												"machine~ learning",
+												"mashine~ +learning model*",
+												"machine~ -modelb learn*",
+												"'machine learning' model~",
+												"machine~ learning model macine machiney"};
+	const auto selectRanks = [&](std::string_view dsl) {
+		auto qr = rt.Select(reindexer::Query("nm1").Where("ft3", CondEq, dsl).WithRank());
+		std::map<int, float> ranks;
+		for (auto& it : qr) {
+			ranks.emplace(it.GetItem(false)["id"].As<int>(), it.GetItemRefRanked().Rank().Value());
+		}
+		return ranks;
+	};
+	std::vector<std::map<int, float>> expected;
+	for (auto q : queries) {
+		expected.emplace_back(selectRanks(q));
+		EXPECT_GT(expected.back().size(), 0) << q;
+	}
+
+	// Terms and variants lookup in the parallel threads has to give the same results
+	for (int threads : {2, 8}) {
+		ftCfg.maxSelectParallelism = threads;
+		auto err = SetFTConfig(ftCfg, "nm1", "ft3", {"ft1", "ft2"});
+		ASSERT_TRUE(err.ok()) << err.what();
+		for (size_t i = 0; i < queries.size(); ++i) {
+			EXPECT_EQ(selectRanks(queries[i]), expected[i]) << queries[i] << "; threads: " << threads;
+		}
+	}
+}
+
 INSTANTIATE_TEST_SUITE_P(, FTGenericApi, ::testing::Values(kRxFtTestTypes), [](const auto& info) {
 	switch (info.param) {
 		case reindexer::FTConfig::Optimization::Memory:
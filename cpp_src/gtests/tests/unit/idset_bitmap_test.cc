@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "core/idset/idsetbitmap.h"
+#include "gtests/tests/gtest_cout.h"
+
+namespace reindexer_tests {
+namespace {
+
+using reindexer::IdSetBitmap;
+using reindexer::IdType;
+
+std::vector<IdType> ToIds(const std::vector<int>& ids) {
+	std::vector<IdType> res;
+	res.reserve(ids.size());
+	for (int id : ids) {
+		res.emplace_back(IdType::FromNumber(id));
+	}
+	return res;
+}
+
+std::vector<int> Collect(const IdSetBitmap& bitmap) {
+	std::vector<int> res;
+	res.reserve(bitmap.Size());
+	bitmap.ForEach([&res](IdType id) { res.push_back(id.ToNumber()); });
+	return res;
+}
+
+// Generates sorted unique ids with the mix of sparse, dense and continuous chunks
+std::vector<int> GenerateIds(std::mt19937& rng, int chunksCount) {
+	constexpr int kChunkSize = 1 << 16;
+	std::uniform_int_distribution<int> kindDist(0, 3);
+	std::uniform_int_distribution<int> lowDist(0, kChunkSize - 1);
+	std::vector<int> ids;
+	for (int chunk = 0; chunk < chunksCount; ++chunk) {
+		const int base = chunk * kChunkSize;
+		switch (kindDist(rng)) {
+			case 0:	 // Empty chunk
+				break;
+			case 1:	 // Sparse chunk
+				for (int i = 0; i < 100; ++i) {
+					ids.push_back(base + lowDist(rng));
+				}
+				break;
+			case 2:	 // Dense chunk
+				for (int i = 0; i < 20'000; ++i) {
+					ids.push_back(base + lowDist(rng));
+				}
+				break;
+			default: {	// Few long runs
+				for (int i = 0; i < 3; ++i) {
+					const int start = lowDist(rng);
+					const int end = std::min(kChunkSize, start + 5000);
+					for (int id = start; id < end; ++id) {
+						ids.push_back(base + id);
+					}
+				}
+				break;
+			}
+		}
+	}
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	return ids;
+}
+
+}  // namespace
+
+TEST(IdSetBitmapTest, BuildRoundTrip) {
+	const auto seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	TestCout() << "IdSetBitmap seed: " << seed << std::endl;
+	std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+
+	for (int run = 0; run < 5; ++run) {
+		const auto ids = GenerateIds(rng, 8);
+		const auto bitmap = IdSetBitmap::Build(ToIds(ids));
+		ASSERT_EQ(ids.size(), bitmap->Size());
+		ASSERT_EQ(ids, Collect(*bitmap));
+		for (int id : ids) {
+			ASSERT_TRUE(bitmap->Contains(IdType::FromNumber(id))) << id;
+		}
+		std::uniform_int_distribution<int> idDist(0, 8 << 16);
+		for (int i = 0; i < 10'000; ++i) {
+			const int id = idDist(rng);
+			ASSERT_EQ(std::binary_search(ids.begin(), ids.end(), id), bitmap->Contains(IdType::FromNumber(id))) << id;
+		}
+	}
+}
+
+TEST(IdSetBitmapTest, CursorSeek) {
+	const auto seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	TestCout() << "IdSetBitmap seed: " << seed << std::endl;
+	std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+
+	const auto ids = GenerateIds(rng, 6);
+	const auto bitmap = IdSetBitmap::Build(ToIds(ids));
+	std::uniform_int_distribution<int> stepDist(0, 3000);
+
+	// Forward seeks with random gaps
+	IdSetBitmap::Cursor cursor;
+	cursor.StartFwd();
+	for (int bound = -1;;) {
+		const auto it = std::upper_bound(ids.begin(), ids.end(), bound);
+		const bool found = cursor.SeekFwd(*bitmap, IdType::FromNumber(bound));
+		ASSERT_EQ(it != ids.end(), found) << bound;
+		if (!found) {
+			ASSERT_TRUE(cursor.IsEnd());
+			break;
+		}
+		ASSERT_EQ(*it, cursor.Value().ToNumber()) << bound;
+		bound = *it + stepDist(rng);
+	}
+
+	// Reverse seeks with random gaps
+	cursor.StartRev(*bitmap);
+	for (int bound = std::numeric_limits<int>::max();;) {
+		const auto it = std::lower_bound(ids.begin(), ids.end(), bound);
+		const bool found = cursor.SeekRev(*bitmap, IdType::FromNumber(bound));
+		ASSERT_EQ(it != ids.begin(), found) << bound;
+		if (!found) {
+			ASSERT_TRUE(cursor.IsEnd());
+			break;
+		}
+		ASSERT_EQ(*std::prev(it), cursor.Value().ToNumber()) << bound;
+		bound = *std::prev(it) - stepDist(rng);
+	}
+}
+
+TEST(IdSetBitmapTest, IntersectSorted) {
+	const auto seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	TestCout() << "IdSetBitmap seed: " << seed << std::endl;
+	std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+
+	for (int run = 0; run < 5; ++run) {
+		const auto lIds = GenerateIds(rng, 8);
+		const auto rIds = GenerateIds(rng, 10);
+		const auto bitmap = IdSetBitmap::Build(ToIds(lIds));
+
+		std::vector<int> expected;
+		std::ranges::set_intersection(lIds, rIds, std::back_inserter(expected));
+		auto ids = ToIds(rIds);
+		ids.resize(bitmap->IntersectSorted(ids));
+		ASSERT_EQ(ToIds(expected), ids);
+	}
+}
+
+TEST(IdSetBitmapTest, TryCompress) {
+	// Small sets are never compressed
+	std::vector<int> ids;
+	for (int id = 0; id < int(IdSetBitmap::kMinIdsCount) - 1; ++id) {
+		ids.push_back(id);
+	}
+	EXPECT_FALSE(IdSetBitmap::TryCompress(ToIds(ids)));
+
+	// Sparse sets are never compressed
+	ids.clear();
+	for (int id = 0; id < 10'000; ++id) {
+		ids.push_back(id << 16);
+	}
+	EXPECT_FALSE(IdSetBitmap::TryCompress(ToIds(ids)));
+
+	// Continuous and dense sets are compressed
+	ids.clear();
+	for (int id = 0; id < 500'000; ++id) {
+		ids.push_back(id);
+	}
+	auto bitmap = IdSetBitmap::TryCompress(ToIds(ids));
+	ASSERT_TRUE(bitmap);
+	EXPECT_LT(bitmap->HeapSize() * 2, bitmap->PlainHeapSize());
+
+	ids.clear();
+	for (int id = 0; id < 500'000; id += 3) {
+		ids.push_back(id);
+	}
+	bitmap = IdSetBitmap::TryCompress(ToIds(ids));
+	ASSERT_TRUE(bitmap);
+	EXPECT_EQ(ids, Collect(*bitmap));
+}
+
+}  // namespace reindexer_tests
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "core/idset/idsetintersection.h"
+#include "gtests/tests/fixtures/json_helpers.h"
+#include "gtests/tests/fixtures/reindexer_api.h"
+#include "gtests/tests/gtest_cout.h"
+
+namespace reindexer_tests {
+namespace {
+
+using namespace json_helpers;
+using reindexer::IdSetCRef;
+using reindexer::IdType;
+using reindexer::IndexOpts;
+
+std::vector<IdType> GenerateIds(std::mt19937& rng, size_t count, int maxId) {
+	std::uniform_int_distribution<int> idDist(0, maxId);
+	std::vector<IdType> ids;
+	ids.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		ids.emplace_back(IdType::FromNumber(idDist(rng)));
+	}
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	return ids;
+}
+
+}  // namespace
+
+TEST(IdSetIntersectionTest, MultiWayRandomized) {
+	const auto seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	TestCout() << "IdSetIntersection seed: " << seed << std::endl;
+	std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+	std::uniform_int_distribution<size_t> sizeDist(0, 50'000);
+	std::uniform_int_distribution<int> maxIdDist(10, 200'000);
+
+	for (size_t ways : {1, 2, 3, 4, 8}) {
+		for (int run = 0; run < 20; ++run) {
+			std::vector<std::vector<IdType>> sets;
+			std::vector<IdSetCRef> views;
+			for (size_t i = 0; i < ways; ++i) {
+				sets.emplace_back(GenerateIds(rng, sizeDist(rng), maxIdDist(rng)));
+			}
+			for (const auto& s : sets) {
+				views.emplace_back(s);
+			}
+
+			std::vector<IdType> expected = sets[0];
+			for (size_t i = 1; i < ways; ++i) {
+				std::vector<IdType> tmp;
+				std::ranges::set_intersection(expected, sets[i], std::back_inserter(tmp));
+				expected = std::move(tmp);
+			}
+
+			reindexer::base_idset result;
+			reindexer::IntersectIdsets(views, result);
+			ASSERT_EQ(expected.size(), result.size()) << "ways: " << ways << "; run: " << run;
+			ASSERT_TRUE(std::equal(expected.begin(), expected.end(), result.begin())) << "ways: " << ways << "; run: " << run;
+		}
+	}
+}
+
+TEST(IdSetIntersectionTest, SkewedSizes) {
+	// Small set against the large one: most of the values are found via galloping
+	std::vector<IdType> large, small;
+	for (int i = 0; i < 1'000'000; i += 2) {
+		large.emplace_back(IdType::FromNumber(i));
+	}
+	for (int i = 1; i < 1'000'000; i += 9973) {
+		small.emplace_back(IdType::FromNumber(i));
+	}
+	std::vector<IdType> out(small.size());
+	const auto cnt = reindexer::IntersectIdsets(small, large, out.data());
+	out.resize(cnt);
+	std::vector<IdType> expected;
+	std::ranges::set_intersection(small, large, std::back_inserter(expected));
+	EXPECT_EQ(expected, out);
+}
+
+TEST_F(ReindexerApi, AndChainIdsetsIntersection) {
+	constexpr int kItemsCount = 10'000;
+	rt.OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "tree", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"mod2", "hash", "int", IndexOpts(), 0},
+											   IndexDeclaration{"mod3", "hash", "int", IndexOpts(), 0},
+											   IndexDeclaration{"mod5", "hash", "int", IndexOpts(), 0}});
+	for (int i = 0; i < kItemsCount; ++i) {
+		rt.UpsertJSON(default_namespace, fmt::format(R"json({{"id":{},"mod2":{},"mod3":{},"mod5":{}}})json", i, i % 2, i % 3, i % 5));
+	}
+	rt.AwaitIndexOptimization(default_namespace);
+
+	std::vector<int> expected;
+	for (int i = 0; i < kItemsCount; i += 30) {
+		expected.emplace_back(i);
+	}
+	const auto collectIds = [](const auto& qr) {
+		std::vector<int> ids;
+		for (auto& it : qr) {
+			ids.emplace_back(it.GetItem(false)["id"].template As<int>());
+		}
+		return ids;
+	};
+	const auto query = Query(default_namespace).Where("mod2", CondEq, 0).Where("mod3", CondEq, 0).Where("mod5", CondEq, 0);
+
+	// Idsets of all the conditions are intersected in advance, so the select loop has the single iterator over the intersection
+	auto qr = rt.Select(Query(query).Explain());
+	EXPECT_EQ(expected, collectIds(qr));
+	ASSERT_NO_FATAL_FAILURE(AssertJsonFieldEqualTo(qr.GetExplainResults(), "intersected_with", {2})) << qr.GetExplainResults();
+	ASSERT_NO_FATAL_FAILURE(AssertJsonFieldEqualTo(qr.GetExplainResults(), "method", {"index"})) << qr.GetExplainResults();
+
+	// Small limit without total: select loop stops after a few iterations, so there is no eager intersection
+	qr = rt.Select(Query(query).Limit(10).Explain());
+	EXPECT_EQ(std::vector<int>(expected.begin(), expected.begin() + 10), collectIds(qr));
+	ASSERT_NO_FATAL_FAILURE(AssertJsonFieldAbsent(qr.GetExplainResults(), "intersected_with")) << qr.GetExplainResults();
+
+	// Total requires all the matches
+	qr = rt.Select(Query(query).Limit(10).ReqTotal().Explain());
+	EXPECT_EQ(std::vector<int>(expected.begin(), expected.begin() + 10), collectIds(qr));
+	EXPECT_EQ(qr.TotalCount(), expected.size());
+	ASSERT_NO_FATAL_FAILURE(AssertJsonFieldEqualTo(qr.GetExplainResults(), "intersected_with", {2})) << qr.GetExplainResults();
+
+	// Sort orders ids must be intersected the same way
+	for (bool desc : {false, true}) {
+		qr = rt.Select(Query(query).Sort("id", desc));
+		EXPECT_EQ(expected, collectIds(qr)) << "desc: " << desc;
+		std::reverse(expected.begin(), expected.end());
+	}
+}
+
+}  // namespace reindexer_tests
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "core/namespace/items_image.h"
+#include "core/system_ns_names.h"
+#include "gtests/tests/fixtures/reindexertestapi.h"
+#include "tools/fsops.h"
+
+namespace reindexer_tests {
+
+using reindexer::IndexOpts;
+using reindexer::Query;
+
+class [[nodiscard]] ItemsImageApi : public ::testing::Test {
+protected:
+	void SetUp() override {
+		std::ignore = reindexer::fs::RmDirAll(kStoragePath);
+		rt.reindexer = std::make_shared<reindexer::Reindexer>();
+		rt.Connect("builtin://" + kStoragePath);
+		setItemsImageEnabled(true);
+
+		rt.OpenNamespace(kNsName);
+		rt.DefineNamespaceDataset(kNsName, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											IndexDeclaration{"name", "hash", "string", IndexOpts(), 0},
+											IndexDeclaration{"tags", "tree", "string", IndexOpts().Array(), 0},
+											IndexDeclaration{"price", "tree", "double", IndexOpts(), 0},
+											IndexDeclaration{"nested.value", "hash", "int", IndexOpts().Sparse(), 0}});
+	}
+
+	void setItemsImageEnabled(bool enabled) {
+		ReindexerTestApi<reindexer::Reindexer>::QueryResultsType qr;
+		rt.Update(Query(reindexer::kConfigNamespace).Set("namespaces[*].items_image", enabled).Where("type", CondEq, "namespaces"), qr);
+	}
+	void upsertItems(int from, int to, std::string_view suffix) {
+		for (int i = from; i < to; ++i) {
+			rt.UpsertJSON(kNsName, fmt::format(R"json({{"id":{},"name":"name_{}{}","tags":["t{}","t{}"],"price":{}.5,)json"
+											   R"json("nested":{{"value":{}}},"non_indexed":"data_{}","arr":[{},{}]}})json",
+											   i, i % 100, suffix, i % 7, i % 11, i, i % 13, i, i, i + 1));
+		}
+	}
+	// Items and the results of the indexed queries, which must be rebuilt from the restored payloads
+	std::vector<std::string> selectAll() {
+		auto qr = rt.Select(Query(kNsName).Sort("id", false));
+		auto items = rt.GetSerializedQrItems(qr);
+		for (const auto& q : {Query(kNsName).Where("name", CondEq, "name_5"), Query(kNsName).Where("tags", CondEq, "t3"),
+							  Query(kNsName).Where("price", CondGe, 500), Query(kNsName).Where("nested.value", CondEq, 5)}) {
+			items.emplace_back(fmt::format("{}: {}", q.GetSQL(), rt.Select(q).Count()));
+		}
+		return items;
+	}
+	void reopenAndCheck(const std::vector<std::string>& expected) {
+		rt.CloseNamespace(kNsName);
+		ASSERT_EQ(reindexer::fs::Stat(imagePath()), reindexer::fs::StatFile);
+		rt.OpenNamespace(kNsName);
+		ASSERT_EQ(expected, selectAll());
+	}
+	std::string imagePath() const { return reindexer::items_image::FilePath(reindexer::fs::JoinPath(kStoragePath, kNsName)); }
+
+	const std::string kStoragePath = reindexer::fs::JoinPath(reindexer::fs::GetTempDir(), "ItemsImageTest");
+	constexpr static std::string_view kNsName = "items_image_ns";
+	ReindexerTestApi<reindexer::Reindexer> rt;
+};
+
+TEST_F(ItemsImageApi, RestoreUnchangedItems) {
+	upsertItems(0, 3000, "");
+	const auto expected = selectAll();
+	reopenAndCheck(expected);
+	// Image from the previous close is rewritten
+	reopenAndCheck(expected);
+}
+
+TEST_F(ItemsImageApi, OutdatedImage) {
+	upsertItems(0, 3000, "");
+	rt.CloseNamespace(kNsName);
+	std::string oldImage;
+	ASSERT_GT(reindexer::fs::ReadFile(imagePath(), oldImage), 0);
+	rt.OpenNamespace(kNsName);
+
+	// Updated, deleted and inserted items must be loaded from the storage
+	upsertItems(500, 1000, "_updated");
+	ASSERT_EQ(rt.Delete(Query(kNsName).Where("id", CondRange, {1500, 1999})), 500u);
+	upsertItems(3000, 3500, "");
+	const auto expected = selectAll();
+	rt.CloseNamespace(kNsName);
+
+	ASSERT_EQ(reindexer::fs::WriteFile(imagePath(), oldImage), int64_t(oldImage.size()));
+	rt.OpenNamespace(kNsName);
+	ASSERT_EQ(expected, selectAll());
+}
+
+TEST_F(ItemsImageApi, BrokenImage) {
+	upsertItems(0, 2000, "");
+	const auto expected = selectAll();
+	rt.CloseNamespace(kNsName);
+	std::string image;
+	ASSERT_GT(reindexer::fs::ReadFile(imagePath(), image), 0);
+
+	for (const auto& broken : {image.substr(0, image.size() / 2), image.substr(0, image.size() - 1), std::string("garbage")}) {
+		ASSERT_EQ(reindexer::fs::WriteFile(imagePath(), broken), int64_t(broken.size()));
+		rt.OpenNamespace(kNsName);
+		ASSERT_EQ(expected, selectAll());
+		rt.CloseNamespace(kNsName);
+	}
+}
+
+TEST_F(ItemsImageApi, DisabledImage) {
+	upsertItems(0, 100, "");
+	const auto expected = selectAll();
+	reopenAndCheck(expected);
+
+	// Image is removed on close, when option is disabled
+	setItemsImageEnabled(false);
+	rt.CloseNamespace(kNsName);
+	ASSERT_NE(reindexer::fs::Stat(imagePath()), reindexer::fs::StatFile);
+	rt.OpenNamespace(kNsName);
+	ASSERT_EQ(expected, selectAll());
+
+	// Image is removed with the namespace's storage
+	setItemsImageEnabled(true);
+	reopenAndCheck(expected);
+	rt.DropNamespace(kNsName);
+	ASSERT_NE(reindexer::fs::Stat(imagePath()), reindexer::fs::StatFile);
+}
+
+}  // namespace reindexer_tests
@@ -1023,4 +1023,86 @@ TEST_F(JoinSelectsApi, SeveralJoinsByTheSameNs) {
 	CheckJoinIds({{0, {{0}, {0, 1, 2}, {2}}}, {1, {{1}, {0, 1, 2, 3}, {3}}}}, qr);
 }
 
+TEST_F(JoinSelectsApi, KeyJoinStrategies) {
+	constexpr std::string_view kMainNs = "key_join_main";
+	constexpr std::string_view kRightNs = "key_join_right";
+	constexpr int kMainCount = 2'000;
+	constexpr int kRightCount = 10'000;
+	constexpr int kKeys = 1'000;
+	rt.OpenNamespace(kMainNs);
+	DefineNamespaceDataset(kMainNs, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+									 IndexDeclaration{"tkey", "tree", "int", IndexOpts(), 0}});
+	rt.OpenNamespace(kRightNs);
+	DefineNamespaceDataset(kRightNs, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+									  IndexDeclaration{"store_ref", "-", "int", IndexOpts(), 0},
+									  IndexDeclaration{"tree_ref", "tree", "int", IndexOpts(), 0}});
+	for (int i = 0; i < kMainCount; ++i) {
+		rt.UpsertJSON(kMainNs, fmt::format(R"json({{"id":{},"ref":{},"ref2":{},"tkey":{}}})json", i, i % 700, i % 3, i % 700));
+	}
+	for (int j = 0; j < kRightCount; ++j) {
+		// Non-indexed values of the different types have to be compared in the relaxed way
+		const std::string ref = (j % 5 == 0) ? fmt::format(R"("{}")", j % kKeys) : std::to_string(j % kKeys);
+		rt.UpsertJSON(kRightNs, fmt::format(R"json({{"id":{},"ref":{},"ref2":{},"store_ref":{},"tree_ref":{}}})json", j, ref, j % 3,
+											j % kKeys, j % kKeys));
+	}
+	rt.AwaitIndexOptimization(kMainNs);
+	rt.AwaitIndexOptimization(kRightNs);
+
+	const auto joinedIds = [](const QueryResults& qr) {
+		std::map<int, std::vector<int>> result;
+		for (auto it : qr) {
+			auto& ids = result[it.GetItem()["id"].Get<int>()];
+			const auto joined = it.GetJoined();
+			if (joined.getJoinedFieldsCount() == 0) {
+				continue;
+			}
+			const auto& items = joined.at(0);
+			for (int j = 0; j < items.ItemsCount(); ++j) {
+				const auto nsId = items[j].Nsid();
+				auto itemImpl = items.GetItem(j, qr.GetPayloadType(nsId), qr.GetTagsMatcher(nsId));
+				ids.emplace_back(reindexer::Item::FieldRefByNameOrJsonPath("id", itemImpl).Get<int>());
+			}
+		}
+		return result;
+	};
+	const auto expectedIds = [&](size_t limit, bool withRef2) {
+		std::map<int, std::vector<int>> result;
+		for (int i = 0; i < kMainCount; ++i) {
+			auto& ids = result[i];
+			for (int j = i % 700; j < kRightCount && ids.size() < limit; j += kKeys) {
+				if (!withRef2 || j % 3 == i % 3) {
+					ids.emplace_back(j);
+				}
+			}
+		}
+		return result;
+	};
+	const auto check = [&](const Query& q, const std::map<int, std::vector<int>>& expected, std::string_view strategy,
+						   bool ordered = true) {
+		auto qr = rt.Select(Query(q).Explain());
+		auto result = joinedIds(qr);
+		if (!ordered) {
+			for (auto& [id, ids] : result) {
+				std::sort(ids.begin(), ids.end());
+			}
+		}
+		EXPECT_EQ(result, expected) << q.GetSQL();
+		EXPECT_NE(qr.GetExplainResults().find(fmt::format(R"("join_strategy":"{}")", strategy)), std::string::npos)
+			<< q.GetSQL() << "\n"
+			<< qr.GetExplainResults();
+	};
+
+	// Joins by the non-indexed field and by the store index have to scan all of the preselected rows for each of the items
+	check(Query(kMainNs).InnerJoin("ref", "ref", CondEq, Query(kRightNs).Limit(3)), expectedIds(3, false), "hash");
+	check(Query(kMainNs).LeftJoin("ref", "store_ref", CondEq, Query(kRightNs).Limit(2)), expectedIds(2, false), "hash");
+	check(Query(kMainNs).Join(InnerJoin, Query(kRightNs)).OpenBracket().On("ref", CondEq, "ref").On("ref2", CondEq, "ref2").CloseBracket(),
+		  expectedIds(kRightCount, true), "hash");
+	// Joined rows are preselected in the order of the join field
+	check(Query(kMainNs).Sort("tkey", false).InnerJoin("tkey", "tree_ref", CondEq, Query(kRightNs).Sort("tree_ref", false)),
+		  expectedIds(kRightCount, false), "merge");
+	// Joined items with the descending order are selected by the nested loop join
+	check(Query(kMainNs).InnerJoin("tkey", "tree_ref", CondEq, Query(kRightNs).Sort("tree_ref", true)), expectedIds(kRightCount, false),
+		  "nested_loop", false);
+}
+
 }  // namespace reindexer_tests
@@ -6,6 +6,8 @@
 #include "core/cjson/msgpackbuilder.h"
 #include "core/cjson/msgpackdecoder.h"
 #include "core/namespace/asyncstorage.h"
+#include "core/storage/sharedrocksdbstorage.h"
+#include "core/storage/storagefactory.h"
 #include "core/system_ns_names.h"
 #include "estl/fast_hash_set.h"
 #include "gmock/gmock.h"
@@ -3822,4 +3824,87 @@ TEST(AsyncStorage, ConsistReadWriteRemoveTest) {
 	}
 }
 
+#ifdef REINDEX_WITH_ROCKSDB
+TEST(SharedRocksDbStorage, ConcurrentNamespaces) {
+	using namespace reindexer;
+	using namespace reindexer::datastorage;
+	constexpr static int kNamespaces = 4, kBatches = 50, kBatchSize = 20;
+	const auto kDbPath = fs::JoinPath(fs::GetTempDir(), "SharedRocksDbStorage.ConcurrentNamespaces");
+	std::ignore = fs::RmDirAll(kDbPath);
+	const auto nsPath = [&](int ns) { return fs::JoinPath(kDbPath, "ns" + std::to_string(ns)); };
+	const auto key = [](int ns, int i) { return fmt::format("{}_{:06}", ns, i); };
+	const auto checkData = [&](IDataStorage& storage, int ns) {
+		StorageOpts opts;
+		std::unique_ptr<Cursor> cursor(storage.GetCursor(opts));
+		int count = 0;
+		for (cursor->SeekToFirst(); cursor->Valid(); cursor->Next(), ++count) {
+			ASSERT_EQ(cursor->Key(), key(ns, count));
+			ASSERT_EQ(cursor->Value(), std::to_string(ns));
+		}
+		ASSERT_EQ(count, kBatches * kBatchSize);
+	};
+
+	auto engine = StorageFactory::createShared(StorageType::RocksDBShared, kDbPath, SharedStorageOpts{std::chrono::milliseconds(10)});
+	ASSERT_TRUE(engine);
+	std::vector<std::unique_ptr<IDataStorage>> storages;
+	for (int ns = 0; ns < kNamespaces; ++ns) {
+		storages.emplace_back(StorageFactory::create(StorageType::RocksDBShared));
+		auto err = storages.back()->Open(nsPath(ns), StorageOpts{}.CreateIfMissing());
+		ASSERT_TRUE(err.ok()) << err.what();
+	}
+
+	// Batches of the different namespaces are group-committed into the single instance
+	std::vector<std::thread> threads;
+	for (int ns = 0; ns < kNamespaces; ++ns) {
+		threads.emplace_back([&, ns] {
+			std::unique_ptr<UpdatesCollection> batch(storages[ns]->GetUpdatesCollection());
+			for (int b = 0; b < kBatches; ++b) {
+				batch->Clear();
+				for (int i = 0; i < kBatchSize; ++i) {
+					batch->Put(key(ns, b * kBatchSize + i), std::to_string(ns));
+				}
+				auto err = storages[ns]->Write(StorageOpts{}.Sync(b % 10 == 0), *batch);
+				ASSERT_TRUE(err.ok()) << err.what();
+			}
+		});
+	}
+	for (auto& th : threads) {
+		th.join();
+	}
+	// Each cursor sees its own namespace only
+	for (int ns = 0; ns < kNamespaces; ++ns) {
+		checkData(*storages[ns], ns);
+	}
+	std::string value;
+	auto err = storages[0]->Delete(StorageOpts{}, key(0, 0));
+	ASSERT_TRUE(err.ok()) << err.what();
+	EXPECT_EQ(storages[0]->Read(StorageOpts{}, key(0, 0), value).code(), errNotFound);
+	err = storages[1]->Read(StorageOpts{}, key(1, 0), value);
+	ASSERT_TRUE(err.ok()) << err.what();
+
+	// Column family follows the renamed namespace's directory
+	storages[1].reset();
+	const auto renamedPath = fs::JoinPath(kDbPath, "renamed");
+	ASSERT_EQ(fs::Rename(nsPath(1), renamedPath), 0);
+	storages[1].reset(StorageFactory::create(StorageType::RocksDBShared));
+	err = storages[1]->Open(renamedPath, StorageOpts{});
+	ASSERT_TRUE(err.ok()) << err.what();
+	checkData(*storages[1], 1);
+
+	storages[2]->Destroy(nsPath(2));
+	EXPECT_FALSE(fs::DirectoryExists(nsPath(2)));
+
+	// Data is kept after the reopening of the engine
+	storages.clear();
+	engine.reset();
+	ASSERT_FALSE(SharedRocksDbEngine::IsOpen(kDbPath));
+	std::unique_ptr<IDataStorage> storage(StorageFactory::create(StorageType::RocksDBShared));
+	err = storage->Open(nsPath(3), StorageOpts{});
+	ASSERT_TRUE(err.ok()) << err.what();
+	checkData(*storage, 3);
+	std::unique_ptr<IDataStorage> destroyed(StorageFactory::create(StorageType::RocksDBShared));
+	EXPECT_FALSE(destroyed->Open(nsPath(2), StorageOpts{}).ok());
+}
+#endif	// REINDEX_WITH_ROCKSDB
+
 }  // namespace reindexer_tests
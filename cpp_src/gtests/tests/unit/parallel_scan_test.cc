@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <thread>
+#include "core/system_ns_names.h"
+#include "gtests/tests/fixtures/reindexer_api.h"
+
+namespace reindexer_tests {
+
+using reindexer::IndexOpts;
+
+TEST_F(ReindexerApi, ParallelFullScan) {
+	constexpr int kItemsCount = 50'000;
+	rt.OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "tree", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"year", "tree", "int", IndexOpts(), 0}});
+	for (int i = 0; i < kItemsCount; ++i) {
+		rt.UpsertJSON(default_namespace, fmt::format(R"json({{"id":{},"year":{},"value":{},"name":"name_{}"}})json", i, 2000 + i % 25,
+													 (i * 7919) % 1000, i % 10));
+	}
+	// Free items must be skipped by the workers
+	ASSERT_EQ(rt.Delete(Query(default_namespace).Where("id", CondRange, {10'000, 19'999})), 10'000u);
+	rt.AwaitIndexOptimization(default_namespace);
+	{
+		ReindexerTestApi<reindexer::Reindexer>::QueryResultsType qr;
+		rt.Update(Query(reindexer::kConfigNamespace)
+					  .Set("namespaces[*].min_parallel_scan_items", 0)
+					  .Set("namespaces[*].max_select_parallelism", 4)
+					  .Where("type", CondEq, "namespaces"),
+				  qr);
+	}
+
+	const auto selectAll = [&](const Query& q) {
+		auto qr = rt.Select(q);
+		std::vector<std::string> items = rt.GetSerializedQrItems(qr);
+		items.emplace_back(fmt::format("total: {}", qr.TotalCount()));
+		for (const auto& agg : qr.GetAggregationResults()) {
+			items.emplace_back(fmt::format("{}: {}", int(agg.GetType()), agg.GetValueOrZero()));
+		}
+		return std::make_pair(std::move(items), qr.GetExplainResults());
+	};
+	// Matched counters of the 'value' comparators in the order of their appearance in the explain
+	const auto valueMatched = [](const std::string& explain) {
+		static const std::regex kValueMatched{R"re("field":"[a-z ]*value"[^{}]*"matched":(\d+))re"};
+		std::vector<std::string> res;
+		for (auto it = std::sregex_iterator(explain.begin(), explain.end(), kValueMatched); it != std::sregex_iterator(); ++it) {
+			res.emplace_back((*it)[1].str());
+		}
+		return res;
+	};
+	const bool multithreaded = std::thread::hardware_concurrency() > 1;
+	for (const auto& q : {Query(default_namespace).Where("value", CondLt, 100),
+						  Query(default_namespace).Where("value", CondLt, 100).Sort("year", true).Sort("id", false),
+						  Query(default_namespace).Where("value", CondGe, 900).Sort("id", true).Limit(10).ReqTotal(),
+						  Query(default_namespace).Where("name", CondEq, "name_3").OpenBracket().Where("value", CondLt, 10).Or().Where(
+							  "value", CondGt, 990).CloseBracket().Aggregate(AggSum, {"year"}).Aggregate(AggMax, {"value"}),
+						  Query(default_namespace).Not().Where("value", CondSet, {1, 2, 3}).Limit(0).ReqTotal()}) {
+		const auto [expected, sequentialExplain] = selectAll(Query(q).Parallel(1).Explain());
+		const auto [result, parallelExplain] = selectAll(Query(q).Parallel(4).Explain());
+		EXPECT_EQ(expected, result) << q.GetSQL();
+		EXPECT_EQ(sequentialExplain.find("-parallel-scan"), std::string::npos) << q.GetSQL();
+		if (multithreaded) {
+			EXPECT_NE(parallelExplain.find("-parallel-scan"), std::string::npos) << q.GetSQL() << "\n" << parallelExplain;
+			// Workers' matched counters are summed up
+			const auto expectedMatched = valueMatched(sequentialExplain);
+			EXPECT_FALSE(expectedMatched.empty()) << sequentialExplain;
+			EXPECT_EQ(expectedMatched, valueMatched(parallelExplain)) << q.GetSQL() << "\n" << sequentialExplain << "\n" << parallelExplain;
+		}
+	}
+
+	// Queries with limit and without total count are stopped early by the sequential loop
+	const auto [result, explain] = selectAll(Query(default_namespace).Where("value", CondLt, 100).Limit(10).Explain().Parallel(4));
+	EXPECT_EQ(explain.find("-parallel-scan"), std::string::npos) << explain;
+}
+
+}  // namespace reindexer_tests
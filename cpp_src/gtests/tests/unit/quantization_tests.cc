@@ -633,6 +633,138 @@ TEST_F(QuantizationApi, SearchWithRadiusTest_IP) { SearchWithRadiusTestBody<rein
 TEST_F(QuantizationApi, SearchWithRadiusTest_Cosine) { SearchWithRadiusTestBody<reindexer::VectorMetric::Cosine>(api); }
 #endif	// RX_WITH_STDLIB_DEBUG
 
+template <reindexer::VectorMetric Metric>
+void IvfProductQuantizationTestBody(auto& api) {
+	constexpr static auto kNsName = "ivf_product_quantization_test_ns";
+	constexpr static auto kIvfIndexNameQ = "quantized_ivf_index";
+	constexpr static size_t kNCentroids = 16;
+	constexpr static size_t kItemsCount = kHNSWMaxSize;
+	constexpr static int K = 20;
+
+	auto fvOpts = FloatVectorIndexOpts{}.SetDimension(kDimension).SetMetric(Metric);
+	hnswlib::QuantizationConfig pqConfig;
+	pqConfig.quantizationType = hnswlib::QuantizationType::ProductQuantization;
+	pqConfig.sampleSize = kItemsCount;
+	pqConfig.quantizationThreshold = kItemsCount;
+	pqConfig.rerankFactor = 4;
+	api.OpenNamespace(kNsName);
+	api.AddIndex(kNsName, reindexer::IndexDef{"id", {"id"}, IndexIntHash, IndexOpts{}.PK()});
+	api.AddIndex(kNsName, reindexer::IndexDef{kBfIndexName,
+											  {kBfIndexName},
+											  IndexVectorBruteforce,
+											  IndexOpts{}.SetFloatVector(IndexVectorBruteforce, fvOpts)});
+
+	// Product quantization is not supported by HNSW
+	auto hnswOpts = FloatVectorIndexOpts{fvOpts}.SetM(kM).SetEfConstruction(kEfConstruction).SetQuantizationConfig(pqConfig);
+	auto err = api.reindexer->AddIndex(
+		kNsName, reindexer::IndexDef{kHnswIndexNameQ, {kHnswIndexNameQ}, IndexHnsw, IndexOpts{}.SetFloatVector(IndexHnsw, hnswOpts)});
+	ASSERT_FALSE(err.ok());
+
+	const auto ivfIndexDef = [&](std::optional<hnswlib::QuantizationConfig> config) {
+		auto opts = FloatVectorIndexOpts{fvOpts}.SetNCentroids(kNCentroids);
+		if (config) {
+			opts.SetQuantizationConfig(*config);
+		}
+		return reindexer::IndexDef{kIvfIndexNameQ, {kIvfIndexNameQ}, IndexIvf, IndexOpts{}.SetFloatVector(IndexIvf, opts)};
+	};
+	api.AddIndex(kNsName, ivfIndexDef(pqConfig));
+
+	std::unordered_map<int, std::vector<float>> points;
+	for (size_t i = 0; i < kItemsCount; ++i) {
+		reindexer::WrSerializer ser;
+		{
+			reindexer::JsonBuilder json(ser);
+			json.Put("id", i);
+			const auto& point = points.emplace(i, MakePoint()).first->second;
+			json.Array(kIvfIndexNameQ, std::span{point});
+			json.Array(kBfIndexName, std::span{point});
+		}
+		auto item = api.NewItem(kNsName);
+		err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		api.Upsert(kNsName, item);
+	}
+
+	const auto queryPoints = MakeQueryPoints();
+	const auto checkRecall = [&] {
+		float recall = 0;
+		for (const auto& point : queryPoints) {
+			std::unordered_set<int> resBf;
+			auto qrBf = api.Select(reindexer::Query(kNsName).WhereKNN(kBfIndexName, reindexer::ConstFloatVectorView{point},
+																	  reindexer::BruteForceSearchParams{}.K(K)));
+			for (auto& it : qrBf) {
+				resBf.emplace(it.GetItem()["id"].template As<int>());
+			}
+			auto qrIvf = api.Select(reindexer::Query(kNsName).WhereKNN(kIvfIndexNameQ, reindexer::ConstFloatVectorView{point},
+																	   reindexer::IvfSearchParams{}.K(K).NProbe(kNCentroids)));
+			EXPECT_EQ(qrIvf.Count(), K);
+			for (auto& it : qrIvf) {
+				recall += resBf.contains(it.GetItem()["id"].template As<int>());
+			}
+		}
+		recall /= float(K * queryPoints.size());
+		TestCout() << fmt::format("recall = {}\n", recall);
+		EXPECT_GE(recall, 0.9f);
+	};
+	const auto checkFloatVectorValues = [&] {
+		auto qr = api.Select(reindexer::Query(kNsName).SelectAllFields());
+		ASSERT_EQ(qr.Count(), kItemsCount);
+		for (auto& it : qr) {
+			auto item = it.GetItem();
+			const auto fv = item[kIvfIndexNameQ].template As<reindexer::ConstFloatVectorView>().Span();
+			const auto& expected = points.at(item["id"].template As<int>());
+			ASSERT_EQ(fv.size(), kDimension);
+			for (size_t i = 0; i < kDimension; ++i) {
+				ASSERT_TRUE(reindexer::fp::EqualWithinULPs(fv[i], expected[i]));
+			}
+		}
+	};
+
+	WaitQuantization(api, kNsName, kIvfIndexNameQ);
+	checkRecall();
+	checkFloatVectorValues();
+
+	// Deletions and upsertions into the quantized index
+	for (size_t i = 0; i < kItemsCount; i += 7) {
+		auto item = api.NewItem(kNsName);
+		err = item.FromJSON(fmt::format(R"({{"id":{}}})", i));
+		ASSERT_TRUE(err.ok()) << err.what();
+		api.Delete(kNsName, item);
+		points.erase(i);
+	}
+	for (size_t i = 0; i < kItemsCount; i += 7) {
+		reindexer::WrSerializer ser;
+		{
+			reindexer::JsonBuilder json(ser);
+			json.Put("id", i);
+			const auto& point = points.emplace(i, MakePoint()).first->second;
+			json.Array(kIvfIndexNameQ, std::span{point});
+			json.Array(kBfIndexName, std::span{point});
+		}
+		auto item = api.NewItem(kNsName);
+		err = item.FromJSON(ser.Slice());
+		ASSERT_TRUE(err.ok()) << err.what();
+		api.Upsert(kNsName, item);
+	}
+	checkRecall();
+	checkFloatVectorValues();
+
+	api.CloseNamespace(kNsName);
+	api.OpenNamespace(kNsName);
+	checkRecall();
+	checkFloatVectorValues();
+
+	// Reset quantization
+	api.UpdateIndex(kNsName, ivfIndexDef(std::nullopt));
+	WaitDequantization(api, kNsName, kIvfIndexNameQ);
+	checkRecall();
+	checkFloatVectorValues();
+}
+
+TEST_F(QuantizationApi, IvfProductQuantizationTest_L2) { IvfProductQuantizationTestBody<reindexer::VectorMetric::L2>(api); }
+TEST_F(QuantizationApi, IvfProductQuantizationTest_IP) { IvfProductQuantizationTestBody<reindexer::VectorMetric::InnerProduct>(api); }
+TEST_F(QuantizationApi, IvfProductQuantizationTest_Cosine) { IvfProductQuantizationTestBody<reindexer::VectorMetric::Cosine>(api); }
+
 }  // namespace sq8_test
 
 }  // namespace reindexer_tests
@@ -98,8 +98,13 @@ void QueryAggStrictModeTest(const std::unique_ptr<Client>& client) {
 			case AggAvg:
 			case AggDistinct:
 			case AggFacet:
+			case AggApproxCountDistinct:
+			case AggTopKApprox:
 			case AggUnknown:
 				query.Aggregate(type, {field});
+				break;
+			case AggPercentile:
+				query.AggregatePercentile(field, {50});
 		}
 
 		auto err = client->Select(query, qr);
@@ -121,6 +126,9 @@ void QueryAggStrictModeTest(const std::unique_ptr<Client>& client) {
 			case AggAvg:
 			case AggDistinct:
 			case AggFacet:
+			case AggApproxCountDistinct:
+			case AggPercentile:
+			case AggTopKApprox:
 			case AggUnknown:
 				switch (expectedError) {
 					case Ok: {
@@ -275,6 +275,7 @@ TEST(DBConfigTests, ReadValidJsonConfiguration) {
 			"retry_sync_interval_msec":30000,
 			"enable_compression":true,
 			"batching_routines_count": 100,
+			"apply_lanes_count": 4,
 			"force_sync_on_logic_error": false,
 			"force_sync_on_wrong_data_hash": false,
 			"max_wal_depth_on_force_sync": 1000,
@@ -346,6 +347,7 @@ TEST(DBConfigTests, ReadInvalidJsonConfiguration) {
 			"retry_sync_interval_msec":30000,
 			"enable_compression":true,
 			"batching_routines_count":"100test",
+			"apply_lanes_count":"4test",
 			"force_sync_on_logic_error": false,
 			"force_sync_on_wrong_data_hash": false,
 			"max_wal_depth_on_force_sync":1000,
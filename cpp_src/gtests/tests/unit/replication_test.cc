@@ -662,6 +662,178 @@ TEST_F(ReplicationLoadApi, NodeOfflineLastError) {
 	ASSERT_FALSE(stats.nodeStats[0].lastError.whatStr().empty());
 }
 
+TEST_F(ReplicationLoadApi, ApplyLanes) {
+	// Check online updates of the several namespaces, applied concurrently via the several connections (lanes) to each follower
+	constexpr size_t kNsCount = 8;
+	constexpr int kLanesCount = 4;
+	constexpr int kItemsCount = 300;
+	auto leader = GetSrv(masterId_);
+	auto config = leader->GetServerConfig(ServerControl::ConfigType::Namespace);
+	config.applyLanesCount = kLanesCount;
+	leader->SetReplicationConfig(config);
+
+	std::vector<std::string> nsNames;
+	for (size_t i = 0; i < kNsCount; ++i) {
+		const auto& nsName = nsNames.emplace_back("lanes_ns_" + std::to_string(i));
+		auto err = leader->api.reindexer->OpenNamespace(nsName, StorageOpts().Enabled(true));
+		ASSERT_TRUE(err.ok()) << err.what();
+		leader->api.DefineNamespaceDataset(
+			nsName, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0}, IndexDeclaration{"int", "tree", "int", IndexOpts(), 0}});
+	}
+
+	std::vector<std::thread> writers;
+	writers.reserve(nsNames.size());
+	for (const auto& nsName : nsNames) {
+		writers.emplace_back([&leader, &nsName] {
+			auto& api = leader->api;
+			for (int i = 0; i < kItemsCount; ++i) {
+				api.UpsertJSON(nsName, fmt::format(R"json({{"id":{},"int":{},"data":"{}"}})json", i, rand(), api.RandString()));
+			}
+			// Transactions and queries await the batched updates of the all lanes
+			auto tx = api.reindexer->NewTransaction(nsName);
+			ASSERT_TRUE(tx.Status().ok()) << tx.Status().what();
+			for (int i = kItemsCount; i < 2 * kItemsCount; ++i) {
+				auto item = tx.NewItem();
+				auto err = item.FromJSON(fmt::format(R"json({{"id":{},"int":{}}})json", i, rand()));
+				ASSERT_TRUE(err.ok()) << err.what();
+				err = tx.Upsert(std::move(item));
+				ASSERT_TRUE(err.ok()) << err.what();
+			}
+			BaseApi::QueryResultsType txQr;
+			auto err = api.reindexer->CommitTransaction(tx, txQr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			BaseApi::QueryResultsType qr;
+			api.Delete(Query(nsName).Where("id", CondLt, kItemsCount / 2), qr);
+			ASSERT_EQ(qr.Count(), kItemsCount / 2);
+			for (int i = 0; i < kItemsCount; ++i) {
+				api.UpsertJSON(nsName, fmt::format(R"json({{"id":{},"int":{},"data":"{}"}})json", i, rand(), api.RandString()));
+			}
+		});
+	}
+	for (auto& th : writers) {
+		th.join();
+	}
+	// Followers' data, LSNs and tagsmatchers have to be the same as the leader's ones
+	for (const auto& nsName : nsNames) {
+		WaitSync(nsName);
+		auto qr = leader->api.Select(Query(nsName));
+		ASSERT_EQ(qr.Count(), 2 * kItemsCount);
+	}
+
+	auto stats = leader->GetReplicationStats(reindexer::cluster::kAsyncReplStatsType);
+	ASSERT_EQ(stats.nodeStats.size(), kDefaultServerCount - 1);
+	for (const auto& node : stats.nodeStats) {
+		ASSERT_EQ(node.applyLanes.lanes.size(), size_t(kLanesCount)) << node.dsn;
+		const auto usedLanes = std::ranges::count_if(node.applyLanes.lanes, [](const auto& lane) { return lane.updates > 0; });
+		EXPECT_GT(usedLanes, 1) << node.dsn;
+	}
+}
+
+TEST_F(ReplicationLoadApi, PartialResync) {
+	// Check resync of the follower, which is behind the leader's WAL, by the diverged data hash tree buckets only
+	constexpr std::string_view kNsSome = "some";
+	constexpr int kItemsCount = 2000, kUpdatesCount = 200;
+	constexpr size_t kFollowerId = 1;
+	const std::vector<int> kModifiedIds{0, 1, 2, 3, 4}, kDeletedIds{10, 11, 12};
+	constexpr int kInsertedId = 5 * kItemsCount;
+	const auto upsert = [](BaseApi& api, int id, int value) {
+		api.UpsertJSON(kNsSome, fmt::format(R"json({{"id":{},"int":{},"string":"{}","uuid":"{}"}})json", id, value, api.RandString(),
+											reindexer_tests_tools::randStrUuid()));
+	};
+	InitNs();
+	auto leader = GetSrv(masterId_);
+	auto& api = leader->api;
+	SetWALSize(masterId_, 100, kNsSome);
+	for (int i = 0; i < kItemsCount; ++i) {
+		upsert(api, i, i);
+	}
+	WaitSync(kNsSome);
+	const auto statsBefore = leader->GetReplicationStats(reindexer::cluster::kAsyncReplStatsType);
+
+	// Each of the diverged items is updated several times, so the follower's LSN is out of the leader's WAL
+	ASSERT_TRUE(StopServer(kFollowerId));
+	for (int i = 0; i < kUpdatesCount; ++i) {
+		for (int id : kModifiedIds) {
+			upsert(api, id, i);
+		}
+	}
+	for (int id : kDeletedIds) {
+		BaseApi::QueryResultsType qr;
+		api.Delete(Query(kNsSome).Where("id", CondEq, id), qr);
+		ASSERT_EQ(qr.Count(), 1);
+	}
+	upsert(api, kInsertedId, 0);
+	ASSERT_TRUE(StartServer(kFollowerId));
+	WaitSync(kNsSome);
+
+	// Only the items of the diverged buckets are transferred
+	const auto stats = leader->GetReplicationStats(reindexer::cluster::kAsyncReplStatsType);
+	EXPECT_EQ(stats.forceSyncs.count, statsBefore.forceSyncs.count);
+	EXPECT_EQ(stats.partialSyncs.count, statsBefore.partialSyncs.count + 1);
+	EXPECT_GT(stats.partialSyncs.records, statsBefore.partialSyncs.records);
+	EXPECT_LT(stats.partialSyncs.records - statsBefore.partialSyncs.records, size_t(kItemsCount / 10));
+
+	auto& followerApi = GetSrv(kFollowerId)->api;
+	auto qr = followerApi.Select(Query(kNsSome).Where("id", CondSet, {10, 11, 12}));
+	EXPECT_EQ(qr.Count(), 0);
+	qr = followerApi.Select(Query(kNsSome).Where("id", CondEq, kInsertedId));
+	EXPECT_EQ(qr.Count(), 1);
+	qr = followerApi.Select(Query(kNsSome).Where("id", CondSet, {0, 1, 2, 3, 4}).Where("int", CondEq, kUpdatesCount - 1));
+	EXPECT_EQ(qr.Count(), kModifiedIds.size());
+}
+
+#ifdef RX_WITH_ZSTD
+TEST_F(ReplicationLoadApi, ZstdDictionary) {
+	// Check online updates, compressed with zstd. The dictionary is trained on the replicated items, shipped to the followers and used
+	// for the following updates
+	constexpr int kItemsCount = 2000;
+	constexpr int kDictSize = 4096;
+	const std::string kNsName = "zstd_dict_ns";
+	auto leader = GetSrv(masterId_);
+	auto config = leader->GetServerConfig(ServerControl::ConfigType::Namespace);
+	config.compressionCodec = "zstd";
+	config.zstdDictSize = kDictSize;
+	leader->SetReplicationConfig(config);
+
+	auto err = leader->api.reindexer->OpenNamespace(kNsName, StorageOpts().Enabled(true));
+	ASSERT_TRUE(err.ok()) << err.what();
+	leader->api.DefineNamespaceDataset(kNsName, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0}});
+	const auto upsert = [&leader, &kNsName](int from, int to, std::string_view suffix) {
+		for (int i = from; i < to; ++i) {
+			leader->api.UpsertJSON(kNsName, fmt::format(R"json({{"id":{},"name":"user_{}_{}","email":"user_{}@example.com","age":{}}})json",
+														i, i, suffix, i * 7, 18 + i % 60));
+		}
+	};
+	upsert(0, kItemsCount, "first");
+	WaitSync(kNsName);
+
+	// Dictionary has to be trained on the first items, so these updates are compressed with it
+	upsert(0, kItemsCount, "second");
+	BaseApi::QueryResultsType qr;
+	leader->api.Delete(Query(kNsName).Where("id", CondLt, kItemsCount / 4), qr);
+	ASSERT_EQ(qr.Count(), kItemsCount / 4);
+	upsert(kItemsCount, kItemsCount + 100, "third");
+	WaitSync(kNsName);
+	auto leaderQr = leader->api.Select(Query(kNsName));
+	ASSERT_EQ(leaderQr.Count(), kItemsCount - kItemsCount / 4 + 100);
+
+	// Stats are updated by the replication routines asynchronously
+	reindexer::cluster::ReplicationStats stats;
+	for (int i = 0; i < 50; ++i) {
+		stats = leader->GetReplicationStats(reindexer::cluster::kAsyncReplStatsType);
+		ASSERT_EQ(stats.nodeStats.size(), kDefaultServerCount - 1);
+		if (std::ranges::all_of(stats.nodeStats, [](const auto& node) { return node.compression.zstdDictRawBytes > 0; })) {
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	for (const auto& node : stats.nodeStats) {
+		EXPECT_GT(node.compression.zstdRawBytes, 0) << node.dsn;
+		EXPECT_GT(node.compression.zstdDictRawBytes, 0) << node.dsn;
+	}
+}
+#endif	// RX_WITH_ZSTD
+
 TEST_F(ReplicationLoadApi, LogLevel) {
 	// Check async replication log level setup
 	InitNs();
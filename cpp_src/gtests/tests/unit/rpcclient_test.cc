@@ -694,6 +694,137 @@ TEST_F(RPCClientTestApi, FirstSelectWithFetch) {
 	loop.run();
 }
 
+TEST_F(RPCClientTestApi, LargeResultsFetching) {
+	// Large uncompressed results are sent as the chain of the buffers. Check them together with compressed results and small pages
+	StartDefaultRealServer();
+	ev::dynamic_loop loop;
+
+	loop.spawn(exceptionWrapper([this, &loop] {
+		constexpr int kDataCount = 3000;
+		const std::string kNsName = "large_results_ns";
+		const std::string dsn = "cproto://" + kDefaultRPCServerAddr + "/db1";
+		const auto itemJSON = [](int id) {
+			return fmt::format(R"({{"id":{},"data":"{}"}})", id, std::string(500 + id % 700, char('a' + id % 26)));
+		};
+		{
+			client::CoroReindexer crx;
+			auto err = crx.Connect(dsn, loop, reindexer::client::ConnectOpts().CreateDBIfMissing());
+			ASSERT_TRUE(err.ok()) << err.what();
+			CreateNamespace(crx, kNsName);
+			for (int id = 0; id < kDataCount; ++id) {
+				auto item = crx.NewItem(kNsName);
+				ASSERT_TRUE(item.Status().ok()) << item.Status().what();
+				err = item.FromJSON(itemJSON(id));
+				ASSERT_TRUE(err.ok()) << err.what();
+				err = crx.Upsert(kNsName, item);
+				ASSERT_TRUE(err.ok()) << err.what();
+			}
+		}
+		for (const bool enableCompression : {false, true}) {
+			for (const int fetchAmount : {10000, 1000, 10}) {
+				client::ReindexerConfig cfg;
+				cfg.EnableCompression = enableCompression;
+				cfg.FetchAmount = fetchAmount;
+				client::CoroReindexer rxs(cfg);
+				auto err = rxs.Connect(dsn, loop);
+				ASSERT_TRUE(err.ok()) << err.what();
+				client::CoroQueryResults res;
+				err = rxs.Select(Query(kNsName).Sort("id", false), res);
+				ASSERT_TRUE(err.ok()) << err.what();
+				ASSERT_EQ(res.Count(), kDataCount);
+				int id = 0;
+				WrSerializer ser;
+				for (auto& it : res) {
+					ASSERT_TRUE(it.Status().ok()) << it.Status().what();
+					ser.Reset();
+					err = it.GetJSON(ser, false);
+					ASSERT_TRUE(err.ok()) << err.what();
+					ASSERT_EQ(ser.Slice(), itemJSON(id)) << "compression: " << enableCompression << "; fetch amount: " << fetchAmount;
+					++id;
+				}
+				ASSERT_EQ(id, kDataCount);
+			}
+		}
+	}));
+
+	loop.run();
+}
+
+#ifdef RX_WITH_ZSTD
+TEST_F(RPCClientTestApi, ZstdFallbackToSnappy) {
+	// Fake server does not report zstd capability on login, like the servers with the protocol versions before 0x105. So the client, which
+	// requests zstd, has to fall back to snappy
+	RPCServerConfig conf;
+	conf.loginDelay = std::chrono::seconds(0);
+	conf.openNsDelay = std::chrono::seconds(0);
+	AddFakeServer(kDefaultRPCServerAddr, conf);
+	StartServer();
+	ev::dynamic_loop loop;
+	loop.spawn(exceptionWrapper([&loop] {
+		reindexer::client::ReindexerConfig config;
+		config.EnableCompression = true;
+		config.Codec = reindexer::net::cproto::CompressionCodec::Zstd;
+		reindexer::client::CoroReindexer rx(config);
+		auto err = rx.Connect(std::string("cproto://") + kDefaultRPCServerAddr + "/test_db", loop);
+		ASSERT_TRUE(err.ok()) << err.what();
+		for (int i = 0; i < 10; ++i) {
+			err = rx.AddNamespace(reindexer::NamespaceDef("MyNamespace" + std::to_string(i)));
+			ASSERT_TRUE(err.ok()) << err.what();
+		}
+		const auto stats = rx.GetCompressionStats();
+		EXPECT_GT(stats.rawBytes, 0);
+		EXPECT_EQ(stats.zstdRawBytes, 0);
+	}));
+	loop.run();
+	Error err = StopServer();
+	ASSERT_TRUE(err.ok()) << err.what();
+}
+
+TEST_F(RPCClientTestApi, ZstdNegotiation) {
+	// Real server supports zstd, so it is used by the clients, which request it. Other clients still use snappy with the same server
+	StartDefaultRealServer();
+	ev::dynamic_loop loop;
+
+	loop.spawn(exceptionWrapper([this, &loop] {
+		constexpr int kDataCount = 500;
+		const std::string kNsName = "zstd_ns";
+		const std::string dsn = "cproto://" + kDefaultRPCServerAddr + "/db1";
+		{
+			client::CoroReindexer crx;
+			auto err = crx.Connect(dsn, loop, reindexer::client::ConnectOpts().CreateDBIfMissing());
+			ASSERT_TRUE(err.ok()) << err.what();
+			CreateNamespace(crx, kNsName);
+		}
+		for (const auto codec : {net::cproto::CompressionCodec::Zstd, net::cproto::CompressionCodec::Snappy}) {
+			client::ReindexerConfig cfg;
+			cfg.EnableCompression = true;
+			cfg.Codec = codec;
+			client::CoroReindexer rx(cfg);
+			auto err = rx.Connect(dsn, loop);
+			ASSERT_TRUE(err.ok()) << err.what();
+			FillData(rx, kNsName, 0, kDataCount);
+			client::CoroQueryResults qr;
+			err = rx.Select(Query(kNsName), qr);
+			ASSERT_TRUE(err.ok()) << err.what();
+			ASSERT_EQ(qr.Count(), kDataCount);
+
+			const auto stats = rx.GetCompressionStats();
+			EXPECT_GT(stats.rawBytes, 0);
+			if (codec == net::cproto::CompressionCodec::Zstd) {
+				// Login request is compressed with snappy, because zstd is negotiated by its response
+				EXPECT_GT(stats.zstdRawBytes, 0);
+				EXPECT_LT(stats.zstdRawBytes, stats.rawBytes);
+			} else {
+				EXPECT_EQ(stats.zstdRawBytes, 0);
+			}
+			EXPECT_EQ(stats.zstdDictRawBytes, 0);
+		}
+	}));
+
+	loop.run();
+}
+#endif	// RX_WITH_ZSTD
+
 TEST_F(RPCClientTestApi, FetchingWithJoin) {
 	// Check that particular results fetching does not break tagsmatchers
 	using namespace reindexer::client;
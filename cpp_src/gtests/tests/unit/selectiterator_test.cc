@@ -9,6 +9,7 @@
 
 #include "core/id_type.h"
 #include "core/idset/idset.h"
+#include "core/idset/idsetbitmap.h"
 #include "core/index/keyentry.h"
 #include "core/nsselecter/selectiterator.h"
 #include "core/type_consts.h"
@@ -19,6 +20,7 @@ namespace reindexer_tests {
 namespace {
 
 using reindexer::IdSet;
+using reindexer::IdSetBitmap;
 using reindexer::IdSetPlain;
 using reindexer::IdType;
 using reindexer::IsDistinct_False;
@@ -70,6 +72,17 @@ public:
 		skr_.emplace_back(SingleSelectKeyResult(entry, SortType{0}));
 	}
 
+	RX_NO_INLINE void AddBitmapIds(std::vector<int> ids) {
+		std::sort(ids.begin(), ids.end());
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+		std::vector<IdType> rids;
+		rids.reserve(ids.size());
+		for (int id : ids) {
+			rids.emplace_back(RID(id));
+		}
+		skr_.emplace_back(SingleSelectKeyResult(IdSetBitmap::Build(rids)));
+	}
+
 	RX_NO_INLINE void AddRange(int begin, int endExclusive) { skr_.emplace_back(SingleSelectKeyResult(RID(begin), RID(endExclusive))); }
 
 	void SetDeferedExplicitSort(bool v = true) noexcept { skr_.deferedExplicitSort = v; }
@@ -246,7 +259,7 @@ std::vector<int> UniqueSortedIds(std::vector<int> ids) {
 }
 
 void GenerateRandomIdSets(std::mt19937& rng, SelectIteratorHarness& harness, std::vector<std::vector<int>>* partitions) {
-	enum class [[nodiscard]] RandomIdSetKind : uint8_t { Range, Plain, Btree };
+	enum class [[nodiscard]] RandomIdSetKind : uint8_t { Range, Plain, Btree, Bitmap };
 	constexpr int kMinIdSets = 5;
 	constexpr int kMaxIdSets = 100;
 	constexpr int kMinIdSetSize = 1;
@@ -256,7 +269,7 @@ void GenerateRandomIdSets(std::mt19937& rng, SelectIteratorHarness& harness, std
 
 	std::uniform_int_distribution<int> idSetCountDist(kMinIdSets, kMaxIdSets);
 	std::uniform_int_distribution<int> sizeDist(kMinIdSetSize, kMaxIdSetSize);
-	std::uniform_int_distribution<int> kindDist(0, 2);
+	std::uniform_int_distribution<int> kindDist(0, 3);
 	std::uniform_int_distribution<int> idDist(0, kMaxIdValue);
 
 	const int idSetCount = idSetCountDist(rng);
@@ -293,6 +306,8 @@ void GenerateRandomIdSets(std::mt19937& rng, SelectIteratorHarness& harness, std
 
 		if (kind == RandomIdSetKind::Plain) {
 			harness.AddPlainIds(ids);
+		} else if (kind == RandomIdSetKind::Bitmap) {
+			harness.AddBitmapIds(ids);
 		} else {
 			harness.AddBtreeIds(ids);
 		}
@@ -390,6 +405,34 @@ TEST(SelectIteratorTest, SingleIdset_PlainVsBtree) {
 	}
 }
 
+TEST(SelectIteratorTest, SingleIdset_PlainVsBitmap) {
+	// SingleIdset: same ids stored as plain or compressed bitmap yield identical forward/reverse traversal.
+	// Ids cover sparse (array), dense (bitset) and continuous (run) bitmap containers.
+	std::vector<int> ids;
+	for (int id = 0; id < 3000; id += 7) {
+		ids.push_back(id);
+	}
+	for (int id = 70'000; id < 120'000; id += 2) {
+		ids.push_back(id);
+	}
+	for (int id = 200'000; id < 210'000; ++id) {
+		ids.push_back(id);
+	}
+
+	SelectIteratorHarness plain;
+	plain.AddPlainIds(ids);
+	auto plainIt = std::move(plain).BuildIterator();
+
+	SelectIteratorHarness bitmap;
+	bitmap.AddBitmapIds(ids);
+	auto bitmapIt = std::move(bitmap).BuildIterator();
+
+	for (bool reverse : {true, false}) {
+		AssertEquivalentTraversal(plainIt, bitmapIt, reverse ? SelectIterator::Type::RevSingleIdset : SelectIterator::Type::SingleIdset,
+								  reverse);
+	}
+}
+
 TEST(SelectIteratorTest, SingleRange_Forward) {
 	// SingleRange forward: iterate every id in [begin, end).
 	constexpr int begin = 100;
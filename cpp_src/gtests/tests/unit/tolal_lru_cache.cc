@@ -16,6 +16,7 @@ using reindexer::QueryCountCache;
 using reindexer::QueryCacheKey;
 using reindexer::QueryCountCacheVal;
 using reindexer::EqQueryCacheKey;
+using reindexer::HashQueryCacheKey;
 using reindexer::kCountCachedKeyMode;
 
 struct [[nodiscard]] CacheJoinItemsProcessorMock {
@@ -172,4 +173,105 @@ TEST(LruCache, StressTest) {
 	}
 }
 
+TEST(LruCache, ShardedStressTest) {
+	constexpr size_t kShards = 16;
+	constexpr size_t kCacheSize = 256 * 1024;
+	constexpr int kQueriesCount = 2000;
+	constexpr int kIterCount = 20000;
+	using ShardedQueryCountCache =
+		reindexer::LRUCache<reindexer::ShardedLRUCacheImpl<QueryCacheKey, QueryCountCacheVal, HashQueryCacheKey, EqQueryCacheKey>,
+							reindexer::LRUWithAtomicPtr::Yes>;
+	ShardedQueryCountCache cache(kCacheSize, 1, reindexer::CachePolicy::LRU, kShards);
+
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < 8; ++t) {
+		threads.emplace_back([&cache, t] {
+			for (int i = 0; i < kIterCount; ++i) {
+				const int idx = (i * 7 + int(t) * 13) % kQueriesCount;
+				QueryCacheKey ckey{Query(fmt::format("namespace_{}", idx)), kCountCachedKeyMode,
+								   static_cast<const CacheItemsProcessorsMock*>(nullptr)};
+				auto cached = cache.Get(ckey);
+				if (cached.valid && cached.val.IsInitialized()) {
+					// Each query has its own cached value, regardless of the shard
+					ASSERT_EQ(cached.val.totalCount, idx);
+				} else if (cached.valid) {
+					cache.Put(ckey, QueryCountCacheVal{size_t(idx)});
+				}
+			}
+		});
+	}
+	for (auto& th : threads) {
+		th.join();
+	}
+
+	// Each shard has its own part of the size limit
+	const auto memStat = cache.GetMemStat();
+	EXPECT_LE(memStat.totalSize, kCacheSize);
+	EXPECT_GT(memStat.itemsCount, 0u);
+	// Hits and misses are counted by the shards and summed by the cache
+	auto perfStat = cache.GetPerfStat();
+	EXPECT_EQ(perfStat.hits + perfStat.misses, 8u * kIterCount);
+	EXPECT_GT(perfStat.hits, 0u);
+
+	// Counters of the shards are kept after the cache reinitialization
+	cache.Reinitialize(kCacheSize, 1, reindexer::CachePolicy::LRU, kShards);
+	perfStat = cache.GetPerfStat();
+	EXPECT_EQ(perfStat.hits + perfStat.misses, 8u * kIterCount);
+	cache.ResetPerfStat();
+	perfStat = cache.GetPerfStat();
+	EXPECT_EQ(perfStat.hits + perfStat.misses, 0u);
+}
+
+TEST(LruCache, TinyLFUScanResistance) {
+	// Hot queries are requested between the scans of unique queries, which are larger than the cache
+	constexpr int kHotCount = 50;
+	constexpr int kScanChunk = 200;
+	constexpr int kCycles = 20;
+	constexpr size_t kCacheSize = 64 * 1024;
+
+	const auto hotHitRate = [&](reindexer::CachePolicy policy, reindexer::LRUCachePerfStat& stats) {
+		QueryCountCache cache(kCacheSize, 1, policy);
+		const auto access = [&cache](const Query& q) {
+			QueryCacheKey ckey{q, kCountCachedKeyMode, static_cast<const CacheItemsProcessorsMock*>(nullptr)};
+			auto cached = cache.Get(ckey);
+			const bool hit = cached.valid && cached.val.IsInitialized();
+			if (!hit && cached.valid) {
+				cache.Put(ckey, QueryCountCacheVal{size_t(1)});
+			}
+			return hit;
+		};
+		int hits = 0, scanned = 0;
+		for (int cycle = 0; cycle < kCycles; ++cycle) {
+			for (int i = 0; i < kHotCount; ++i) {
+				// Hits are counted after the warm up
+				hits += (access(Query(fmt::format("hot_{}", i))) && cycle >= kCycles / 2) ? 1 : 0;
+			}
+			for (int i = 0; i < kScanChunk; ++i) {
+				std::ignore = access(Query(fmt::format("scan_{}", scanned++)));
+			}
+		}
+		stats = cache.GetPerfStat();
+		return double(hits) / (kHotCount * (kCycles - kCycles / 2));
+	};
+
+	reindexer::LRUCachePerfStat lruStats, lfuStats;
+	const double lruHitRate = hotHitRate(reindexer::CachePolicy::LRU, lruStats);
+	const double lfuHitRate = hotHitRate(reindexer::CachePolicy::WTinyLFU, lfuStats);
+	PRINTF("hot queries hit rate: LRU %f, W-TinyLFU %f\n", lruHitRate, lfuHitRate);
+	EXPECT_LT(lruHitRate, 0.1);
+	EXPECT_GT(lfuHitRate, 0.9);
+
+	EXPECT_FALSE(lruStats.regions.has_value());
+	ASSERT_TRUE(lfuStats.regions.has_value());
+	uint64_t hits = 0, misses = 0;
+	for (const auto& region : *lfuStats.regions) {
+		hits += region.hits;
+		misses += region.misses;
+	}
+	EXPECT_EQ(hits, lfuStats.hits);
+	EXPECT_EQ(misses, lfuStats.misses);
+	// Hot queries are kept in the protected region
+	EXPECT_GT((*lfuStats.regions)[size_t(reindexer::LRUCacheRegion::Protected)].hits, uint64_t(kHotCount));
+}
+
 }  // namespace reindexer_tests
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "core/system_ns_names.h"
+#include "gtests/tests/fixtures/reindexer_api.h"
+
+namespace reindexer_tests {
+
+using reindexer::IndexOpts;
+
+TEST_F(ReindexerApi, TopKSortWithLimit) {
+	constexpr int kItemsCount = 20'000;
+	rt.OpenNamespace(default_namespace, StorageOpts().Enabled(false));
+	DefineNamespaceDataset(default_namespace, {IndexDeclaration{"id", "hash", "int", IndexOpts().PK(), 0},
+											   IndexDeclaration{"group", "hash", "int", IndexOpts(), 0},
+											   IndexDeclaration{"rating", "-", "double", IndexOpts(), 0}});
+	for (int i = 0; i < kItemsCount; ++i) {
+		rt.UpsertJSON(default_namespace, fmt::format(R"json({{"id":{},"group":{},"rating":{},"name":"name_{}"}})json", i, (i * 7) % 100,
+													 ((i * 37) % 1000) / 10.0, i % 300));
+	}
+	rt.UpsertJSON(reindexer::kConfigNamespace,
+				  R"json({"type":"profiling","profiling":{"queriesperfstats":true,"queries_threshold_us":0,"perfstats":true}})json");
+
+	const auto selectIds = [&](const Query& q) {
+		auto qr = rt.Select(q);
+		std::vector<int> ids;
+		ids.reserve(qr.Count());
+		for (auto& it : qr) {
+			ids.emplace_back(it.GetItem(false)["id"].As<int>());
+		}
+		return std::make_pair(std::move(ids), qr.TotalCount());
+	};
+	const auto sortMemory = [&](const Query& q) {
+		auto qr = rt.Select(Query(reindexer::kQueriesPerfStatsNamespace).Where("query", CondEq, q.GetSQL(true)));
+		EXPECT_EQ(qr.Count(), 1) << q.GetSQL(true);
+		return qr.Count() ? qr.begin().GetItem(false)["max_sort_memory"].As<int64_t>() : 0;
+	};
+	// The items with the limit must be the same as the ones, selected from all of the sorted items
+	const auto check = [&](Query&& q, unsigned offset, unsigned limit) {
+		const auto [all, allTotal] = selectIds(Query(q).ReqTotal());
+		const auto [limited, limitedTotal] = selectIds(Query(q).ReqTotal().Offset(offset).Limit(limit));
+		ASSERT_EQ(allTotal, all.size()) << q.GetSQL();
+		EXPECT_EQ(limitedTotal, allTotal) << q.GetSQL();
+		const auto from = std::min<size_t>(offset, all.size());
+		const auto to = std::min<size_t>(offset + limit, all.size());
+		EXPECT_EQ(limited, std::vector<int>(all.begin() + from, all.begin() + to)) << q.GetSQL();
+
+		// Only 'offset + limit' of the best items (and a bounded count of the candidates) are held until the sort
+		const auto allMemory = sortMemory(Query(q).ReqTotal());
+		const auto limitedMemory = sortMemory(Query(q).ReqTotal().Offset(offset).Limit(limit));
+		EXPECT_GT(limitedMemory, 0) << q.GetSQL();
+		if (all.size() > 10 * (offset + limit + 1024)) {
+			EXPECT_LT(limitedMemory * 4, allMemory) << q.GetSQL();
+		}
+	};
+
+	check(Query(default_namespace).Sort("group", false), 30, 50);
+	check(Query(default_namespace).Sort("group", true).Sort("rating", false), 0, 10);
+	check(Query(default_namespace).Sort("name", false), 100, 1000);
+	check(Query(default_namespace).Where("group", CondLt, 90).Sort("rating * 2 + group", true), 5, 20);
+	check(Query(default_namespace).Where("rating", CondGe, 50.0).Sort("group", false).Sort("id / 1000 - rating", false), 10, 3000);
+	check(Query(default_namespace).Where("id", CondLt, 500).Sort("rating", true), 400, 200);
+}
+
+}  // namespace reindexer_tests
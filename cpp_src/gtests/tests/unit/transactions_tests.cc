@@ -211,6 +211,10 @@ TEST_F(TransactionApi, ConcurrencyTest) {
 		EXPECT_GT(stats.minCopyTimeUs, 0);
 		EXPECT_GT(stats.avgCopyTimeUs, stats.minCopyTimeUs);
 		EXPECT_GT(stats.maxCopyTimeUs, stats.avgCopyTimeUs);
+
+		EXPECT_GT(stats.minCopyMemory, 0);
+		EXPECT_GE(stats.avgCopyMemory, stats.minCopyMemory);
+		EXPECT_GE(stats.maxCopyMemory, stats.avgCopyMemory);
 	};
 
 	ValidateData();
@@ -239,6 +243,41 @@ TEST_F(TransactionApi, IndexesOptimizeTest) {
 	ASSERT_EQ(true, optimization_completed);
 }
 
+TEST_F(TransactionApi, LargeTxCopyPolicy) {
+	rt.EnablePerfStats(*rt.reindexer);
+	auto setConfig = [this](int copyPolicyMultiplier) {
+		QueryResults qr;
+		auto err = rt.reindexer->Update(Query(reindexer::kConfigNamespace)
+											.Set("namespaces[*].start_copy_policy_tx_size", 100)
+											.Set("namespaces[*].copy_policy_multiplier", copyPolicyMultiplier)
+											.Set("namespaces[*].tx_size_to_always_copy", 100'000)
+											.Where("type", CondEq, "namespaces"),
+										qr);
+		ASSERT_TRUE(err.ok()) << err.what();
+	};
+	// Perform select to trick ns copy heuristic - it expecting at least one select query
+	auto qr = rt.Select(Query(default_namespace));
+	ASSERT_EQ(0, qr.Count());
+
+	setConfig(1);
+	AddDataToNsTx(*rt.reindexer, 0, 2000, "data");
+	const auto initialCopies = GetTxPerfStats(*rt.reindexer, default_namespace).totalCopyCount;
+
+	// Namespace is too large for the copy policy: transaction has to be committed without copying
+	AddDataToNsTx(*rt.reindexer, 2000, 200, "data");
+	EXPECT_EQ(GetTxPerfStats(*rt.reindexer, default_namespace).totalCopyCount, initialCopies);
+
+	// Large multiplier allows to copy the large namespace for the transaction
+	setConfig(1000);
+	AddDataToNsTx(*rt.reindexer, 2200, 200, "data");
+	EXPECT_EQ(GetTxPerfStats(*rt.reindexer, default_namespace).totalCopyCount, initialCopies + 1);
+
+	// Transactions smaller than start_copy_policy_tx_size are still committed in place
+	AddDataToNsTx(*rt.reindexer, 2400, 50, "data");
+	EXPECT_EQ(GetTxPerfStats(*rt.reindexer, default_namespace).totalCopyCount, initialCopies + 1);
+	EXPECT_EQ(GetItemsCount(*rt.reindexer), 2450);
+}
+
 #if defined(__GNUC__) && !defined(__clang__) && defined(REINDEX_WITH_TSAN)
 #pragma GCC diagnostic pop
 #endif
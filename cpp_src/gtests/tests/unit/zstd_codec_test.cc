@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include "fmt/format.h"
+#include "net/cproto/zstdcodec.h"
+#include "tools/errors.h"
+
+using namespace reindexer::net::cproto;
+
+TEST(ZstdCodecTest, CodecNames) {
+	EXPECT_EQ(CompressionCodecFromStr(CompressionCodecToStr(CompressionCodec::Snappy)), CompressionCodec::Snappy);
+	EXPECT_EQ(CompressionCodecFromStr(CompressionCodecToStr(CompressionCodec::Zstd)), CompressionCodec::Zstd);
+	EXPECT_THROW(std::ignore = CompressionCodecFromStr("lz4"), reindexer::Error);
+}
+
+TEST(ZstdCodecTest, CompressionWithTrainedDictionary) {
+	if (!ZstdCompressionAvailable()) {
+		GTEST_SKIP() << "Reindexer was built without zstd";
+	}
+	// Small and similar records, like the items of the single namespace
+	constexpr size_t kSamplesCount = 4000;
+	std::vector<std::string> samples;
+	samples.reserve(kSamplesCount);
+	for (size_t i = 0; i < kSamplesCount; ++i) {
+		samples.emplace_back(
+			fmt::format(R"json({{"id":{},"name":"user_{}","email":"user_{}@example.com","age":{},"tags":["t{}","t{}"]}})json", i, i * 7,
+						i % 113, 18 + i % 60, i % 11, i % 17));
+	}
+	auto dict = ZstdDictionary::Train(samples, kDefaultZstdDictSize, kDefaultZstdCompressionLevel);
+	ASSERT_TRUE(dict);
+	ASSERT_NE(dict->ID(), 0);
+	ASSERT_LE(dict->Data().size(), kDefaultZstdDictSize);
+
+	// The other side of the connection loads the dictionary from the raw data
+	ZstdCodec sender, receiver;
+	sender.AddDictionary(dict);
+	receiver.AddDictionary(ZstdDictionary::Load(dict->Data(), kDefaultZstdCompressionLevel));
+	ASSERT_TRUE(receiver.HasDictionary(dict->ID()));
+
+	size_t withDictSize = 0, withoutDictSize = 0;
+	std::string compressed, decompressed;
+	for (size_t i = 0; i < 100; ++i) {
+		const auto record = fmt::format(R"json({{"id":{},"name":"user_{}","email":"user_{}@example.com","age":{},"tags":["t{}"]}})json",
+										100'000 + i, i, i, 20 + i % 40, i % 7);
+		sender.Compress(record, compressed, dict->ID());
+		withDictSize += compressed.size();
+		receiver.Decompress(compressed, decompressed);
+		ASSERT_EQ(decompressed, record);
+
+		sender.Compress(record, compressed);
+		withoutDictSize += compressed.size();
+		receiver.Decompress(compressed, decompressed);
+		ASSERT_EQ(decompressed, record);
+	}
+	EXPECT_LT(withDictSize * 2, withoutDictSize);
+
+	// Frames, compressed with unknown dictionary, can not be decompressed
+	ZstdCodec otherReceiver;
+	sender.Compress(samples.front(), compressed, dict->ID());
+	EXPECT_THROW(otherReceiver.Decompress(compressed, decompressed), reindexer::Error);
+	EXPECT_THROW(otherReceiver.Decompress("not a zstd frame", decompressed), reindexer::Error);
+}
@@ -144,7 +144,7 @@ CoroRPCAnswer CoroClientConnection::call(const CommandParams& opts, const Args&
 			opts.cmd, seq, false, args,
 			Args{Arg{int64_t(opts.execTimeout.count())}, Arg{int64_t(opts.lsn)}, Arg{int64_t(opts.serverId)},
 				 Arg{opts.shardingParallelExecution ? int64_t{opts.shardId} | kShardingParallelExecutionBit : int64_t{opts.shardId}}},
-			opts.requiredLoginTs));
+			opts.requiredLoginTs, opts.compressionDictId));
 		auto ansp = call.rspCh.pop();
 		if (ansp.second) {
 			ans = std::move(ansp.first);
@@ -187,13 +187,16 @@ Error CoroClientConnection::callNoReply(const CommandParams& opts, uint32_t seq,
 }
 
 CoroClientConnection::MarkedChunk CoroClientConnection::packRPC(CmdCode cmd, uint32_t seq, bool noReply, const Args& args,
-																const Args& ctxArgs, std::optional<TimePointT> requiredLoginTs) {
+																const Args& ctxArgs, std::optional<TimePointT> requiredLoginTs,
+																uint32_t compressionDictId) {
 	CProtoHeader hdr;
 	hdr.len = 0;
 	hdr.magic = kCprotoMagic;
 	hdr.version = kCprotoVersion;
 	hdr.compressed = enableCompression_;
 	hdr.dedicatedThread = requestDedicatedThread_;
+	hdr.zstd = enableCompression_ && zstdEnabled_;
+	hdr._reserved = 0;
 	hdr.cmd = cmd;
 	hdr.seq = seq;
 
@@ -205,7 +208,20 @@ CoroClientConnection::MarkedChunk CoroClientConnection::packRPC(CmdCode cmd, uin
 	ctxArgs.Pack(ser);
 	if (hdr.compressed) {
 		auto data = ser.Slice().substr(sizeof(hdr));
-		snappy::Compress(data.data(), data.length(), &compressedBuffer_);
+		const auto start = ClockT::now();
+		if (hdr.zstd) {
+			zstd_.Compress(data, compressedBuffer_, compressionDictId);
+			// Zstd (and its dictionaries) was negotiated with the current server's connection only, so this chunk can not be sent after
+			// the reconnect
+			if (!requiredLoginTs.has_value()) {
+				requiredLoginTs = LoginTs();
+			}
+		} else {
+			snappy::Compress(data.data(), data.length(), &compressedBuffer_);
+		}
+		compressionStats_.OnCompressed(data.size(), compressedBuffer_.size(),
+									   std::chrono::duration_cast<std::chrono::microseconds>(ClockT::now() - start),
+									   hdr.zstd ? CompressionCodec::Zstd : CompressionCodec::Snappy, hdr.zstd ? compressionDictId : 0);
 		ser.Reset(sizeof(hdr));
 		ser.Write(compressedBuffer_);
 	}
@@ -262,6 +278,7 @@ Error CoroClientConnection::login(std::vector<char>& buf) {
 #else
 		enableCompression_ = connectData_.opts.enableCompression;
 #endif
+		zstd_.SetLevel(connectData_.opts.zstdCompressionLevel);
 
 		requestDedicatedThread_ = connectData_.opts.requestDedicatedThread;
 		Args args = {Arg{p_string(&userName)},
@@ -323,6 +340,8 @@ void CoroClientConnection::handleFatalErrorImpl(const Error& err) noexcept {
 		connectionStateHandler_(err);
 	}
 	rxVersion_ = std::nullopt;
+	zstdEnabled_ = false;
+	zstd_.ClearDictionaries();
 	errSyncCh_.close();
 }
 
@@ -464,9 +483,13 @@ void CoroClientConnection::readerRoutine() {
 			Serializer ser(buf.data(), hdr.len);
 			if (hdr.compressed) {
 				uncompressed.reserve(kReadBufReserveSize);
-				if (!snappy::Uncompress(buf.data(), hdr.len, &uncompressed)) {
+				const auto start = ClockT::now();
+				if (hdr.zstd && hdr.version >= kCprotoMinZstdVersion) {
+					zstd_.Decompress(std::string_view(buf.data(), hdr.len), uncompressed);
+				} else if (!snappy::Uncompress(buf.data(), hdr.len, &uncompressed)) {
 					throw Error(errParseBin, "Can't decompress data from peer");
 				}
+				compressionStats_.OnDecompressed(std::chrono::duration_cast<std::chrono::microseconds>(ClockT::now() - start));
 				ser = Serializer(uncompressed);
 			}
 
@@ -484,9 +507,14 @@ void CoroClientConnection::readerRoutine() {
 
 		if (hdr.cmd == kCmdLogin) {
 			if (ans.Status().ok()) {
+				const auto args = ans.GetArgs(2);
 				if (!rxVersion_) {
-					rxVersion_ = ans.GetArgs(2)[0].As<std::string>();
+					rxVersion_ = args[0].As<std::string>();
 				}
+				const int64_t serverCaps = args.size() > 2 ? args[2].As<int64_t>() : 0;
+				zstdEnabled_ = enableCompression_ && connectData_.opts.compressionCodec == CompressionCodec::Zstd &&
+							   hdr.version >= kCprotoMinZstdVersion && (serverCaps & kCprotoServerCapabilityZstd) &&
+							   ZstdCompressionAvailable();
 				setLoggedIn(true);
 				if (connectionStateHandler_) {
 					connectionStateHandler_(Error());
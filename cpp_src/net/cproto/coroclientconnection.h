@@ -9,6 +9,7 @@
 #include "tools/lsn.h"
 #include "tools/serilize/serializer.h"
 #include "urlparser/urlparser.h"
+#include "zstdcodec.h"
 
 namespace reindexer {
 
@@ -102,6 +103,9 @@ public:
 		bool requestDedicatedThread;
 		std::string appName;
 		std::string replToken;
+		// Zstd is used only if the server supports it. Otherwise the connection falls back to snappy
+		CompressionCodec compressionCodec = CompressionCodec::Snappy;
+		int zstdCompressionLevel = kDefaultZstdCompressionLevel;
 	};
 	struct [[nodiscard]] ConnectData {
 		httpparser::UrlParser uri;
@@ -131,6 +135,14 @@ public:
 
 	std::optional<std::string> RxServerVersion() const noexcept { return rxVersion_; }
 
+	// True, if zstd compression was negotiated with the server for the current connection
+	bool ZstdEnabled() const noexcept { return zstdEnabled_; }
+	// Dictionaries are known to the server only until the reconnect, so they have to be shipped to the server (kCmdSetCompressionDict)
+	// after each reconnect before their usage
+	bool HasCompressionDict(uint32_t id) const noexcept { return zstd_.HasDictionary(id); }
+	void AddCompressionDict(std::shared_ptr<const ZstdDictionary> dict) { zstd_.AddDictionary(std::move(dict)); }
+	const CompressionStats& GetCompressionStats() const noexcept { return compressionStats_; }
+
 private:
 	struct [[nodiscard]] RPCData {
 		// NOLINTNEXTLINE(bugprone-exception-escape)
@@ -170,7 +182,7 @@ private:
 	Error callNoReply(const CommandParams& opts, uint32_t seq, const Args& args);
 
 	MarkedChunk packRPC(CmdCode cmd, uint32_t seq, bool noReply, const Args& args, const Args& ctxArgs,
-						std::optional<TimePointT> requiredLoginTs);
+						std::optional<TimePointT> requiredLoginTs, uint32_t compressionDictId = 0);
 	void appendChunck(std::vector<char>& buf, chunk&& ch);
 	Error login(std::vector<char>& buf);
 	void handleFatalErrorFromReader(const Error& err) noexcept;
@@ -214,6 +226,9 @@ private:
 	TimePointT loginTs_;
 	std::string compressedBuffer_;
 	std::optional<std::string> rxVersion_;
+	bool zstdEnabled_ = false;
+	ZstdCodec zstd_;
+	CompressionStats compressionStats_;
 };
 
 struct [[nodiscard]] CommandParams {
@@ -241,6 +256,8 @@ struct [[nodiscard]] CommandParams {
 	const IRdxCancelContext* cancelCtx;
 	bool shardingParallelExecution;
 	std::optional<CoroClientConnection::TimePointT> requiredLoginTs;
+	// Zstd dictionary for the request's compression (0 - without dictionary)
+	uint32_t compressionDictId = 0;
 };
 
 }  // namespace cproto
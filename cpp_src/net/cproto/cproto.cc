@@ -96,6 +96,8 @@ std::string_view CmdName(uint16_t cmd) noexcept {
 			return "ApplySnapshotChunk"sv;
 		case kCmdSetClusterOperationStatus:
 			return "SetClusterOperationStatus"sv;
+		case kCmdGetDataHashTree:
+			return "GetDataHashTree"sv;
 		case kCmdSuggestLeader:
 			return "SuggestLeader"sv;
 		case kCmdLeadersPing:
@@ -110,6 +112,8 @@ std::string_view CmdName(uint16_t cmd) noexcept {
 			return "kCmdSetTagsMatcherTx"sv;
 		case kCmdSetTagsMatcher:
 			return "kCmdSetTagsMatcher"sv;
+		case kCmdSetCompressionDict:
+			return "SetCompressionDict"sv;
 		default:
 			return "Unknown"sv;
 	}
@@ -60,6 +60,7 @@ enum [[nodiscard]] CmdCode : uint16_t {
 
 	kCmdPutTxMeta = 74,
 	kCmdSetTagsMatcherTx = 75,
+	kCmdGetDataHashTree = 76,
 
 	kCmdSubscribeUpdates = 90,	// Deprecated
 	kCmdUpdates = 91,			// Deprecated
@@ -74,6 +75,8 @@ enum [[nodiscard]] CmdCode : uint16_t {
 
 	kCmdGetSchema = 110,
 
+	kCmdSetCompressionDict = 111,
+
 	kCmdCodeMax = 128,
 
 };
@@ -87,10 +90,14 @@ const uint32_t kMaxConcurrentQueries = 256;
 const uint32_t kMaxConcurentSnapshots = 8;
 
 const uint32_t kCprotoMagic = 0xEEDD1132;
-const uint32_t kCprotoVersion = 0x104;
+const uint32_t kCprotoVersion = 0x105;
 const uint32_t kCprotoMinCompatVersion = 0x101;
 const uint32_t kCprotoMinSnappyVersion = 0x103;
 const uint32_t kCprotoMinDedicatedThreadsVersion = 0x103;
+const uint32_t kCprotoMinZstdVersion = 0x105;
+
+// Capabilities of the server, returned in the login response
+const int64_t kCprotoServerCapabilityZstd = 1;
 
 #pragma pack(push, 1)
 struct [[nodiscard]] CProtoHeader {
@@ -98,7 +105,8 @@ struct [[nodiscard]] CProtoHeader {
 	uint16_t version : 10;
 	uint16_t compressed : 1;
 	uint16_t dedicatedThread : 1;
-	uint16_t _reserved : 4;
+	uint16_t zstd : 1;	// Compressed with zstd instead of snappy
+	uint16_t _reserved : 3;
 	uint16_t cmd;
 	uint32_t len;
 	uint32_t seq;
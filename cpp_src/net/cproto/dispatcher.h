@@ -48,13 +48,19 @@ public:
 	virtual size_t AvailableEventsSpace() noexcept = 0;
 	virtual void SendEvent(chunk&& ch) = 0;
 	virtual void WriteRPCReturn(Context& ctx, const Args& args, const Error& status) = 0;
+	// Returns 'data' as the first of the response's args (string) followed by 'args'. Large uncompressed data is moved into the
+	// connection's write buffer without copying
+	virtual void WriteRPCReturn(Context& ctx, chunk&& data, const Args& args) = 0;
 	virtual void SetClientData(std::unique_ptr<ClientData>&& data) noexcept = 0;
 	virtual ClientData* GetClientData() noexcept = 0;
 	virtual std::shared_ptr<reindexer::net::connection_stat> GetConnectionStat() noexcept = 0;
+	// Adds zstd dictionary for the decompression of the connection's requests
+	virtual Error AddCompressionDict(std::string_view dict) noexcept = 0;
 };
 
 struct [[nodiscard]] Context {
 	void Return(const Args& args, const Error& status = Error()) { writer->WriteRPCReturn(*this, args, status); }
+	void Return(chunk&& data, const Args& args) { writer->WriteRPCReturn(*this, std::move(data), args); }
 	void SetClientData(std::unique_ptr<ClientData>&& data) noexcept { writer->SetClientData(std::move(data)); }
 	ClientData* GetClientData() noexcept { return writer->GetClientData(); }
 
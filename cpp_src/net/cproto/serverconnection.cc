@@ -66,6 +66,8 @@ void ServerConnection::onClose() {
 		dispatcher_.OnCloseRef()(ctx, errOK);
 	}
 	clientData_.reset();
+	enableZstd_ = false;
+	zstd_.ClearDictionaries();
 	balancingType_ = BalancingType::NotSet;
 	rebalance_ = nullptr;
 }
@@ -118,6 +120,8 @@ ServerConnection::BaseConnT::ReadResT ServerConnection::onRead() {
 #else
 		enableSnappy_ = (hdr.version >= kCprotoMinSnappyVersion) && hdr.compressed;
 #endif
+		// Response is compressed with the same codec as the request
+		enableZstd_ = enableSnappy_ && (hdr.version >= kCprotoMinZstdVersion) && hdr.zstd;
 
 		// Rebalance connection, when first message was received
 		if (balancingType_ == BalancingType::NotSet) [[unlikely]] {
@@ -159,7 +163,10 @@ ServerConnection::BaseConnT::ReadResT ServerConnection::onRead() {
 			ctx.call->cmd = CmdCode(hdr.cmd);
 			ctx.call->seq = hdr.seq;
 			Serializer ser(it.data(), hdr.len);
-			if (hdr.compressed) {
+			if (enableZstd_) {
+				zstd_.Decompress(std::string_view(it.data(), hdr.len), uncompressed);
+				ser = Serializer(uncompressed);
+			} else if (hdr.compressed) {
 				if (!snappy::Uncompress(it.data(), hdr.len, &uncompressed)) [[unlikely]] {
 					throw Error(errParseBin, "Can't decompress data from peer");
 				}
@@ -236,12 +243,18 @@ ServerConnection::BaseConnT::ReadResT ServerConnection::onRead() {
 	return BaseConnT::ReadResT::Default;
 }
 
-static void packRPC(WrSerializer& ser, Context& ctx, const Error& status, const Args& args, bool enableSnappy) {
+// Minimal size of the response's data, which is sent without copying into the write buffer
+constexpr static size_t kMinZeroCopyResponseSize = 0x10000;
+
+static CProtoHeader responseHeader(const Context& ctx, bool compressed, bool zstd) noexcept {
 	CProtoHeader hdr;
 	hdr.len = 0;
 	hdr.magic = kCprotoMagic;
 	hdr.version = kCprotoVersion;
-	hdr.compressed = enableSnappy;
+	hdr.compressed = compressed;
+	hdr.dedicatedThread = 0;
+	hdr.zstd = zstd;
+	hdr._reserved = 0;
 
 	if (ctx.call != nullptr) {
 		hdr.cmd = ctx.call->cmd;
@@ -250,7 +263,18 @@ static void packRPC(WrSerializer& ser, Context& ctx, const Error& status, const
 		hdr.cmd = 0;
 		hdr.seq = 0;
 	}
+	return hdr;
+}
 
+static void checkRPCMessageSize(const CProtoHeader& hdr, size_t size) {
+	if (size >= size_t(std::numeric_limits<int32_t>::max())) {
+		throw Error(errNetwork, "Too large RPC message({}), size: {} bytes", hdr.cmd, size);
+	}
+}
+
+// 'zstd' is not null, if the message has to be compressed with zstd instead of snappy
+static void packRPC(WrSerializer& ser, Context& ctx, const Error& status, const Args& args, bool enableSnappy, ZstdCodec* zstd) {
+	CProtoHeader hdr = responseHeader(ctx, enableSnappy || zstd, bool(zstd));
 	size_t savePos = ser.Len();
 	ser.Write(std::string_view(reinterpret_cast<char*>(&hdr), sizeof(hdr)));
 
@@ -261,19 +285,21 @@ static void packRPC(WrSerializer& ser, Context& ctx, const Error& status, const
 	if (hdr.compressed) {
 		auto data = ser.Slice().substr(sizeof(hdr) + savePos);
 		std::string compressed;
-		snappy::Compress(data.data(), data.length(), &compressed);
+		if (zstd) {
+			zstd->Compress(data, compressed);
+		} else {
+			snappy::Compress(data.data(), data.length(), &compressed);
+		}
 		ser.Reset(sizeof(hdr) + savePos);
 		ser.Write(compressed);
 	}
-	if (ser.Len() - savePos >= size_t(std::numeric_limits<int32_t>::max())) {
-		throw Error(errNetwork, "Too large RPC message({}), size: {} bytes", hdr.cmd, ser.Len());
-	}
+	checkRPCMessageSize(hdr, ser.Len() - savePos);
 	reinterpret_cast<CProtoHeader*>(ser.Buf() + savePos)->len = ser.Len() - savePos - sizeof(hdr);
 }
 
-static chunk packRPC(chunk chunk, Context& ctx, const Error& status, const Args& args, bool enableSnappy) {
+static chunk packRPC(chunk chunk, Context& ctx, const Error& status, const Args& args, bool enableSnappy, ZstdCodec* zstd) {
 	WrSerializer ser(std::move(chunk));
-	packRPC(ser, ctx, status, args, enableSnappy);
+	packRPC(ser, ctx, status, args, enableSnappy, zstd);
 	return ser.DetachChunk();
 }
 
@@ -283,7 +309,7 @@ void ServerConnection::responseRPC(Context& ctx, const Error& status, const Args
 		return;
 	}
 
-	auto&& chunk = packRPC(BaseConnT::wrBuf_.get_chunk(), ctx, status, args, enableSnappy_);
+	auto&& chunk = packRPC(BaseConnT::wrBuf_.get_chunk(), ctx, status, args, enableSnappy_, enableZstd_ ? &zstd_ : nullptr);
 	auto len = chunk.len();
 	BaseConnT::wrBuf_.write(std::move(chunk));
 	if (BaseConnT::stats_) {
@@ -305,6 +331,75 @@ void ServerConnection::responseRPC(Context& ctx, const Error& status, const Args
 	}
 }
 
+void ServerConnection::responseRPC(Context& ctx, chunk&& data, const Args& args) {
+	const std::string_view dataView(data);
+	Args allArgs;
+	allArgs.reserve(args.size() + 1);
+	allArgs.emplace_back(p_string(&dataView));
+	allArgs.insert(allArgs.end(), args.begin(), args.end());
+
+	// Compressed message has to be contiguous. Small data is cheaper to copy into the reusable chunk
+	constexpr size_t kRequiredChunks = 3;
+	if (enableSnappy_ || enableZstd_ || dataView.size() < kMinZeroCopyResponseSize ||
+		BaseConnT::wrBuf_.capacity() - BaseConnT::wrBuf_.size() < kRequiredChunks) {
+		responseRPC(ctx, Error(), allArgs);
+		return;
+	}
+	if (ctx.respSent) [[unlikely]] {
+		fprintf(stderr, "reindexer warning: RPC response already sent\n");
+		return;
+	}
+
+	// The message is written as the chain of the chunks: [header, status, args count, string type and length], [data], [rest of the args].
+	// The data's buffer is moved into the write buffer and sent by writev without copying
+	const CProtoHeader hdr = responseHeader(ctx, false, false);
+	WrSerializer prefix(BaseConnT::wrBuf_.get_chunk());
+	const size_t savePos = prefix.Len();
+	prefix.Write(std::string_view(reinterpret_cast<const char*>(&hdr), sizeof(hdr)));
+	prefix.PutVarUint(errOK);
+	prefix.PutVString(std::string_view());
+	prefix.PutVarUint(allArgs.size());
+	prefix.PutKeyValueType(KeyValueType::String{});
+	prefix.PutVarUint(dataView.size());
+	WrSerializer suffix(BaseConnT::wrBuf_.get_chunk());
+	for (const auto& arg : args) {
+		suffix.PutVariant(arg);
+	}
+	const size_t len = prefix.Len() - savePos + dataView.size() + suffix.Len();
+	checkRPCMessageSize(hdr, len);
+	reinterpret_cast<CProtoHeader*>(prefix.Buf() + savePos)->len = len - sizeof(hdr);
+
+	BaseConnT::wrBuf_.write(prefix.DetachChunk());
+	BaseConnT::wrBuf_.write(std::move(data));
+	BaseConnT::wrBuf_.write(suffix.DetachChunk());
+	if (BaseConnT::stats_) {
+		BaseConnT::stats_->update_send_buf_size(BaseConnT::wrBuf_.data_size());
+	}
+
+	if (dispatcher_.OnResponseRef()) {
+		ctx.stat.sizeStat.respSizeBytes = len;
+		dispatcher_.OnResponseRef()(ctx);
+	}
+
+	ctx.respSent = true;
+
+	if (dispatcher_.LoggerRef()) {
+		// 'dataView' is still valid: the chunk is owned by the write buffer and is not sent until the next write event
+		dispatcher_.LoggerRef()(ctx, Error(), allArgs);
+	}
+}
+
+Error ServerConnection::AddCompressionDict(std::string_view dict) noexcept {
+	try {
+		zstd_.AddDictionary(ZstdDictionary::Load(dict, kDefaultZstdCompressionLevel));
+	} catch (const Error& err) {
+		return err;
+	} catch (const std::exception& err) {
+		return Error(errLogic, err.what());
+	}
+	return {};
+}
+
 void ServerConnection::handleException(Context& ctx, const Error& err) noexcept {
 	// Exception occurs on unrecoverable error. Send response, and drop connection
 	fprintf(stderr, "reindexer error: dropping RPC-connection. Reason: %s\n", err.what());
@@ -346,7 +441,7 @@ void ServerConnection::sendUpdates() {
 		auto& upd = updates[cnt];
 		std::string_view updateData(upd);
 		args.emplace_back(p_string(&updateData), Variant::noHold);
-		packRPC(ser, ctx, Error(), args, enableSnappy_);
+		packRPC(ser, ctx, Error(), args, enableSnappy_, enableZstd_ ? &zstd_ : nullptr);
 
 		len += ser.Len();
 		BaseConnT::wrBuf_.write(ser.DetachChunk());
@@ -4,6 +4,7 @@
 #include "estl/mutex.h"
 #include "net/connection.h"
 #include "net/iserverconnection.h"
+#include "zstdcodec.h"
 
 namespace reindexer::net::cproto {
 
@@ -43,12 +44,14 @@ public:
 
 	// Writer iterface implementation
 	void WriteRPCReturn(Context& ctx, const Args& args, const Error& status) override { responseRPC(ctx, status, args); }
+	void WriteRPCReturn(Context& ctx, chunk&& data, const Args& args) override { responseRPC(ctx, std::move(data), args); }
 
 	void SetClientData(std::unique_ptr<ClientData>&& data) noexcept override { clientData_ = std::move(data); }
 	ClientData* GetClientData() noexcept override final { return clientData_.get(); }
 	std::shared_ptr<connection_stat> GetConnectionStat() noexcept override {
 		return BaseConnT::stats_ ? BaseConnT::stats_->get_stat() : std::shared_ptr<connection_stat>();
 	}
+	Error AddCompressionDict(std::string_view dict) noexcept override;
 	size_t AvailableEventsSpace() noexcept override {
 		int64_t available = int64_t(maxPendingUpdates_) - int64_t(BaseConnT::wrBuf_.size_atomic()) - int64_t(pendingUpdates());
 		return available > 0 ? size_t(available) : 0;
@@ -60,6 +63,7 @@ protected:
 	void onClose() override;
 	void handleRPC(Context& ctx);
 	void responseRPC(Context& ctx, const Error& error, const Args& args);
+	void responseRPC(Context& ctx, chunk&& data, const Args& args);
 	void handleException(Context& ctx, const Error& err) noexcept;
 	void sendUpdates();
 	void async_cb(ev::async&) { sendUpdates(); }
@@ -84,6 +88,8 @@ protected:
 	RPCCall call_ = {kCmdPing, 0, {}, std::chrono::milliseconds(0), lsn_t(), -1, ShardingKeyType::NotSetShard, false};
 
 	bool enableSnappy_ = false;
+	bool enableZstd_ = false;
+	ZstdCodec zstd_;
 	bool hasPendingData_ = false;
 	BalancingType balancingType_ = BalancingType::NotSet;
 	std::function<void(IServerConnection*, BalancingType)> rebalance_;
@@ -0,0 +1,180 @@
+#include "zstdcodec.h"
+#include <algorithm>
+#include <vector>
+#include "tools/assertrx.h"
+#include "tools/errors.h"
+
+#ifdef RX_WITH_ZSTD
+#include <zdict.h>
+#include <zstd.h>
+#endif	// RX_WITH_ZSTD
+
+namespace reindexer {
+namespace net {
+namespace cproto {
+
+using namespace std::string_view_literals;
+
+std::string_view CompressionCodecToStr(CompressionCodec codec) noexcept {
+	switch (codec) {
+		case CompressionCodec::Zstd:
+			return "zstd"sv;
+		case CompressionCodec::Snappy:
+		default:
+			return "snappy"sv;
+	}
+}
+
+CompressionCodec CompressionCodecFromStr(std::string_view str) {
+	if (str == "snappy"sv) {
+		return CompressionCodec::Snappy;
+	}
+	if (str == "zstd"sv) {
+		return CompressionCodec::Zstd;
+	}
+	throw Error(errParams, "Unknown compression codec '{}'. Expected 'snappy' or 'zstd'", str);
+}
+
+#ifdef RX_WITH_ZSTD
+
+// Upper bound for the size of the decompressed message
+constexpr static unsigned long long kMaxZstdFrameContentSize = 1ull << 31;
+
+bool ZstdCompressionAvailable() noexcept { return true; }
+
+ZstdDictionary::ZstdDictionary(std::string&& data, int level) : data_(std::move(data)) {
+	id_ = ZDICT_getDictID(data_.data(), data_.size());
+	if (id_ == 0) {
+		throw Error(errParams, "Data of the zstd dictionary does not contain dictionary ID");
+	}
+	cdict_ = ZSTD_createCDict(data_.data(), data_.size(), level);
+	ddict_ = ZSTD_createDDict(data_.data(), data_.size());
+	if (!cdict_ || !ddict_) {
+		ZSTD_freeCDict(cdict_);
+		ZSTD_freeDDict(ddict_);
+		throw Error(errParams, "Unable to create zstd dictionary {}", id_);
+	}
+}
+
+ZstdDictionary::~ZstdDictionary() {
+	ZSTD_freeCDict(cdict_);
+	ZSTD_freeDDict(ddict_);
+}
+
+std::shared_ptr<const ZstdDictionary> ZstdDictionary::Train(std::span<const std::string> samples, size_t dictSize, int level) {
+	std::string samplesBuffer;
+	std::vector<size_t> samplesSizes;
+	samplesSizes.reserve(samples.size());
+	for (const auto& s : samples) {
+		samplesBuffer.append(s);
+		samplesSizes.emplace_back(s.size());
+	}
+	std::string data(std::min(dictSize, kMaxZstdDictSize), '\0');
+	const size_t size =
+		ZDICT_trainFromBuffer(data.data(), data.size(), samplesBuffer.data(), samplesSizes.data(), unsigned(samplesSizes.size()));
+	if (ZDICT_isError(size)) {
+		throw Error(errParams, "Unable to train zstd dictionary on {} samples: {}", samples.size(), ZDICT_getErrorName(size));
+	}
+	data.resize(size);
+	return std::shared_ptr<const ZstdDictionary>(new ZstdDictionary(std::move(data), level));
+}
+
+std::shared_ptr<const ZstdDictionary> ZstdDictionary::Load(std::string_view data, int level) {
+	if (data.empty() || data.size() > kMaxZstdDictSize) {
+		throw Error(errParams, "Unexpected size of the zstd dictionary: {} bytes", data.size());
+	}
+	return std::shared_ptr<const ZstdDictionary>(new ZstdDictionary(std::string(data), level));
+}
+
+ZstdCodec::~ZstdCodec() {
+	ZSTD_freeCCtx(cctx_);
+	ZSTD_freeDCtx(dctx_);
+}
+
+void ZstdCodec::AddDictionary(std::shared_ptr<const ZstdDictionary> dict) {
+	assertrx_throw(dict);
+	for (auto& d : dicts_) {
+		if (d->ID() == dict->ID()) {
+			d = std::move(dict);
+			return;
+		}
+	}
+	if (dicts_.size() >= kMaxDictionaries) {
+		throw Error(errParams, "Too many zstd dictionaries for the single connection: {}", dicts_.size());
+	}
+	dicts_.emplace_back(std::move(dict));
+}
+
+void ZstdCodec::Compress(std::string_view src, std::string& dst, uint32_t dictId) {
+	if (!cctx_) {
+		cctx_ = ZSTD_createCCtx();
+		if (!cctx_) {
+			throw Error(errLogic, "Unable to create zstd compression context");
+		}
+	}
+	dst.resize(ZSTD_compressBound(src.size()));
+	const ZstdDictionary* dict = dictId ? findDictionary(dictId) : nullptr;
+	const size_t size = dict ? ZSTD_compress_usingCDict(cctx_, dst.data(), dst.size(), src.data(), src.size(), dict->cdict_)
+							 : ZSTD_compressCCtx(cctx_, dst.data(), dst.size(), src.data(), src.size(), level_);
+	if (ZSTD_isError(size)) {
+		throw Error(errLogic, "Unable to compress data with zstd: {}", ZSTD_getErrorName(size));
+	}
+	dst.resize(size);
+}
+
+void ZstdCodec::Decompress(std::string_view src, std::string& dst) {
+	const auto contentSize = ZSTD_getFrameContentSize(src.data(), src.size());
+	if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize > kMaxZstdFrameContentSize) {
+		throw Error(errParseBin, "Can't decompress data from peer: unexpected zstd frame");
+	}
+	if (!dctx_) {
+		dctx_ = ZSTD_createDCtx();
+		if (!dctx_) {
+			throw Error(errLogic, "Unable to create zstd decompression context");
+		}
+	}
+	const ZstdDictionary* dict = nullptr;
+	if (const uint32_t dictId = ZSTD_getDictID_fromFrame(src.data(), src.size()); dictId != 0) {
+		dict = findDictionary(dictId);
+		if (!dict) {
+			throw Error(errParseBin, "Can't decompress data from peer: unknown zstd dictionary {}", dictId);
+		}
+	}
+	dst.resize(contentSize);
+	const size_t size = dict ? ZSTD_decompress_usingDDict(dctx_, dst.data(), dst.size(), src.data(), src.size(), dict->ddict_)
+							 : ZSTD_decompressDCtx(dctx_, dst.data(), dst.size(), src.data(), src.size());
+	if (ZSTD_isError(size) || size != contentSize) {
+		throw Error(errParseBin, "Can't decompress data from peer");
+	}
+}
+
+#else  // RX_WITH_ZSTD
+
+static Error zstdIsNotAvailable() { return Error(errParams, "Reindexer was built without zstd support"); }
+
+bool ZstdCompressionAvailable() noexcept { return false; }
+
+ZstdDictionary::ZstdDictionary(std::string&&, int) { throw zstdIsNotAvailable(); }
+ZstdDictionary::~ZstdDictionary() = default;
+std::shared_ptr<const ZstdDictionary> ZstdDictionary::Train(std::span<const std::string>, size_t, int) { throw zstdIsNotAvailable(); }
+std::shared_ptr<const ZstdDictionary> ZstdDictionary::Load(std::string_view, int) { throw zstdIsNotAvailable(); }
+
+ZstdCodec::~ZstdCodec() = default;
+void ZstdCodec::AddDictionary(std::shared_ptr<const ZstdDictionary>) { throw zstdIsNotAvailable(); }
+void ZstdCodec::Compress(std::string_view, std::string&, uint32_t) { throw zstdIsNotAvailable(); }
+void ZstdCodec::Decompress(std::string_view, std::string&) { throw zstdIsNotAvailable(); }
+
+#endif	// RX_WITH_ZSTD
+
+const ZstdDictionary* ZstdCodec::findDictionary(uint32_t id) const noexcept {
+	for (const auto& d : dicts_) {
+		if (d->ID() == id) {
+			return d.get();
+		}
+	}
+	return nullptr;
+}
+
+}  // namespace cproto
+}  // namespace net
+}  // namespace reindexer
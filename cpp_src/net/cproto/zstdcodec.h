@@ -0,0 +1,128 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include "estl/h_vector.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace reindexer {
+namespace net {
+namespace cproto {
+
+enum class [[nodiscard]] CompressionCodec { Snappy, Zstd };
+std::string_view CompressionCodecToStr(CompressionCodec) noexcept;
+CompressionCodec CompressionCodecFromStr(std::string_view);
+
+constexpr int kDefaultZstdCompressionLevel = 3;
+constexpr size_t kDefaultZstdDictSize = 16 * 1024;
+constexpr size_t kMaxZstdDictSize = 1024 * 1024;
+
+// True, if reindexer was built with zstd
+bool ZstdCompressionAvailable() noexcept;
+
+// Traffic and time of the connection's compression (both of the codecs)
+struct [[nodiscard]] CompressionStats {
+	// 'dictId' is the ID of the zstd dictionary (or 0)
+	void OnCompressed(size_t rawSize, size_t compressedSize, std::chrono::microseconds time, CompressionCodec codec,
+					  uint32_t dictId) noexcept {
+		rawBytes += rawSize;
+		compressedBytes += compressedSize;
+		compressTimeUs += time.count();
+		if (codec == CompressionCodec::Zstd) {
+			zstdRawBytes += rawSize;
+			if (dictId) {
+				zstdDictRawBytes += rawSize;
+			}
+		}
+	}
+	void OnDecompressed(std::chrono::microseconds time) noexcept { decompressTimeUs += time.count(); }
+	double Ratio() const noexcept { return compressedBytes ? double(rawBytes) / double(compressedBytes) : 0.0; }
+	CompressionStats& operator+=(const CompressionStats& o) noexcept {
+		rawBytes += o.rawBytes;
+		compressedBytes += o.compressedBytes;
+		compressTimeUs += o.compressTimeUs;
+		decompressTimeUs += o.decompressTimeUs;
+		zstdRawBytes += o.zstdRawBytes;
+		zstdDictRawBytes += o.zstdDictRawBytes;
+		return *this;
+	}
+	bool operator==(const CompressionStats&) const noexcept = default;
+
+	uint64_t rawBytes = 0;
+	uint64_t compressedBytes = 0;
+	uint64_t compressTimeUs = 0;
+	uint64_t decompressTimeUs = 0;
+	// Parts of the raw data, compressed with zstd and with zstd dictionaries. The rest of the data was compressed with snappy
+	uint64_t zstdRawBytes = 0;
+	uint64_t zstdDictRawBytes = 0;
+};
+
+// Zstd dictionary, trained on the samples of the small and similar records (i.e. CJSON of the single namespace's items).
+// The dictionary ID is written into each of the frames, compressed with this dictionary, so the other side of the connection
+// chooses the dictionary for the decompression by this ID
+class [[nodiscard]] ZstdDictionary {
+public:
+	// Throws, if the dictionary can not be trained on these samples (i.e. there are too few of them)
+	static std::shared_ptr<const ZstdDictionary> Train(std::span<const std::string> samples, size_t dictSize, int level);
+	// Loads the dictionary, received from the other side of the connection
+	static std::shared_ptr<const ZstdDictionary> Load(std::string_view data, int level);
+
+	ZstdDictionary(const ZstdDictionary&) = delete;
+	ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+	~ZstdDictionary();
+
+	uint32_t ID() const noexcept { return id_; }
+	std::string_view Data() const noexcept { return data_; }
+
+private:
+	friend class ZstdCodec;
+	ZstdDictionary(std::string&& data, int level);
+
+	std::string data_;
+	uint32_t id_ = 0;
+	ZSTD_CDict_s* cdict_ = nullptr;
+	ZSTD_DDict_s* ddict_ = nullptr;
+};
+
+// Zstd compression of the cproto messages. Reuses the compression contexts between the messages and keeps the dictionaries,
+// which are known to the both sides of the connection
+class [[nodiscard]] ZstdCodec {
+public:
+	// Limit for the dictionaries count, received by the single connection
+	constexpr static size_t kMaxDictionaries = 64;
+
+	explicit ZstdCodec(int level = kDefaultZstdCompressionLevel) noexcept : level_(level) {}
+	ZstdCodec(const ZstdCodec&) = delete;
+	ZstdCodec& operator=(const ZstdCodec&) = delete;
+	~ZstdCodec();
+
+	void SetLevel(int level) noexcept { level_ = level; }
+	// Dictionary with the same ID replaces the previous one
+	void AddDictionary(std::shared_ptr<const ZstdDictionary>);
+	bool HasDictionary(uint32_t id) const noexcept { return findDictionary(id) != nullptr; }
+	void ClearDictionaries() noexcept { dicts_.clear(); }
+
+	// 'dictId' == 0 (or unknown ID) means compression without dictionary
+	void Compress(std::string_view src, std::string& dst, uint32_t dictId = 0);
+	// Throws errParseBin on the broken data or unknown dictionary
+	void Decompress(std::string_view src, std::string& dst);
+
+private:
+	const ZstdDictionary* findDictionary(uint32_t id) const noexcept;
+
+	int level_;
+	ZSTD_CCtx_s* cctx_ = nullptr;
+	ZSTD_DCtx_s* dctx_ = nullptr;
+	h_vector<std::shared_ptr<const ZstdDictionary>, 2> dicts_;
+};
+
+}  // namespace cproto
+}  // namespace net
+}  // namespace reindexer
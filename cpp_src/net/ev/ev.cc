@@ -19,6 +19,12 @@
 #ifdef HAVE_EPOLL_LOOP
 #include <sys/epoll.h>
 #endif
+#ifdef HAVE_URING_LOOP
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 
 namespace reindexer {
 namespace net {
@@ -359,6 +365,288 @@ int loop_epoll_backend::runonce(int64_t t) {
 
 #endif
 
+#ifdef HAVE_URING_LOOP
+
+// Poll requests are one-shot: each completion disarms the request and it is rearmed after the callback, if fd is still watched.
+// Requests' user_data contains fd and its generation, so the completions of the removed/replaced requests are skipped
+class [[nodiscard]] loop_uring_backend_private {
+public:
+	struct [[nodiscard]] fd_state {
+		uint32_t gen = 0;
+		int events = 0;
+		bool armed = false;
+	};
+
+	// 256 entries require less than 64KB of the locked memory (default RLIMIT_MEMLOCK for the old kernels)
+	static constexpr unsigned kEntries = 256;
+	static constexpr uint64_t kTimeoutUserData = ~uint64_t(0);
+	static constexpr uint64_t kRemoveUserData = ~uint64_t(0) - 1;
+
+	loop_uring_backend_private() = default;
+	loop_uring_backend_private(const loop_uring_backend_private&) = delete;
+	~loop_uring_backend_private() {
+		if (sqes_ != MAP_FAILED) {
+			munmap(sqes_, sqesSize_);
+		}
+		if (ring_ != MAP_FAILED) {
+			munmap(ring_, ringSize_);
+		}
+		if (ringfd_ >= 0) {
+			close(ringfd_);
+		}
+	}
+
+	bool init() noexcept {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ringfd_ = syscall(__NR_io_uring_setup, kEntries, &params);
+		if (ringfd_ < 0) {
+			return false;
+		}
+		// NODROP (5.5+) also guarantees support of the POLL_ADD, POLL_REMOVE and TIMEOUT with completions count
+		if (!(params.features & IORING_FEAT_NODROP) || !(params.features & IORING_FEAT_SINGLE_MMAP)) {
+			return false;
+		}
+		ringSize_ = std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+							 params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+		ring_ = mmap(nullptr, ringSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringfd_, IORING_OFF_SQ_RING);
+		if (ring_ == MAP_FAILED) {
+			return false;
+		}
+		sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+		sqes_ = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringfd_, IORING_OFF_SQES);
+		if (sqes_ == MAP_FAILED) {
+			return false;
+		}
+		char* base = static_cast<char*>(ring_);
+		sqHead_ = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+		sqTail_ = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+		sqFlags_ = reinterpret_cast<unsigned*>(base + params.sq_off.flags);
+		sqArray_ = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+		sqMask_ = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+		sqEntries_ = params.sq_entries;
+		cqHead_ = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+		cqTail_ = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+		cqMask_ = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+		cqes_ = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+		return true;
+	}
+
+	// Requests are only queued here. Submission is performed by the runonce() call (or by the ring overflow)
+	io_uring_sqe* get_sqe() {
+		const unsigned tail = std::atomic_ref(*sqTail_).load(std::memory_order_relaxed);
+		if (tail - std::atomic_ref(*sqHead_).load(std::memory_order_acquire) >= sqEntries_) {
+			if (enter(0, 0) < 0 || tail - std::atomic_ref(*sqHead_).load(std::memory_order_acquire) >= sqEntries_) {
+				perror("io_uring submission queue overflow");
+				return nullptr;
+			}
+		}
+		const unsigned idx = tail & sqMask_;
+		sqArray_[idx] = idx;
+		io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + idx;
+		memset(sqe, 0, sizeof(*sqe));
+		std::atomic_ref(*sqTail_).store(tail + 1, std::memory_order_release);
+		++toSubmit_;
+		return sqe;
+	}
+
+	int enter(unsigned minComplete, unsigned flags) noexcept {
+		const int ret = syscall(__NR_io_uring_enter, ringfd_, toSubmit_, minComplete, flags, nullptr, 0);
+		if (ret > 0) {
+			toSubmit_ -= std::min(unsigned(ret), toSubmit_);
+		}
+		return ret;
+	}
+
+	bool has_completions() const noexcept {
+		return std::atomic_ref(*cqHead_).load(std::memory_order_relaxed) != std::atomic_ref(*cqTail_).load(std::memory_order_acquire);
+	}
+	bool has_overflow() const noexcept { return std::atomic_ref(*sqFlags_).load(std::memory_order_relaxed) & IORING_SQ_CQ_OVERFLOW; }
+
+	void reap() {
+		unsigned head = std::atomic_ref(*cqHead_).load(std::memory_order_relaxed);
+		const unsigned tail = std::atomic_ref(*cqTail_).load(std::memory_order_acquire);
+		completions_.clear();
+		for (; head != tail; ++head) {
+			completions_.emplace_back(cqes_[head & cqMask_]);
+		}
+		std::atomic_ref(*cqHead_).store(head, std::memory_order_release);
+	}
+
+	void arm(int fd) {
+		fd_state& st = fds_[fd];
+		io_uring_sqe* sqe = get_sqe();
+		if (!sqe) {
+			return;
+		}
+		sqe->opcode = IORING_OP_POLL_ADD;
+		sqe->fd = fd;
+		// Poll masks fit into the compatible 16-bit field, so the layout is valid for both old and new kernels (little endian only)
+		sqe->poll_events = ((st.events & READ) ? (POLLIN | POLLRDHUP) : 0) | ((st.events & WRITE) ? POLLOUT : 0);
+		sqe->user_data = user_data(fd, st.gen);
+		st.armed = true;
+	}
+	void disarm(int fd) {
+		fd_state& st = fds_[fd];
+		if (io_uring_sqe* sqe = get_sqe(); sqe) {
+			sqe->opcode = IORING_OP_POLL_REMOVE;
+			sqe->fd = -1;
+			sqe->addr = user_data(fd, st.gen);
+			sqe->user_data = kRemoveUserData;
+		}
+		++st.gen;
+		st.armed = false;
+	}
+	void add_timeout(int64_t t) {
+		// Timeout is completed either by the time or by the first completion of any other request, so there is only one timeout
+		// in the ring at the same time. Timespec is copied by the kernel during submission
+		ts_.tv_sec = t / 1000000;
+		ts_.tv_nsec = (t % 1000000) * 1000;
+		if (io_uring_sqe* sqe = get_sqe(); sqe) {
+			sqe->opcode = IORING_OP_TIMEOUT;
+			sqe->fd = -1;
+			sqe->addr = reinterpret_cast<uintptr_t>(&ts_);
+			sqe->len = 1;
+			sqe->off = 1;
+			sqe->user_data = kTimeoutUserData;
+		}
+	}
+
+	static uint64_t user_data(int fd, uint32_t gen) noexcept { return (uint64_t(gen) << 32) | uint32_t(fd); }
+
+	int ringfd_ = -1;
+	void* ring_ = MAP_FAILED;
+	size_t ringSize_ = 0;
+	void* sqes_ = MAP_FAILED;
+	size_t sqesSize_ = 0;
+	unsigned* sqHead_ = nullptr;
+	unsigned* sqTail_ = nullptr;
+	unsigned* sqFlags_ = nullptr;
+	unsigned* sqArray_ = nullptr;
+	unsigned sqMask_ = 0;
+	unsigned sqEntries_ = 0;
+	unsigned toSubmit_ = 0;
+	unsigned* cqHead_ = nullptr;
+	unsigned* cqTail_ = nullptr;
+	unsigned cqMask_ = 0;
+	io_uring_cqe* cqes_ = nullptr;
+	std::vector<fd_state> fds_;
+	std::vector<io_uring_cqe> completions_;
+	__kernel_timespec ts_;
+};
+
+bool uring_supported() noexcept {
+	static const bool supported = [] {
+		loop_uring_backend_private probe;
+		return probe.init();
+	}();
+	return supported;
+}
+
+loop_uring_backend::loop_uring_backend() = default;
+loop_uring_backend::~loop_uring_backend() = default;
+
+void loop_uring_backend::init(dynamic_loop* owner, loop_backend type) {
+	if (type == loop_backend::uring && uring_supported()) {
+		auto uring = std::make_unique<loop_uring_backend_private>();
+		if (uring->init()) {
+			owner_ = owner;
+			uring->fds_.reserve(2048);
+			uring->completions_.reserve(loop_uring_backend_private::kEntries);
+			uring_ = std::move(uring);
+			return;
+		}
+	}
+	loop_epoll_backend::init(owner);
+}
+
+void loop_uring_backend::set(int fd, int events, int oldevents) {
+	if (!uring_) {
+		loop_epoll_backend::set(fd, events, oldevents);
+		return;
+	}
+	auto& fds = uring_->fds_;
+	fds.resize(std::max(fds.size(), size_t(fd + 1)));
+	if (fds[fd].armed) {
+		if (fds[fd].events == events) {
+			return;
+		}
+		uring_->disarm(fd);
+	}
+	fds[fd].events = events;
+	uring_->arm(fd);
+}
+
+void loop_uring_backend::stop(int fd) {
+	if (!uring_) {
+		loop_epoll_backend::stop(fd);
+		return;
+	}
+	if (size_t(fd) >= uring_->fds_.size()) {
+		return;
+	}
+	if (uring_->fds_[fd].armed) {
+		uring_->disarm(fd);
+	}
+	uring_->fds_[fd].events = 0;
+}
+
+int loop_uring_backend::runonce(int64_t t) {
+	if (!uring_) {
+		return loop_epoll_backend::runonce(t);
+	}
+	auto& ring = *uring_;
+	unsigned minComplete = 0;
+	if (t != 0 && !ring.has_completions()) {
+		minComplete = 1;
+		if (t > 0) {
+			ring.add_timeout(t);
+		}
+	}
+	// All the requests, queued since the previous iteration, are submitted with the single syscall
+	if (ring.toSubmit_ || minComplete || ring.has_overflow()) {
+		const int ret = ring.enter(minComplete, (minComplete || ring.has_overflow()) ? IORING_ENTER_GETEVENTS : 0);
+		if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY && errno != ETIME) {
+			perror("io_uring_enter error");
+			return ret;
+		}
+	}
+
+	ring.reap();
+	int ret = 0;
+	for (const auto& cqe : ring.completions_) {
+		if (cqe.user_data == loop_uring_backend_private::kTimeoutUserData || cqe.user_data == loop_uring_backend_private::kRemoveUserData) {
+			continue;
+		}
+		const int fd = int(uint32_t(cqe.user_data));
+		const uint32_t gen = cqe.user_data >> 32;
+		if (size_t(fd) >= ring.fds_.size() || ring.fds_[fd].gen != gen || !ring.fds_[fd].armed) {
+			// Request was removed or replaced
+			continue;
+		}
+		ring.fds_[fd].armed = false;
+		int events = READ | WRITE;
+		if (cqe.res >= 0) {
+			const unsigned revents = unsigned(cqe.res);
+			events = ((revents & (POLLIN | POLLHUP | POLLRDHUP | POLLERR)) ? READ : 0) | ((revents & (POLLOUT | POLLERR)) ? WRITE : 0);
+		}
+		++ret;
+		if (!check_async(fd)) {
+			owner_->io_callback(fd, events);
+		}
+		// Watcher may be modified or stopped from the callback. Failed request is not rearmed until the next set() call
+		auto& st = ring.fds_[fd];
+		if (cqe.res >= 0 && st.gen == gen && st.events && !st.armed) {
+			ring.arm(fd);
+		}
+	}
+	return ret;
+}
+
+#else	// HAVE_URING_LOOP
+bool uring_supported() noexcept { return false; }
+#endif	// HAVE_URING_LOOP
+
 #ifdef HAVE_WSA_LOOP
 struct [[nodiscard]] win_fd {
 	HANDLE hEvent = INVALID_HANDLE_VALUE;
@@ -481,9 +769,22 @@ static void net_ev_sighandler(int signum) {
 #endif
 }
 
-dynamic_loop::dynamic_loop() : async_sent_(false) {
+dynamic_loop::dynamic_loop(loop_backend backend) : async_sent_(false) {
 	fds_.reserve(2048);
+#ifdef HAVE_URING_LOOP
+	backend_.init(this, backend);
+#else
+	(void)backend;
 	backend_.init(this);
+#endif
+}
+
+loop_backend dynamic_loop::backend() const noexcept {
+#ifdef HAVE_URING_LOOP
+	return backend_.type();
+#else
+	return loop_backend::native;
+#endif
 }
 
 dynamic_loop::~dynamic_loop() {
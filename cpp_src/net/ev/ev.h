@@ -23,6 +23,9 @@
 #ifdef __linux__
 #define HAVE_EPOLL_LOOP 1
 #define HAVE_EVENT_FD 1
+#if __has_include(<linux/io_uring.h>) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define HAVE_URING_LOOP 1
+#endif
 #elif defined(__APPLE__) || (defined __unix__)
 #define HAVE_POLL_LOOP 1
 #endif
@@ -38,6 +41,19 @@ const int ERROR = 0x08;
 
 class dynamic_loop;
 
+/// IO multiplexing backend of the loop
+enum class [[nodiscard]] loop_backend {
+	/// Default backend of the platform: epoll, poll, select or WSA
+	native,
+	/// One-shot io_uring poll requests, which are submitted in batches once per loop iteration.
+	/// Replaces epoll only: sockets are still read and written by recv/send, so it is not expected to be faster than the native backend.
+	/// Falls back to the native backend, if io_uring is not supported by the kernel (or disabled by seccomp/sysctl)
+	uring,
+};
+
+/// @return true, if io_uring loop backend may be used on this system
+bool uring_supported() noexcept;
+
 #ifdef HAVE_POSIX_LOOP
 #ifdef HAVE_EVENT_FD
 class [[nodiscard]] loop_posix_base {
@@ -117,6 +133,23 @@ protected:
 };
 #endif
 
+#ifdef HAVE_URING_LOOP
+class loop_uring_backend_private;
+class [[nodiscard]] loop_uring_backend : public loop_epoll_backend {
+public:
+	loop_uring_backend();
+	~loop_uring_backend();
+	void init(dynamic_loop* owner, loop_backend type);
+	void set(int fd, int events, int oldevents);
+	void stop(int fd);
+	int runonce(int64_t tv);
+	loop_backend type() const noexcept { return uring_ ? loop_backend::uring : loop_backend::native; }
+
+protected:
+	std::unique_ptr<loop_uring_backend_private> uring_;
+};
+#endif
+
 #ifdef HAVE_WSA_LOOP
 class loop_wsa_backend_private;
 class [[nodiscard]] loop_wsa_backend {
@@ -145,15 +178,18 @@ class sig;
 class [[nodiscard]] dynamic_loop {
 	friend class loop_ref;
 	friend class loop_epoll_backend;
+	friend class loop_uring_backend;
 	friend class loop_poll_backend;
 	friend class loop_select_backend;
 	friend class loop_wsa_backend;
 	friend class loop_posix_base;
 
 public:
-	dynamic_loop();
+	explicit dynamic_loop(loop_backend backend = loop_backend::native);
 	~dynamic_loop();
 	void run();
+	/// @return actual IO backend of the loop (may differ from the requested one)
+	loop_backend backend() const noexcept;
 	void break_loop() noexcept { break_ = true; }
 	void spawn(std::function<void()> func, size_t stack_size = coroutine::k_default_stack_limit);
 	void spawn(coroutine::wait_group& wg, std::function<void()> func, size_t stack_size = coroutine::k_default_stack_limit);
@@ -209,7 +245,9 @@ protected:
 	h_vector<coroutine::routine_t, 5> yielded_tasks_;
 	std::thread::id coroTid_;
 
-#ifdef HAVE_EPOLL_LOOP
+#ifdef HAVE_URING_LOOP
+	loop_uring_backend backend_;
+#elif defined(HAVE_EPOLL_LOOP)
 	loop_epoll_backend backend_;
 #elif defined(HAVE_POLL_LOOP)
 	loop_poll_backend backend_;
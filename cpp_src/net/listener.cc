@@ -43,11 +43,20 @@ Listener<LT>::Listener(ev::dynamic_loop& loop, std::shared_ptr<Shared> shared)
 	shared_->sharedListenersCount_.fetch_add(1, std::memory_order_release);
 }
 
+static ev::loop_backend checked_backend(ev::loop_backend backend) {
+	if (backend == ev::loop_backend::uring && !ev::uring_supported()) {
+		logFmt(LogWarning, "io_uring loop backend is not supported by the system. Native backend will be used instead");
+		return ev::loop_backend::native;
+	}
+	return backend;
+}
+
 template <ListenerType LT>
-Listener<LT>::Listener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr sslCtx, int maxListeners)
+Listener<LT>::Listener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr sslCtx, ev::loop_backend backend,
+					   int maxListeners)
 	: Listener(loop,
 			   std::make_shared<Shared>(std::move(connFactory), (maxListeners ? maxListeners : (double(hardware_concurrency()) * 1.2)) + 1,
-										std::move(sslCtx))) {}
+										std::move(sslCtx), checked_backend(backend))) {}
 
 template <ListenerType LT>
 Listener<LT>::~Listener() {
@@ -464,7 +473,7 @@ void Listener<LT>::reserve_stack() noexcept {
 
 template <ListenerType LT>
 Listener<LT>::Shared::Worker::Worker(std::shared_ptr<Shared> shared, std::unique_ptr<IServerConnection> conn)
-	: conn_{std::move(conn)}, shared_{std::move(shared)} {
+	: loop_(shared->backend_), conn_{std::move(conn)}, shared_{std::move(shared)} {
 	assertrx(shared_);
 	assertrx(conn_);
 
@@ -508,8 +517,12 @@ void Listener<LT>::Shared::Worker::Run() {
 }
 
 template <ListenerType LT>
-Listener<LT>::Shared::Shared(ConnectionFactory&& connFactory, int maxListeners, openssl::SslCtxPtr SslCtx)
-	: sslCtx_(std::move(SslCtx)), maxListeners_(maxListeners), connFactory_(std::move(connFactory)), terminating_(false) {}
+Listener<LT>::Shared::Shared(ConnectionFactory&& connFactory, int maxListeners, openssl::SslCtxPtr SslCtx, ev::loop_backend backend)
+	: sslCtx_(std::move(SslCtx)),
+	  backend_(backend),
+	  maxListeners_(maxListeners),
+	  connFactory_(std::move(connFactory)),
+	  terminating_(false) {}
 
 template <ListenerType LT>
 Listener<LT>::Shared::~Shared() {
@@ -518,8 +531,9 @@ Listener<LT>::Shared::~Shared() {
 	}
 }
 
-ForkedListener::ForkedListener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr sslCtx)
-	: sslCtx_(std::move(sslCtx)), connFactory_(std::move(connFactory)), loop_(loop) {
+ForkedListener::ForkedListener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr sslCtx,
+							   ev::loop_backend backend)
+	: sslCtx_(std::move(sslCtx)), backend_(checked_backend(backend)), connFactory_(std::move(connFactory)), loop_(loop) {
 	io_.set<ForkedListener, &ForkedListener::io_accept>(this);
 	io_.set(loop);
 	async_.set<ForkedListener, &ForkedListener::async_cb>(this);
@@ -586,7 +600,7 @@ void ForkedListener::io_accept(ev::io& /*watcher*/, int revents) {
 				reindexer_server::pprof::ProfilerRegisterThread();
 			}
 #endif
-			ev::dynamic_loop loop;
+			ev::dynamic_loop loop(backend_);
 			ev::async async;
 			async.set([](ev::async& a) { a.loop.break_loop(); });
 			async.set(loop);
@@ -63,8 +63,10 @@ public:
 	/// Constructs new listener object.
 	/// @param loop - ev::loop of caller's thread, listener's socket will be bound to that loop.
 	/// @param connFactory - Connection factory, will create objects with IServerConnection interface implementation.
+	/// @param backend - IO backend for the listener's own threads' loops
 	/// @param maxListeners - Maximum number of threads, which listener will utilize. std::thread::hardware_concurrency() by default
-	Listener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr SslCtx, int maxListeners = 0);
+	Listener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr SslCtx,
+			 ev::loop_backend backend = ev::loop_backend::native, int maxListeners = 0);
 	~Listener() override;
 	Listener(const Listener&) = delete;
 	Listener(Listener&&) = delete;
@@ -105,9 +107,10 @@ private:
 			std::shared_ptr<Shared> shared_;
 		};
 
-		Shared(ConnectionFactory&& connFactory, int maxListeners, openssl::SslCtxPtr SslCtx);
+		Shared(ConnectionFactory&& connFactory, int maxListeners, openssl::SslCtxPtr SslCtx, ev::loop_backend backend);
 		~Shared();
 		openssl::SslCtxPtr sslCtx_;
+		const ev::loop_backend backend_;
 		lst_socket sock_;
 		const int maxListeners_;
 		std::atomic<int> sharedListenersCount_{0};
@@ -123,7 +126,10 @@ private:
 	};
 	class [[nodiscard]] ListeningThreadData {
 	public:
-		ListeningThreadData(std::shared_ptr<Shared> shared) : listener_(loop_, shared), shared_(std::move(shared)) { assertrx(shared_); }
+		ListeningThreadData(std::shared_ptr<Shared> shared)
+			: loop_(shared->backend_), listener_(loop_, shared), shared_(std::move(shared)) {
+			assertrx(shared_);
+		}
 
 		void Loop() {
 			if constexpr (LT == ListenerType::Shared) {
@@ -161,7 +167,9 @@ public:
 	/// Constructs new listener object.
 	/// @param loop - ev::loop of caller's thread, listener's socket will be bound to that loop.
 	/// @param connFactory - Connection factory, will create objects with IServerConnection interface implementation.
-	ForkedListener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr SslCtx);
+	/// @param backend - IO backend for the dedicated connections' threads loops
+	ForkedListener(ev::dynamic_loop& loop, ConnectionFactory&& connFactory, openssl::SslCtxPtr SslCtx,
+				   ev::loop_backend backend = ev::loop_backend::native);
 	~ForkedListener() override;
 	/// Bind listener to specified host:port
 	/// @param addr - tcp host:port for bind or file path for the unix domain socket
@@ -190,6 +198,7 @@ protected:
 	};
 
 	openssl::SslCtxPtr sslCtx_;
+	const ev::loop_backend backend_;
 	lst_socket sock_;
 	mutex mtx_;
 	ConnectionFactory connFactory_;
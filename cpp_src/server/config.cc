@@ -21,6 +21,8 @@ void ServerConfig::Reset() {
 	RPCThreadingMode = kSharedThreading;
 	RPCUnixThreadingMode = kSharedThreading;
 	HttpThreadingMode = kSharedThreading;
+	RPCIOBackend = kNativeIOBackend;
+	HttpIOBackend = kNativeIOBackend;
 	LogLevel = "info";
 	ServerLog = "stdout";
 	CoreLog = "stdout";
@@ -39,6 +41,7 @@ void ServerConfig::Reset() {
 	SvcMode = false;
 #endif
 	StartWithErrors = false;
+	StorageSyncInterval = std::chrono::milliseconds(100);
 	EnableSecurity = false;
 	DebugPprof = false;
 	EnablePrometheus = false;
@@ -106,6 +109,8 @@ Error ServerConfig::ParseCmd(int argc, char* argv[]) {
 	}
 	args::ValueFlag<std::string> storageEngineF(dbGroup, "NAME", "'reindexer' storage engine (" + availabledStorages + ")", {'e', "engine"},
 												StorageEngine, args::Options::Single);
+	args::ValueFlag<int> storageSyncIntervalF(dbGroup, "", "WAL sync interval (ms) for 'rocksdb_shared' engine (0 - on flush only)",
+											  {"storage-sync-interval"}, StorageSyncInterval.count(), args::Options::Single);
 	args::Flag autorepairF(dbGroup, "", "Deprecated. Does nothing", {"autorepair"});
 	args::Flag disableNamespaceLeakF(dbGroup, "", "Disable namespaces leak on database destruction (may slow down server's termination)",
 									 {"disable-ns-leak"});
@@ -130,6 +135,14 @@ Error ServerConfig::ParseCmd(int argc, char* argv[]) {
 													{"http-threading"}, HttpThreadingMode, args::Options::Single);
 	args::ValueFlag<std::string> rpcThreadingModeF(netGroup, "RTHREADING", "RPC connections threading mode: shared or dedicated",
 												   {'X', "rpc-threading"}, RPCThreadingMode, args::Options::Single);
+	args::ValueFlag<std::string> httpIOBackendF(
+		netGroup, "HIOBACKEND",
+		"IO backend for the HTTP connections threads: native or io_uring (Linux only, replaces epoll and is not expected to be faster)",
+		{"http-io-backend"}, HttpIOBackend, args::Options::Single);
+	args::ValueFlag<std::string> rpcIOBackendF(
+		netGroup, "RIOBACKEND",
+		"IO backend for the RPC connections threads: native or io_uring (Linux only, replaces epoll and is not expected to be faster)",
+		{"rpc-io-backend"}, RPCIOBackend, args::Options::Single);
 #ifndef _WIN32
 	args::ValueFlag<std::string> rpcUnixThreadingModeF(netGroup, "URTHREADING",
 													   "RPC connections threading mode: shared or dedicated (unix domain socket)",
@@ -239,6 +252,9 @@ Error ServerConfig::ParseCmd(int argc, char* argv[]) {
 	if (startWithErrorsF) {
 		StartWithErrors = args::get(startWithErrorsF);
 	}
+	if (storageSyncIntervalF) {
+		StorageSyncInterval = std::chrono::milliseconds(args::get(storageSyncIntervalF));
+	}
 	if (disableNamespaceLeakF) {
 		AllowNamespaceLeak = !args::get(disableNamespaceLeakF);
 	}
@@ -264,6 +280,12 @@ Error ServerConfig::ParseCmd(int argc, char* argv[]) {
 	if (httpThreadingModeF) {
 		HttpThreadingMode = args::get(httpThreadingModeF);
 	}
+	if (rpcIOBackendF) {
+		RPCIOBackend = args::get(rpcIOBackendF);
+	}
+	if (httpIOBackendF) {
+		HttpIOBackend = args::get(httpIOBackendF);
+	}
 	if (webRootF) {
 		WebRoot = args::get(webRootF);
 	}
@@ -384,6 +406,7 @@ reindexer::Error ServerConfig::fromYaml(YAML::Node& root) {
 		StoragePath = root["storage"]["path"].as<std::string>(StoragePath);
 		StorageEngine = root["storage"]["engine"].as<std::string>(StorageEngine);
 		StartWithErrors = root["storage"]["startwitherrors"].as<bool>(StartWithErrors);
+		StorageSyncInterval = std::chrono::milliseconds(root["storage"]["sync_interval_ms"].as<int>(StorageSyncInterval.count()));
 		LogLevel = root["logger"]["loglevel"].as<std::string>(LogLevel);
 		ServerLog = root["logger"]["serverlog"].as<std::string>(ServerLog);
 		CoreLog = root["logger"]["corelog"].as<std::string>(CoreLog);
@@ -397,6 +420,8 @@ reindexer::Error ServerConfig::fromYaml(YAML::Node& root) {
 		RPCsAddr = root["net"]["rpcsaddr"].as<std::string>(RPCsAddr);
 		RPCThreadingMode = root["net"]["rpc_threading"].as<std::string>(RPCThreadingMode);
 		HttpThreadingMode = root["net"]["http_threading"].as<std::string>(HttpThreadingMode);
+		RPCIOBackend = root["net"]["rpc_io_backend"].as<std::string>(RPCIOBackend);
+		HttpIOBackend = root["net"]["http_io_backend"].as<std::string>(HttpIOBackend);
 		WebRoot = root["net"]["webroot"].as<std::string>(WebRoot);
 		if (root["net"]["max_updates_size"].IsDefined()) {
 			MaxUpdatesSize = root["net"]["max_updates_size"].as<size_t>(MaxUpdatesSize);
@@ -46,6 +46,8 @@ struct [[nodiscard]] ServerConfig {
 	std::string RPCThreadingMode;
 	std::string RPCUnixThreadingMode;
 	std::string HttpThreadingMode;
+	std::string RPCIOBackend;
+	std::string HttpIOBackend;
 	std::string LogLevel;
 	std::string ServerLog;
 	std::string CoreLog;
@@ -55,6 +57,7 @@ struct [[nodiscard]] ServerConfig {
 	std::string SslCertPath;
 	std::string SslKeyPath;
 	bool StartWithErrors;
+	std::chrono::milliseconds StorageSyncInterval;
 	bool AllowNamespaceLeak;
 #ifndef _WIN32
 	std::string UserName;
@@ -84,6 +87,8 @@ struct [[nodiscard]] ServerConfig {
 
 	constexpr static std::string_view kDedicatedThreading = "dedicated";
 	constexpr static std::string_view kSharedThreading = "shared";
+	constexpr static std::string_view kNativeIOBackend = "native";
+	constexpr static std::string_view kUringIOBackend = "io_uring";
 
 	void SetHttpWriteTimeout(std::chrono::seconds val) noexcept;
 	std::chrono::seconds HttpWriteTimeout() const noexcept {
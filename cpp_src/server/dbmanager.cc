@@ -124,7 +124,11 @@ Error DBManager::loadOrCreateDatabase(const std::string& dbName, bool allowDBErr
 
 	logFmt(LogInfo, "Loading database {}", dbName);
 	auto db = std::make_unique<reindexer::Reindexer>(
-		reindexer::ReindexerConfig().WithClientStats(clientsStats_).WithUpdatesSize(config_.MaxUpdatesSize).WithDBName(dbName));
+		reindexer::ReindexerConfig()
+			.WithClientStats(clientsStats_)
+			.WithUpdatesSize(config_.MaxUpdatesSize)
+			.WithDBName(dbName)
+			.WithStorageSyncInterval(config_.StorageSyncInterval));
 	StorageTypeOpt storageType = kStorageTypeOptLevelDB;
 	switch (storageType_) {
 		case datastorage::StorageType::LevelDB:
@@ -133,6 +137,9 @@ Error DBManager::loadOrCreateDatabase(const std::string& dbName, bool allowDBErr
 		case datastorage::StorageType::RocksDB:
 			storageType = kStorageTypeOptRocksDB;
 			break;
+		case datastorage::StorageType::RocksDBShared:
+			storageType = kStorageTypeOptRocksDBShared;
+			break;
 	}
 	auto opts = ConnectOpts().AllowNamespaceErrors(allowDBErrors).WithStorageType(storageType);
 	if (auth.checkClusterID_) {
@@ -1179,12 +1179,14 @@ void HTTPServer::Start(const std::string& addr, ev::dynamic_loop& loop) {
 
 	auto sslCtx =
 		serverConfig_.HTTPsAddr == addr ? openssl::create_server_context(serverConfig_.SslCertPath, serverConfig_.SslKeyPath) : nullptr;
+	const auto ioBackend =
+		(serverConfig_.HttpIOBackend == ServerConfig::kUringIOBackend) ? ev::loop_backend::uring : ev::loop_backend::native;
 	if (serverConfig_.HttpThreadingMode == ServerConfig::kDedicatedThreading) {
 		listener_ = std::make_unique<ForkedListener>(loop, http::ServerConnection::NewFactory(router_, serverConfig_.MaxHttpReqSize),
-													 std::move(sslCtx));
+													 std::move(sslCtx), ioBackend);
 	} else {
 		listener_ = std::make_unique<Listener<ListenerType::Shared>>(
-			loop, http::ServerConnection::NewFactory(router_, serverConfig_.MaxHttpReqSize), std::move(sslCtx));
+			loop, http::ServerConnection::NewFactory(router_, serverConfig_.MaxHttpReqSize), std::move(sslCtx), ioBackend);
 	}
 	deadlineChecker_.set<HTTPServer, &HTTPServer::deadlineTimerCb>(this);
 	deadlineChecker_.set(loop);
@@ -6,6 +6,7 @@
 #include "core/cjson/jsonbuilder.h"
 #include "core/iclientsstats.h"
 #include "core/id_type.h"
+#include "core/namespace/datahashtree.h"
 #include "core/namespace/namespacestat.h"
 #include "core/namespace/snapshot/snapshot.h"
 #include "core/query/sql/sql_suggestions.h"
@@ -106,7 +107,8 @@ Error RPCServer::Login(cproto::Context& ctx, p_string login, p_string password,
 	if (status.ok()) {
 		const int64_t startTs = std::chrono::duration_cast<std::chrono::seconds>(startTs_.time_since_epoch()).count();
 		constexpr std::string_view version = REINDEX_VERSION;
-		ctx.Return({cproto::Arg(p_string(&version)), cproto::Arg(startTs)}, status);
+		const int64_t serverCaps = cproto::ZstdCompressionAvailable() ? cproto::kCprotoServerCapabilityZstd : 0;
+		ctx.Return({cproto::Arg(p_string(&version)), cproto::Arg(startTs), cproto::Arg(serverCaps)}, status);
 	} else {
 		std::cerr << status.what() << std::endl;
 	}
@@ -402,6 +404,8 @@ Error RPCServer::GetSchema(cproto::Context& ctx, p_string ns, int format) {
 	return errOK;
 }
 
+Error RPCServer::SetCompressionDict(cproto::Context& ctx, p_string dict) { return ctx.writer->AddCompressionDict(std::string_view(dict)); }
+
 Error RPCServer::StartTransaction(cproto::Context& ctx, p_string nsName) {
 	int64_t id = -1;
 	try {
@@ -791,8 +795,13 @@ Error RPCServer::sendResults(cproto::Context& ctx, QueryResults& qres, RPCQrId i
 			id.main = -1;
 			id.uid = RPCQrWatcher::kUninitialized;
 		}
-		std::string_view resSlice = rser.Slice();
-		ctx.Return({cproto::Arg(p_string(&resSlice)), cproto::Arg(int(id.main)), cproto::Arg(int64_t(id.uid))});
+		if (rser.HasAllocatedBuffer()) {
+			// Large results are moved into the connection's write buffer instead of copying
+			ctx.Return(rser.DetachChunk(), {cproto::Arg(int(id.main)), cproto::Arg(int64_t(id.uid))});
+		} else {
+			std::string_view resSlice = rser.Slice();
+			ctx.Return({cproto::Arg(p_string(&resSlice)), cproto::Arg(int(id.main)), cproto::Arg(int64_t(id.uid))});
+		}
 	} catch (Error& err) {
 		if (id.main >= 0) {
 			try {
@@ -1174,6 +1183,43 @@ Error RPCServer::ApplySnapshotChunk(cproto::Context& ctx, p_string ns, p_string
 	return getDB(ctx, kRoleDataWrite).ApplySnapshotChunk(ns, ch);
 }
 
+Error RPCServer::GetDataHashTree(cproto::Context& ctx, p_string ns, int64_t leavesCount, p_string nodesData) {
+	if (leavesCount < DataHashTree::kMinLeavesCount || leavesCount > DataHashTree::kMaxLeavesCount) {
+		return Error(errParams, "Unexpected leaves count of the data hash tree: {}", leavesCount);
+	}
+	const uint64_t nodesCount = 2 * uint64_t(leavesCount);
+	std::vector<uint32_t> nodes;
+	std::vector<uint64_t> hashes;
+	try {
+		Serializer ser(nodesData);
+		const auto count = ser.GetVarUInt();
+		if (count > nodesCount) {
+			return Error(errParams, "Too many data hash tree nodes in the request: {}", count);
+		}
+		nodes.resize(count);
+		for (auto& node : nodes) {
+			const auto id = ser.GetVarUInt();
+			if (id == 0 || id >= nodesCount) {
+				return Error(errParams, "Unexpected data hash tree node: {}. Tree has {} leaves", id, leavesCount);
+			}
+			node = uint32_t(id);
+		}
+	} catch (Error& err) {
+		return err;
+	}
+	auto err = getDB(ctx, kRoleDataRead).GetDataHashTreeNodes(ns, leavesCount, nodes, hashes);
+	if (err.ok()) {
+		WrSerializer ser;
+		ser.PutVarUint(hashes.size());
+		for (auto hash : hashes) {
+			ser.PutUInt64(hash);
+		}
+		auto slice = ser.Slice();
+		ctx.Return({cproto::Arg(p_string(&slice))});
+	}
+	return err;
+}
+
 Error RPCServer::GetMeta(cproto::Context& ctx, p_string ns, p_string key, std::optional<int> options) {
 	if (options && options.value() == 1) {
 		std::vector<ShardedMeta> data;
@@ -1357,6 +1403,7 @@ void RPCServer::Start(const std::string& addr, ev::dynamic_loop& loop, RPCSocket
 	dispatcher_.Register(cproto::kCmdDropIndex, this, &RPCServer::DropIndex);
 	dispatcher_.Register(cproto::kCmdSetSchema, this, &RPCServer::SetSchema);
 	dispatcher_.Register(cproto::kCmdGetSchema, this, &RPCServer::GetSchema);
+	dispatcher_.Register(cproto::kCmdSetCompressionDict, this, &RPCServer::SetCompressionDict);
 	dispatcher_.Register(cproto::kCmdStartTransaction, this, &RPCServer::StartTransaction);
 	dispatcher_.Register(cproto::kCmdAddTxItem, this, &RPCServer::AddTxItem);
 	dispatcher_.Register(cproto::kCmdDeleteQueryTx, this, &RPCServer::DeleteQueryTx);
@@ -1382,6 +1429,7 @@ void RPCServer::Start(const std::string& addr, ev::dynamic_loop& loop, RPCSocket
 	dispatcher_.Register(cproto::kCmdGetSnapshot, this, &RPCServer::GetSnapshot);
 	dispatcher_.Register(cproto::kCmdFetchSnapshot, this, &RPCServer::FetchSnapshot);
 	dispatcher_.Register(cproto::kCmdApplySnapshotCh, this, &RPCServer::ApplySnapshotChunk);
+	dispatcher_.Register(cproto::kCmdGetDataHashTree, this, &RPCServer::GetDataHashTree);
 	dispatcher_.Register(cproto::kCmdPutTxMeta, this, &RPCServer::PutMetaTx);
 	dispatcher_.Register(cproto::kCmdSetTagsMatcherTx, this, &RPCServer::SetTagsMatcherTx);
 	dispatcher_.Register(cproto::kCmdSuggestLeader, this, &RPCServer::SuggestLeader);
@@ -1403,10 +1451,12 @@ void RPCServer::Start(const std::string& addr, ev::dynamic_loop& loop, RPCSocket
 	auto factory = cproto::ServerConnection::NewFactory(dispatcher_, serverConfig_.EnableConnectionsStats);
 	auto sslCtx =
 		serverConfig_.RPCsAddr == addr ? openssl::create_server_context(serverConfig_.SslCertPath, serverConfig_.SslKeyPath) : nullptr;
+	const auto ioBackend =
+		(serverConfig_.RPCIOBackend == ServerConfig::kUringIOBackend) ? ev::loop_backend::uring : ev::loop_backend::native;
 	if (threadingMode == ServerConfig::kDedicatedThreading) {
-		listener_ = std::make_unique<ForkedListener>(loop, std::move(factory), std::move(sslCtx));
+		listener_ = std::make_unique<ForkedListener>(loop, std::move(factory), std::move(sslCtx), ioBackend);
 	} else {
-		listener_ = std::make_unique<Listener<ListenerType::Mixed>>(loop, std::move(factory), std::move(sslCtx));
+		listener_ = std::make_unique<Listener<ListenerType::Mixed>>(loop, std::move(factory), std::move(sslCtx), ioBackend);
 	}
 
 	assertrx(!qrWatcherThread_.joinable());
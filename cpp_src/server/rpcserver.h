@@ -86,6 +86,7 @@ public:
 
 	Error SetSchema(cproto::Context& ctx, p_string ns, p_string schema);
 	Error GetSchema(cproto::Context& ctx, p_string ns, int format);
+	Error SetCompressionDict(cproto::Context& ctx, p_string dict);
 
 	Error ModifyItem(cproto::Context& ctx, p_string nsName, int format, p_string itemData, int mode, p_string percepsPack, int stateToken,
 					 int txID);
@@ -114,6 +115,7 @@ public:
 	Error GetSnapshot(cproto::Context& ctx, p_string ns, p_string optsJson);
 	Error FetchSnapshot(cproto::Context& ctx, int id, int64_t offset);
 	Error ApplySnapshotChunk(cproto::Context& ctx, p_string ns, p_string rec);
+	Error GetDataHashTree(cproto::Context& ctx, p_string ns, int64_t leavesCount, p_string nodes);
 
 	Error ShardingControlRequest(cproto::Context& ctx, p_string data) noexcept;
 
@@ -196,6 +196,7 @@ void WALSelecter::operator()(LocalQueryResults& result, SelectCtx& params, bool
 	} else {
 		throw Error(errLogic, "Query to WAL should contain condition '#lsn > number' or '#lsn is not null'");
 	}
+	ns_->holdColdPayloads(result, 0, false);
 	if (params.floatVectorsHolder) {
 		const FieldsFilter fieldsFilter{q.SelectFilters(), *ns_};
 		params.floatVectorsHolder->Add(*ns_, result.begin(), result.end(), fieldsFilter);
@@ -84,6 +84,8 @@ type CacheMemStat struct {
 	EmptyCount int64 `json:"empty_count"`
 	// Number of hits of queries, to store results in cache
 	HitCountLimit int64 `json:"hit_count_limit"`
+	// Memory, saved by storing cached id sets in the compressed bitmap representation
+	CompressedSavings int64 `json:"compressed_savings"`
 }
 
 // Embedder status
@@ -139,6 +141,8 @@ type NamespaceMemStat struct {
 	ItemsCount int64 `json:"items_count,omitempty"`
 	// Count of emopy(unused) slots in namespace
 	EmptyItemsCount int64 `json:"empty_items_count"`
+	// Count of documents, whose payloads were evicted from RAM by 'payloads_memory_limit'
+	ColdItemsCount int64 `json:"cold_items_count,omitempty"`
 	// Size of strings deleted from namespace, but still used in queryResults
 	StringsWaitingToBeDeletedSize int64 `json:"strings_waiting_to_be_deleted_size"`
 	// Summary of total namespace memory consumption
@@ -221,6 +225,14 @@ type NamespaceMemStat struct {
 		TrackedUpdatesOverflow int64 `json:"tracked_updates_overflow"`
 		// Shows whether KNN/fulltext indexing structure is fully built. If this field is nil, index does not require any specific build steps
 		IsBuilt *bool `json:"is_built,omitempty"`
+		// Heap size of the fulltext index posting lists in bytes (fast fulltext indexes only)
+		FtPostingsSize *int64 `json:"ft_postings_size,omitempty"`
+		// Size of the same posting lists in the varint format. Allows to compare 'varint' and 'blocks' postings formats
+		FtPostingsVarintSize *int64 `json:"ft_postings_varint_size,omitempty"`
+		// Number of the fulltext index steps (segments), which have to be searched by the select (fast fulltext indexes only)
+		FtSegmentsCount *int64 `json:"ft_segments_count,omitempty"`
+		// Number of the removed documents, which are still referenced by the fulltext index steps (fast fulltext indexes only)
+		FtTombstonesCount *int64 `json:"ft_tombstones_count,omitempty"`
 		// Shows whether HNSW-index quantized. If this field is nil, index does not support quantization
 		IsQuantized *bool `json:"is_quantized,omitempty"`
 		// Upsert embedder status
@@ -314,6 +326,12 @@ type TxPerfStat struct {
 	MinCopyTimeUs int64 `json:"min_copy_time_us"`
 	// Minimum namespace copy time usec
 	MaxCopyTimeUs int64 `json:"max_copy_time_us"`
+	// Average memory size in bytes, allocated for namespace copy
+	AvgCopyMemory int64 `json:"avg_copy_memory"`
+	// Minimum memory size in bytes, allocated for namespace copy
+	MinCopyMemory int64 `json:"min_copy_memory"`
+	// Maximum memory size in bytes, allocated for namespace copy
+	MaxCopyMemory int64 `json:"max_copy_memory"`
 }
 
 // LRUCachePerfStat is information about LRU cache efficiency
@@ -324,6 +342,21 @@ type LRUCachePerfStat struct {
 	CacheHitRate float64 `json:"cache_hit_rate"`
 	// Determines if cache is currently in use. Usually it has 'false' value for uncommitted indexes
 	IsActive bool `json:"is_active"`
+	// Hits and misses by the cache regions. Reported for the caches with 'w_tinylfu' policy only
+	Regions *LRUCacheRegionsPerfStat `json:"regions,omitempty"`
+}
+
+type LRUCacheRegionPerfStat struct {
+	// Cache hits count in the region
+	Hits uint64 `json:"hits"`
+	// Cache misses count in the region
+	Misses uint64 `json:"misses"`
+}
+
+type LRUCacheRegionsPerfStat struct {
+	Window    LRUCacheRegionPerfStat `json:"window"`
+	Probation LRUCacheRegionPerfStat `json:"probation"`
+	Protected LRUCacheRegionPerfStat `json:"protected"`
 }
 
 type EmbedderPerfStat struct {
@@ -378,6 +411,40 @@ type EmbedderPerfStat struct {
 
 	// Cache statistics
 	CacheStat *EmbedderCachePerfStat `json:"cache,omitempty"`
+	// Batching statistics. Set, if batching is enabled in the embedder's config
+	BatchingStat *EmbedderBatchingPerfStat `json:"batching,omitempty"`
+}
+
+// EmbedderBatchingPerfStat is information about batching of the concurrent upsert embedding requests
+type EmbedderBatchingPerfStat struct {
+	// Total number of batched requests to the embedding service
+	TotalBatchesCount uint64 `json:"total_batches_count"`
+	// Total number of documents, sent in the batched requests
+	TotalBatchedDocumentsCount uint64 `json:"total_batched_documents_count"`
+	// Total number of identical documents, which were sent once in the batched requests
+	TotalDeduplicatedDocumentsCount uint64 `json:"total_deduplicated_documents_count"`
+	// Number of batched requests in the last second
+	LastSecBatches uint64 `json:"last_sec_batches"`
+	// Number of documents, sent in the batched requests in the last second
+	LastSecBatchedDps uint64 `json:"last_sec_batched_dps"`
+	// Average number of documents in the batch (over the last second)
+	LastSecAvgBatchSize uint64 `json:"last_sec_avg_batch_size"`
+	// Average latency of the batched request (over all time)
+	TotalAvgBatchLatencyUs uint64 `json:"total_avg_batch_latency_us"`
+	// Average latency of the batched request (over the last second)
+	LastSecAvgBatchLatencyUs uint64 `json:"last_sec_avg_batch_latency_us"`
+	// Histogram of the documents count in the batches
+	BatchSizeHistogram []HistogramBucket `json:"batch_size_histogram"`
+	// Histogram of the batched requests latencies (microseconds)
+	BatchLatencyHistogramUs []HistogramBucket `json:"batch_latency_histogram_us"`
+}
+
+// HistogramBucket is the bucket of the exponential histogram
+type HistogramBucket struct {
+	// Upper bound of the bucket (inclusive). Not set for the last bucket
+	UpperBound *uint64 `json:"le,omitempty"`
+	// Number of the values in the bucket
+	Count uint64 `json:"count"`
 }
 
 // EmbedderCachePerfStat is information about specific embedder performance statistics
@@ -403,6 +470,10 @@ type IndexPerfStat struct {
 	// Performance statistics for LRU IdSets index cache (or fulltext cache for text indexes).
 	// Nil-value means, that index does not use cache at all
 	Cache *LRUCachePerfStat `json:"cache,omitempty"`
+	// Performance statistics for the fulltext index full rebuilds on select (fast fulltext indexes only)
+	FtRebuilds *PerfStat `json:"ft_rebuilds,omitempty"`
+	// Performance statistics for the fulltext index background merges (fast fulltext indexes only)
+	FtMerges *PerfStat `json:"ft_merges,omitempty"`
 	// Performance statistics for upsert embedder
 	UpsertEmbedder EmbedderPerfStat `json:"upsert_embedder"`
 	// Performance statistics for query embedder
@@ -424,6 +495,8 @@ type NamespacePerfStat struct {
 	JoinCache LRUCachePerfStat `json:"join_cache"`
 	// Performance statistics for CountCached aggregation cache
 	QueryCountCache LRUCachePerfStat `json:"query_count_cache"`
+	// Performance statistics for the cold payloads cache
+	ColdPayloadsCache LRUCachePerfStat `json:"cold_payloads_cache"`
 	// Performance statistics for each namespace index
 	Indexes []IndexPerfStat `json:"indexes"`
 }
@@ -472,6 +545,10 @@ type ReplicationSyncStat struct {
 	AvgTimeUs int64 `json:"avg_time_us"`
 	// Max sync time
 	MaxTimeUs int64 `json:"max_time_us"`
+	// Total count of the snapshot records, sent by the syncs
+	Records int64 `json:"records"`
+	// Total size of the snapshot records, sent by the syncs
+	Bytes int64 `json:"bytes"`
 }
 
 // ReplicationStat replication statistic
@@ -482,6 +559,8 @@ type ReplicationStat struct {
 	WALSync ReplicationSyncStat `json:"wal_syncs"`
 	// Global force-syncs' stats
 	ForceSync ReplicationSyncStat `json:"force_syncs"`
+	// Global partial syncs' stats (force syncs of the diverged data hash tree buckets only)
+	PartialSync ReplicationSyncStat `json:"partial_syncs"`
 	// Leader's initial sync statistic (for "cluster" type only)
 	InitialSyncStat struct {
 		// WAL-syncs' stats
@@ -590,6 +669,11 @@ type NamespaceCacheConfig struct {
 	// This value may be automatically increased if cache is invalidation too fast
 	// Default value is 2. Min value is 0
 	IdxIdsetHitsToCache uint32 `json:"index_idset_hits_to_cache"`
+	// Number of the independent lock-striped shards in each index IdSets cache
+	// Keys are distributed between the shards by hash and 'index_idset_cache_size' is split equally between them
+	// So the single IdSet larger than 'index_idset_cache_size' / 'index_idset_cache_shards' is never cached. Set 1 for the indexes with the large IdSets
+	// Default value is 8. Min value is 1, max value is 256
+	IdxIdsetCacheShards uint32 `json:"index_idset_cache_shards,omitempty"`
 	// Max size of the fulltext indexes IdSets cache in bytes (per index)
 	// Each fulltext index has it's own independent cache
 	// This cache is used in any selections to store resulting sets of internal document IDs, FT ranks and highlighted areas (it does not stores documents' content itself)
@@ -620,6 +704,25 @@ type NamespaceCacheConfig struct {
 	// For example with value of 2: first request will be executed without caching, second request will generate cache entry and put results into the cache and third request will get cached results. This value may be automatically increased if cache is invalidation too fast
 	// Default value is 2. Min value is 0
 	QueryCountHitsToCache uint32 `json:"query_count_hit_to_cache"`
+	// Eviction policy of the index IdSets caches: 'lru' or 'w_tinylfu'
+	// 'w_tinylfu' admits new entries into the main region only if they are accessed more frequently than the eviction candidates
+	// Default value is 'lru'
+	IdxIdsetCachePolicy string `json:"index_idset_cache_policy,omitempty"`
+	// Eviction policy of the fulltext index IdSets caches: 'lru' or 'w_tinylfu'. Default value is 'lru'
+	FTIdxCachePolicy string `json:"ft_index_cache_policy,omitempty"`
+	// Eviction policy of the joins preselect cache: 'lru' or 'w_tinylfu'. Default value is 'lru'
+	JoinCachePolicy string `json:"joins_preselect_cache_policy,omitempty"`
+	// Eviction policy of the COUNT_CACHED() aggregation cache: 'lru' or 'w_tinylfu'. Default value is 'lru'
+	QueryCountCachePolicy string `json:"query_count_cache_policy,omitempty"`
+	// Max size of the cold payloads cache in bytes for each namespace
+	// This cache stores payloads, which were evicted from RAM by 'payloads_memory_limit' and were loaded from the storage by the selects
+	// Default value is 134217728 (128 MB). Min value is 0
+	ColdPayloadsCacheSize uint64 `json:"cold_payloads_cache_size,omitempty"`
+	// Default 'hits to cache' for cold payloads cache of the current namespace
+	// Default value is 1. Min value is 0
+	ColdPayloadsHitsToCache uint32 `json:"cold_payloads_hit_to_cache,omitempty"`
+	// Eviction policy of the cold payloads cache: 'lru' or 'w_tinylfu'. Default value is 'lru'
+	ColdPayloadsCachePolicy string `json:"cold_payloads_cache_policy,omitempty"`
 }
 
 // DBNamespacesConfig is part of reindexer configuration contains namespaces options
@@ -632,7 +735,10 @@ type DBNamespacesConfig struct {
 	JoinCacheMode string `json:"join_cache_mode"`
 	// Enable namespace copying for transaction with steps count greater than this value (if copy_politics_multiplier also allows this)
 	StartCopyPolicyTxSize int `json:"start_copy_policy_tx_size"`
-	// Disables copy policy if namespace size is greater than copy_policy_multiplier * start_copy_policy_tx_size
+	// Disables copy policy if namespace size is greater than copy_policy_multiplier * transaction's steps count. Larger value allows to commit
+	// the large transactions into the namespace copy, so the concurrent selects keep reading the previous namespace version instead of waiting
+	// for the commit (namespace memory consumption is doubled during such commits). Single item modifications and smaller transactions are
+	// always applied under the exclusive namespace lock
 	CopyPolicyMultiplier int `json:"copy_policy_multiplier"`
 	// Force namespace copying for transaction with steps count greater than this value
 	TxSizeToAlwaysCopy int `json:"tx_size_to_always_copy"`
@@ -663,6 +769,22 @@ type DBNamespacesConfig struct {
 	// 0 - disables background cache creation (cache will still be created on the database shutdown)
 	// Default value is 5000 ms
 	ANNStorageCacheBuildTimeoutMs int `json:"ann_storage_cache_build_timeout_ms"`
+	// Enables items image: namespace payloads are dumped into the binary image file on the database shutdown and restored on the next
+	// startup without CJSON decoding. Items, changed after the image creation, are still loaded from the storage
+	ItemsImage bool `json:"items_image"`
+	// Max threads count for the parallel evaluation of the full scan conditions. May be decreased by the query's Parallel() option
+	// Workers are borrowed from the shared pool of the idle threads
+	// 1 - disables parallel evaluation
+	// Default value is 1
+	MaxSelectParallelism int `json:"max_select_parallelism,omitempty"`
+	// Min items count in the namespace to evaluate full scan conditions in parallel
+	// Default value is 100000
+	MinParallelScanItems int64 `json:"min_parallel_scan_items,omitempty"`
+	// Max size of the resident documents' payloads (non-indexed CJSON) in bytes. When the limit is exceeded, payloads of the least recently
+	// used documents are evicted from RAM and loaded from the storage on demand. Indexed fields always stay in RAM
+	// Works for the namespaces with storage and primary key only. 0 - disables eviction
+	// Default value is 0
+	PayloadsMemoryLimit int64 `json:"payloads_memory_limit,omitempty"`
 	// Strict mode for queries. Adds additional check for fields('names')/indexes('indexes') existence in sorting and filtering conditions"
 	// Default value - 'names'
 	// Possible values: 'indexes','names','none'
@@ -699,6 +821,8 @@ type DBAsyncReplicationConfig struct {
 	ConcurrentSyncsPerThread int `json:"syncs_per_thread,omitempty"`
 	// Number of coroutines for online-updates batching (per each namespace of each node)
 	BatchingReoutines int `json:"batching_routines_count,omitempty"`
+	// Number of connections to each node, used to apply online updates of the different namespaces in parallel (1-32)
+	ApplyLanes int `json:"apply_lanes_count,omitempty"`
 	// Enable compression for replication network operations
 	EnableCompression bool `json:"enable_compression,omitempty"`
 	// Delay between write operation and replication. Larger values here will leader to higher replication latency and buffering,"
@@ -817,14 +941,16 @@ func DefaultDBNamespaceConfig(namespace string) *DBNamespacesConfig {
 	const kDefaultHitCountToCache = 2
 
 	cacheCfg := &NamespaceCacheConfig{
-		IdxIdsetCacheSize:     kDefaultCacheSizeLimit,
-		IdxIdsetHitsToCache:   kDefaultHitCountToCache,
-		FTIdxCacheSize:        kDefaultCacheSizeLimit,
-		FTIdxHitsToCache:      kDefaultHitCountToCache,
-		JoinCacheSize:         2 * kDefaultCacheSizeLimit,
-		JoinHitsToCache:       kDefaultHitCountToCache,
-		QueryCountCacheSize:   kDefaultCacheSizeLimit,
-		QueryCountHitsToCache: kDefaultHitCountToCache,
+		IdxIdsetCacheSize:       kDefaultCacheSizeLimit,
+		IdxIdsetHitsToCache:     kDefaultHitCountToCache,
+		FTIdxCacheSize:          kDefaultCacheSizeLimit,
+		FTIdxHitsToCache:        kDefaultHitCountToCache,
+		JoinCacheSize:           2 * kDefaultCacheSizeLimit,
+		JoinHitsToCache:         kDefaultHitCountToCache,
+		QueryCountCacheSize:     kDefaultCacheSizeLimit,
+		QueryCountHitsToCache:   kDefaultHitCountToCache,
+		ColdPayloadsCacheSize:   kDefaultCacheSizeLimit,
+		ColdPayloadsHitsToCache: 1,
 	}
 
 	return &DBNamespacesConfig{
@@ -42,14 +42,17 @@ Strict mode is disabled by default.
 */
 
 const (
-	AggSum         = "sum"
-	AggAvg         = "avg"
-	AggMin         = "min"
-	AggMax         = "max"
-	AggCount       = "count"
-	AggCountCached = "count_cached"
-	AggFacet       = "facet"
-	AggDistinct    = "distinct"
+	AggSum                 = "sum"
+	AggAvg                 = "avg"
+	AggMin                 = "min"
+	AggMax                 = "max"
+	AggCount               = "count"
+	AggCountCached         = "count_cached"
+	AggFacet               = "facet"
+	AggDistinct            = "distinct"
+	AggApproxCountDistinct = "approx_count_distinct"
+	AggPercentile          = "percentile"
+	AggTopKApprox          = "top_k_approx"
 )
 
 var dslStrictMode = int32(0)
@@ -73,6 +76,8 @@ type Aggregation struct {
 	Limit   int      `json:"limit,omitempty"`
 	Offset  int      `json:"offset,omitempty"`
 	Fields  []string `json:"fields"`
+	// Percentile ranks in the range [0, 100]. Used by 'percentile' aggregation only
+	Percentiles []float64 `json:"percentiles,omitempty"`
 }
 
 type EqualPosition struct {
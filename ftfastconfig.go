@@ -208,8 +208,20 @@ type FtFastConfig struct {
 	// 'memory': compressed vector of document identifiers
 	// 'cpu':  uncompressed vector of document identifiers
 	Optimization string `json:"optimization,omitempty"`
+	// Format of the compressed posting lists ('memory' optimization only). Default 'varint'.
+	// 'varint': byte-wise varints, decoded one value at a time
+	// 'blocks': blocks of 128 documents, decoded by SIMD and skipped by the first/last ids of the blocks
+	PostingsFormat string `json:"postings_format,omitempty"`
 	// If true, then non-fulltext filtering conditions will be executed before fulltext index selection
 	EnablePreselectBeforeFt bool `json:"enable_preselect_before_ft"`
+	// If true, then the documents with the highest ranks are selected, when the number of the matched documents exceeds MergeLimit.
+	// Requires per-block rank bounds of the posting lists, which are built on the index commit
+	EnableBlockMaxPruning bool `json:"enable_block_max_pruning"`
+	// If true, then the commit steps are merged and the removed documents are purged by the background index optimization.
+	// Selects use the previous state of the index until the merge is done instead of the full rebuild
+	EnableBackgroundMerge bool `json:"enable_background_merge"`
+	// Max threads count for the lookup of the query terms and their variants (typos, stemming, translit, synonyms). 0 or 1 - lookup in the query's thread
+	MaxSelectParallelism int `json:"max_select_parallelism"`
 	// Config for subterm rank multiplier
 	FtBaseRankingConfig *FtBaseRanking `json:"base_ranking,omitempty"`
 	// Config for document ranking
@@ -255,7 +267,11 @@ func DefaultFtFastConfig() FtFastConfig {
 		MaxAreasInDoc:           5,
 		MaxTotalAreasToCache:    -1,
 		Optimization:            "Memory",
+		PostingsFormat:          "varint",
 		EnablePreselectBeforeFt: false,
+		EnableBlockMaxPruning:   false,
+		EnableBackgroundMerge:   false,
+		MaxSelectParallelism:    1,
 		FtBaseRankingConfig:     &FtBaseRanking{FullMatch: 100, ConcatProc: 90, SplitProc: 90, PrefixMin: 50, SuffixMin: 10, Typo: 85, TypoPenalty: 15, StemmerPenalty: 15, Kblayout: 90, Translit: 90, Synonyms: 95, Delimited: 80},
 		Bm25Config:              &Bm25ConfigType{Bm25k1: 2.0, Bm25b: 0.75, Bm25Type: "rx_bm25"},
 	}
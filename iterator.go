@@ -32,6 +32,8 @@ type ExplainSelector struct {
 	// Count of scanned documents by this selector
 	Items     int    `json:"items"`
 	Condition string `json:"condition"`
+	// Count of the other idset selectors, which were intersected with this selector before the select loop
+	IntersectedWith int `json:"intersected_with,omitempty"`
 	// Select iterator type
 	Type        string `json:"type,omitempty"`
 	Description string `json:"description,omitempty"`
@@ -46,6 +46,7 @@ const (
 	queryEnd                       = bindings.QueryEnd
 	queryAggregationLimit          = bindings.QueryAggregationLimit
 	queryAggregationOffset         = bindings.QueryAggregationOffset
+	queryAggregationPercentile     = bindings.QueryAggregationPercentile
 	queryAggregationSort           = bindings.QueryAggregationSort
 	queryOpenBracket               = bindings.QueryOpenBracket
 	queryCloseBracket              = bindings.QueryCloseBracket
@@ -65,6 +66,7 @@ const (
 	queryFunction                  = bindings.QueryFunction
 	queryFunctionSubQueryCondition = bindings.QueryFunctionSubQueryCondition
 	queryExpressions               = bindings.QueryExpressions
+	queryParallelism               = bindings.QueryParallelism
 )
 
 // Constants for KNN query types
@@ -814,6 +816,29 @@ func (q *Query) AggregateAvg(field string) *Query { return q.setAggregate(field,
 func (q *Query) AggregateMin(field string) *Query { return q.setAggregate(field, AggMin) }
 func (q *Query) AggregateMax(field string) *Query { return q.setAggregate(field, AggMax) }
 
+// AggregateApproxCountDistinct - estimate the number of the distinct values of the field with HyperLogLog sketch
+func (q *Query) AggregateApproxCountDistinct(field string) *Query {
+	return q.setAggregate(field, AggApproxCountDistinct)
+}
+
+// AggregatePercentile - estimate the percentiles of the field values with t-digest sketch.
+// Ranks should be in the range [0, 100]. The result's Value is set for the first rank
+func (q *Query) AggregatePercentile(field string, ranks ...float64) *Query {
+	q.setAggregate(field, AggPercentile)
+	for _, r := range ranks {
+		q.ser.PutVarCUInt(queryAggregationPercentile).PutDouble(r)
+	}
+	return q
+}
+
+// AggregateTopKApprox - estimate the k most frequent values of the field with Space-Saving sketch.
+// The results are returned as facets
+func (q *Query) AggregateTopKApprox(field string, k int) *Query {
+	q.setAggregate(field, AggTopKApprox)
+	q.ser.PutVarCUInt(queryAggregationLimit).PutVarCUInt(k)
+	return q
+}
+
 type AggregateFacetRequest struct {
 	query *Query
 }
@@ -969,6 +994,10 @@ func (q *Query) Debug(level int) *Query { return q.setValue(queryDebugLevel, lev
 // Strict - Set query strict mode
 func (q *Query) Strict(mode QueryStrictMode) *Query { return q.setValue(queryStrictMode, int(mode)) }
 
+// Parallel - Set max threads count for the full scan evaluation. Actual count is also limited by the namespace config.
+// 0 - use namespace config, 1 - disable parallel evaluation
+func (q *Query) Parallel(threads int) *Query { return q.setValue(queryParallelism, threads) }
+
 // Explain - Request explain for query
 func (q *Query) Explain() *Query {
 	q.ser.PutVarCUInt(queryExplain)
@@ -322,13 +322,18 @@ func parseIndexesImpl(indexDefs *[]bindings.IndexDef, st reflect.Type, subArray
 				return err
 			}
 			if quantizationType, ok := namedOpts["quantization"]; ok {
-				if quantizationType != "sq8" {
+				switch quantizationType {
+				case "sq8":
+					fvOpts.QuantizationConfig = &bindings.QuantizationConfig{
+						Type: "scalar_quantization_8_bit",
+					}
+				case "pq":
+					fvOpts.QuantizationConfig = &bindings.QuantizationConfig{
+						Type: "product_quantization",
+					}
+				default:
 					return fmt.Errorf("Unsupported quantization type - %s", quantizationType)
 				}
-
-				fvOpts.QuantizationConfig = &bindings.QuantizationConfig{
-					Type: "scalar_quantization_8_bit",
-				}
 			}
 
 			indexDef := makeIndexDef(reindexPath, []string{jsonPath}, idxType, "float_vector", opts, CollateNone, "", 0, &fvOpts)
@@ -53,14 +53,17 @@ const (
 
 // Aggregation funcs
 const (
-	AggAvg         = bindings.AggAvg
-	AggSum         = bindings.AggSum
-	AggFacet       = bindings.AggFacet
-	AggMin         = bindings.AggMin
-	AggMax         = bindings.AggMax
-	AggDistinct    = bindings.AggDistinct
-	AggCount       = bindings.AggCount
-	AggCountCached = bindings.AggCountCached
+	AggAvg                 = bindings.AggAvg
+	AggSum                 = bindings.AggSum
+	AggFacet               = bindings.AggFacet
+	AggMin                 = bindings.AggMin
+	AggMax                 = bindings.AggMax
+	AggDistinct            = bindings.AggDistinct
+	AggCount               = bindings.AggCount
+	AggCountCached         = bindings.AggCountCached
+	AggApproxCountDistinct = bindings.AggApproxCountDistinct
+	AggPercentile          = bindings.AggPercentile
+	AggTopKApprox          = bindings.AggTopKApprox
 )
 
 // Reindexer error codes
@@ -158,20 +161,27 @@ type Facet struct {
 	Count  int      `json:"count"`
 }
 
+type Percentile struct {
+	Rank  float64 `json:"rank"`
+	Value float64 `json:"value"`
+}
+
 type aggregationResultSer struct {
-	Fields    []string `json:"fields"`
-	Type      string   `json:"type"`
-	Value     *float64 `json:"value,omitempty"`
-	Facets    []Facet  `json:"facets,omitempty"`
-	Distincts []any    `json:"distincts,omitempty"`
+	Fields      []string     `json:"fields"`
+	Type        string       `json:"type"`
+	Value       *float64     `json:"value,omitempty"`
+	Facets      []Facet      `json:"facets,omitempty"`
+	Distincts   []any        `json:"distincts,omitempty"`
+	Percentiles []Percentile `json:"percentiles,omitempty"`
 }
 
 type AggregationResult struct {
-	Fields    []string
-	Type      string
-	Value     *float64
-	Facets    []Facet
-	Distincts [][]string
+	Fields      []string
+	Type        string
+	Value       *float64
+	Facets      []Facet
+	Distincts   [][]string
+	Percentiles []Percentile
 }
 
 func (v *AggregationResult) UnmarshalJSON(bytes []byte) error {
@@ -184,6 +194,7 @@ func (v *AggregationResult) UnmarshalJSON(bytes []byte) error {
 	v.Type = resSer.Type
 	v.Value = resSer.Value
 	v.Facets = resSer.Facets
+	v.Percentiles = resSer.Percentiles
 
 	if len(resSer.Distincts) == 0 {
 		return nil
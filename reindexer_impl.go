@@ -1323,6 +1323,16 @@ func (db *reindexerImpl) addAggregationsDSL(q *Query, aggs []dsl.Aggregation) er
 			q.AggregateMax(agg.Fields[0])
 		case dsl.AggDistinct:
 			q.Distinct(agg.Fields...)
+		case dsl.AggApproxCountDistinct:
+			q.AggregateApproxCountDistinct(agg.Fields[0])
+		case dsl.AggPercentile:
+			q.AggregatePercentile(agg.Fields[0], agg.Percentiles...)
+		case dsl.AggTopKApprox:
+			if agg.Limit > 0 {
+				q.AggregateTopKApprox(agg.Fields[0], agg.Limit)
+			} else {
+				q.setAggregate(agg.Fields[0], AggTopKApprox)
+			}
 		case dsl.AggCount:
 			if len(agg.Fields) == 1 && (agg.Fields[0] == "" || agg.Fields[0] == "*") {
 				q.ReqTotal()